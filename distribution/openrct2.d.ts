@@ -284,6 +284,19 @@ declare global {
          */
         getIcon(iconName: IconName): number;
 
+        /**
+         * Starts a worker which runs the given script on a separate thread, so that heavy
+         * work such as statistics or analytics does not take up any tick time.
+         * The worker has no access to the game or any of the plugin APIs. It can only use
+         * onMessage, postMessage and console.log to exchange messages with the plugin, which
+         * must send it any game data it needs, e.g. from an interval.tick subscription.
+         * Messages are copied between the plugin and the worker. Typed arrays are received as
+         * Uint8Array views of the same bytes.
+         * The worker is terminated when the plugin is stopped.
+         * @param source The script to run on the worker.
+         */
+        createWorker(source: string): Worker;
+
         /**
          * Gets a random integer within the specified range using the game's pseudo-
          * random number generator. This is part of the game state and shared across
@@ -1475,6 +1488,13 @@ declare global {
         getAllEntitiesOnTile(type: "staff", tilePos: CoordsXY): Staff[];
         getAllEntitiesOnTile(type: "car", tilePos: CoordsXY): Car[];
         getAllEntitiesOnTile(type: "litter", tilePos: CoordsXY): Litter[];
+
+        /**
+         * Gets fields of all the entities of a type that match the query, without creating an object for each
+         * entity. Each requested field is returned as an Int32Array, with one element per matching entity.
+         * @param query The entity type, the fields to return and the filters to apply.
+         */
+        queryEntities<TField extends EntityQueryField>(query: EntityQuery<TField>): EntityQueryResult<TField>;
         createEntity(type: EntityType, initializer: object): Entity;
 
         /**
@@ -1486,6 +1506,55 @@ declare global {
         getTrackIterator(location: CoordsXY, elementIndex: number): TrackIterator | null;
     }
 
+    /**
+     * The fields that can be queried using {@link GameMap.queryEntities}. All entities have the id and
+     * position fields. Guests and staff (and peeps) have the energy fields, guests also have the other
+     * fields of {@link Guest} and cars the fields of {@link Car}, as listed.
+     */
+    type EntityQueryField =
+        "id" | "x" | "y" | "z" |
+        "energy" | "energyTarget" |
+        "happiness" | "happinessTarget" | "nausea" | "nauseaTarget" | "hunger" | "thirst" | "toilet" | "mass" |
+        "minIntensity" | "maxIntensity" | "nauseaTolerance" | "cash" | "lostCountdown" |
+        "ride" | "acceleration" | "velocity" | "trackProgress";
+
+    type PeepState =
+        "falling" | "one" | "queuing_front" | "on_ride" | "leaving_ride" | "walking" | "queuing" | "entering_ride" |
+        "sitting" | "picked" | "patrolling" | "mowing" | "sweeping" | "entering_park" | "leaving_park" | "answering" |
+        "fixing" | "buying" | "watching" | "emptying_bin" | "using_bin" | "watering" | "heading_to_inspection" |
+        "inspecting";
+
+    interface EntityQuery<TField extends EntityQueryField> {
+        /**
+         * The type of entity to query, one of the types supported by {@link GameMap.getAllEntities}.
+         */
+        type: "balloon" | "car" | "crashed_vehicle_particle" | "duck" | "guest" | "litter" | "peep" | "staff";
+
+        /**
+         * The fields to return for each matching entity.
+         */
+        fields: TField[];
+
+        /**
+         * If set, only entities within this range of map coordinates (inclusive) match.
+         */
+        range?: MapRange;
+
+        /**
+         * If set, only peeps in this state, or cars with this status, match.
+         */
+        state?: PeepState | VehicleStatus;
+    }
+
+    type EntityQueryResult<TField extends EntityQueryField> = {
+        /**
+         * The number of matching entities.
+         */
+        count: number;
+    } & {
+        [K in TField]: Int32Array;
+    };
+
     type TileElementType =
         "surface" | "footpath" | "track" | "small_scenery" | "wall" | "entrance" | "large_scenery" | "banner";
 
@@ -4845,6 +4914,33 @@ declare global {
         off(event: "connection", callback: (socket: Socket) => void): Listener;
     }
 
+    /**
+     * A script running on a separate thread, created using context.createWorker.
+     */
+    interface Worker {
+        /**
+         * The number of messages posted to the worker that it has not started processing.
+         * Can be used to avoid sending more data while the worker is still busy.
+         */
+        readonly pendingMessages: number;
+
+        /**
+         * Sends a copy of the given value to the worker's onMessage callback.
+         */
+        postMessage(data: any): void;
+
+        /**
+         * Sets the callback for values the worker sends with postMessage. The callback is
+         * called on the game thread in between ticks.
+         */
+        onMessage(callback: (data: any) => void): void;
+
+        /**
+         * Stops the worker, interrupting its script if it is running.
+         */
+        terminate(): void;
+    }
+
     /**
      * Represents a socket such as a TCP connection.
      * Based on node.js net.Socket, see https://nodejs.org/api/net.html for more information.
@@ -5183,6 +5279,17 @@ declare global {
         stop(): void;
         reset(): void;
         readonly enabled: boolean;
+
+        /**
+         * Gets the time each plugin has spent in each of its hooks since the plugins were loaded or
+         * the hook data was last reset. Unlike getData, this is always recorded.
+         */
+        getHookData(): ProfiledHook[];
+
+        /**
+         * Resets the time recorded for hooks.
+         */
+        resetHookData(): void;
     }
 
     interface ProfiledFunction {
@@ -5195,6 +5302,21 @@ declare global {
         readonly children: number[];
     }
 
+    interface ProfiledHook {
+        readonly plugin: string;
+        readonly hook: HookType;
+        readonly callCount: number;
+        /**
+         * The number of interval.tick calls that were skipped because the plugin
+         * went over the tick_hook_time_budget set in the plugin section of config.ini.
+         * Hooks are only throttled in single player games that are not being recorded
+         * or played back as a replay.
+         */
+        readonly throttledCount: number;
+        readonly maxTime: number;
+        readonly totalTime: number;
+    }
+
     interface ObjectManager {
         /**
          * Gets all the objects that are installed and can be loaded into the park.
@@ -705,6 +705,7 @@ namespace OpenRCT2::Ui::Windows
                     if (_loadedObject != nullptr)
                     {
                         _loadedObject->Load();
+                        _loadedObject->PostLoad();
                     }
                 }
 
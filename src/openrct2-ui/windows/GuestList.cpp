@@ -27,6 +27,7 @@
 #include <openrct2/util/Math.hpp>
 #include <openrct2/util/Util.h>
 #include <openrct2/world/Park.h>
+#include <unordered_map>
 #include <vector>
 
 namespace OpenRCT2::Ui::Windows
@@ -114,6 +115,20 @@ static Widget window_guest_list_widgets[] = {
             }
         };
 
+        struct FilterArgumentsHash
+        {
+            size_t operator()(const FilterArguments& value) const
+            {
+                uint32_t res = 0x811c9dc5;
+                for (auto b : value.args)
+                {
+                    res ^= b;
+                    res *= 0x01000193;
+                }
+                return res;
+            }
+        };
+
         struct GuestGroup
         {
             size_t NumGuests{};
@@ -126,7 +141,27 @@ static Widget window_guest_list_widgets[] = {
             using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
 
             EntityId Id;
-            char Name[256];
+            uint32_t PeepId;
+            bool HasCustomName;
+            const char* Name;
+        };
+
+        /**
+         * The formatted name of a guest, kept between refreshes so that only renamed or new guests have their name
+         * formatted again, indexed by entity id.
+         */
+        struct GuestNameEntry
+        {
+            bool Valid{};
+            uint32_t PeepId{};
+            bool RealNames{};
+            bool HasCustomName{};
+            std::string CustomName;
+            std::string Name;
+
+            // Whether the guest is in _guestList with this name, so that it can keep its place when re-sorting.
+            bool InList{};
+            uint32_t ListedStamp{};
         };
 
         static constexpr uint8_t SUMMARISED_GUEST_ROW_HEIGHT = kScrollableRowHeight + 11;
@@ -148,8 +183,14 @@ static Widget window_guest_list_widgets[] = {
         uint32_t _lastFindGroupsTick{};
         uint32_t _lastFindGroupsWait{};
         std::vector<GuestGroup> _groups;
+        std::unordered_map<FilterArguments, size_t, FilterArgumentsHash> _groupIndices;
 
         std::vector<GuestItem> _guestList;
+        std::vector<GuestItem> _newGuestItems;
+        std::vector<GuestNameEntry> _guestNames;
+        GuestItem::CompareFunc _guestListCompareFunc{};
+        uint32_t _refreshStamp{};
+        bool _refreshPending{};
         std::optional<size_t> _highlightedIndex;
 
         uint32_t _tabAnimationIndex{};
@@ -264,6 +305,11 @@ static Widget window_guest_list_widgets[] = {
 
         void OnUpdate() override
         {
+            if (_refreshPending)
+            {
+                RefreshList();
+            }
+
             if (_lastFindGroupsWait != 0)
             {
                 _lastFindGroupsWait--;
@@ -409,8 +455,21 @@ static Widget window_guest_list_widgets[] = {
             }
         }
 
+        void OnLanguageChange() override
+        {
+            // Generated names are localised
+            _guestNames.clear();
+            _guestList.clear();
+            RefreshList();
+        }
+
         void OnPrepareDraw() override
         {
+            if (_refreshPending)
+            {
+                RefreshList();
+            }
+
             SetWidgetPressed(WIDX_TAB_1, false);
             SetWidgetPressed(WIDX_TAB_2, false);
             SetWidgetPressed(WIDX_TAB_1 + static_cast<int32_t>(_selectedTab), true);
@@ -554,20 +613,15 @@ static Widget window_guest_list_widgets[] = {
             {
                 case TabId::Individual:
                 {
-                    auto i = screenCoords.y / kScrollableRowHeight;
-                    i += static_cast<int32_t>(_selectedPage * GUESTS_PER_PAGE);
-                    for (const auto& guestItem : _guestList)
+                    auto i = static_cast<size_t>(screenCoords.y / kScrollableRowHeight);
+                    i += _selectedPage * GUESTS_PER_PAGE;
+                    if (i < _guestList.size())
                     {
-                        if (i == 0)
+                        auto guest = GetEntity<Guest>(_guestList[i].Id);
+                        if (guest != nullptr)
                         {
-                            auto guest = GetEntity<Guest>(guestItem.Id);
-                            if (guest != nullptr)
-                            {
-                                GuestOpen(guest);
-                            }
-                            break;
+                            GuestOpen(guest);
                         }
-                        i--;
                     }
                     break;
                 }
@@ -607,41 +661,91 @@ static Widget window_guest_list_widgets[] = {
             }
         }
 
+        /**
+         * Requests the list to be refreshed before the window is next updated or drawn, so that guests entering, leaving
+         * or being renamed many times in one tick only cause a single refresh.
+         */
+        void RequestRefresh()
+        {
+            _refreshPending = true;
+        }
+
         void RefreshList()
         {
+            _refreshPending = false;
+
             // Only the individual tab uses the GuestList so no point calculating it
             if (_selectedTab != TabId::Individual)
             {
                 RefreshGroups();
+                return;
             }
-            else
+
+            const auto compareFunc = GetGuestCompareFunc();
+            if (compareFunc != _guestListCompareFunc)
             {
+                for (const auto& item : _guestList)
+                {
+                    _guestNames[item.Id.ToUnderlying()].InList = false;
+                }
                 _guestList.clear();
+                _guestListCompareFunc = compareFunc;
+            }
 
-                for (auto peep : EntityList<Guest>())
+            const bool realNames = GetGameState().Park.Flags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES;
+            _refreshStamp++;
+            _newGuestItems.clear();
+            for (auto peep : EntityList<Guest>())
+            {
+                EntitySetFlashing(peep, false);
+                if (peep->OutsideOfPark)
+                    continue;
+                if (_selectedFilter)
                 {
-                    EntitySetFlashing(peep, false);
-                    if (peep->OutsideOfPark)
-                        continue;
-                    if (_selectedFilter)
-                    {
-                        if (!IsPeepInFilter(*peep))
-                            continue;
-                        EntitySetFlashing(peep, true);
-                    }
-                    if (!GuestShouldBeVisible(*peep))
+                    if (!IsPeepInFilter(*peep))
                         continue;
+                    EntitySetFlashing(peep, true);
+                }
 
-                    auto& item = _guestList.emplace_back();
-                    item.Id = peep->Id;
+                bool renamed = UpdateGuestName(*peep, realNames);
+                auto& entry = _guestNames[peep->Id.ToUnderlying()];
+                if (!GuestShouldBeVisible(*peep, entry.Name))
+                    continue;
 
-                    Formatter ft;
-                    peep->FormatNameTo(ft);
-                    OpenRCT2::FormatStringLegacy(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+                entry.ListedStamp = _refreshStamp;
+                if (renamed || !entry.InList)
+                {
+                    entry.InList = false;
+                    _newGuestItems.push_back({ peep->Id, peep->PeepId, entry.HasCustomName, nullptr });
+                }
+            }
+
+            // Guests that are still listed under the same name keep their (sorted) place
+            auto kept = std::remove_if(_guestList.begin(), _guestList.end(), [this](GuestItem& item) {
+                auto& entry = _guestNames[item.Id.ToUnderlying()];
+                if (entry.PeepId != item.PeepId)
+                    return true;
+                if (!entry.InList || entry.ListedStamp != _refreshStamp)
+                {
+                    entry.InList = false;
+                    return true;
                 }
+                item.Name = entry.Name.c_str();
+                return false;
+            });
+            _guestList.erase(kept, _guestList.end());
 
-                std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+            // Everyone else is sorted on their own and merged in
+            for (auto& item : _newGuestItems)
+            {
+                auto& entry = _guestNames[item.Id.ToUnderlying()];
+                entry.InList = true;
+                item.Name = entry.Name.c_str();
             }
+            std::sort(_newGuestItems.begin(), _newGuestItems.end(), compareFunc);
+            auto numKept = _guestList.size();
+            _guestList.insert(_guestList.end(), _newGuestItems.begin(), _newGuestItems.end());
+            std::inplace_merge(_guestList.begin(), _guestList.begin() + numKept, _guestList.end(), compareFunc);
         }
 
     private:
@@ -780,18 +884,45 @@ static Widget window_guest_list_widgets[] = {
             }
         }
 
-        bool GuestShouldBeVisible(const Guest& peep)
+        /**
+         * Formats the name of the guest into its cache entry if the cached name is missing or no longer correct.
+         * @returns true if the name had to be formatted.
+         */
+        bool UpdateGuestName(const Guest& peep, bool realNames)
+        {
+            const auto index = peep.Id.ToUnderlying();
+            if (index >= _guestNames.size())
+            {
+                _guestNames.resize(index + 1);
+            }
+
+            auto& entry = _guestNames[index];
+            const bool hasCustomName = peep.Name != nullptr;
+            if (entry.Valid && entry.PeepId == peep.PeepId && entry.HasCustomName == hasCustomName)
+            {
+                if (hasCustomName ? entry.CustomName == peep.Name : entry.RealNames == realNames)
+                    return false;
+            }
+
+            entry.Valid = true;
+            entry.PeepId = peep.PeepId;
+            entry.RealNames = realNames;
+            entry.HasCustomName = hasCustomName;
+            entry.CustomName = hasCustomName ? peep.Name : "";
+
+            Formatter ft;
+            peep.FormatNameTo(ft);
+            entry.Name = FormatStringIDLegacy(STR_STRINGID, ft.Data());
+            return true;
+        }
+
+        bool GuestShouldBeVisible(const Guest& peep, const std::string& name)
         {
             if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
                 return false;
 
             if (!_filterName.empty())
             {
-                char name[256]{};
-
-                Formatter ft;
-                peep.FormatNameTo(ft);
-                OpenRCT2::FormatStringLegacy(name, sizeof(name), STR_STRINGID, ft.Data());
                 if (!String::Contains(name, _filterName.c_str(), true))
                 {
                     return false;
@@ -828,12 +959,10 @@ static Widget window_guest_list_widgets[] = {
 
         GuestGroup& FindOrAddGroup(FilterArguments&& arguments)
         {
-            auto foundGroup = std::find_if(std::begin(_groups), std::end(_groups), [&arguments](GuestGroup& group) {
-                return group.Arguments == arguments;
-            });
-            if (foundGroup != std::end(_groups))
+            auto [it, inserted] = _groupIndices.try_emplace(arguments, _groups.size());
+            if (!inserted)
             {
-                return *foundGroup;
+                return _groups[it->second];
             }
             auto& newGroup = _groups.emplace_back();
             newGroup.Arguments = arguments;
@@ -846,6 +975,7 @@ static Widget window_guest_list_widgets[] = {
             _lastFindGroupsSelectedView = _selectedView;
             _lastFindGroupsWait = 320;
             _groups.clear();
+            _groupIndices.clear();
 
             for (auto peep : EntityList<Guest>())
             {
@@ -934,24 +1064,13 @@ static Widget window_guest_list_widgets[] = {
 
         template<bool TRealNames> static bool CompareGuestItem(const GuestItem& a, const GuestItem& b)
         {
-            const auto* peepA = GetEntity<Peep>(a.Id);
-            const auto* peepB = GetEntity<Peep>(b.Id);
-            if (peepA != nullptr && peepB != nullptr)
+            // Compare name
+            if constexpr (!TRealNames)
             {
-                // Compare types
-                if (peepA->Type != peepB->Type)
+                if (!a.HasCustomName && !b.HasCustomName)
                 {
-                    return static_cast<int32_t>(peepA->Type) < static_cast<int32_t>(peepB->Type);
-                }
-
-                // Compare name
-                if constexpr (!TRealNames)
-                {
-                    if (peepA->Name == nullptr && peepB->Name == nullptr)
-                    {
-                        // Simple ID comparison for when both peeps use a number or a generated name
-                        return peepA->PeepId < peepB->PeepId;
-                    }
+                    // Simple ID comparison for when both peeps use a number or a generated name
+                    return a.PeepId < b.PeepId;
                 }
             }
             return StrLogicalCmp(a.Name, b.Name) < 0;
@@ -992,7 +1111,7 @@ static Widget window_guest_list_widgets[] = {
         auto* w = WindowFindByClass(WindowClass::GuestList);
         if (w != nullptr)
         {
-            static_cast<GuestListWindow*>(w)->RefreshList();
+            static_cast<GuestListWindow*>(w)->RequestRefresh();
         }
     }
 } // namespace OpenRCT2::Ui::Windows
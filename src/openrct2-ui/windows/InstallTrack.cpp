@@ -23,6 +23,7 @@
 #include <openrct2/ride/RideConstruction.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/ride/TrackDesign.h>
+#include <openrct2/ride/TrackDesignPreviewCache.h>
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/sprites.h>
 #include <openrct2/util/Util.h>
@@ -362,7 +363,7 @@ static Widget window_install_track_widgets[] = {
     private:
         void UpdatePreview()
         {
-            TrackDesignDrawPreview(*_trackDesign, _trackDesignPreviewPixels.data());
+            TrackDesignDrawPreviewCached(_trackPath, *_trackDesign, _trackDesignPreviewPixels.data());
         }
 
         void InstallTrackDesign()
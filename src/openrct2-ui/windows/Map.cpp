@@ -200,10 +200,12 @@ static Widget window_map_widgets[] = {
     class MapWindow final : public Window
     {
         uint8_t _rotation;
-        uint32_t _currentLine;
         uint16_t _landRightsToolSize;
         int32_t _firstColumnWidth;
         std::vector<uint8_t> _mapImageData;
+        // Colour of each tile for the selected tab, unrotated, so that only changed tiles need to be recoloured.
+        std::vector<uint16_t> _tileColours;
+        std::vector<TileCoordsXY> _dirtyTiles;
         bool _mapWidthAndHeightLinked{ true };
         bool _recalculateScrollbars = false;
         enum class ResizeDirection
@@ -250,6 +252,8 @@ static Widget window_map_widgets[] = {
         {
             _mapImageData.clear();
             _mapImageData.shrink_to_fit();
+            _tileColours.clear();
+            _tileColours.shrink_to_fit();
 
             if (isToolActive(classification, number))
             {
@@ -309,6 +313,7 @@ static Widget window_map_widgets[] = {
                         list_information_type = 0;
                         _recalculateScrollbars = true;
                         ResetMaxWindowDimensions();
+                        RefreshMap();
                     }
             }
         }
@@ -357,12 +362,11 @@ static Widget window_map_widgets[] = {
             if (GetCurrentRotation() != _rotation)
             {
                 _rotation = GetCurrentRotation();
-                InitMap();
+                DrawMapImage();
                 CentreMapOnViewPoint();
             }
 
-            for (int32_t i = 0; i < 16; i++)
-                SetMapPixels();
+            UpdateDirtyTiles();
 
             Invalidate();
 
@@ -688,8 +692,24 @@ static Widget window_map_widgets[] = {
         void InitMap()
         {
             _mapImageData.resize(getMiniMapWidth() * getMiniMapWidth());
-            std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
-            _currentLine = 0;
+            _tileColours.resize(getTechnicalMapSize() * getTechnicalMapSize());
+
+            // Everything is about to be coloured, so earlier changes no longer matter
+            MapTakeDirtyTiles(_dirtyTiles);
+            RefreshMap();
+        }
+
+        void RefreshMap()
+        {
+            const auto mapSize = getTechnicalMapSize();
+            for (int32_t y = 0; y < mapSize; y++)
+            {
+                for (int32_t x = 0; x < mapSize; x++)
+                {
+                    _tileColours[(y * mapSize) + x] = GetTileColour({ x, y });
+                }
+            }
+            DrawMapImage();
         }
 
         void CentreMapOnViewPoint()
@@ -760,68 +780,101 @@ static Widget window_map_widgets[] = {
             GameActions::Execute(&decreaseMapSizeAction);
         }
 
-        void SetMapPixels()
+        void UpdateDirtyTiles()
+        {
+            if (_tileColours.size() != static_cast<size_t>(getTechnicalMapSize() * getTechnicalMapSize()))
+            {
+                InitMap();
+                return;
+            }
+
+            if (MapTakeDirtyTiles(_dirtyTiles))
+            {
+                RefreshMap();
+                return;
+            }
+
+            const auto mapSize = getTechnicalMapSize();
+            for (const auto& tile : _dirtyTiles)
+            {
+                if (tile.x >= mapSize || tile.y >= mapSize)
+                    continue;
+
+                auto colour = GetTileColour(tile);
+                auto& cachedColour = _tileColours[(tile.y * mapSize) + tile.x];
+                if (colour != cachedColour)
+                {
+                    cachedColour = colour;
+                    SetTilePixels(tile, colour);
+                }
+            }
+        }
+
+        uint16_t GetTileColour(const TileCoordsXY& tile)
+        {
+            const auto coords = tile.ToCoordsXY();
+            if (MapIsEdge(coords))
+                return 0;
+
+            switch (selected_tab)
+            {
+                case PAGE_PEEPS:
+                    return GetPixelColourPeep(coords);
+                case PAGE_RIDES:
+                    return GetPixelColourRide(coords);
+            }
+            return 0;
+        }
+
+        void DrawMapImage()
         {
-            int32_t x = 0, y = 0, dx = 0, dy = 0;
+            std::fill(_mapImageData.begin(), _mapImageData.end(), PALETTE_INDEX_10);
 
-            int32_t pos = (_currentLine * (getMiniMapWidth() - 1)) + getTechnicalMapSize() - 1;
-            auto destinationPosition = ScreenCoordsXY{ pos % getMiniMapWidth(), pos / getMiniMapWidth() };
-            auto destination = _mapImageData.data() + (destinationPosition.y * getMiniMapWidth()) + destinationPosition.x;
+            const auto mapSize = getTechnicalMapSize();
+            for (int32_t y = 0; y < mapSize; y++)
+            {
+                for (int32_t x = 0; x < mapSize; x++)
+                {
+                    if (!MapIsEdge(TileCoordsXY{ x, y }.ToCoordsXY()))
+                    {
+                        SetTilePixels({ x, y }, _tileColours[(y * mapSize) + x]);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Each tile is two pixels wide; the rows of tiles for the current rotation run diagonally down and to the right,
+         * with each row starting one pixel down and to the left of the previous one.
+         */
+        void SetTilePixels(const TileCoordsXY& tile, uint16_t colour)
+        {
+            const auto mapSize = getTechnicalMapSize();
+            int32_t line = 0, i = 0;
             switch (GetCurrentRotation())
             {
                 case 0:
-                    x = _currentLine * kCoordsXYStep;
-                    y = 0;
-                    dx = 0;
-                    dy = kCoordsXYStep;
+                    line = tile.x;
+                    i = tile.y;
                     break;
                 case 1:
-                    x = getMaxTileStartXY();
-                    y = _currentLine * kCoordsXYStep;
-                    dx = -kCoordsXYStep;
-                    dy = 0;
+                    line = tile.y;
+                    i = mapSize - 1 - tile.x;
                     break;
                 case 2:
-                    x = getTechnicalMapSizeBig() - ((_currentLine + 1) * kCoordsXYStep);
-                    y = getMaxTileStartXY();
-                    dx = 0;
-                    dy = -kCoordsXYStep;
+                    line = mapSize - 1 - tile.x;
+                    i = mapSize - 1 - tile.y;
                     break;
                 case 3:
-                    x = 0;
-                    y = getTechnicalMapSizeBig() - ((_currentLine + 1) * kCoordsXYStep);
-                    dx = kCoordsXYStep;
-                    dy = 0;
+                    line = mapSize - 1 - tile.y;
+                    i = tile.x;
                     break;
             }
 
-            for (int32_t i = 0; i < getTechnicalMapSize(); i++)
-            {
-                if (!MapIsEdge({ x, y }))
-                {
-                    uint16_t colour = 0;
-                    switch (selected_tab)
-                    {
-                        case PAGE_PEEPS:
-                            colour = GetPixelColourPeep({ x, y });
-                            break;
-                        case PAGE_RIDES:
-                            colour = GetPixelColourRide({ x, y });
-                            break;
-                    }
-                    destination[0] = (colour >> 8) & 0xFF;
-                    destination[1] = colour;
-                }
-                x += dx;
-                y += dy;
-
-                destinationPosition.x++;
-                destinationPosition.y++;
-                destination = _mapImageData.data() + (destinationPosition.y * getMiniMapWidth()) + destinationPosition.x;
-            }
-            _currentLine++;
-            if (_currentLine >= static_cast<uint32_t>(getTechnicalMapSize()))
-                _currentLine = 0;
+            const auto miniMapWidth = getMiniMapWidth();
+            auto destination = _mapImageData.data() + (line * (miniMapWidth - 1)) + mapSize - 1 + (i * (miniMapWidth + 1));
+            destination[0] = (colour >> 8) & 0xFF;
+            destination[1] = colour;
         }
 
         uint16_t GetPixelColourPeep(const CoordsXY& c)
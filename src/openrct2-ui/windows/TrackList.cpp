@@ -21,6 +21,7 @@
 #include <openrct2/ride/RideConstruction.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/ride/TrackDesign.h>
+#include <openrct2/ride/TrackDesignPreviewCache.h>
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/sprites.h>
 #include <openrct2/windows/Intent.h>
@@ -200,7 +201,7 @@ static Widget _trackListWidgets[] = {
             _loadedTrackDesign = TrackDesignImport(path.c_str());
             if (_loadedTrackDesign != nullptr)
             {
-                TrackDesignDrawPreview(*_loadedTrackDesign, _trackDesignPreviewPixels.data());
+                TrackDesignDrawPreviewCached(path, *_loadedTrackDesign, _trackDesignPreviewPixels.data());
                 return true;
             }
             return false;
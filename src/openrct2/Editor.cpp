@@ -62,7 +62,7 @@ namespace OpenRCT2::Editor
     static void FinaliseMainView();
     static void ClearMapForEditing(bool fromSave);
 
-    static void ObjectListLoad()
+    void ObjectListLoad()
     {
         auto* context = GetContext();
 
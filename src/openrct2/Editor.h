@@ -21,6 +21,9 @@ namespace OpenRCT2::Editor
     void LoadTrackManager();
     bool LoadLandscape(const utf8* path);
 
+    // Unloads every object and loads just the ones the editors start from
+    void ObjectListLoad();
+
     ResultWithMessage CheckPark();
     std::pair<ObjectType, StringId> CheckObjectSelection();
 
@@ -177,49 +177,28 @@ void RCT2StringToUTF8Self(char* buffer, size_t length)
     }
 }
 
-static void FixGuestsHeadingToParkCount()
+static void FixGuestCounts()
 {
-    auto& gameState = GetGameState();
-
-    uint32_t guestsHeadingToPark = 0;
-
-    for (auto* peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark && peep->State != PeepState::LeavingPark)
-        {
-            guestsHeadingToPark++;
-        }
-    }
+    // Recalculates guest counts after loading a save to fix corrupted files
+    const auto statistics = Park::CalculateGuestStatistics();
 
-    if (gameState.NumGuestsHeadingForPark != guestsHeadingToPark)
+    auto& gameState = GetGameState();
+    if (gameState.NumGuestsHeadingForPark != statistics.NumHeadingForPark)
     {
         LOG_WARNING(
-            "Corrected bad amount of guests heading to park: %u -> %u", gameState.NumGuestsHeadingForPark, guestsHeadingToPark);
+            "Corrected bad amount of guests heading to park: %u -> %u", gameState.NumGuestsHeadingForPark,
+            statistics.NumHeadingForPark);
     }
+    gameState.NumGuestsHeadingForPark = statistics.NumHeadingForPark;
 
-    gameState.NumGuestsHeadingForPark = guestsHeadingToPark;
-}
-
-static void FixGuestCount()
-{
-    // Recalculates peep count after loading a save to fix corrupted files
-    uint32_t guestCount = 0;
-
-    for (auto guest : EntityList<Guest>())
+    if (gameState.NumGuestsInPark != statistics.NumInPark)
     {
-        if (!guest->OutsideOfPark)
-        {
-            guestCount++;
-        }
+        LOG_WARNING("Corrected bad amount of guests in park: %u -> %u", gameState.NumGuestsInPark, statistics.NumInPark);
     }
+    gameState.NumGuestsInPark = statistics.NumInPark;
 
-    auto& gameState = GetGameState();
-    if (gameState.NumGuestsInPark != guestCount)
-    {
-        LOG_WARNING("Corrected bad amount of guests in park: %u -> %u", gameState.NumGuestsInPark, guestCount);
-    }
-
-    gameState.NumGuestsInPark = guestCount;
+    // The happy and lost guest counts are recounted from the loaded guests
+    Park::ResetGuestStatistics();
 }
 
 static void FixPeepsWithInvalidRideReference()
@@ -315,9 +294,7 @@ static void FixInvalidSurfaces()
 // For example recalculate guest count by looking at all the guests instead of trusting the value in the file.
 void GameFixSaveVars()
 {
-    FixGuestsHeadingToParkCount();
-
-    FixGuestCount();
+    FixGuestCounts();
 
     FixPeepsWithInvalidRideReference();
 
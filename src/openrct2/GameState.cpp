@@ -310,6 +310,7 @@ namespace OpenRCT2
 
         ScenarioUpdate(gameState);
         ClimateUpdate();
+        MapCompactTileElements();
         MapUpdateTiles();
         // Temporarily remove provisional paths to prevent peep from interacting with them
         MapRemoveProvisionalElements();
@@ -635,7 +635,7 @@ void CheatSetAction::SetGuestParameter(int32_t parameter, int32_t value) const
         switch (parameter)
         {
             case GUEST_PARAMETER_HAPPINESS:
-                peep->Happiness = value;
+                peep->SetHappiness(value);
                 peep->HappinessTarget = value;
                 // Clear the 'red-faced with anger' status if we're making the guest happy
                 if (value > 0)
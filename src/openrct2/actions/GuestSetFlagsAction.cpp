@@ -60,7 +60,7 @@ GameActions::Result GuestSetFlagsAction::Execute() const
         return GameActions::Result(GameActions::Status::InvalidParameters, STR_CANT_CHANGE_THIS, STR_NONE);
     }
 
-    peep->PeepFlags = _newFlags;
+    peep->SetPeepFlags(_newFlags);
 
     return GameActions::Result();
 }
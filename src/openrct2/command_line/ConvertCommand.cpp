@@ -13,20 +13,57 @@
 #include "../OpenRCT2.h"
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
+#include "../core/String.hpp"
 #include "../interface/Window.h"
 #include "../object/ObjectManager.h"
 #include "../park/ParkFile.h"
+#include "../platform/Platform.h"
 #include "../scenario/Scenario.h"
 #include "CommandLine.hpp"
 
 #include <cassert>
+#include <chrono>
+#include <deque>
+#include <future>
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 
+// How many source files are read ahead of the one being converted
+static constexpr size_t kConvertBatchReadAhead = 4;
+// How many converted parks can be waiting to be written before conversion waits for them
+static constexpr size_t kConvertBatchMaxPendingWrites = 4;
+
+using ConvertClock = std::chrono::steady_clock;
+
+struct ConvertBatchJob
+{
+    u8string SourcePath;
+    u8string DestinationPath;
+    FileExtension SourceFileType{};
+
+    bool Success{};
+    std::string Error;
+    double ReadTime{};
+    double ConvertTime{};
+    double WriteTime{};
+};
+
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType);
 static u8string GetFileTypeFriendlyName(FileExtension fileType);
+static bool IsConvertibleFileType(FileExtension fileType);
+static u8string GetConvertBatchDestination(u8string_view destinationPath, u8string_view relativeSourcePath);
+static bool AddConvertBatchJobs(std::vector<ConvertBatchJob>& jobs, u8string_view sourcePath, u8string_view destinationPath);
+static bool CheckConvertBatchDestinations(const std::vector<ConvertBatchJob>& jobs);
+static MemoryStream ConvertPark(const ConvertBatchJob& job, const std::vector<uint8_t>& sourceData);
+static void WriteConvertBatchJobResult(const ConvertBatchJob& job, size_t index, size_t count);
 
 exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerator)
 {
@@ -137,6 +174,290 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     return EXITCODE_OK;
 }
 
+/**
+ * Converts many files with a single initialisation of the game. Parks are imported into and exported from the one
+ * global game state, so the conversions themselves run one at a time, while the files are read ahead and written
+ * behind them on other threads.
+ */
+exitcode_t CommandLine::HandleCommandConvertBatch(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    // Get the destination directory
+    const utf8* rawDestinationPath;
+    if (!enumerator->TryPopString(&rawDestinationPath))
+    {
+        Console::Error::WriteLine("Expected a destination directory.");
+        return EXITCODE_FAIL;
+    }
+    const auto destinationPath = Path::GetAbsolute(rawDestinationPath);
+
+    // Get the source files and directories
+    std::vector<ConvertBatchJob> jobs;
+    const utf8* rawSourcePath;
+    bool hasSourcePath = false;
+    while (enumerator->TryPopString(&rawSourcePath))
+    {
+        hasSourcePath = true;
+        if (!AddConvertBatchJobs(jobs, Path::GetAbsolute(rawSourcePath), destinationPath))
+        {
+            return EXITCODE_FAIL;
+        }
+    }
+    if (!hasSourcePath)
+    {
+        Console::Error::WriteLine("Expected at least one source path.");
+        return EXITCODE_FAIL;
+    }
+    if (jobs.empty())
+    {
+        Console::Error::WriteLine("No .SC4, .SV4, .SC6 or .SV6 files were found.");
+        return EXITCODE_FAIL;
+    }
+    if (!CheckConvertBatchDestinations(jobs))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+    auto context = OpenRCT2::CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    Console::WriteLine("Converting %zu files to '%s'.", jobs.size(), destinationPath.c_str());
+    const auto startTime = ConvertClock::now();
+
+    auto readFile = [](ConvertBatchJob& job) {
+        const auto readStartTime = ConvertClock::now();
+        auto data = File::ReadAllBytes(job.SourcePath);
+        job.ReadTime = std::chrono::duration<double, std::milli>(ConvertClock::now() - readStartTime).count();
+        return data;
+    };
+    auto writeFile = [](ConvertBatchJob& job, MemoryStream park) {
+        const auto writeStartTime = ConvertClock::now();
+        try
+        {
+            Path::CreateDirectory(Path::GetDirectory(job.DestinationPath));
+            File::WriteAllBytes(job.DestinationPath, park.GetData(), park.GetLength());
+            job.Success = true;
+        }
+        catch (const std::exception& ex)
+        {
+            job.Error = ex.what();
+        }
+        job.WriteTime = std::chrono::duration<double, std::milli>(ConvertClock::now() - writeStartTime).count();
+    };
+
+    std::deque<std::future<std::vector<uint8_t>>> pendingReads;
+    std::deque<std::pair<size_t, std::future<void>>> pendingWrites;
+    size_t numReadsStarted = 0;
+    auto finishWrite = [&]() {
+        auto& [index, write] = pendingWrites.front();
+        write.get();
+        WriteConvertBatchJobResult(jobs[index], index, jobs.size());
+        pendingWrites.pop_front();
+    };
+
+    for (size_t i = 0; i < jobs.size(); i++)
+    {
+        while (numReadsStarted < jobs.size() && numReadsStarted <= i + kConvertBatchReadAhead)
+        {
+            pendingReads.push_back(std::async(std::launch::async, readFile, std::ref(jobs[numReadsStarted])));
+            numReadsStarted++;
+        }
+
+        auto& job = jobs[i];
+        auto read = std::move(pendingReads.front());
+        pendingReads.pop_front();
+
+        std::optional<MemoryStream> park;
+        try
+        {
+            auto sourceData = read.get();
+            const auto convertStartTime = ConvertClock::now();
+            park = ConvertPark(job, sourceData);
+            job.ConvertTime = std::chrono::duration<double, std::milli>(ConvertClock::now() - convertStartTime).count();
+        }
+        catch (const std::exception& ex)
+        {
+            job.Error = ex.what();
+        }
+
+        if (park.has_value())
+        {
+            while (pendingWrites.size() >= kConvertBatchMaxPendingWrites)
+            {
+                finishWrite();
+            }
+            pendingWrites.emplace_back(i, std::async(std::launch::async, writeFile, std::ref(job), std::move(*park)));
+        }
+        else
+        {
+            // Keep the results in order
+            while (!pendingWrites.empty())
+            {
+                finishWrite();
+            }
+            WriteConvertBatchJobResult(job, i, jobs.size());
+        }
+
+        // Report the writes that have already finished
+        while (!pendingWrites.empty()
+               && pendingWrites.front().second.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            finishWrite();
+        }
+    }
+    while (!pendingWrites.empty())
+    {
+        finishWrite();
+    }
+
+    const auto totalTime = std::chrono::duration<double>(ConvertClock::now() - startTime).count();
+    size_t numFailed = 0;
+    for (const auto& job : jobs)
+    {
+        if (!job.Success)
+        {
+            numFailed++;
+        }
+    }
+
+    Console::WriteLine();
+    Console::WriteLine("Converted %zu of %zu files in %.2f seconds.", jobs.size() - numFailed, jobs.size(), totalTime);
+    if (numFailed != 0)
+    {
+        Console::Error::WriteLine("%zu files failed to convert:", numFailed);
+        for (const auto& job : jobs)
+        {
+            if (!job.Success)
+            {
+                Console::Error::WriteLine("  %s: %s", job.SourcePath.c_str(), job.Error.c_str());
+            }
+        }
+        return EXITCODE_FAIL;
+    }
+    return EXITCODE_OK;
+}
+
+// Replaces the source's extension with .park, rather than appending it
+static u8string GetConvertBatchDestination(u8string_view destinationPath, u8string_view relativeSourcePath)
+{
+    auto fileName = Path::GetFileNameWithoutExtension(relativeSourcePath) + u8".park";
+    return Path::Combine(destinationPath, Path::GetDirectory(relativeSourcePath), fileName);
+}
+
+static bool AddConvertBatchJobs(std::vector<ConvertBatchJob>& jobs, u8string_view sourcePath, u8string_view destinationPath)
+{
+    if (Path::DirectoryExists(sourcePath))
+    {
+        // Mirror the directory structure of the source directory
+        auto pattern = Path::Combine(sourcePath, u8"*.sc4;*.sv4;*.sc6;*.sv6");
+        auto scanner = Path::ScanDirectory(pattern, true);
+        while (scanner->Next())
+        {
+            const auto& path = scanner->GetPath();
+            auto& job = jobs.emplace_back();
+            job.SourcePath = path;
+            job.DestinationPath = GetConvertBatchDestination(destinationPath, Path::GetRelative(path, sourcePath));
+            job.SourceFileType = GetFileExtensionType(path);
+        }
+        return true;
+    }
+
+    if (!File::Exists(sourcePath))
+    {
+        Console::Error::WriteLine("The path '%s' does not exist.", u8string(sourcePath).c_str());
+        return false;
+    }
+
+    auto sourceFileType = GetFileExtensionType(sourcePath);
+    if (!IsConvertibleFileType(sourceFileType))
+    {
+        Console::Error::WriteLine("'%s' is not a .SC4, .SV4, .SC6 or .SV6 file.", u8string(sourcePath).c_str());
+        return false;
+    }
+    auto& job = jobs.emplace_back();
+    job.SourcePath = sourcePath;
+    job.DestinationPath = GetConvertBatchDestination(destinationPath, Path::GetFileName(sourcePath));
+    job.SourceFileType = sourceFileType;
+    return true;
+}
+
+/**
+ * Sources with the same name, e.g. from different directories or X.SC6 and X.SV6, are converted to the same destination.
+ * Their writes can run at the same time and would race each other, so they are reported before anything is converted.
+ */
+static bool CheckConvertBatchDestinations(const std::vector<ConvertBatchJob>& jobs)
+{
+    std::unordered_map<u8string, const ConvertBatchJob*> destinations;
+    bool success = true;
+    for (const auto& job : jobs)
+    {
+        auto key = Platform::ShouldIgnoreCase() ? String::ToUpper(job.DestinationPath) : job.DestinationPath;
+        auto [it, inserted] = destinations.emplace(std::move(key), &job);
+        if (!inserted)
+        {
+            Console::Error::WriteLine(
+                "'%s' and '%s' would both be converted to '%s'.", it->second->SourcePath.c_str(), job.SourcePath.c_str(),
+                job.DestinationPath.c_str());
+            success = false;
+        }
+    }
+    return success;
+}
+
+static MemoryStream ConvertPark(const ConvertBatchJob& job, const std::vector<uint8_t>& sourceData)
+{
+    auto& objManager = GetContext()->GetObjectManager();
+    auto& gameState = GetGameState();
+
+    const bool isScenario = job.SourceFileType == FileExtension::SC4 || job.SourceFileType == FileExtension::SC6;
+    auto importer = ParkImporter::Create(job.SourcePath);
+    MemoryStream source(sourceData.data(), sourceData.size());
+    auto loadResult = importer->LoadFromStream(&source, isScenario, false, job.SourcePath);
+
+    // Importing resets the game state, so nothing is carried over from the previous park
+    objManager.LoadObjects(loadResult.RequiredObjects);
+    importer->Import(gameState);
+
+    if (isScenario)
+    {
+        // We are converting a scenario, so reset the park
+        ScenarioBegin(gameState);
+    }
+
+    // HACK remove the main window so it saves the park with the
+    //      correct initial view
+    WindowCloseByClass(WindowClass::MainWindow);
+
+    MemoryStream park;
+    auto exporter = std::make_unique<ParkFileExporter>();
+    exporter->Export(gameState, park);
+    return park;
+}
+
+static void WriteConvertBatchJobResult(const ConvertBatchJob& job, size_t index, size_t count)
+{
+    if (job.Success)
+    {
+        Console::WriteLine(
+            "[%zu/%zu] %s: read %.1f ms, convert %.1f ms, write %.1f ms", index + 1, count, job.SourcePath.c_str(),
+            job.ReadTime, job.ConvertTime, job.WriteTime);
+    }
+    else
+    {
+        Console::Error::WriteLine("[%zu/%zu] %s: %s", index + 1, count, job.SourcePath.c_str(), job.Error.c_str());
+    }
+}
+
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType)
 {
     const auto sourceFileTypeName = GetFileTypeFriendlyName(sourceFileType);
@@ -166,3 +487,17 @@ static u8string GetFileTypeFriendlyName(FileExtension fileType)
     assert(false);
     return nullptr;
 }
+
+static bool IsConvertibleFileType(FileExtension fileType)
+{
+    switch (fileType)
+    {
+        case FileExtension::SC4:
+        case FileExtension::SV4:
+        case FileExtension::SC6:
+        case FileExtension::SV6:
+            return true;
+        default:
+            return false;
+    }
+}
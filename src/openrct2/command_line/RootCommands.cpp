@@ -8,6 +8,8 @@
  *****************************************************************************/
 
 #include "../Context.h"
+#include "../Editor.h"
+#include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../Version.h"
@@ -20,11 +22,14 @@
 #include "../core/String.hpp"
 #include "../localisation/Language.h"
 #include "../network/network.h"
+#include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
 #include "../park/ParkFile.h"
 #include "../platform/Crash.h"
 #include "../platform/Platform.h"
+#include "../ride/TrackDesignPreviewCache.h"
 #include "../scripting/ScriptEngine.h"
+#include "../world/Map.h"
 #include "CommandLine.hpp"
 
 #include <ctime>
@@ -99,6 +104,7 @@ static exitcode_t HandleCommandJoin(CommandLineArgEnumerator * enumerator);
 #endif
 static exitcode_t HandleCommandSetRCT2(CommandLineArgEnumerator * enumerator);
 static exitcode_t HandleCommandScanObjects(CommandLineArgEnumerator * enumerator);
+static exitcode_t HandleCommandCacheTrackPreviews(CommandLineArgEnumerator * enumerator);
 
 #if defined(_WIN32)
 
@@ -134,7 +140,9 @@ const CommandLineCommand CommandLine::RootCommands[]
 #endif
     DefineCommand("set-rct2", "<path>",                 StandardOptions, HandleCommandSetRCT2),
     DefineCommand("convert",  "<source> <destination>", StandardOptions, CommandLine::HandleCommandConvert),
+    DefineCommand("convert-batch", "<destination> <source>...", StandardOptions, CommandLine::HandleCommandConvertBatch),
     DefineCommand("scan-objects", "<path>",             StandardOptions, HandleCommandScanObjects),
+    DefineCommand("cache-track-previews", "[path]",     StandardOptions, HandleCommandCacheTrackPreviews),
     DefineCommand("handle-uri", "openrct2://.../",      StandardOptions, CommandLine::HandleCommandUri),
 
 #if defined(_WIN32)
@@ -407,6 +415,53 @@ static exitcode_t HandleCommandScanObjects([[maybe_unused]] CommandLineArgEnumer
     return EXITCODE_OK;
 }
 
+static exitcode_t HandleCommandCacheTrackPreviews(CommandLineArgEnumerator* enumerator)
+{
+    exitcode_t result = CommandLine::HandleCommandDefault();
+    if (result != EXITCODE_CONTINUE)
+    {
+        return result;
+    }
+
+    gOpenRCT2Headless = true;
+
+    auto context = OpenRCT2::CreateContext();
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    // Default to the user's track designs, which are what the track manager lists
+    u8string path;
+    const utf8* rawPath;
+    if (enumerator->TryPopString(&rawPath))
+    {
+        path = Path::GetAbsolute(rawPath);
+    }
+    else
+    {
+        path = context->GetPlatformEnvironment()->GetDirectoryPath(DIRBASE::USER, DIRID::TRACK);
+    }
+
+    if (!Path::DirectoryExists(path))
+    {
+        Console::Error::WriteLine("The path '%s' does not exist", path.c_str());
+        return EXITCODE_FAIL;
+    }
+
+    // Previews are drawn the way the track manager draws them, starting from the same objects
+    gScreenFlags = SCREEN_FLAGS_TRACK_MANAGER;
+    ObjectManagerUnloadAllObjects();
+    Editor::ObjectListLoad();
+    gameStateInitAll(GetGameState(), DEFAULT_MAP_SIZE);
+
+    Console::WriteLine("Caching track design previews in '%s'...", path.c_str());
+    auto numRendered = TrackDesignPreviewCacheWarm(path);
+    Console::WriteLine("Rendered %zu new previews.", numRendered);
+    return EXITCODE_OK;
+}
+
 #if defined(_WIN32)
 static exitcode_t HandleCommandRegisterShell([[maybe_unused]] CommandLineArgEnumerator* enumerator)
 {
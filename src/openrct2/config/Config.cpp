@@ -590,6 +590,7 @@ namespace OpenRCT2::Config
             auto model = &_config.plugin;
             model->EnableHotReloading = reader->GetBoolean("enable_hot_reloading", false);
             model->AllowedHosts = reader->GetString("allowed_hosts", "");
+            model->TickHookTimeBudget = reader->GetInt32("tick_hook_time_budget", 0);
         }
     }
 
@@ -599,6 +600,7 @@ namespace OpenRCT2::Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->EnableHotReloading);
         writer->WriteString("allowed_hosts", model->AllowedHosts);
+        writer->WriteInt32("tick_hook_time_budget", model->TickHookTimeBudget);
     }
 
     bool SetDefaults()
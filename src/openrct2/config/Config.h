@@ -221,6 +221,7 @@ namespace OpenRCT2::Config
     {
         bool EnableHotReloading;
         u8string AllowedHosts;
+        int32_t TickHookTimeBudget;
     };
 
     struct Config
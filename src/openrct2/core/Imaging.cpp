@@ -164,7 +164,7 @@ namespace OpenRCT2::Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePng(std::ostream& ostream, const Image& image, const ImageRowFunc& getRow)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -233,11 +233,9 @@ namespace OpenRCT2::Imaging
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
-            auto pixels = image.Pixels.data();
             for (uint32_t y = 0; y < image.Height; y++)
             {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
+                png_write_row(png_ptr, const_cast<png_byte*>(getRow(y)));
             }
 
             png_write_end(png_ptr, nullptr);
@@ -253,6 +251,11 @@ namespace OpenRCT2::Imaging
         }
     }
 
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        WritePng(ostream, image, [&image](uint32_t y) { return image.Pixels.data() + (y * image.Stride); });
+    }
+
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path)
     {
         if (String::EndsWith(path, ".png", true))
@@ -342,4 +345,22 @@ namespace OpenRCT2::Imaging
                 throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
         }
     }
+
+    void WriteToFile(std::string_view path, const Image& image, const ImageRowFunc& getRow, IMAGE_FORMAT format)
+    {
+        switch (format)
+        {
+            case IMAGE_FORMAT::AUTOMATIC:
+                WriteToFile(path, image, getRow, GetImageFormatFromPath(path));
+                break;
+            case IMAGE_FORMAT::PNG:
+            {
+                std::ofstream fs(fs::u8path(path), std::ios::binary);
+                WritePng(fs, image, getRow);
+                break;
+            }
+            default:
+                throw std::runtime_error(EXCEPTION_IMAGE_FORMAT_UNKNOWN);
+        }
+    }
 } // namespace OpenRCT2::Imaging
@@ -42,6 +42,7 @@ struct Image
 };
 
 using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
+using ImageRowFunc = std::function<const uint8_t*(uint32_t y)>;
 
 namespace OpenRCT2::Imaging
 {
@@ -50,5 +51,12 @@ namespace OpenRCT2::Imaging
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     void WriteToFile(std::string_view path, const Image& image, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
 
+    /**
+     * Writes an image without holding all of its pixels: each row is requested in order from getRow and
+     * image.Pixels is ignored. Only PNG is supported.
+     */
+    void WriteToFile(
+        std::string_view path, const Image& image, const ImageRowFunc& getRow, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
+
     void SetReader(IMAGE_FORMAT format, ImageReaderFunc impl);
 } // namespace OpenRCT2::Imaging
@@ -0,0 +1,110 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "../Diagnostic.h"
+#include "MemoryMappedFile.h"
+
+namespace OpenRCT2
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+#ifdef _WIN32
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mappingHandle != nullptr)
+        {
+            CloseHandle(_mappingHandle);
+        }
+        if (_fileHandle != nullptr)
+        {
+            CloseHandle(_fileHandle);
+        }
+#else
+        if (_data != nullptr)
+        {
+            munmap(const_cast<uint8_t*>(_data), _length);
+        }
+#endif
+    }
+
+    std::unique_ptr<MemoryMappedFile> MemoryMappedFile::Open(u8string_view path)
+    {
+        auto result = std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile());
+        auto pathStr = u8string(path);
+#ifdef _WIN32
+        auto pathW = String::ToWideChar(pathStr);
+        auto fileHandle = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+        result->_fileHandle = fileHandle;
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0
+            || static_cast<uint64_t>(fileSize.QuadPart) > SIZE_MAX)
+        {
+            return nullptr;
+        }
+
+        result->_mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (result->_mappingHandle == nullptr)
+        {
+            return nullptr;
+        }
+
+        auto view = MapViewOfFile(result->_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr)
+        {
+            return nullptr;
+        }
+        result->_data = static_cast<const uint8_t*>(view);
+        result->_length = static_cast<size_t>(fileSize.QuadPart);
+#else
+        int fd = open(pathStr.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return nullptr;
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size <= 0
+            || static_cast<uint64_t>(fileStat.st_size) > SIZE_MAX)
+        {
+            close(fd);
+            return nullptr;
+        }
+
+        auto length = static_cast<size_t>(fileStat.st_size);
+        auto view = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file, so the descriptor is no longer needed.
+        close(fd);
+        if (view == MAP_FAILED)
+        {
+            LOG_VERBOSE("Unable to map '%s' into memory", pathStr.c_str());
+            return nullptr;
+        }
+        result->_data = static_cast<const uint8_t*>(view);
+        result->_length = length;
+#endif
+        return result;
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,57 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "String.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OpenRCT2
+{
+    /**
+     * A read-only view of a whole file mapped into the address space. Pages are only read from disk when they are
+     * first touched, and are shared with any other process mapping the same file.
+     */
+    class MemoryMappedFile final
+    {
+    private:
+        const uint8_t* _data = nullptr;
+        size_t _length = 0;
+#ifdef _WIN32
+        void* _fileHandle = nullptr;
+        void* _mappingHandle = nullptr;
+#endif
+
+        MemoryMappedFile() = default;
+
+    public:
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        ~MemoryMappedFile();
+
+        const uint8_t* GetData() const
+        {
+            return _data;
+        }
+
+        size_t GetLength() const
+        {
+            return _length;
+        }
+
+        /**
+         * Maps the file at the given path. Returns nullptr if the file could not be mapped, e.g. because it is empty
+         * or the platform does not support it, in which case the caller should fall back to reading the file.
+         */
+        static std::unique_ptr<MemoryMappedFile> Open(u8string_view path);
+    };
+} // namespace OpenRCT2
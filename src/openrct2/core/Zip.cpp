@@ -11,6 +11,8 @@
 
 #include "IStream.hpp"
 
+#include <unordered_map>
+
 #ifndef __ANDROID__
 #    include <zip.h>
 #endif
@@ -73,6 +75,10 @@ private:
     ZIP_ACCESS _access;
     std::vector<std::vector<uint8_t>> _writeBuffers;
 
+    // Normalised path to entry index, built on first lookup and rebuilt after the archive is modified
+    mutable std::unordered_map<std::string, size_t> _pathIndex;
+    mutable bool _pathIndexValid{};
+
 public:
     ZipArchive(std::string_view path, ZIP_ACCESS access)
     {
@@ -113,6 +119,21 @@ public:
         return result;
     }
 
+    std::optional<size_t> GetIndexFromPath(std::string_view path) const override
+    {
+        if (!_pathIndexValid)
+        {
+            BuildPathIndex();
+        }
+
+        auto it = _pathIndex.find(NormalisePath(path));
+        if (it != _pathIndex.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
     uint64_t GetFileSize(size_t index) const override
     {
         zip_stat_t zipFileStat;
@@ -182,6 +203,7 @@ public:
             zip_source_free(source);
             throw std::runtime_error(std::string(zip_strerror(_zip)));
         }
+        _pathIndexValid = false;
     }
 
     void DeleteFile(std::string_view path) override
@@ -190,6 +212,7 @@ public:
         if (index.has_value())
         {
             zip_delete(_zip, index.value());
+            _pathIndexValid = false;
         }
         else
         {
@@ -203,6 +226,7 @@ public:
         if (index)
         {
             zip_file_rename(_zip, *index, newPath.data(), ZIP_FL_ENC_GUESS);
+            _pathIndexValid = false;
         }
         else
         {
@@ -211,6 +235,23 @@ public:
     }
 
 private:
+    void BuildPathIndex() const
+    {
+        _pathIndex.clear();
+        auto numFiles = GetNumFiles();
+        _pathIndex.reserve(numFiles);
+        for (size_t i = 0; i < numFiles; i++)
+        {
+            auto name = zip_get_name(_zip, i, ZIP_FL_ENC_GUESS);
+            if (name != nullptr && name[0] != '\0')
+            {
+                // Keep the first entry if the archive contains duplicate paths
+                _pathIndex.emplace(NormalisePath(name), i);
+            }
+        }
+        _pathIndexValid = true;
+    }
+
     class ZipItemStream final : public IStream
     {
     private:
@@ -45,7 +45,7 @@ struct IZipArchive
     virtual void DeleteFile(std::string_view path) = 0;
     virtual void RenameFile(std::string_view path, std::string_view newPath) = 0;
 
-    [[nodiscard]] std::optional<size_t> GetIndexFromPath(std::string_view path) const;
+    [[nodiscard]] virtual std::optional<size_t> GetIndexFromPath(std::string_view path) const;
     [[nodiscard]] bool Exists(std::string_view path) const;
 };
 
@@ -15,6 +15,7 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
+#include "../core/MemoryMappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../platform/Platform.h"
@@ -228,6 +229,9 @@ void MaskScalar(
 static Gx _g1 = {};
 static Gx _g2 = {};
 static Gx _csg = {};
+static std::unique_ptr<MemoryMappedFile> _g1Mapping;
+static std::unique_ptr<MemoryMappedFile> _g2Mapping;
+static std::unique_ptr<MemoryMappedFile> _csgMapping;
 static G1Element _scrollingText[MaxScrollingTextEntries]{};
 static bool _csgLoaded = false;
 
@@ -235,6 +239,39 @@ static G1Element _g1Temp = {};
 static std::vector<G1Element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+/**
+ * Opens a graphics file for reading, memory mapping it where possible so that sprite data is only paged in when it is
+ * drawn and can be shared between several running instances.
+ */
+static std::unique_ptr<IStream> OpenGxStream(u8string_view path, std::unique_ptr<MemoryMappedFile>& mapping)
+{
+    mapping = MemoryMappedFile::Open(path);
+    if (mapping != nullptr)
+    {
+        return std::make_unique<MemoryStream>(mapping->GetData(), mapping->GetLength());
+    }
+    return std::make_unique<FileStream>(path, FILE_MODE_OPEN);
+}
+
+/**
+ * Gets the element data at the current position of the stream. Mapped files are used in place, otherwise the data is
+ * read into the Gx's own buffer.
+ */
+static uint8_t* ReadGxData(IStream& stream, const MemoryMappedFile* mapping, Gx& gx, uint32_t length)
+{
+    if (mapping != nullptr)
+    {
+        auto position = stream.GetPosition();
+        if (position + length > mapping->GetLength())
+        {
+            throw IOException("Attempted to read past end of stream.");
+        }
+        return const_cast<uint8_t*>(mapping->GetData() + position);
+    }
+    gx.data = stream.ReadArray<uint8_t>(length);
+    return gx.data.get();
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -245,8 +282,8 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
     try
     {
         auto path = env.FindFile(DIRBASE::RCT2, DIRID::DATA, u8"g1.dat");
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g1.header = fs.ReadValue<RCTG1Header>();
+        auto fs = OpenGxStream(path, _g1Mapping);
+        _g1.header = fs->ReadValue<RCTG1Header>();
 
         LOG_VERBOSE("g1.dat, number of entries: %u", _g1.header.num_entries);
 
@@ -258,16 +295,16 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
         // Read element headers
         bool is_rctc = _g1.header.num_entries == SPR_RCTC_G1_END;
         _g1.elements.resize(_g1.header.num_entries);
-        ReadAndConvertGxDat(&fs, _g1.header.num_entries, is_rctc, _g1.elements.data());
+        ReadAndConvertGxDat(fs.get(), _g1.header.num_entries, is_rctc, _g1.elements.data());
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        auto data = ReadGxData(*fs, _g1Mapping.get(), _g1, _g1.header.total_size);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
+            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -275,6 +312,8 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
     {
         _g1.elements.clear();
         _g1.elements.shrink_to_fit();
+        _g1.data.reset();
+        _g1Mapping.reset();
 
         LOG_FATAL("Unable to load g1 graphics");
         if (!gOpenRCT2Headless)
@@ -291,6 +330,7 @@ void GfxUnloadG1()
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
+    _g1Mapping.reset();
 }
 
 void GfxUnloadG2()
@@ -298,6 +338,7 @@ void GfxUnloadG2()
     _g2.data.reset();
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
+    _g2Mapping.reset();
 }
 
 void GfxUnloadCsg()
@@ -305,6 +346,7 @@ void GfxUnloadCsg()
     _csg.data.reset();
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
+    _csgMapping.reset();
 }
 
 bool GfxLoadG2()
@@ -317,15 +359,15 @@ bool GfxLoadG2()
 
     try
     {
-        auto fs = FileStream(path, FILE_MODE_OPEN);
-        _g2.header = fs.ReadValue<RCTG1Header>();
+        auto fs = OpenGxStream(path, _g2Mapping);
+        _g2.header = fs->ReadValue<RCTG1Header>();
 
         // Read element headers
         _g2.elements.resize(_g2.header.num_entries);
-        ReadAndConvertGxDat(&fs, _g2.header.num_entries, false, _g2.elements.data());
+        ReadAndConvertGxDat(fs.get(), _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        auto data = ReadGxData(*fs, _g2Mapping.get(), _g2, _g2.header.total_size);
 
         if (_g2.header.num_entries != G2_SPRITE_COUNT)
         {
@@ -346,7 +388,7 @@ bool GfxLoadG2()
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
         {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
+            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -354,6 +396,8 @@ bool GfxLoadG2()
     {
         _g2.elements.clear();
         _g2.elements.shrink_to_fit();
+        _g2.data.reset();
+        _g2Mapping.reset();
 
         LOG_FATAL("Unable to load g2 graphics");
         if (!gOpenRCT2Headless)
@@ -380,9 +424,9 @@ bool GfxLoadCsg()
     try
     {
         auto fileHeader = FileStream(pathHeaderPath, FILE_MODE_OPEN);
-        auto fileData = FileStream(pathDataPath, FILE_MODE_OPEN);
+        auto fileData = OpenGxStream(pathDataPath, _csgMapping);
         size_t fileHeaderSize = fileHeader.GetLength();
-        size_t fileDataSize = fileData.GetLength();
+        size_t fileDataSize = fileData->GetLength();
 
         _csg.header.num_entries = static_cast<uint32_t>(fileHeaderSize / sizeof(RCTG1Element));
         _csg.header.total_size = static_cast<uint32_t>(fileDataSize);
@@ -390,6 +434,7 @@ bool GfxLoadCsg()
         if (!CsgIsUsable(_csg))
         {
             LOG_WARNING("Cannot load CSG1.DAT, it has too few entries. Only CSG1.DAT from Loopy Landscapes will work.");
+            _csgMapping.reset();
             return false;
         }
 
@@ -398,12 +443,12 @@ bool GfxLoadCsg()
         ReadAndConvertGxDat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        auto data = ReadGxData(*fileData, _csgMapping.get(), _csg, _csg.header.total_size);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -417,6 +462,8 @@ bool GfxLoadCsg()
     {
         _csg.elements.clear();
         _csg.elements.shrink_to_fit();
+        _csg.data.reset();
+        _csgMapping.reset();
 
         LOG_ERROR("Unable to load csg graphics");
         return false;
@@ -340,16 +340,12 @@ bool TTFProvidesGlyph(const TTF_Font* font, codepoint_t codepoint)
 
 static bool TTFGetSize(TTF_Font* font, std::string_view text, int32_t* outWidth, int32_t* outHeight)
 {
-    thread_local std::string buffer;
-    buffer.assign(text);
-    return TTF_SizeUTF8(font, buffer.c_str(), outWidth, outHeight);
+    return TTF_SizeUTF8(font, text, outWidth, outHeight);
 }
 
 static TTFSurface* TTFRender(TTF_Font* font, std::string_view text)
 {
-    thread_local std::string buffer;
-    buffer.assign(text);
-    return TTF_RenderUTF8(font, buffer.c_str(), TTF_GetFontHinting(font) != 0);
+    return TTF_RenderUTF8(font, text, TTF_GetFontHinting(font) != 0);
 }
 
 void TTFFreeSurface(TTFSurface* surface)
@@ -37,8 +37,8 @@ void TTFFreeSurface(TTFSurface* surface);
 int TTF_Init(void);
 TTF_Font* TTF_OpenFont(const char* file, int ptsize);
 int TTF_GlyphIsProvided(const TTF_Font* font, codepoint_t ch);
-int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h);
-TTFSurface* TTF_RenderUTF8(TTF_Font* font, const char* text, bool shaded);
+int TTF_SizeUTF8(TTF_Font* font, std::string_view text, int* w, int* h);
+TTFSurface* TTF_RenderUTF8(TTF_Font* font, std::string_view text, bool shaded);
 void TTF_CloseFont(TTF_Font* font);
 void TTF_SetFontHinting(TTF_Font* font, int hinting);
 int TTF_GetFontHinting(const TTF_Font* font);
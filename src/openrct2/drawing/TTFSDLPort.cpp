@@ -39,9 +39,11 @@ misrepresented as being the original software.
 
 #    include <cmath>
 #    include <cstring>
+#    include <new>
 #    include <stdio.h>
 #    include <stdlib.h>
 #    include <string.h>
+#    include <unordered_map>
 
 #    pragma clang diagnostic push
 #    pragma clang diagnostic ignored "-Wdocumentation"
@@ -87,6 +89,9 @@ in the result FT_Bitmap after the FT_Render_Glyph() call. */
 #    define CACHED_BITMAP 0x01
 #    define CACHED_PIXMAP 0x02
 
+/* Upper bound on the glyph atlas before it is flushed, keeps memory bounded for CJK fonts */
+#    define MAX_CACHED_GLYPHS 4096
+
 /* Cached glyph information */
 struct c_glyph
 {
@@ -131,9 +136,14 @@ struct InternalTTFFont
     int underline_offset;
     int underline_height;
 
-    /* Cache for style-transformed glyphs */
+    /* Glyph atlas: every style-transformed glyph rendered so far, keyed by code point.
+     * Unlike the original direct-mapped cache, glyphs never evict each other so text
+     * composed of many distinct characters does not have to be re-rasterised. */
     c_glyph* current;
-    c_glyph cache[257]; /* 257 is a prime */
+    std::unordered_map<uint16_t, c_glyph> glyphs;
+
+    /* Kerning between glyph index pairs, as looked up from FreeType */
+    std::unordered_map<uint64_t, int> kerning_cache;
 
     /* We are responsible for closing the font stream */
     FILE* src;
@@ -162,18 +172,6 @@ static int TTF_initialized = 0;
 
 #    define TTF_SetError LOG_ERROR
 
-#    define TTF_CHECKPOINTER(p, errval)                                                                                        \
-        if (!TTF_initialized)                                                                                                  \
-        {                                                                                                                      \
-            TTF_SetError("Library not initialized");                                                                           \
-            return errval;                                                                                                     \
-        }                                                                                                                      \
-        if (!(p))                                                                                                              \
-        {                                                                                                                      \
-            TTF_SetError("Passed a NULL pointer");                                                                             \
-            return errval;                                                                                                     \
-        }
-
 /* Gets the top row of the underline. The outline
 is taken into account.
 */
@@ -389,7 +387,7 @@ static TTF_Font* TTF_OpenFontIndexRW(FILE* src, int freesrc, int ptsize, long in
         return NULL;
     }
 
-    font = static_cast<TTF_Font*>(malloc(sizeof *font));
+    font = new (std::nothrow) TTF_Font{};
     if (font == NULL)
     {
         TTF_SetError("Out of memory");
@@ -399,7 +397,6 @@ static TTF_Font* TTF_OpenFontIndexRW(FILE* src, int freesrc, int ptsize, long in
         }
         return NULL;
     }
-    std::fill_n(reinterpret_cast<uint8_t*>(font), sizeof(*font), 0x00);
 
     font->src = src;
     font->freesrc = freesrc;
@@ -566,16 +563,13 @@ static void Flush_Glyph(c_glyph* glyph)
 
 static void Flush_Cache(TTF_Font* font)
 {
-    int i;
-    int size = sizeof(font->cache) / sizeof(font->cache[0]);
-
-    for (i = 0; i < size; ++i)
+    for (auto& [ch, glyph] : font->glyphs)
     {
-        if (font->cache[i].cached)
-        {
-            Flush_Glyph(&font->cache[i]);
-        }
+        Flush_Glyph(&glyph);
     }
+    font->glyphs.clear();
+    font->kerning_cache.clear();
+    font->current = nullptr;
 }
 
 static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int want)
@@ -971,13 +965,17 @@ static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int wan
 static FT_Error Find_Glyph(TTF_Font* font, uint16_t ch, int want)
 {
     int retval = 0;
-    int hsize = sizeof(font->cache) / sizeof(font->cache[0]);
 
-    int h = ch % hsize;
-    font->current = &font->cache[h];
-
-    if (font->current->cached != ch)
-        Flush_Glyph(font->current);
+    auto it = font->glyphs.find(ch);
+    if (it == font->glyphs.end())
+    {
+        if (font->glyphs.size() >= MAX_CACHED_GLYPHS)
+        {
+            Flush_Cache(font);
+        }
+        it = font->glyphs.emplace(ch, c_glyph{}).first;
+    }
+    font->current = &it->second;
 
     if ((font->current->stored & want) != want)
     {
@@ -986,6 +984,19 @@ static FT_Error Find_Glyph(TTF_Font* font, uint16_t ch, int want)
     return retval;
 }
 
+static int Find_Kerning(TTF_Font* font, FT_UInt prev_index, FT_UInt index)
+{
+    const auto key = (static_cast<uint64_t>(prev_index) << 32) | index;
+    auto it = font->kerning_cache.find(key);
+    if (it == font->kerning_cache.end())
+    {
+        FT_Vector delta;
+        FT_Get_Kerning(font->face, prev_index, index, ft_kerning_default, &delta);
+        it = font->kerning_cache.emplace(key, static_cast<int>(delta.x >> 6)).first;
+    }
+    return it->second;
+}
+
 void TTF_CloseFont(TTF_Font* font)
 {
     if (font)
@@ -1003,7 +1014,7 @@ void TTF_CloseFont(TTF_Font* font)
         {
             fclose(font->src);
         }
-        free(font);
+        delete font;
     }
 }
 
@@ -1127,7 +1138,7 @@ int TTF_GlyphIsProvided(const TTF_Font* font, codepoint_t ch)
     return (FT_Get_Char_Index(font->face, ch));
 }
 
-int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h)
+int TTF_SizeUTF8(TTF_Font* font, std::string_view text, int* w, int* h)
 {
     int status;
     int x, z;
@@ -1138,10 +1149,9 @@ int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h)
     FT_Long use_kerning;
     FT_UInt prev_index = 0;
     int outline_delta = 0;
+    const char* ch = text.data();
     size_t textlen;
 
-    TTF_CHECKPOINTER(text, -1);
-
     /* Initialize everything to 0 */
     status = 0;
     minx = maxx = 0;
@@ -1157,11 +1167,11 @@ int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h)
     }
 
     /* Load each character and sum it's bounding box */
-    textlen = strlen(text);
+    textlen = text.size();
     x = 0;
     while (textlen > 0)
     {
-        uint16_t c = UTF8_getch(&text, &textlen);
+        uint16_t c = UTF8_getch(&ch, &textlen);
         if (c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED)
         {
             continue;
@@ -1178,9 +1188,7 @@ int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h)
         /* handle kerning */
         if (use_kerning && prev_index && glyph->index)
         {
-            FT_Vector delta;
-            FT_Get_Kerning(font->face, prev_index, glyph->index, ft_kerning_default, &delta);
-            x += delta.x >> 6;
+            x += Find_Kerning(font, prev_index, glyph->index);
         }
 
 #    if 0
@@ -1264,7 +1272,7 @@ int TTF_SizeUTF8(TTF_Font* font, const char* text, int* w, int* h)
     return status;
 }
 
-TTFSurface* TTF_RenderUTF8(TTF_Font* font, const char* text, bool shaded)
+TTFSurface* TTF_RenderUTF8(TTF_Font* font, std::string_view text, bool shaded)
 {
     bool first;
     int xstart;
@@ -1281,10 +1289,9 @@ TTFSurface* TTF_RenderUTF8(TTF_Font* font, const char* text, bool shaded)
     FT_Error error;
     FT_Long use_kerning;
     FT_UInt prev_index = 0;
+    const char* ch = text.data();
     size_t textlen;
 
-    TTF_CHECKPOINTER(text, NULL);
-
     /* Get the dimensions of the text surface */
     if ((TTF_SizeUTF8(font, text, &width, &height) < 0) || !width)
     {
@@ -1310,12 +1317,12 @@ TTFSurface* TTF_RenderUTF8(TTF_Font* font, const char* text, bool shaded)
     use_kerning = FT_HAS_KERNING(font->face) && font->kerning;
 
     /* Load and render each character */
-    textlen = strlen(text);
+    textlen = text.size();
     first = true;
     xstart = 0;
     while (textlen > 0)
     {
-        uint16_t c = UTF8_getch(&text, &textlen);
+        uint16_t c = UTF8_getch(&ch, &textlen);
         if (c == UNICODE_BOM_NATIVE || c == UNICODE_BOM_SWAPPED)
         {
             continue;
@@ -1340,9 +1347,7 @@ TTFSurface* TTF_RenderUTF8(TTF_Font* font, const char* text, bool shaded)
         /* do kerning, if possible AC-Patch */
         if (use_kerning && prev_index && glyph->index)
         {
-            FT_Vector delta;
-            FT_Get_Kerning(font->face, prev_index, glyph->index, ft_kerning_default, &delta);
-            xstart += delta.x >> 6;
+            xstart += Find_Kerning(font, prev_index, glyph->index);
         }
         /* Compensate for wrap around bug with negative minx's */
         if (first && (glyph->minx < 0))
@@ -23,8 +23,10 @@
 #include "../interface/Viewport.h"
 #include "../peep/RideUseSystem.h"
 #include "../profiling/Profiling.h"
+#include "../ride/QueueIndex.h"
 #include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
+#include "../world/Park.h"
 #include "Balloon.h"
 #include "Duck.h"
 #include "EntityTweener.h"
@@ -34,6 +36,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <deque>
 #include <iterator>
 #include <numeric>
 #include <vector>
@@ -48,7 +51,11 @@ static bool _entityFlashingList[MAX_ENTITIES];
 constexpr const uint32_t SPATIAL_INDEX_SIZE = (kMaximumMapSizeTechnical * kMaximumMapSizeTechnical) + 1;
 constexpr uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
-static std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
+// The spatial index is sparse: each tile stores the index of its bucket, and buckets are only allocated for tiles that
+// have held an entity. Bucket 0 is always empty and shared by every other tile. Buckets live in a deque so that references
+// handed out by GetEntityTileList stay valid when new buckets are allocated.
+static std::array<uint32_t, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
+static std::deque<std::vector<EntityId>> gEntitySpatialBuckets(1);
 
 static void FreeEntity(EntityBase& entity);
 
@@ -130,7 +137,25 @@ EntityBase* GetEntity(EntityId entityIndex)
 
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
 {
-    return gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)];
+    return gEntitySpatialBuckets[gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)]];
+}
+
+static std::vector<EntityId>& GetOrCreateSpatialBucket(size_t spatialIndex)
+{
+    auto& bucketIndex = gEntitySpatialIndex[spatialIndex];
+    if (bucketIndex == 0)
+    {
+        bucketIndex = static_cast<uint32_t>(gEntitySpatialBuckets.size());
+        gEntitySpatialBuckets.emplace_back();
+    }
+    return gEntitySpatialBuckets[bucketIndex];
+}
+
+static void ReleaseEntitySpatialBuckets()
+{
+    gEntitySpatialIndex.fill(0);
+    gEntitySpatialBuckets.resize(1);
+    gEntitySpatialBuckets.shrink_to_fit();
 }
 
 static void ResetEntityLists()
@@ -180,6 +205,8 @@ void ResetAllEntities()
     std::fill(std::begin(gameState.Entities), std::end(gameState.Entities), Entity_t());
     OpenRCT2::RideUse::GetHistory().Clear();
     OpenRCT2::RideUse::GetTypeHistory().Clear();
+    OpenRCT2::QueueIndex::Reset();
+    OpenRCT2::Park::ResetGuestStatistics();
     for (int32_t i = 0; i < MAX_ENTITIES; ++i)
     {
         auto* spr = GetEntity(EntityId::FromUnderlying(i));
@@ -194,6 +221,7 @@ void ResetAllEntities()
     }
     ResetEntityLists();
     ResetFreeIds();
+    ReleaseEntitySpatialBuckets();
     ResetEntitySpatialIndices();
 }
 
@@ -207,9 +235,10 @@ static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc);
  */
 void ResetEntitySpatialIndices()
 {
-    for (auto& vec : gEntitySpatialIndex)
+    // Buckets are emptied rather than released as callers may still hold a reference to one.
+    for (auto& bucket : gEntitySpatialBuckets)
     {
-        vec.clear();
+        bucket.clear();
     }
     for (EntityId::UnderlyingType i = 0; i < MAX_ENTITIES; i++)
     {
@@ -415,15 +444,14 @@ void UpdateMoneyEffect()
 static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc)
 {
     size_t newIndex = GetSpatialIndexOffset(newLoc);
-    auto& spatialVector = gEntitySpatialIndex[newIndex];
+    auto& spatialVector = GetOrCreateSpatialBucket(newIndex);
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), entity->Id);
     spatialVector.insert(index, entity->Id);
 }
 
-static void EntitySpatialRemove(EntityBase* entity)
+static void EntitySpatialRemove(EntityBase* entity, size_t currentIndex)
 {
-    size_t currentIndex = GetSpatialIndexOffset({ entity->x, entity->y });
-    auto& spatialVector = gEntitySpatialIndex[currentIndex];
+    auto& spatialVector = gEntitySpatialBuckets[gEntitySpatialIndex[currentIndex]];
     auto index = BinaryFind(std::begin(spatialVector), std::end(spatialVector), entity->Id);
     if (index != std::end(spatialVector))
     {
@@ -443,7 +471,7 @@ static void EntitySpatialMove(EntityBase* entity, const CoordsXY& newLoc)
     if (newIndex == currentIndex)
         return;
 
-    EntitySpatialRemove(entity);
+    EntitySpatialRemove(entity, currentIndex);
     EntitySpatialInsert(entity, newLoc);
 }
 
@@ -503,6 +531,7 @@ static void FreeEntity(EntityBase& entity)
         guest->SetName({});
         OpenRCT2::RideUse::GetHistory().RemoveHandle(guest->Id);
         OpenRCT2::RideUse::GetTypeHistory().RemoveHandle(guest->Id);
+        OpenRCT2::QueueIndex::InvalidateGuest(guest->Id);
     }
 }
 
@@ -518,7 +547,7 @@ void EntityRemove(EntityBase* entity)
     RemoveFromEntityList(entity); // remove from existing list
     AddToFreeList(entity->Id);
 
-    EntitySpatialRemove(entity);
+    EntitySpatialRemove(entity, GetSpatialIndexOffset({ entity->x, entity->y }));
     EntityReset(entity);
 }
 
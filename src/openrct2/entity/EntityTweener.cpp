@@ -10,21 +10,107 @@
 
 #include "../entity/Guest.h"
 #include "../entity/Staff.h"
+#include "../interface/Viewport.h"
 #include "../ride/Vehicle.h"
 #include "EntityList.h"
 #include "EntityRegistry.h"
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
+
+// How far outside of a viewport, in screen units at zoom level 0, an entity is still tweened. Tweened positions are
+// rounded to whole map units, which can move the sprite a couple of units off the line between its two positions.
+static constexpr int32_t kTweenViewMargin = 4;
+
+static constexpr uint32_t kNoTweenSlot = std::numeric_limits<uint32_t>::max();
+
+static ScreenRect GetSpriteRect(const EntityBase& entity, const CoordsXYZ& pos, uint8_t rotation)
+{
+    auto screenCoords = Translate3DTo2DWithZ(rotation, pos);
+    return ScreenRect(
+        screenCoords - ScreenCoordsXY{ entity.SpriteData.Width, entity.SpriteData.HeightMin },
+        screenCoords + ScreenCoordsXY{ entity.SpriteData.Width, entity.SpriteData.HeightMax });
+}
+
+static bool AreViewRectsEqual(const std::vector<ScreenRect>& a, const std::vector<ScreenRect>& b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const ScreenRect& rectA, const ScreenRect& rectB) {
+        return rectA.Point1 == rectB.Point1 && rectA.Point2 == rectB.Point2;
+    });
+}
+
+/**
+ * Whether the entity can be seen anywhere between its positions before and after the tick. Every tweened position
+ * lies between the two, so an entity that is not in view can be left where it is without changing what is drawn.
+ */
+bool EntityTweener::IsEntityInView(size_t index) const
+{
+    // Entities joining or leaving the map are tweened from or to nowhere, which can be anywhere on screen
+    if (PrePos[index].x == kLocationNull || PostPos[index].x == kLocationNull)
+        return true;
+
+    const auto& ent = *Entities[index];
+    auto preRect = GetSpriteRect(ent, PrePos[index], ViewRotation);
+    auto postRect = GetSpriteRect(ent, PostPos[index], ViewRotation);
+    auto left = std::min(preRect.GetLeft(), postRect.GetLeft());
+    auto top = std::min(preRect.GetTop(), postRect.GetTop());
+    auto right = std::max(preRect.GetRight(), postRect.GetRight());
+    auto bottom = std::max(preRect.GetBottom(), postRect.GetBottom());
+    for (const auto& viewRect : ViewRects)
+    {
+        if (left < viewRect.GetRight() && right > viewRect.GetLeft() && top < viewRect.GetBottom()
+            && bottom > viewRect.GetTop())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Works out which entities are in view for the current frame. This only changes when the tick moves the entities or
+ * a viewport is scrolled, zoomed, rotated, opened or closed, so between those the previous frame's result is used.
+ */
+void EntityTweener::UpdateInView()
+{
+    auto rotation = GetCurrentRotation();
+    auto canCull = ViewportsGetVisibleViewRects(rotation, kTweenViewMargin, FrameViewRects);
+    if (IsInViewValid && canCull == IsCulled && rotation == ViewRotation && AreViewRectsEqual(FrameViewRects, ViewRects))
+        return;
+
+    IsInViewValid = true;
+    IsCulled = canCull;
+    ViewRotation = rotation;
+    std::swap(ViewRects, FrameViewRects);
+
+    InView.clear();
+    if (!IsCulled)
+        return;
+
+    for (size_t i = 0; i < Entities.size(); ++i)
+    {
+        if (Entities[i] != nullptr && PrePos[i] != PostPos[i] && IsEntityInView(i))
+        {
+            InView.push_back(static_cast<uint32_t>(i));
+        }
+    }
+}
 
 void EntityTweener::AddEntity(EntityBase* entity)
 {
+    EntitySlots[entity->Id.ToUnderlying()] = static_cast<uint32_t>(Entities.size());
     Entities.push_back(entity);
     PrePos.emplace_back(entity->GetLocation());
 }
 
 void EntityTweener::PopulateEntities()
 {
+    if (EntitySlots.empty())
+    {
+        EntitySlots.resize(MAX_ENTITIES, kNoTweenSlot);
+    }
+
     for (auto ent : EntityList<Guest>())
     {
         AddEntity(ent);
@@ -60,49 +146,60 @@ void EntityTweener::PostTick()
             PostPos.emplace_back(ent->GetLocation());
         }
     }
+    IsInViewValid = false;
 }
 
-static bool CanTweenEntity(EntityBase* ent)
+void EntityTweener::RemoveEntity(EntityBase* entity)
 {
-    if (ent->Is<Guest>() || ent->Is<Staff>() || ent->Is<Vehicle>())
-        return true;
-    return false;
+    const auto index = entity->Id.ToUnderlying();
+    if (index >= EntitySlots.size())
+        return;
+
+    auto& slot = EntitySlots[index];
+    if (slot != kNoTweenSlot)
+    {
+        Entities[slot] = nullptr;
+        slot = kNoTweenSlot;
+    }
 }
 
-void EntityTweener::RemoveEntity(EntityBase* entity)
+void EntityTweener::TweenEntity(size_t index, float alpha)
 {
-    if (!CanTweenEntity(entity))
-    {
-        // Only peeps and vehicles are tweened, bail if type is incorrect.
+    auto* ent = Entities[index];
+    if (ent == nullptr)
         return;
-    }
 
-    auto it = std::find(Entities.begin(), Entities.end(), entity);
-    if (it != Entities.end())
-        *it = nullptr;
+    auto& posA = PrePos[index];
+    auto& posB = PostPos[index];
+
+    if (posA == posB)
+        return;
+
+    const float inv = (1.0f - alpha);
+    EntitySetCoordinates(
+        { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
+          static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
+          static_cast<int32_t>(std::round(posB.z * alpha + posA.z * inv)) },
+        ent);
+    ent->Invalidate();
 }
 
 void EntityTweener::Tween(float alpha)
 {
-    const float inv = (1.0f - alpha);
-    for (size_t i = 0; i < Entities.size(); ++i)
+    UpdateInView();
+    if (IsCulled)
     {
-        auto* ent = Entities[i];
-        if (ent == nullptr)
-            continue;
-
-        auto& posA = PrePos[i];
-        auto& posB = PostPos[i];
-
-        if (posA == posB)
-            continue;
-
-        EntitySetCoordinates(
-            { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
-              static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
-              static_cast<int32_t>(std::round(posB.z * alpha + posA.z * inv)) },
-            ent);
-        ent->Invalidate();
+        for (auto index : InView)
+        {
+            TweenEntity(index, alpha);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < Entities.size(); ++i)
+        {
+            TweenEntity(i, alpha);
+        }
     }
 }
 
@@ -114,6 +211,10 @@ void EntityTweener::Restore()
         if (ent == nullptr)
             continue;
 
+        // Only entities that were in view on some frame have been moved
+        if (ent->GetLocation() == PostPos[i])
+            continue;
+
         EntitySetCoordinates(PostPos[i], ent);
         ent->Invalidate();
     }
@@ -121,9 +222,18 @@ void EntityTweener::Restore()
 
 void EntityTweener::Reset()
 {
+    for (auto* ent : Entities)
+    {
+        if (ent != nullptr)
+        {
+            EntitySlots[ent->Id.ToUnderlying()] = kNoTweenSlot;
+        }
+    }
     Entities.clear();
     PrePos.clear();
     PostPos.clear();
+    InView.clear();
+    IsInViewValid = false;
 }
 
 static EntityTweener tweener;
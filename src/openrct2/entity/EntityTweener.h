@@ -19,9 +19,24 @@ class EntityTweener
     std::vector<CoordsXYZ> PrePos;
     std::vector<CoordsXYZ> PostPos;
 
+    // Position of each entity in Entities by entity id, so that entities can be removed in constant time.
+    std::vector<uint32_t> EntitySlots;
+
+    // Indices into Entities of those in view, which are the only ones that need tweening, and the areas shown by the
+    // visible viewports they were found with. When a viewport is shown at another rotation, every entity is tweened.
+    std::vector<uint32_t> InView;
+    std::vector<ScreenRect> ViewRects;
+    std::vector<ScreenRect> FrameViewRects;
+    uint8_t ViewRotation{};
+    bool IsCulled{};
+    bool IsInViewValid{};
+
 private:
     void PopulateEntities();
     void AddEntity(EntityBase* entity);
+    bool IsEntityInView(size_t index) const;
+    void UpdateInView();
+    void TweenEntity(size_t index, float alpha);
 
 public:
     static EntityTweener& Get();
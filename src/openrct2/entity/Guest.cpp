@@ -40,6 +40,7 @@
 #include "../peep/PeepThoughts.h"
 #include "../peep/RideUseSystem.h"
 #include "../rct2/RCT2.h"
+#include "../ride/QueueIndex.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
@@ -628,7 +629,7 @@ void Guest::HandleEasterEggName()
 
     if (CheckEasterEggName(EASTEREGG_PEEP_NAME_MELANIE_WARN))
     {
-        Happiness = 250;
+        SetHappiness(250);
         HappinessTarget = 250;
         Energy = 127;
         EnergyTarget = 127;
@@ -680,7 +681,7 @@ void Guest::HandleEasterEggName()
 
     if (CheckEasterEggName(EASTEREGG_PEEP_NAME_KATIE_RODGER))
     {
-        PeepFlags |= PEEP_FLAGS_LEAVING_PARK;
+        SetPeepFlags(PeepFlags | PEEP_FLAGS_LEAVING_PARK);
         PeepFlags &= ~PEEP_FLAGS_PARK_ENTRANCE_CHOSEN;
     }
 
@@ -788,6 +789,38 @@ void Guest::UpdateMotivesIdle()
     }
 }
 
+/**
+ * Moves energy two or four steps towards its target. Matches the original byte arithmetic exactly, including the
+ * wrap around when energy is below two.
+ */
+static constexpr uint8_t StepEnergyTowardsTarget(uint8_t energy, uint8_t target)
+{
+    uint8_t newEnergy;
+    if (energy >= target)
+    {
+        newEnergy = energy - 2;
+        newEnergy = newEnergy < target ? target : newEnergy;
+    }
+    else
+    {
+        newEnergy = std::min<uint16_t>(kPeepMaxEnergyTarget, energy + 4);
+        newEnergy = newEnergy > target ? target : newEnergy;
+    }
+
+    /* Previous code here suggested maximum energy is 128. */
+    return std::clamp(newEnergy, kPeepMinEnergy, kPeepMaxEnergy);
+}
+
+/**
+ * Moves happiness or nausea four steps towards its target without overshooting it.
+ */
+static constexpr uint8_t StepMotiveTowardsTarget(uint8_t value, uint8_t target)
+{
+    if (value >= target)
+        return static_cast<uint8_t>(std::max<int32_t>(value - 4, target));
+    return static_cast<uint8_t>(std::min<int32_t>(value + 4, target));
+}
+
 /* rct2: 0x0068FA89*/
 void Guest::UpdateConsumptionMotives()
 {
@@ -831,66 +864,21 @@ void Guest::UpdateConsumptionMotives()
         }
     }
 
-    uint8_t newEnergy = Energy;
-    uint8_t newTargetEnergy = EnergyTarget;
-    if (newEnergy >= newTargetEnergy)
-    {
-        newEnergy -= 2;
-        if (newEnergy < newTargetEnergy)
-            newEnergy = newTargetEnergy;
-    }
-    else
-    {
-        newEnergy = std::min<uint16_t>(kPeepMaxEnergyTarget, newEnergy + 4);
-        if (newEnergy > newTargetEnergy)
-            newEnergy = newTargetEnergy;
-    }
-
-    /* Previous code here suggested maximum energy is 128. */
-    newEnergy = std::clamp(newEnergy, kPeepMinEnergy, kPeepMaxEnergy);
-
+    auto newEnergy = StepEnergyTowardsTarget(Energy, EnergyTarget);
     if (newEnergy != Energy)
     {
         Energy = newEnergy;
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
     }
 
-    uint8_t newHappiness = Happiness;
-    uint8_t newHappinessGrowth = HappinessTarget;
-    if (newHappiness >= newHappinessGrowth)
-    {
-        newHappiness = std::max(newHappiness - 4, 0);
-        if (newHappiness < newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-    else
-    {
-        newHappiness = std::min(255, newHappiness + 4);
-        if (newHappiness > newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-
+    auto newHappiness = StepMotiveTowardsTarget(Happiness, HappinessTarget);
     if (newHappiness != Happiness)
     {
-        Happiness = newHappiness;
+        SetHappiness(newHappiness);
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
     }
 
-    uint8_t newNausea = Nausea;
-    uint8_t newNauseaGrowth = NauseaTarget;
-    if (newNausea >= newNauseaGrowth)
-    {
-        newNausea = std::max(newNausea - 4, 0);
-        if (newNausea < newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-    else
-    {
-        newNausea = std::min(255, newNausea + 4);
-        if (newNausea > newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-
+    auto newNausea = StepMotiveTowardsTarget(Nausea, NauseaTarget);
     if (newNausea != Nausea)
     {
         Nausea = newNausea;
@@ -1433,7 +1421,7 @@ void Guest::CheckCantFindRide()
         HappinessTarget = std::max(HappinessTarget - 30, 0);
     }
 
-    GuestIsLostCountdown--;
+    SetLostCountdown(GuestIsLostCountdown - 1);
     if (GuestIsLostCountdown != 0)
         return;
 
@@ -1465,8 +1453,9 @@ void Guest::CheckCantFindExit()
         HappinessTarget = std::max(HappinessTarget - 30, 0);
     }
 
-    if (--GuestIsLostCountdown == 0)
-        GuestIsLostCountdown = 90;
+    SetLostCountdown(GuestIsLostCountdown - 1);
+    if (GuestIsLostCountdown == 0)
+        SetLostCountdown(90);
 }
 
 /** Main logic to decide whether a peep should buy an item in question
@@ -1608,7 +1597,7 @@ bool Guest::DecideAndBuyItem(Ride& ride, const ShopItem shopItem, money64 price)
 
             int32_t happinessGrowth = itemValue * 4;
             HappinessTarget = std::min((HappinessTarget + happinessGrowth), kPeepMaxHappiness);
-            Happiness = std::min((Happiness + happinessGrowth), kPeepMaxHappiness);
+            SetHappiness(std::min((Happiness + happinessGrowth), kPeepMaxHappiness));
         }
 
         // reset itemValue for satisfaction calculation
@@ -1782,7 +1771,7 @@ void Guest::OnExitRide(Ride& ride)
     if (PeepShouldGoOnRideAgain(this, ride))
     {
         GuestHeadingToRideId = ride.id;
-        GuestIsLostCountdown = 200;
+        SetLostCountdown(200);
         ResetPathfindGoal();
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_ACTION;
     }
@@ -1837,7 +1826,7 @@ void Guest::PickRideToGoOn()
     {
         // Head to that ride
         GuestHeadingToRideId = ride->id;
-        GuestIsLostCountdown = 200;
+        SetLostCountdown(200);
         ResetPathfindGoal();
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_ACTION;
 
@@ -2360,6 +2349,34 @@ int32_t Guest::GetParkEntryTime() const
     return ParkEntryTime;
 }
 
+void Guest::SetHappiness(uint8_t value)
+{
+    const auto before = Park::GetGuestStatistics(*this);
+    Happiness = value;
+    Park::OnGuestStatisticsChanged(before, Park::GetGuestStatistics(*this));
+}
+
+void Guest::SetLostCountdown(uint8_t value)
+{
+    const auto before = Park::GetGuestStatistics(*this);
+    GuestIsLostCountdown = value;
+    Park::OnGuestStatisticsChanged(before, Park::GetGuestStatistics(*this));
+}
+
+void Guest::SetOutsideOfPark(bool value)
+{
+    const auto before = Park::GetGuestStatistics(*this);
+    OutsideOfPark = value;
+    Park::OnGuestStatisticsChanged(before, Park::GetGuestStatistics(*this));
+}
+
+void Guest::SetPeepFlags(uint32_t value)
+{
+    const auto before = Park::GetGuestStatistics(*this);
+    PeepFlags = value;
+    Park::OnGuestStatisticsChanged(before, Park::GetGuestStatistics(*this));
+}
+
 bool Guest::ShouldRideWhileRaining(const Ride& ride)
 {
     // Peeps will go on rides that are sufficiently undercover while it's raining.
@@ -3122,8 +3139,8 @@ static void PeepLeavePark(Guest* peep)
     }
     else
     {
-        peep->GuestIsLostCountdown = 254;
-        peep->PeepFlags |= PEEP_FLAGS_LEAVING_PARK;
+        peep->SetLostCountdown(254);
+        peep->SetPeepFlags(peep->PeepFlags | PEEP_FLAGS_LEAVING_PARK);
         peep->PeepFlags &= ~PEEP_FLAGS_PARK_ENTRANCE_CHOSEN;
     }
 
@@ -3234,7 +3251,7 @@ template<typename T> static void PeepHeadForNearestRide(Guest* peep, bool consid
     {
         // Head to that ride
         peep->GuestHeadingToRideId = closestRide->id;
-        peep->GuestIsLostCountdown = 200;
+        peep->SetLostCountdown(200);
         peep->ResetPathfindGoal();
         peep->WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_ACTION;
         peep->TimeLost = 0;
@@ -5723,7 +5740,7 @@ void Guest::UpdateEnteringPark()
     }
     SetState(PeepState::Falling);
 
-    OutsideOfPark = false;
+    SetOutsideOfPark(false);
     ParkEntryTime = GetGameState().CurrentTicks;
     IncrementGuestsInPark();
     DecrementGuestsHeadingForPark();
@@ -5753,7 +5770,7 @@ void Guest::UpdateLeavingPark()
         return;
     }
 
-    OutsideOfPark = true;
+    SetOutsideOfPark(true);
     DestinationTolerance = 5;
     DecrementGuestsInPark();
     auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
@@ -7494,6 +7511,23 @@ void Guest::RemoveFromQueue()
     if (Id == station.LastPeepInQueue)
     {
         station.LastPeepInQueue = GuestNextInQueue;
+        QueueIndex::OnGuestLeft(*ride, CurrentRideStation, *this);
+        return;
+    }
+
+    EntityId guestBehindId;
+    if (QueueIndex::GetGuestBehind(*ride, CurrentRideStation, *this, guestBehindId))
+    {
+        auto* guestBehind = GetEntity<Guest>(guestBehindId);
+        if (guestBehind != nullptr)
+        {
+            guestBehind->GuestNextInQueue = GuestNextInQueue;
+            QueueIndex::OnGuestLeft(*ride, CurrentRideStation, *this);
+        }
+        else if (station.LastPeepInQueue.IsNull())
+        {
+            LOG_ERROR("Invalid Guest Queue list!");
+        }
         return;
     }
 
@@ -350,6 +350,11 @@ public:
     bool HasRiddenRideType(int32_t rideType) const;
     void SetParkEntryTime(int32_t entryTime);
     int32_t GetParkEntryTime() const;
+    // Change state the park rating counts guests by, keeping the counts up to date
+    void SetHappiness(uint8_t value);
+    void SetLostCountdown(uint8_t value);
+    void SetOutsideOfPark(bool value);
+    void SetPeepFlags(uint32_t value);
     void CheckIfLost();
     void CheckCantFindRide();
     void CheckCantFindExit();
@@ -40,6 +40,7 @@
 #include "../peep/PeepSpriteIds.h"
 #include "../peep/RealNames.h"
 #include "../profiling/Profiling.h"
+#include "../ride/QueueIndex.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/ShopItem.h"
@@ -696,6 +697,7 @@ void PeepEntityRemove(Peep* peep)
     if (guest != nullptr)
     {
         guest->RemoveFromRide();
+        Park::OnGuestStatisticsChanged(Park::GetGuestStatistics(*guest), {});
     }
     peep->Invalidate();
 
@@ -1822,6 +1824,7 @@ static bool PeepInteractWithEntrance(Peep* peep, const CoordsXYE& coords, uint8_
         station.LastPeepInQueue = guest->Id;
         guest->GuestNextInQueue = previous_last;
         station.QueueLength++;
+        QueueIndex::OnGuestJoinedBack(*ride, stationNum, *guest, previous_last);
 
         guest->CurrentRide = rideIndex;
         guest->CurrentRideStation = stationNum;
@@ -2249,6 +2252,7 @@ static void PeepInteractWithPath(Peep* peep, const CoordsXYE& coords)
                     station.LastPeepInQueue = guest->Id;
                     guest->GuestNextInQueue = old_last_peep;
                     station.QueueLength++;
+                    QueueIndex::OnGuestJoinedBack(*ride, stationNum, *guest, old_last_peep);
 
                     PeepDecrementNumRiders(guest);
                     guest->CurrentRide = rideIndex;
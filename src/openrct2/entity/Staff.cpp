@@ -71,6 +71,9 @@ const StringId StaffCostumeNames[] = {
 // Maximum manhattan distance that litter can be for a handyman to seek to it
 const uint16_t MAX_LITTER_DISTANCE = 3 * kCoordsXYStep;
 
+// With fewer pieces of litter in the park it is cheaper to check all of them than the tiles around the handyman
+static constexpr uint16_t kNearestLitterTileSearchThreshold = 256;
+
 template<> bool EntityBase::Is<Staff>() const
 {
     return Type == EntityType::Staff;
@@ -329,20 +332,74 @@ bool Staff::HasPatrolArea() const
  *
  * Returns INVALID_DIRECTION when no nearby litter or unpathable litter
  */
-Direction Staff::HandymanDirectionToNearestLitter() const
+static uint16_t GetLitterDistance(const Litter& litter, const CoordsXYZ& loc)
+{
+    return abs(litter.x - loc.x) + abs(litter.y - loc.y) + abs(litter.z - loc.z) * 4;
+}
+
+/**
+ * The distance is kept in 16 bits, which on very large maps wraps around for litter far away. On those maps any
+ * litter could be the nearest so all of it has to be checked.
+ */
+static bool CanLitterDistanceWrap()
 {
-    uint16_t nearestLitterDist = 0xFFFF;
+    // Tile element heights are 8 bit and entities never go above the highest one
+    constexpr int32_t kMaxHeightDistance = (std::numeric_limits<uint8_t>::max() + 1) * kCoordsZStep * 4;
+
+    const auto& mapSize = GetGameState().MapSize;
+    return (mapSize.x + mapSize.y) * kCoordsXYStep + kMaxHeightDistance > std::numeric_limits<uint16_t>::max();
+}
+
+/**
+ * Finds the litter with the lowest distance, preferring the lowest entity id like the entity list does. Only litter
+ * within MAX_LITTER_DISTANCE is of interest, so in parks with a lot of litter only the tiles in that range are searched.
+ */
+static Litter* FindNearestLitter(const CoordsXYZ& loc, uint16_t& nearestLitterDist)
+{
+    nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
-    for (auto litter : EntityList<Litter>())
+    if (GetEntityListCount(EntityType::Litter) < kNearestLitterTileSearchThreshold || CanLitterDistanceWrap())
     {
-        uint16_t distance = abs(litter->x - x) + abs(litter->y - y) + abs(litter->z - z) * 4;
+        for (auto litter : EntityList<Litter>())
+        {
+            uint16_t distance = GetLitterDistance(*litter, loc);
+            if (distance < nearestLitterDist)
+            {
+                nearestLitterDist = distance;
+                nearestLitter = litter;
+            }
+        }
+        return nearestLitter;
+    }
 
-        if (distance < nearestLitterDist)
+    // Litter is always on the map, so the search is limited to it
+    const auto left = std::max(loc.x - MAX_LITTER_DISTANCE, 0);
+    const auto right = std::min(loc.x + MAX_LITTER_DISTANCE, MAXIMUM_MAP_SIZE_BIG - 1);
+    const auto top = std::max(loc.y - MAX_LITTER_DISTANCE, 0);
+    const auto bottom = std::min(loc.y + MAX_LITTER_DISTANCE, MAXIMUM_MAP_SIZE_BIG - 1);
+    for (auto tileX = left / kCoordsXYStep; tileX <= right / kCoordsXYStep; tileX++)
+    {
+        for (auto tileY = top / kCoordsXYStep; tileY <= bottom / kCoordsXYStep; tileY++)
         {
-            nearestLitterDist = distance;
-            nearestLitter = litter;
+            for (auto litter : EntityTileList<Litter>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+            {
+                uint16_t distance = GetLitterDistance(*litter, loc);
+                if (distance < nearestLitterDist
+                    || (distance == nearestLitterDist && nearestLitter != nullptr && litter->Id < nearestLitter->Id))
+                {
+                    nearestLitterDist = distance;
+                    nearestLitter = litter;
+                }
+            }
         }
     }
+    return nearestLitter;
+}
+
+Direction Staff::HandymanDirectionToNearestLitter() const
+{
+    uint16_t nearestLitterDist;
+    Litter* nearestLitter = FindNearestLitter(GetLocation(), nearestLitterDist);
 
     if (nearestLitterDist > MAX_LITTER_DISTANCE)
     {
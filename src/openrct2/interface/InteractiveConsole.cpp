@@ -63,6 +63,7 @@
 #include "../world/Scenery.h"
 #include "Viewport.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstdarg>
@@ -77,6 +78,10 @@
 #    include "../drawing/TTF.h"
 #endif
 
+#ifdef ENABLE_SCRIPTING
+#    include "../scripting/ScriptEngine.h"
+#endif
+
 using namespace OpenRCT2;
 
 using arguments_t = std::vector<std::string>;
@@ -1919,6 +1924,67 @@ static int32_t ConsoleCommandProfilerStop(
     return 0;
 }
 
+static int32_t ConsoleCommandProfilerHooks(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+#ifdef ENABLE_SCRIPTING
+    auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
+    if (argv.size() >= 1 && argv[0] == "reset")
+    {
+        hookEngine.ResetStats();
+        return 0;
+    }
+
+    // List the most expensive hooks first
+    std::vector<std::pair<const Scripting::HookStatsMap::key_type*, const Scripting::HookStats*>> rows;
+    for (const auto& [key, stats] : hookEngine.GetStats())
+    {
+        if (stats.CallCount != 0 || stats.ThrottledCount != 0)
+        {
+            rows.emplace_back(&key, &stats);
+        }
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+        return a.second->TotalTimeUs > b.second->TotalTimeUs;
+    });
+
+    console.WriteFormatLine(
+        "%-32s %-24s %10s %12s %10s %10s %10s", "Plugin", "Hook", "Calls", "Total (ms)", "Avg (us)", "Max (us)", "Throttled");
+    for (const auto& [key, stats] : rows)
+    {
+        const auto hookName = std::string(Scripting::GetHookName(key->second));
+        const auto avgTimeUs = stats->CallCount != 0 ? stats->TotalTimeUs / stats->CallCount : 0.0;
+        console.WriteFormatLine(
+            "%-32s %-24s %10llu %12.2f %10.1f %10.1f %10llu", key->first.c_str(), hookName.c_str(),
+            static_cast<unsigned long long>(stats->CallCount), stats->TotalTimeUs / 1000.0, avgTimeUs, stats->MaxTimeUs,
+            static_cast<unsigned long long>(stats->ThrottledCount));
+    }
+#else
+    console.WriteLineError("Plugins are not supported by this build.");
+#endif
+    return 0;
+}
+
+static int32_t ConsoleCommandBreakdownStats(InteractiveConsole& console, const arguments_t& argv)
+{
+    if (argv.size() >= 1 && argv[0] == "reset")
+    {
+        RideResetBreakdownResponseStats();
+        return 0;
+    }
+
+    const auto& stats = RideGetBreakdownResponseStats();
+    const auto avgTicksToAnswer = stats.NumAnswered != 0 ? stats.TotalTicksToAnswer / stats.NumAnswered : 0;
+    const auto avgTicksToFix = stats.NumFixed != 0 ? stats.TotalTicksToFix / stats.NumFixed : 0;
+    console.WriteFormatLine("%-24s %10s %14s %14s", "", "Count", "Avg (ticks)", "Max (ticks)");
+    console.WriteFormatLine(
+        "%-24s %10u %14llu %14u", "Mechanic sent", stats.NumAnswered, static_cast<unsigned long long>(avgTicksToAnswer),
+        stats.MaxTicksToAnswer);
+    console.WriteFormatLine(
+        "%-24s %10u %14llu %14u", "Breakdown fixed", stats.NumFixed, static_cast<unsigned long long>(avgTicksToFix),
+        stats.MaxTicksToFix);
+    return 0;
+}
+
 static int32_t ConsoleSpawnBalloon(InteractiveConsole& console, const arguments_t& argv)
 {
     if (argv.size() < 3)
@@ -2047,6 +2113,10 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "profiler_stop", ConsoleCommandProfilerStop, "Stops the profiler.", "profiler_stop [<output file>]" },
     { "profiler_exportcsv", ConsoleCommandProfilerExportCSV, "Exports the current profiler data.",
       "profiler_exportcsv <output file>" },
+    { "profiler_hooks", ConsoleCommandProfilerHooks, "Lists the time each plugin has spent in its hooks.",
+      "profiler_hooks [reset]" },
+    { "breakdown_stats", ConsoleCommandBreakdownStats,
+      "Shows how long broken down rides have waited for a mechanic to be sent and to fix them.", "breakdown_stats [reset]" },
 };
 
 static int32_t ConsoleCommandWindows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
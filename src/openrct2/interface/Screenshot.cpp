@@ -35,9 +35,11 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <array>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
@@ -52,6 +54,9 @@ extern uint8_t gClipHeight;
 
 uint8_t gScreenshotCountdown = 0;
 
+// Number of rows rendered at once when writing a viewport straight to file
+static constexpr int32_t kScreenshotBandHeight = 256;
+
 static bool WriteDpiToFile(std::string_view path, const DrawPixelInfo& dpi, const GamePalette& palette)
 {
     auto const pixels8 = dpi.bits;
@@ -257,34 +262,6 @@ static int32_t GetTallestVisibleTileTop(
     return minViewY - 64;
 }
 
-static DrawPixelInfo CreateDPI(const Viewport& viewport)
-{
-    DrawPixelInfo dpi;
-    dpi.width = viewport.width;
-    dpi.height = viewport.height;
-    dpi.bits = new (std::nothrow) uint8_t[dpi.width * dpi.height];
-    if (dpi.bits == nullptr)
-    {
-        throw std::runtime_error("Giant screenshot failed, unable to allocate memory for image.");
-    }
-
-    if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
-    {
-        std::memset(dpi.bits, PALETTE_INDEX_0, static_cast<size_t>(dpi.width) * dpi.height);
-    }
-
-    return dpi;
-}
-
-static void ReleaseDPI(DrawPixelInfo& dpi)
-{
-    if (dpi.bits != nullptr)
-        delete[] dpi.bits;
-    dpi.bits = nullptr;
-    dpi.width = 0;
-    dpi.height = 0;
-}
-
 static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
 {
     auto& gameState = GetGameState();
@@ -337,24 +314,81 @@ static Viewport GetGiantViewport(int32_t rotation, ZoomLevel zoom)
     return viewport;
 }
 
-static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewport, DrawPixelInfo& dpi)
+/**
+ * Renders a viewport straight into a PNG a band of rows at a time, so memory use is bounded by the width of the image
+ * rather than its area. The next band is rendered on a worker thread while the previous one is being compressed.
+ */
+static bool WriteViewportToFile(std::string_view path, const Viewport& viewport, const GamePalette& palette)
 {
-    // Ensure sprites appear regardless of rotation
-    ResetAllSpriteQuadrantPlacements();
+    try
+    {
+        // Ensure sprites appear regardless of rotation
+        ResetAllSpriteQuadrantPlacements();
+
+        auto drawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+        const auto stride = static_cast<size_t>(viewport.width);
+        std::array<std::vector<uint8_t>, 2> bands;
+        for (auto& band : bands)
+        {
+            band.resize(stride * kScreenshotBandHeight);
+        }
 
-    std::unique_ptr<X8DrawingEngine> tempDrawingEngine;
-    if (drawingEngine == nullptr)
+        auto renderBand = [&](int32_t top, std::vector<uint8_t>& band) {
+            if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+            {
+                std::fill(band.begin(), band.end(), PALETTE_INDEX_0);
+            }
+
+            DrawPixelInfo dpi;
+            dpi.DrawingEngine = drawingEngine.get();
+            dpi.bits = band.data();
+            dpi.x = 0;
+            dpi.y = top;
+            dpi.width = viewport.width;
+            dpi.height = std::min(kScreenshotBandHeight, viewport.height - top);
+            ViewportRender(dpi, &viewport, { { 0, top }, { viewport.width, top + dpi.height } });
+        };
+
+        // Only one band is ever being painted at a time, the viewport painter is not reentrant.
+        auto pendingBand = std::async(std::launch::async, renderBand, 0, std::ref(bands[0]));
+        int32_t currentBand = -1;
+
+        Image image;
+        image.Width = viewport.width;
+        image.Height = viewport.height;
+        image.Depth = 8;
+        image.Stride = viewport.width;
+        image.Palette = std::make_unique<GamePalette>(palette);
+        Imaging::WriteToFile(
+            path, image,
+            [&](uint32_t y) -> const uint8_t* {
+                const auto bandIndex = static_cast<int32_t>(y / kScreenshotBandHeight);
+                if (bandIndex != currentBand)
+                {
+                    pendingBand.get();
+                    currentBand = bandIndex;
+
+                    const auto nextTop = (bandIndex + 1) * kScreenshotBandHeight;
+                    if (nextTop < viewport.height)
+                    {
+                        pendingBand = std::async(
+                            std::launch::async, renderBand, nextTop, std::ref(bands[(bandIndex + 1) % 2]));
+                    }
+                }
+                return bands[bandIndex % 2].data() + (y % kScreenshotBandHeight) * stride;
+            },
+            IMAGE_FORMAT::PNG);
+        return true;
+    }
+    catch (const std::exception& e)
     {
-        tempDrawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
-        drawingEngine = tempDrawingEngine.get();
+        LOG_ERROR("Unable to write png: %s", e.what());
+        return false;
     }
-    dpi.DrawingEngine = drawingEngine;
-    ViewportRender(dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } });
 }
 
 void ScreenshotGiant()
 {
-    DrawPixelInfo dpi{};
     try
     {
         auto path = ScreenshotGetNextPath();
@@ -382,10 +416,10 @@ void ScreenshotGiant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path.value(), dpi, gPalette);
+        if (!WriteViewportToFile(path.value(), viewport, gPalette))
+        {
+            throw std::runtime_error("Giant screenshot failed, unable to write image.");
+        }
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -399,8 +433,6 @@ void ScreenshotGiant()
         LOG_ERROR("%s", e.what());
         ContextShowError(STR_SCREENSHOT_FAILED, STR_NONE, {}, true);
     }
-
-    ReleaseDPI(dpi);
 }
 
 static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
@@ -473,7 +505,6 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
     }
 
     int32_t exitCode = 1;
-    DrawPixelInfo dpi;
     try
     {
         bool customLocation = false;
@@ -575,17 +606,16 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
 
         ApplyOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, dpi, gPalette);
+        if (!WriteViewportToFile(outputPath, viewport, gPalette))
+        {
+            exitCode = -1;
+        }
     }
     catch (const std::exception& e)
     {
         std::printf("%s\n", e.what());
         exitCode = -1;
     }
-    ReleaseDPI(dpi);
 
     DrawingEngineDispose();
 
@@ -670,8 +700,5 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto dpi = CreateDPI(viewport);
-    RenderViewport(nullptr, viewport, dpi);
-    WriteDpiToFile(outputPath, dpi, gPalette);
-    ReleaseDPI(dpi);
+    WriteViewportToFile(outputPath, viewport, gPalette);
 }
@@ -1828,13 +1828,8 @@ InteractionInfo GetMapCoordinatesFromPosWindow(WindowBase* window, const ScreenC
     return info;
 }
 
-/**
- * screenRect represents 2D map coordinates at zoom 0.
- */
-void ViewportInvalidate(const Viewport* viewport, const ScreenRect& screenRect)
+static bool ViewportIsVisible(const Viewport* viewport)
 {
-    PROFILED_FUNCTION();
-
     // if unknown viewport visibility, use the containing window to discover the status
     if (viewport->visibility == VisibilityCache::Unknown)
     {
@@ -1845,14 +1840,16 @@ void ViewportInvalidate(const Viewport* viewport, const ScreenRect& screenRect)
             // note, window_is_visible will update viewport->visibility, so this should have a low hit count
             if (!WindowIsVisible(*owner))
             {
-                return;
+                return false;
             }
         }
     }
 
-    if (viewport->visibility == VisibilityCache::Covered)
-        return;
+    return viewport->visibility != VisibilityCache::Covered;
+}
 
+static void ViewportInvalidateVisible(const Viewport* viewport, const ScreenRect& screenRect)
+{
     auto [topLeft, bottomRight] = screenRect;
     const auto [viewportRight, viewportBottom] = viewport->viewPos
         + ScreenCoordsXY{ viewport->view_width, viewport->view_height };
@@ -1873,6 +1870,73 @@ void ViewportInvalidate(const Viewport* viewport, const ScreenRect& screenRect)
     }
 }
 
+/**
+ * screenRect represents 2D map coordinates at zoom 0.
+ */
+void ViewportInvalidate(const Viewport* viewport, const ScreenRect& screenRect)
+{
+    PROFILED_FUNCTION();
+
+    if (ViewportIsVisible(viewport))
+    {
+        ViewportInvalidateVisible(viewport, screenRect);
+    }
+}
+
+/**
+ * Gets the area shown by each visible viewport in screen coordinates at zoom level 0, grown by the given margin.
+ * @returns false when a visible viewport is shown at another rotation, as its area is not in the same coordinates.
+ */
+bool ViewportsGetVisibleViewRects(uint8_t rotation, int32_t margin, std::vector<ScreenRect>& viewRects)
+{
+    viewRects.clear();
+    for (auto& vp : _viewports)
+    {
+        if (!ViewportIsVisible(&vp))
+            continue;
+        if (vp.rotation != rotation)
+            return false;
+
+        viewRects.emplace_back(
+            vp.viewPos - ScreenCoordsXY{ margin, margin },
+            vp.viewPos + ScreenCoordsXY{ vp.view_width + margin, vp.view_height + margin });
+    }
+    return true;
+}
+
+/**
+ * Invalidates a batch of tiles, equivalent to calling ViewportsInvalidate for each of them. Visibility is only
+ * resolved once per viewport and tiles outside of a viewport's view are skipped.
+ */
+void ViewportsInvalidateTiles(std::span<const CoordsXYRangedZ> tiles, ZoomLevel maxZoom)
+{
+    PROFILED_FUNCTION();
+
+    if (tiles.empty())
+        return;
+
+    for (auto& vp : _viewports)
+    {
+        if (maxZoom != ZoomLevel{ -1 } && vp.zoom > ZoomLevel{ maxZoom })
+            continue;
+        if (!ViewportIsVisible(&vp))
+            continue;
+
+        const auto viewRight = vp.viewPos.x + vp.view_width;
+        const auto viewBottom = vp.viewPos.y + vp.view_height;
+        for (const auto& tile : tiles)
+        {
+            auto screenCoord = Translate3DTo2DWithZ(vp.rotation, CoordsXYZ{ tile.x + 16, tile.y + 16, 0 });
+            auto screenRect = ScreenRect{ { screenCoord.x - 32, screenCoord.y - 32 - tile.clearanceZ },
+                                          { screenCoord.x + 32, screenCoord.y + 32 - tile.baseZ } };
+            if (screenRect.GetLeft() >= viewRight || screenRect.GetTop() >= viewBottom)
+                continue;
+
+            ViewportInvalidateVisible(&vp, screenRect);
+        }
+    }
+}
+
 static Viewport* ViewportFindFromPoint(const ScreenCoordsXY& screenCoords)
 {
     WindowBase* w = WindowFindFromPoint(screenCoords);
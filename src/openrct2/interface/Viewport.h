@@ -14,6 +14,7 @@
 
 #include <limits>
 #include <optional>
+#include <span>
 #include <vector>
 
 struct PaintSession;
@@ -136,6 +137,8 @@ void ViewportRemove(Viewport* viewport);
 void ViewportsInvalidate(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom);
 void ViewportsInvalidate(const CoordsXYZ& pos, int32_t width, int32_t minHeight, int32_t maxHeight, ZoomLevel maxZoom);
 void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom = ZoomLevel{ -1 });
+void ViewportsInvalidateTiles(std::span<const CoordsXYRangedZ> tiles, ZoomLevel maxZoom);
+bool ViewportsGetVisibleViewRects(uint8_t rotation, int32_t margin, std::vector<ScreenRect>& viewRects);
 void ViewportUpdatePosition(WindowBase* window);
 void ViewportUpdateSmartFollowGuest(WindowBase* window, const Guest& peep);
 void ViewportRotateSingle(WindowBase* window, int32_t direction);
@@ -9,6 +9,7 @@
 
 #include "Formatting.h"
 
+#include "../Context.h"
 #include "../Diagnostic.h"
 #include "../config/Config.h"
 #include "../peep/RealNames.h"
@@ -17,6 +18,7 @@
 #include "FormatCodes.h"
 #include "Formatter.h"
 #include "Localisation.Date.h"
+#include "LocalisationService.h"
 #include "StringIds.h"
 
 #include <cmath>
@@ -91,8 +93,22 @@ namespace OpenRCT2
         update();
     }
 
+    FmtString::iterator::iterator(std::span<const Token> t, size_t i)
+        : index(i)
+        , tokens(t.data())
+        , numTokens(t.size())
+    {
+        update();
+    }
+
     void FmtString::iterator::update()
     {
+        if (tokens != nullptr)
+        {
+            current = index < numTokens ? tokens[index] : Token();
+            return;
+        }
+
         auto i = index;
         if (i >= str.size())
         {
@@ -208,9 +224,9 @@ namespace OpenRCT2
 
     FmtString::iterator& FmtString::iterator::operator++()
     {
-        if (index < str.size())
+        if (!eol())
         {
-            index += current.text.size();
+            index += tokens != nullptr ? 1 : current.text.size();
             update();
         }
         return *this;
@@ -219,17 +235,13 @@ namespace OpenRCT2
     FmtString::iterator FmtString::iterator::operator++(int)
     {
         auto result = *this;
-        if (index < str.size())
-        {
-            index += current.text.size();
-            update();
-        }
+        ++(*this);
         return result;
     }
 
     bool FmtString::iterator::eol() const
     {
-        return index >= str.size();
+        return index >= (tokens != nullptr ? numTokens : str.size());
     }
 
     FmtString::FmtString(std::string&& s)
@@ -248,16 +260,40 @@ namespace OpenRCT2
     {
     }
 
+    FmtString::FmtString(std::string_view s, std::span<const Token> tokens)
+        : _str(s)
+        , _tokens(tokens)
+    {
+    }
+
     FmtString::iterator FmtString::begin() const
     {
+        if (!_tokens.empty())
+        {
+            return iterator(_tokens, 0);
+        }
         return iterator(_str, 0);
     }
 
     FmtString::iterator FmtString::end() const
     {
+        if (!_tokens.empty())
+        {
+            return iterator(_tokens, _tokens.size());
+        }
         return iterator(_str, _str.size());
     }
 
+    std::vector<FmtString::Token> FmtString::Compile(std::string_view s)
+    {
+        std::vector<Token> result;
+        for (auto it = iterator(s, 0); !it.eol(); ++it)
+        {
+            result.push_back(*it);
+        }
+        return result;
+    }
+
     std::string FmtString::WithoutFormatTokens() const
     {
         std::string result;
@@ -636,8 +672,14 @@ namespace OpenRCT2
 
     FmtString GetFmtStringById(StringId id)
     {
-        auto fmtc = LanguageGetString(id);
-        return FmtString(fmtc);
+        const auto& localisationService = GetContext()->GetLocalisationService();
+        return localisationService.GetFmtString(id);
+    }
+
+    void LogFormatNestingTooDeep(StringId id)
+    {
+        LOG_WARNING(
+            "String %u is nested more than %zu levels deep and has not been formatted.", id, kFormatMaxNestingDepth);
     }
 
     FormatBuffer& GetThreadFormatStream()
@@ -12,9 +12,11 @@
 #include "FormatCodes.h"
 #include "Language.h"
 
+#include "../core/FixedVector.h"
+
 #include <cstring>
+#include <span>
 #include <sstream>
-#include <stack>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -173,13 +175,18 @@ namespace OpenRCT2
         {
         private:
             std::string_view str;
-            size_t index;
+            size_t index{};
             Token current;
+            // When set, the string has already been tokenised and index refers to a token rather than a character
+            const Token* tokens{};
+            size_t numTokens{};
 
             void update();
 
         public:
+            iterator() = default;
             iterator(std::string_view s, size_t i);
+            iterator(std::span<const Token> t, size_t i);
             bool operator==(iterator& rhs);
             bool operator!=(iterator& rhs);
             Token CreateToken(size_t len);
@@ -190,29 +197,48 @@ namespace OpenRCT2
             bool eol() const;
         };
 
+    private:
+        std::span<const Token> _tokens;
+
+    public:
         FmtString() = default;
         FmtString(std::string&& s);
         FmtString(std::string_view s);
         FmtString(const char* s);
+        /**
+         * Creates a format string from tokens produced by Compile. The tokens must outlive the FmtString.
+         */
+        FmtString(std::string_view s, std::span<const Token> tokens);
         iterator begin() const;
         iterator end() const;
 
         std::string WithoutFormatTokens() const;
+
+        /**
+         * Splits a string into its tokens up front so that formatting does not need to parse it again. The tokens
+         * refer to the given string which must therefore not move or change while they are in use.
+         */
+        static std::vector<Token> Compile(std::string_view s);
     };
 
+    // Maximum depth of nested {STRINGID} tokens while formatting a string
+    constexpr size_t kFormatMaxNestingDepth = 16;
+    using FormatStack = FixedVector<FmtString::iterator, kFormatMaxNestingDepth>;
+
     template<typename T> void FormatArgument(FormatBuffer& ss, FormatToken token, T arg);
 
     bool IsRealNameStringId(StringId id);
     void FormatRealName(FormatBuffer& ss, StringId id);
     FmtString GetFmtStringById(StringId id);
+    void LogFormatNestingTooDeep(StringId id);
     FormatBuffer& GetThreadFormatStream();
     size_t CopyStringStreamToBuffer(char* buffer, size_t bufferLen, FormatBuffer& ss);
 
-    inline void FormatString(FormatBuffer& ss, std::stack<FmtString::iterator>& stack)
+    inline void FormatString(FormatBuffer& ss, FormatStack& stack)
     {
         while (!stack.empty())
         {
-            auto& it = stack.top();
+            auto& it = stack.back();
             while (!it.eol())
             {
                 const auto& token = *it;
@@ -220,21 +246,22 @@ namespace OpenRCT2
                 {
                     ss << token.text;
                 }
-                it++;
+                ++it;
             }
-            stack.pop();
+            stack.pop_back();
         }
     }
 
     template<typename TArg0, typename... TArgs>
-    static void FormatString(FormatBuffer& ss, std::stack<FmtString::iterator>& stack, TArg0 arg0, TArgs&&... argN)
+    static void FormatString(FormatBuffer& ss, FormatStack& stack, TArg0 arg0, TArgs&&... argN)
     {
         while (!stack.empty())
         {
-            auto& it = stack.top();
+            auto& it = stack.back();
             while (!it.eol())
             {
-                auto token = *it++;
+                auto token = *it;
+                ++it;
                 if (token.kind == FormatToken::StringById)
                 {
                     if constexpr (std::is_integral<TArg0>())
@@ -246,9 +273,15 @@ namespace OpenRCT2
                             return FormatString(ss, stack, argN...);
                         }
 
-                        auto subfmt = GetFmtStringById(stringId);
-                        auto subit = subfmt.begin();
-                        stack.push(subit);
+                        if (stack.size() < stack.capacity())
+                        {
+                            auto subfmt = GetFmtStringById(stringId);
+                            stack.push_back(subfmt.begin());
+                        }
+                        else
+                        {
+                            LogFormatNestingTooDeep(stringId);
+                        }
                         return FormatString(ss, stack, argN...);
                     }
                 }
@@ -260,14 +293,14 @@ namespace OpenRCT2
 
                 ss << token.text;
             }
-            stack.pop();
+            stack.pop_back();
         }
     }
 
     template<typename... TArgs> static void FormatString(FormatBuffer& ss, const FmtString& fmt, TArgs&&... argN)
     {
-        std::stack<FmtString::iterator> stack;
-        stack.push(fmt.begin());
+        FormatStack stack;
+        stack.push_back(fmt.begin());
         FormatString(ss, stack, argN...);
     }
 
@@ -45,6 +45,7 @@ class LanguagePack final : public ILanguagePack
 private:
     uint16_t const _id;
     std::vector<std::string> _strings;
+    std::vector<std::vector<FmtString::Token>> _compiledStrings;
     std::vector<ScenarioOverride> _scenarioOverrides;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -102,6 +103,13 @@ public:
         // Clean up the parsing work data
         _currentGroup.clear();
         _currentScenarioOverride = nullptr;
+
+        // Tokenise every string once now rather than each time it is formatted
+        _compiledStrings.resize(_strings.size());
+        for (size_t i = 0; i < _strings.size(); i++)
+        {
+            _compiledStrings[i] = FmtString::Compile(_strings[i]);
+        }
     }
 
     uint16_t GetId() const override
@@ -119,6 +127,7 @@ public:
         if (_strings.size() > static_cast<size_t>(stringId))
         {
             _strings[stringId].clear();
+            _compiledStrings[stringId].clear();
         }
     }
 
@@ -127,6 +136,7 @@ public:
         if (_strings.size() > static_cast<size_t>(stringId))
         {
             _strings[stringId] = str;
+            _compiledStrings[stringId] = FmtString::Compile(_strings[stringId]);
         }
     }
 
@@ -155,6 +165,22 @@ public:
         return nullptr;
     }
 
+    std::optional<FmtString> GetFmtString(StringId stringId) const override
+    {
+        if (stringId < ScenarioOverrideBase && _strings.size() > static_cast<size_t>(stringId)
+            && !_strings[stringId].empty())
+        {
+            return FmtString(_strings[stringId], _compiledStrings[stringId]);
+        }
+
+        auto str = GetString(stringId);
+        if (str != nullptr)
+        {
+            return FmtString(str);
+        }
+        return std::nullopt;
+    }
+
     StringId GetScenarioOverrideStringId(const utf8* scenarioFilename, uint8_t index) override
     {
         Guard::ArgumentNotNull(scenarioFilename);
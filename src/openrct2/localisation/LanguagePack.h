@@ -11,8 +11,10 @@
 
 #include "../core/String.hpp"
 #include "../localisation/StringIdType.h"
+#include "Formatting.h"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -26,6 +28,10 @@ struct ILanguagePack
     virtual void RemoveString(StringId stringId) = 0;
     virtual void SetString(StringId stringId, const std::string& str) = 0;
     virtual const utf8* GetString(StringId stringId) const = 0;
+    /**
+     * Gets the same string as GetString, but as a format string that has already been tokenised when possible.
+     */
+    virtual std::optional<OpenRCT2::FmtString> GetFmtString(StringId stringId) const = 0;
     virtual StringId GetScenarioOverrideStringId(const utf8* scenarioFilename, uint8_t index) = 0;
 };
 
@@ -70,6 +70,21 @@ const char* LocalisationService::GetString(StringId id) const
     return nullptr;
 }
 
+FmtString LocalisationService::GetFmtString(StringId id) const
+{
+    auto isObjectString = id >= BASE_OBJECT_STRING_ID && id < BASE_OBJECT_STRING_ID + MAX_OBJECT_CACHED_STRINGS;
+    if (id != STR_EMPTY && id != STR_NONE && !isObjectString)
+    {
+        for (const auto& language : _loadedLanguages)
+        {
+            auto result = language->GetFmtString(id);
+            if (result.has_value())
+                return *result;
+        }
+    }
+    return FmtString(GetString(id));
+}
+
 std::string LocalisationService::GetLanguagePath(uint32_t languageId) const
 {
     auto locale = std::string(LanguagesDescriptors[languageId].locale);
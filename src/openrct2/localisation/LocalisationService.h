@@ -24,6 +24,7 @@ struct IObjectManager;
 namespace OpenRCT2
 {
     struct IPlatformEnvironment;
+    class FmtString;
 }
 
 namespace OpenRCT2::Localisation
@@ -58,6 +59,7 @@ namespace OpenRCT2::Localisation
         ~LocalisationService();
 
         const char* GetString(StringId id) const;
+        FmtString GetFmtString(StringId id) const;
         std::tuple<StringId, StringId, StringId> GetLocalisedScenarioStrings(const std::string& scenarioFilename) const;
         std::string GetLanguagePath(uint32_t languageId) const;
 
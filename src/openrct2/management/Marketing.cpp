@@ -161,7 +161,7 @@ void MarketingSetGuestCampaign(Guest* peep, int32_t campaignType)
             peep->VoucherType = VOUCHER_TYPE_RIDE_FREE;
             peep->VoucherRideId = campaign->RideId;
             peep->GuestHeadingToRideId = campaign->RideId;
-            peep->GuestIsLostCountdown = 240;
+            peep->SetLostCountdown(240);
             break;
         case ADVERTISING_CAMPAIGN_PARK_ENTRY_HALF_PRICE:
             peep->GiveItem(ShopItem::Voucher);
@@ -176,7 +176,7 @@ void MarketingSetGuestCampaign(Guest* peep, int32_t campaignType)
             break;
         case ADVERTISING_CAMPAIGN_RIDE:
             peep->GuestHeadingToRideId = campaign->RideId;
-            peep->GuestIsLostCountdown = 240;
+            peep->SetLostCountdown(240);
             break;
     }
 }
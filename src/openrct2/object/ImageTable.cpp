@@ -25,12 +25,23 @@
 #include "ObjectFactory.h"
 
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
-static thread_local std::map<u8string, std::unique_ptr<Object>> _objDataCache = {};
+/**
+ * Legacy objects that images are borrowed from, shared by all threads loading objects so that each source object is
+ * only read once per load pass.
+ */
+struct CachedObjectData
+{
+    std::once_flag Loaded;
+    std::unique_ptr<Object> Obj;
+};
+static std::mutex _objDataCacheMutex;
+static std::map<u8string, std::shared_ptr<CachedObjectData>> _objDataCache = {};
 
 struct ImageTable::RequiredImage
 {
@@ -271,25 +282,30 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
     IReadObjectContext* context, const std::string& name, const std::vector<int32_t>& range)
 {
     std::vector<std::unique_ptr<RequiredImage>> result;
-    Object* obj;
 
-    auto cached = _objDataCache.find(name);
-    if (cached != _objDataCache.end())
+    std::shared_ptr<CachedObjectData> cached;
     {
-        obj = cached->second.get();
+        std::lock_guard<std::mutex> guard(_objDataCacheMutex);
+        auto& entry = _objDataCache[name];
+        if (entry == nullptr)
+        {
+            entry = std::make_shared<CachedObjectData>();
+        }
+        cached = entry;
     }
-    else
-    {
+
+    // Only the first thread to ask for an object reads it, any others wait for it here.
+    std::call_once(cached->Loaded, [&]() {
         auto objectPath = FindLegacyObject(name);
-        auto tmp = ObjectFactory::CreateObjectFromLegacyFile(
+        cached->Obj = ObjectFactory::CreateObjectFromLegacyFile(
             context->GetObjectRepository(), objectPath.c_str(), !gOpenRCT2NoGraphics);
-        auto inserted = _objDataCache.insert({ name, std::move(tmp) });
-        obj = inserted.first->second.get();
-    }
+    });
+
+    const Object* obj = cached->Obj.get();
 
     if (obj != nullptr)
     {
-        auto& imgTable = static_cast<const Object*>(obj)->GetImageTable();
+        auto& imgTable = obj->GetImageTable();
         auto numImages = static_cast<int32_t>(imgTable.GetCount());
         auto images = imgTable.GetImages();
         size_t placeHoldersAdded = 0;
@@ -326,6 +342,12 @@ std::vector<std::unique_ptr<ImageTable::RequiredImage>> ImageTable::LoadObjectIm
     return result;
 }
 
+void ImageTable::ClearObjectDataCache()
+{
+    std::lock_guard<std::mutex> guard(_objDataCacheMutex);
+    _objDataCache.clear();
+}
+
 std::vector<int32_t> ImageTable::ParseRange(std::string s)
 {
     // Currently only supports [###] or [###..###]
@@ -67,4 +67,9 @@ public:
         return static_cast<uint32_t>(_entries.size());
     }
     void AddImage(const G1Element* g1);
+
+    /**
+     * Releases the legacy objects that were read to supply images for other objects.
+     */
+    static void ClearObjectDataCache();
 };
@@ -288,6 +288,14 @@ public:
     virtual void Load() = 0;
     virtual void Unload() = 0;
 
+    /**
+     * Second phase of loading for work that only reads the object's own data and the images allocated by Load(). The
+     * object manager calls this for many objects at once on worker threads.
+     */
+    virtual void PostLoad()
+    {
+    }
+
     virtual void DrawPreview(DrawPixelInfo& /*dpi*/, int32_t /*width*/, int32_t /*height*/) const
     {
     }
@@ -20,6 +20,7 @@
 #include "../localisation/StringIds.h"
 #include "../ride/Ride.h"
 #include "../ride/RideAudio.h"
+#include "../ride/TrackDesignPreviewCache.h"
 #include "../util/Util.h"
 #include "BannerSceneryEntry.h"
 #include "LargeSceneryObject.h"
@@ -240,6 +241,7 @@ public:
 
     void ResetObjects() override
     {
+        std::vector<Object*> reloadedObjects;
         for (auto& list : _loadedObjects)
         {
             for (auto* loadedObject : list)
@@ -247,10 +249,13 @@ public:
                 if (loadedObject != nullptr)
                 {
                     loadedObject->Unload();
+                    TrackDesignPreviewCacheOnObjectUnloaded(*loadedObject);
                     loadedObject->Load();
+                    reloadedObjects.push_back(loadedObject);
                 }
             }
         }
+        PostLoadObjects(reloadedObjects);
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
 
@@ -424,6 +429,7 @@ private:
         std::replace(list.begin(), list.end(), object, static_cast<Object*>(nullptr));
 
         object->Unload();
+        TrackDesignPreviewCacheOnObjectUnloaded(*object);
 
         // TODO try to prevent doing a repository search
         const auto* ori = _objectRepository.FindObject(object->GetDescriptor());
@@ -560,6 +566,19 @@ private:
         return requiredObjects;
     }
 
+    /**
+     * Runs the second load phase of the given objects concurrently, see Object::PostLoad.
+     */
+    static void PostLoadObjects(const std::vector<Object*>& objects)
+    {
+        JobPool jobs{};
+        for (auto* object : objects)
+        {
+            jobs.AddTask([object]() { object->PostLoad(); });
+        }
+        jobs.Join();
+    }
+
     void ReportProgress(size_t numLoaded, size_t numRequired)
     {
         constexpr auto kObjectLoadMinProgress = 10;
@@ -654,7 +673,10 @@ private:
             objects.push_back(loadedObject);
         }
 
-        // Load objects
+        // Sources that images were borrowed from are no longer needed
+        ImageTable::ClearObjectDataCache();
+
+        // Load objects, this allocates strings and images so must happen serially
         for (auto* obj : newLoadedObjects)
         {
             obj->Load();
@@ -670,6 +692,8 @@ private:
             throw ObjectLoadException(std::move(badObjects));
         }
 
+        PostLoadObjects(newLoadedObjects);
+
         // Unload objects which are not in the required list.
         if (objects.empty())
         {
@@ -716,6 +740,7 @@ private:
             loadedObject = object.get();
 
             object->Load();
+            object->PostLoad();
 
             // Connect the ori to the registered object
             _objectRepository.RegisterLoadedObject(ori, std::move(object));
@@ -689,6 +689,7 @@ std::unique_ptr<Object> ObjectRepositoryLoadObject(const RCTObjectEntry* objectE
         if (object != nullptr)
         {
             object->Load();
+            object->PostLoad();
         }
     }
     return object;
@@ -308,20 +308,6 @@ void RideObject::Load()
             currentCarImagesOffset = imageIndex + carEntry.no_seating_rows * carEntry.NumCarImages;
             // 0x6DEB0D
 
-            if (!(carEntry.flags & CAR_ENTRY_FLAG_RECALCULATE_SPRITE_BOUNDS))
-            {
-                int32_t num_images = currentCarImagesOffset - baseImageId;
-                if (carEntry.flags & CAR_ENTRY_FLAG_SPRITE_BOUNDS_INCLUDE_INVERTED_SET)
-                {
-                    num_images *= 2;
-                }
-
-                if (!gOpenRCT2NoGraphics)
-                {
-                    CarEntrySetImageMaxSizes(carEntry, num_images);
-                }
-            }
-
             if (!_peepLoadingPositions[i].empty())
             {
                 carEntry.peep_loading_positions = std::move(_peepLoadingPositions[i]);
@@ -335,6 +321,28 @@ void RideObject::Load()
     }
 }
 
+void RideObject::PostLoad()
+{
+    if (gOpenRCT2NoGraphics)
+    {
+        return;
+    }
+
+    // Measuring the sprite bounds draws every image of the car, so it is done here rather than in Load().
+    for (auto& carEntry : _legacyType.Cars)
+    {
+        if (carEntry.GroupEnabled(SpriteGroupType::SlopeFlat) && !(carEntry.flags & CAR_ENTRY_FLAG_RECALCULATE_SPRITE_BOUNDS))
+        {
+            int32_t num_images = carEntry.NumCarImages * (carEntry.no_seating_rows + 1);
+            if (carEntry.flags & CAR_ENTRY_FLAG_SPRITE_BOUNDS_INCLUDE_INVERTED_SET)
+            {
+                num_images *= 2;
+            }
+            CarEntrySetImageMaxSizes(carEntry, num_images);
+        }
+    }
+}
+
 void RideObject::Unload()
 {
     LanguageFreeObjectString(_legacyType.naming.Name);
@@ -35,6 +35,7 @@ public:
     void ReadLegacy(IReadObjectContext* context, OpenRCT2::IStream* stream) override;
     void Load() override;
     void Unload() override;
+    void PostLoad() override;
 
     void DrawPreview(DrawPixelInfo& dpi, int32_t width, int32_t height) const override;
 
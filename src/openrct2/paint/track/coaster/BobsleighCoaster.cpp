@@ -42,29 +42,46 @@ static void BobsleighRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        {
+            { 14576, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14578, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14577, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14579, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14576, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14578, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14577, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14579, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14572, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14574, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14573, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14575, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14572, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14574, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14573, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14575, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14576), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14578), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14577), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14579), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -72,27 +89,7 @@ static void BobsleighRCTrackFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14572), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14574), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14573), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14575), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -132,43 +129,46 @@ static void BobsleighRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        {
+            { 14634, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14638, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 14635, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14639, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 14636, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14640, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 14637, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14641, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14610, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14614, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 14611, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14615, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 14612, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14616, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 14613, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14617, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14634), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14638), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14635), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14639), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14636), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14640), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14637), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14641), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -176,41 +176,7 @@ static void BobsleighRCTrack25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14610), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14614), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14611), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14615), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14612), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14616), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14613), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14617), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -233,43 +199,46 @@ static void BobsleighRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        {
+            { 14618, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14622, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 14619, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14623, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 14620, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14624, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 14621, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14625, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14594, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14598, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 14595, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14599, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 14596, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14600, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 14597, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14601, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14618), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14622), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14619), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14623), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14620), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14624), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14621), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14625), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -277,41 +246,7 @@ static void BobsleighRCTrackFlatTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14594), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14598), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14595), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14599), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14596), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14600), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14597), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14601), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -334,43 +269,46 @@ static void BobsleighRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        {
+            { 14626, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14630, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 14627, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14631, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 14628, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14632, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 14629, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14633, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14602, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14606, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 14603, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14607, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 14604, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14608, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 14605, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14609, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14626), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14630), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14627), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14631), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14628), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14632), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14629), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14633), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -378,41 +316,7 @@ static void BobsleighRCTrack25DegUpToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14602), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14606), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14603), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14607), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14604), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14608), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14605), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(14609), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -459,44 +363,101 @@ static void BobsleighRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14707, { 0, 2, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14727, { 0, 2, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14712, { 0, 2, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14732, { 0, 2, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14717, { 0, 2, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14737, { 0, 2, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14702, { 0, 2, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14722, { 0, 2, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 14706, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14726, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14711, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14731, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14716, { 0, 16, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14736, { 0, 16, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14701, { 0, 16, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14721, { 0, 16, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14705, { 0, 16, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14725, { 0, 16, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14710, { 16, 16, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14730, { 16, 16, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14715, { 16, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14735, { 16, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14700, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14720, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        {
+            { 14704, { 16, 0, 0 }, { { 16, 0, 0 }, { 16, 34, 2 } } },
+            { 14724, { 16, 0, 0 }, { { 16, 0, 27 }, { 16, 34, 0 } } },
+        },
+        {
+            { 14709, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14729, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14714, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14734, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14699, { 16, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14719, { 16, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        {
+            { 14703, { 2, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14723, { 2, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14708, { 2, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14728, { 2, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14713, { 2, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14733, { 2, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14698, { 2, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14718, { 2, 0, 0 }, { { 6, 0, 27 }, { 30, 32, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14707), { 0, 2, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14727), { 0, 2, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14712), { 0, 2, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14732), { 0, 2, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14717), { 0, 2, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14737), { 0, 2, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14702), { 0, 2, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14722), { 0, 2, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -516,41 +477,7 @@ static void BobsleighRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14706), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14726), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14711), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14731), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14716), { 0, 16, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14736), { 0, 16, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14701), { 0, 16, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14721), { 0, 16, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -562,41 +489,7 @@ static void BobsleighRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14705), { 0, 16, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14725), { 0, 16, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14710), { 16, 16, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14730), { 16, 16, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14715), { 16, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14735), { 16, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14700), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14720), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -611,41 +504,7 @@ static void BobsleighRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14704), { 16, 0, height },
-                        { { 16, 0, height }, { 16, 34, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14724), { 16, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 34, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14709), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14729), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14714), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14734), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14699), { 16, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14719), { 16, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -657,41 +516,7 @@ static void BobsleighRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14703), { 2, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14723), { 2, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14708), { 2, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14728), { 2, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14713), { 2, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14733), { 2, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14698), { 2, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14718), { 2, 0, height },
-                        { { 6, 0, height + 27 }, { 30, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -729,41 +554,26 @@ static void BobsleighRCTrackFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14642), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14646), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14643), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14647), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14644), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14648), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14645), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14649), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14642, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14646, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14643, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14647, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14644, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14648, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14645, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14649, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -778,41 +588,26 @@ static void BobsleighRCTrackFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14650), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14654), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14651), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14655), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14652), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14656), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14653), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14657), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14650, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14654, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14651, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14655, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14652, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14656, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14653, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14657, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -827,42 +622,27 @@ static void BobsleighRCTrackLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14652), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14656), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14653), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14657), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14650), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14654), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14651), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14655), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
-    if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14652, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14656, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14653, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14657, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14650, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14654, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14651, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14655, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
+    if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
     }
@@ -876,41 +656,26 @@ static void BobsleighRCTrackRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14644), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14648), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14645), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14649), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14642), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14646), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14643), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14647), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14644, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14648, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14645, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14649, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14642, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14646, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14643, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14647, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -925,44 +690,101 @@ static void BobsleighRCTrackBankedLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14747, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14767, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14752, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14772, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14757, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14777, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14742, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14762, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 14746, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14766, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14751, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14771, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14756, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14776, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14741, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14761, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14745, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14765, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14750, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14770, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14755, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14775, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14740, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14760, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        {
+            { 14744, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14764, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14749, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14769, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14754, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14774, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14739, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14759, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        {
+            { 14743, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14763, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14748, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14768, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14753, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14773, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14738, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14758, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14747), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14767), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14752), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14772), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14757), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14777), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14742), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14762), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -982,41 +804,7 @@ static void BobsleighRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14746), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14766), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14751), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14771), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14756), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14776), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14741), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14761), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1028,41 +816,7 @@ static void BobsleighRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14745), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14765), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14750), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14770), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14755), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14775), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14740), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14760), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1077,41 +831,7 @@ static void BobsleighRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14744), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14764), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14749), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14769), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14754), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14774), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14739), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14759), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1123,41 +843,7 @@ static void BobsleighRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14743), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14763), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14748), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14768), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14753), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14773), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14738), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14758), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -1195,41 +881,26 @@ static void BobsleighRCTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14674), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14678), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14675), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14679), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14676), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14680), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14677), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14681), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14674, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14678, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14675, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14679, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14676, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14680, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14677, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14681, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -1251,41 +922,26 @@ static void BobsleighRCTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14682), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14686), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14683), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14687), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14684), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14688), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14685), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14689), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14682, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14686, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14683, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14687, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14684, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14688, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14685, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14689, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -1307,41 +963,26 @@ static void BobsleighRCTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14658), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14662), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14659), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14663), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14660), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14664), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14661), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14665), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14658, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14662, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14659, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14663, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14660, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14664, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14661, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14665, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -1363,42 +1004,27 @@ static void BobsleighRCTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14666), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14670), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14667), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14671), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14668), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14672), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14669), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14673), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
-    if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14666, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14670, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14667, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14671, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14668, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14672, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14669, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14673, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
+    if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
     }
@@ -1451,41 +1077,26 @@ static void BobsleighRCTrackLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14690), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14694), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14691), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14695), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14692), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14696), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14693), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14697), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14690, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14694, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14691, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14695, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14692, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14696, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14693, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14697, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1508,44 +1119,47 @@ static void BobsleighRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14826, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14842, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14830, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14846, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14829, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14845, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14833, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14849, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14829, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14845, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14833, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14849, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14826, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14842, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14830, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14846, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14826), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14842), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14830), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14846), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14829), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14845), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14833), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14849), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1662,41 +1276,7 @@ static void BobsleighRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14829), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14845), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14833), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14849), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14826), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14842), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14830), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14846), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -1725,44 +1305,47 @@ static void BobsleighRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14834, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14850, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14838, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14854, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14837, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14853, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14841, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14857, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14837, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14853, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14841, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14857, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14834, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14850, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+        {
+            { 14838, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 2 } } },
+            { 14854, { 0, 0, 0 }, { { 0, 2, 27 }, { 32, 27, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14834), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14850), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14838), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14854), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14837), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14853), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14841), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14857), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1879,41 +1462,7 @@ static void BobsleighRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14837), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14853), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14841), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14857), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14834), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14850), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14838), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14854), { 0, 0, height },
-                        { { 0, 2, height + 27 }, { 32, 27, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -1942,44 +1491,65 @@ static void BobsleighRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14783, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14795, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14786, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14798, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14789, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14801, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14780, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14792, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 14782, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14794, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14785, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14797, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14788, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14800, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14779, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14791, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14781, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14793, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14784, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14796, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14787, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14799, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14778, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14790, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14783), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14795), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14786), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14798), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14789), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14801), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14780), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14792), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1999,41 +1569,7 @@ static void BobsleighRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14782), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14794), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14785), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14797), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14788), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14800), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14779), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14791), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2045,41 +1581,7 @@ static void BobsleighRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14781), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14793), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14784), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14796), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14787), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14799), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14778), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14790), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -2117,44 +1619,65 @@ static void BobsleighRCTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14807, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14819, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14810, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14822, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14813, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14825, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14804, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14816, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 14806, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14818, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14809, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14821, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14812, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14824, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14803, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14815, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14805, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14817, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14808, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14820, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14811, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14823, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14802, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14814, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14807), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14819), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14810), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14822), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14813), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14825), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14804), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14816), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2174,41 +1697,7 @@ static void BobsleighRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14806), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14818), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14809), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14821), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14812), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14824), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14803), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14815), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2220,41 +1709,7 @@ static void BobsleighRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14805), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14817), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14808), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14820), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14811), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14823), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14802), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14814), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -2292,44 +1747,119 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14887, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14899, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14890, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14902, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14893, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14905, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14884, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 2 } } },
+            { 14896, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 14886, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14898, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14889, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14901, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14892, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14904, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14883, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14895, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14885, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14897, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14888, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14900, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14891, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14903, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14882, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14894, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        {
+            { 14884, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14896, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14887, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14899, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14890, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14902, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14893, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14905, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        {
+            { 14883, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14895, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14886, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14898, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14889, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14901, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14892, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14904, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        {
+            { 14882, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 2 } } },
+            { 14894, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14885, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14897, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14888, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14900, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14891, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14903, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14887), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14899), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14890), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14902), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14893), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14905), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14884), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14896), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2349,41 +1879,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14886), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14898), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14889), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14901), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14892), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14904), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14883), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14895), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2395,41 +1891,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14885), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14897), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14888), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14900), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14891), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14903), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14882), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14894), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -2451,41 +1913,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14884), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14896), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14887), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14899), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14890), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14902), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14893), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14905), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -2510,41 +1938,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14883), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14895), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14886), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14898), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14889), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14901), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14892), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14904), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2556,41 +1950,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14882), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14894), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14885), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14897), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14888), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14900), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14891), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14903), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2614,44 +1974,119 @@ static void BobsleighRCTrackRightHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14858, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14870, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14861, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14873, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14864, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14876, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14867, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14879, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 14859, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14871, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14862, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14874, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14865, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14877, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14868, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14880, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14860, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 2 } } },
+            { 14872, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14863, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14875, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14866, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14878, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14869, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14881, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        {
+            { 14861, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14873, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14864, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14876, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14867, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14879, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14858, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14870, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        {
+            { 14862, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14874, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14865, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14877, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14868, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14880, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14859, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14871, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        {
+            { 14863, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14875, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14866, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14878, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14869, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14881, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14860, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 2 } } },
+            { 14872, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14858), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14870), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14861), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14873), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14864), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14876), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14867), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14879), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2671,41 +2106,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14859), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14871), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14862), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14874), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14865), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14877), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14868), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14880), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2717,49 +2118,15 @@ static void BobsleighRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
+            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
                 case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14860), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14872), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
+                    PaintUtilPushTunnelRight(session, height + 8, TunnelType::StandardFlat);
                     break;
                 case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14863), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14875), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14866), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14878), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14869), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14881), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
-            switch (direction)
-            {
-                case 0:
-                    PaintUtilPushTunnelRight(session, height + 8, TunnelType::StandardFlat);
-                    break;
-                case 1:
-                    PaintUtilPushTunnelLeft(session, height + 8, TunnelType::StandardFlat);
+                    PaintUtilPushTunnelLeft(session, height + 8, TunnelType::StandardFlat);
                     break;
             }
             PaintUtilSetSegmentSupportHeight(
@@ -2773,41 +2140,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14861), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14873), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14864), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14876), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14867), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14879), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14858), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14870), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -2832,41 +2165,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14862), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14874), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14865), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14877), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14868), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14880), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14859), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14871), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2878,41 +2177,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14863), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14875), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14866), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14878), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14869), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14881), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14860), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14872), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2964,44 +2229,191 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14955, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14975, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14960, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14980, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14965, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14985, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14950, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14970, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 14954, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14974, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14959, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14979, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14964, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14984, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14949, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14969, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14953, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14973, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14958, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14978, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14963, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14983, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14948, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14968, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        {
+            { 14952, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14972, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14957, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14977, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14962, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14982, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14947, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14967, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        {
+            { 14951, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14971, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14956, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14976, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14961, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14981, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14946, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 2 } } },
+            { 14966, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        {
+            { 14950, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14970, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14955, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14975, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14960, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14980, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14965, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14985, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        {
+            { 14949, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14969, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14954, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14974, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14959, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14979, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14964, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14984, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        {
+            { 14948, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14968, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14953, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14973, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14958, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14978, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14963, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14983, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        {
+            { 14947, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14967, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14952, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14972, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14957, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14977, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14962, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14982, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        {
+            { 14946, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 2 } } },
+            { 14966, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14951, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14971, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14956, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14976, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14961, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14981, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14955), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14975), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14960), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14980), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14965), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14985), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14950), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14970), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3021,41 +2433,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14954), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14974), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14959), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14979), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14964), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14984), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14949), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14969), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3067,41 +2445,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14953), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14973), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14958), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14978), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14963), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14983), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14948), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14968), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3116,41 +2460,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14952), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14972), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14957), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14977), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14962), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14982), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14947), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14967), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3162,41 +2472,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14951), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14971), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14956), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14976), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14961), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14981), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14946), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14966), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -3218,41 +2494,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14950), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14970), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14955), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14975), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14960), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14980), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14965), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14985), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -3277,41 +2519,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14949), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14969), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14954), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14974), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14959), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14979), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14964), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14984), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3323,41 +2531,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14948), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14968), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14953), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14973), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14958), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14978), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14963), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14983), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3371,41 +2545,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14947), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14967), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14952), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14972), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14957), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14977), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14962), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14982), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3417,41 +2557,7 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14946), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14966), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14951), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14971), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14956), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14976), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14961), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14981), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3470,49 +2576,196 @@ static void BobsleighRCTrackLeftHalfBankedHelixUpLarge(
     }
 }
 
-/** rct2: 0x006FE824 */
-static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
+/** rct2: 0x006FE824 */
+static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
+    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
+    const TrackElement& trackElement)
+{
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 14906, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14926, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14911, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14931, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14916, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14936, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14921, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14941, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 14907, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14927, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14912, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14932, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14917, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14937, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14922, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14942, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 14908, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14928, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14913, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14933, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14918, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14938, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14923, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14943, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        {
+            { 14909, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14929, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14914, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14934, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14919, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14939, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14924, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14944, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        {
+            { 14910, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 2 } } },
+            { 14930, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14915, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14935, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14920, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14940, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14925, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14945, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        {
+            { 14911, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14931, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14916, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14936, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14921, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14941, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+        {
+            { 14906, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 2 } } },
+            { 14926, { 0, 0, 0 }, { { 6, 0, 27 }, { 20, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        {
+            { 14912, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14932, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14917, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14937, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14922, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 2 } } },
+            { 14942, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 0 } } },
+        },
+        {
+            { 14907, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 2 } } },
+            { 14927, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 32, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        {
+            { 14913, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 14933, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14918, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 14938, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14923, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 14943, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 14908, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 14928, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        {
+            { 14914, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14934, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14919, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 2 } } },
+            { 14939, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14924, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14944, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+        {
+            { 14909, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 2 } } },
+            { 14929, { 0, 0, 0 }, { { 0, 16, 27 }, { 32, 16, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        {
+            { 14915, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14935, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14920, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14940, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14925, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14945, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14910, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 2 } } },
+            { 14930, { 0, 0, 0 }, { { 0, 6, 27 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14906), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14926), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14911), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14931), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14916), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14936), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14921), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14941), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3532,41 +2785,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14907), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14927), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14912), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14932), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14917), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14937), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14922), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14942), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3578,41 +2797,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14908), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14928), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14913), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14933), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14918), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14938), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14923), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14943), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3626,41 +2811,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14909), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14929), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14914), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14934), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14919), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14939), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14924), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14944), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3672,41 +2823,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14910), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14930), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14915), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14935), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14920), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14940), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14925), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14945), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -3728,41 +2845,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14911), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14931), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14916), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14936), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14921), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14941), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14906), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14926), { 0, 0, height },
-                        { { 6, 0, height + 27 }, { 20, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -3787,41 +2870,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14912), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14932), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14917), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14937), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14922), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14942), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14907), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14927), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3833,41 +2882,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14913), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14933), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14918), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14938), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14923), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14943), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14908), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14928), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3882,41 +2897,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14914), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14934), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14919), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14939), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14924), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14944), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14909), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14929), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3928,41 +2909,7 @@ static void BobsleighRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14915), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14935), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14920), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14940), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14925), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14945), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14910), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(14930), { 0, 0, height },
-                        { { 0, 6, height + 27 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4014,27 +2961,26 @@ static void BobsleighRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14582), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14584), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14583), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 2 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14585), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14582, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14584, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14583, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14585, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14582, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14584, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 14583, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 14585, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -4084,45 +3030,28 @@ static void BobsleighRCTrackOnRidePhoto(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, kSupportType);
-
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14572), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14574), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14573), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14575), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14572), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14574), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 14572, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } },
+            { 14574, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14573, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } },
+            { 14575, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14572, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } },
+            { 14574, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } },
+        },
+        {
+            { 14573, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } },
+            { 14575, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } },
+        },
+    };
 
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14573), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(14575), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
+    TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, kSupportType);
 
-            break;
-    }
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
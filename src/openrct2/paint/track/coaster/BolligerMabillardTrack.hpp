@@ -146,31 +146,22 @@ static void BolligerMabillardTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17498, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17499, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17500, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17501, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17204, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17205, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17206, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17207, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17498), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17499), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17500), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17501), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -178,29 +169,7 @@ static void BolligerMabillardTrack25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17204), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17205), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17206), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17207), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -223,31 +192,22 @@ static void BolligerMabillardTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17514, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17515, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 17516, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 17517, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17220, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17221, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 17222, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 17223, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17514), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17515), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17516), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17517), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 32, height, session.SupportColours);
@@ -255,29 +215,7 @@ static void BolligerMabillardTrack60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17220), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17221), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17222), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17223), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 32, height, session.SupportColours);
@@ -300,31 +238,22 @@ static void BolligerMabillardTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17490, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17491, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17492, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17493, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17196, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17197, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17198, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17199, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17490), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17491), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17492), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17493), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -332,29 +261,7 @@ static void BolligerMabillardTrackFlatTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17196), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17197), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17198), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17199), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -377,37 +284,34 @@ static void BolligerMabillardTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17502, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17503, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17506, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 17504, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17507, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 17505, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17208, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17209, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17212, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 17210, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17213, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 17211, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17502), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17503), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17506), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17504), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17507), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17505), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 12, height, session.SupportColours);
@@ -415,35 +319,7 @@ static void BolligerMabillardTrack25DegUpTo60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17208), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17209), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17212), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17210), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17213), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17211), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 12, height, session.SupportColours);
@@ -466,37 +342,34 @@ static void BolligerMabillardTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17508, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17509, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17512, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 17510, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17513, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 17511, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17214, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17215, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17218, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 17216, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17219, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 17217, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17508), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17509), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17512), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17510), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17513), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17511), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 20, height, session.SupportColours);
@@ -504,35 +377,7 @@ static void BolligerMabillardTrack60DegUpTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17214), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17215), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17218), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17216), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17219), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17217), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 20, height, session.SupportColours);
@@ -555,31 +400,22 @@ static void BolligerMabillardTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17494, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17495, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17496, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17497, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17200, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17201, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17202, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17203, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17494), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17495), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17496), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17497), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -587,29 +423,7 @@ static void BolligerMabillardTrack25DegUpToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17200), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17201), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17202), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17203), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -682,32 +496,41 @@ static void BolligerMabillardTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17259, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17264, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17269, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17254, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17258, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17263, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17268, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17253, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17257, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17262, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17267, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17252, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17256, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17261, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17266, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17251, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17255, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17260, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17265, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17250, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17259), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17264), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17269), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17254), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -727,29 +550,7 @@ static void BolligerMabillardTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17258), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17263), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17268), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17253), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -761,29 +562,7 @@ static void BolligerMabillardTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17257), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17262), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17267), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17252), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -798,29 +577,7 @@ static void BolligerMabillardTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17256), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17261), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17266), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17251), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -832,29 +589,7 @@ static void BolligerMabillardTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17255), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17260), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17265), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17250), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -893,35 +628,20 @@ static void BolligerMabillardTrackFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17156), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17164), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17157), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17165), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17158), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17159), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17156, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17164, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 17157, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17165, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17158, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17159, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -936,35 +656,20 @@ static void BolligerMabillardTrackFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17160), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17161), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17162), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17166), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17163), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17167), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17160, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17161, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17162, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17166, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 17163, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17167, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -979,35 +684,20 @@ static void BolligerMabillardTrackLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17162), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17166), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17163), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17167), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17160), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17161), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17162, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17166, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 17163, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17167, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17160, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17161, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1022,35 +712,20 @@ static void BolligerMabillardTrackRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17158), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17159), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17156), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17164), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17157), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17165), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17158, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17159, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17156, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17164, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 17157, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17165, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1065,6 +740,34 @@ static void BolligerMabillardTrackBankedLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17278, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17283, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17288, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17273, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17277, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17282, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17287, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17272, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17276, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17281, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17286, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17271, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17275, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17280, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17285, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17291, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17270, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -1120,29 +823,7 @@ static void BolligerMabillardTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17278), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17283), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17288), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17273), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1154,29 +835,7 @@ static void BolligerMabillardTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17277), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17282), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17287), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17272), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1191,29 +850,7 @@ static void BolligerMabillardTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17276), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17281), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17286), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17271), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1225,32 +862,7 @@ static void BolligerMabillardTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17275), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17280), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17285), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17291), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17270), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -1289,35 +901,20 @@ static void BolligerMabillardTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17168), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17172), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17169), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17173), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17170), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17171), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17168, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17172, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 17169, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17173, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17170, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17171, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -1339,35 +936,20 @@ static void BolligerMabillardTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17174), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17175), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17176), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17178), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17177), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17179), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17174, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17175, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17176, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17178, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 17177, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17179, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -1389,35 +971,20 @@ static void BolligerMabillardTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17180), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17184), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17181), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17185), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17182), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17183), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17180, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17184, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 17181, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17185, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17182, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17183, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -1439,35 +1006,20 @@ static void BolligerMabillardTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17186), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17187), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17188), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17190), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17189), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17191), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17186, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17187, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17188, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17190, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 17189, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17191, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -1525,29 +1077,14 @@ static void BolligerMabillardTrackLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17192), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17193), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17194), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17195), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17192, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17193, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17194, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17195, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1570,32 +1107,41 @@ static void BolligerMabillardTrackLeftQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17344, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17349, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17354, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17359, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17345, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17350, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17355, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17360, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17346, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17351, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17356, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17361, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17347, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17352, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17357, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17362, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17348, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17353, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17358, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17363, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17344), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17349), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17354), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17359), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1615,27 +1161,7 @@ static void BolligerMabillardTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17345), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17350), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17355), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17360), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1647,28 +1173,7 @@ static void BolligerMabillardTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17346), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17351), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17356), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17361), { 0, 0, height }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1683,27 +1188,7 @@ static void BolligerMabillardTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17347), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17352), { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17357), { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17362), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1715,29 +1200,7 @@ static void BolligerMabillardTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17348), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17353), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17358), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17363), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -1766,32 +1229,41 @@ static void BolligerMabillardTrackRightQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17324, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17329, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17334, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17339, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17325, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17330, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17335, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17340, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17326, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17331, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17336, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17341, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17327, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17332, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17337, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17342, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17328, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17333, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17338, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17343, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17324), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17329), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17334), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17339), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1811,27 +1283,7 @@ static void BolligerMabillardTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17325), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17330), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17335), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17340), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1843,28 +1295,7 @@ static void BolligerMabillardTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17326), { 0, 0, height }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17331), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17336), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17341), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1878,27 +1309,7 @@ static void BolligerMabillardTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17327), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17332), { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17337), { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17342), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1910,29 +1321,7 @@ static void BolligerMabillardTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17328), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17333), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17338), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17343), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -1981,32 +1370,23 @@ static void BolligerMabillardTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17308, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17312, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17311, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17315, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17311, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17315, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17308, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17312, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17308), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17312), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17311), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17315), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2095,29 +1475,7 @@ static void BolligerMabillardTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17311), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17315), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17308), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17312), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -2146,32 +1504,23 @@ static void BolligerMabillardTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17316, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17320, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17319, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17323, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17319, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17323, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17316, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17320, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17316), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17320), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17319), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17323), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2260,29 +1609,7 @@ static void BolligerMabillardTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17319), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17323), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17316), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17320), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -2311,6 +1638,31 @@ static void BolligerMabillardTrackLeftVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17596, { 16, 0, 0 }, { { 16, 0, 0 }, { 3, 16, 119 } } } },
+        { { 17604, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 17599, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 17607, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17597, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17605, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17598, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 17606, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17598, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 17606, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 17597, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17605, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 17599, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 17607, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 17596, { 16, 0, 0 }, { { 16, 0, 0 }, { 3, 16, 119 } } } },
+        { { 17604, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -2394,29 +1746,7 @@ static void BolligerMabillardTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17596), { 16, 0, height },
-                        { { 16, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17604), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17599), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17607), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2428,25 +1758,7 @@ static void BolligerMabillardTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17597), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17605), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17598), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17606), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2464,25 +1776,7 @@ static void BolligerMabillardTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17598), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17606), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17597), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17605), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2494,29 +1788,7 @@ static void BolligerMabillardTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17599), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17607), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17596), { 16, 0, height },
-                        { { 16, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17604), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2620,28 +1892,47 @@ static void BolligerMabillardTrackRightVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17625, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+        { { 17617, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17618, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17610, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17623, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 17615, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 17620, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 17612, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17622, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 17614, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 17621, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17613, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17621, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17613, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17622, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 17614, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 17620, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 17612, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 17623, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 17615, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 17618, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17610, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17625, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+        { { 17617, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17625), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17617), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17618), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17610), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2680,51 +1971,11 @@ static void BolligerMabillardTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17623), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17615), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17620), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17612), { 16, 0, height },
-                        { { 16, 0, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17622), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17614), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17621), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17613), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
@@ -2734,51 +1985,11 @@ static void BolligerMabillardTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17621), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17613), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17622), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17614), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17620), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17612), { 16, 0, height },
-                        { { 16, 0, height }, { 2, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17623), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17615), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 8:
@@ -2812,25 +2023,7 @@ static void BolligerMabillardTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17618), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17610), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17625), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17617), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -2853,32 +2046,29 @@ static void BolligerMabillardTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17229, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17232, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17235, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17226, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17228, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17231, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17234, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17225, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17227, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17230, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17233, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17224, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17229), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17232), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17235), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17226), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2898,29 +2088,7 @@ static void BolligerMabillardTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17228), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17231), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17234), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17225), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2932,29 +2100,7 @@ static void BolligerMabillardTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17227), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17230), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17233), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17224), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -2993,35 +2139,35 @@ static void BolligerMabillardTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 17241, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17248, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17244, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17247, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17238, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17240, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17243, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17246, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17237, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17239, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17242, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17245, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17249, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17236, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17241), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17248), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17244), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17247), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17238), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3041,29 +2187,7 @@ static void BolligerMabillardTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17240), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17243), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17246), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17237), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3075,32 +2199,7 @@ static void BolligerMabillardTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17239), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17242), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17245), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17249), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17236), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -3139,28 +2238,23 @@ static void BolligerMabillardTrackLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17375, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17377, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17379, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17373, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17374, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17376, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17378, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17372, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17375), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17377), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17379), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17373), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3183,30 +2277,12 @@ static void BolligerMabillardTrackLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
+            MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17374), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17376), { 6, 0, height }, { 20, 32, 3 });
-                    break;
                 case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17378), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17372), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
-            switch (direction)
-            {
-                case 2:
-                    PaintUtilPushTunnelRight(session, height + 8, TunnelType::SquareSlopeEnd);
+                    PaintUtilPushTunnelRight(session, height + 8, TunnelType::SquareSlopeEnd);
                     break;
                 case 3:
                     PaintUtilPushTunnelLeft(session, height + 8, TunnelType::SquareSlopeEnd);
@@ -3230,28 +2306,17 @@ static void BolligerMabillardTrackRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17364, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17366, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17368, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17370, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17364), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17366), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17368), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17370), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3348,35 +2413,59 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 17399, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17406, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17402, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17405, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17396, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17398, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17401, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17404, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17395, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17397, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17400, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17403, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17407, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17394, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 17396, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 17399, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17406, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17402, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 17405, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17395, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17398, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17401, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17404, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 17394, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17397, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17400, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 17403, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17407, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17399), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17406), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17402), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17405), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17396), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3396,29 +2485,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17398), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17401), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17404), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17395), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3430,32 +2497,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17397), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17400), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17403), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17407), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17394), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -3477,32 +2519,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17396), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17399), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17406), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17402), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17405), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -3527,29 +2544,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17395), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17398), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17401), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17404), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3561,32 +2556,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17394), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17397), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17400), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17403), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17407), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3610,35 +2580,59 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17380, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17383, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17386, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 17389, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17393, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17381, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17384, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17387, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17390, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17382, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+        {
+            { 17385, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17392, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17388, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 17391, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 17383, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17386, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17389, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17393, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17380, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17384, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17387, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17390, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17381, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        {
+            { 17385, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17392, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17388, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17391, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17382, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17380), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17383), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17386), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17389), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17393), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3658,29 +2652,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17381), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17384), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17387), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17390), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3692,32 +2664,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17382), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17385), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17392), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17388), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17391), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -3739,32 +2686,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17383), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17386), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17389), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17393), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17380), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -3789,29 +2711,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17384), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17387), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17390), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17381), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3823,32 +2723,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17385), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17392), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17388), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17391), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17382), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3902,35 +2777,83 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 17439, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17450, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17444, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17449, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17434, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17438, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17443, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17448, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17433, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17437, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17442, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17447, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17432, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17436, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17441, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17446, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17431, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17435, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17440, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17445, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17451, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17430, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 17434, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 17439, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17450, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17444, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 17449, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 17433, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17438, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17443, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17448, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        { { 17432, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17437, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17442, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17447, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        { { 17431, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17436, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17441, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17446, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        { { 17430, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17435, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17440, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 17445, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17451, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17439), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17450), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17444), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17449), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17434), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3950,29 +2873,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17438), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17443), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17448), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17433), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3984,29 +2885,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17437), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17442), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17447), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17432), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4021,29 +2900,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17436), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17441), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17446), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17431), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4055,32 +2912,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17435), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17440), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17445), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17451), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17430), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -4102,32 +2934,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17434), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17439), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17450), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17444), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17449), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -4152,29 +2959,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17433), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17438), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17443), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17448), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4186,29 +2971,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17432), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17437), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17442), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17447), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4222,29 +2985,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17431), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17436), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17441), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17446), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4256,32 +2997,7 @@ static void BolligerMabillardTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17430), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17435), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17440), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17445), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17451), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4305,35 +3021,65 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17408, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17413, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17418, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 17423, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17429, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17409, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17414, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17419, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17424, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17410, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17415, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17420, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17425, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17411, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17416, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17421, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17426, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 17413, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17418, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17423, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17429, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17408, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 17414, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17419, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17424, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17409, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        { { 17415, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17420, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17425, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17410, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        { { 17416, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17421, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17426, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17411, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17408), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17413), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17418), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17423), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17429), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4353,29 +3099,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17409), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17414), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17419), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17424), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4387,29 +3111,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17410), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17415), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17420), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17425), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4423,29 +3125,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17411), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17416), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17421), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17426), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4511,32 +3191,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17413), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17418), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17423), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17429), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17408), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -4561,29 +3216,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17414), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17419), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17424), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17409), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4595,29 +3228,7 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17415), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17420), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17425), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17410), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4629,32 +3240,10 @@ static void BolligerMabillardTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 11:
-            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-            break;
-        case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17416), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17421), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17426), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17411), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+            break;
+        case 12:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4752,41 +3341,26 @@ static void BolligerMabillardTrackLeftQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17301), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17305), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17302), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17306), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17303), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17307), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17300), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17304), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17301, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17305, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17302, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17306, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17303, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17307, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17300, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17304, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilLeftQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::SquareSlopeStart, +56, TunnelType::SquareSlopeEnd);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -4798,41 +3372,26 @@ static void BolligerMabillardTrackRightQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17292), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17296), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17293), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17297), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17294), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17298), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17295), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17299), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17292, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17296, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17293, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17297, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17294, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17298, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17295, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17299, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilRightQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::SquareSlopeStart, +56, TunnelType::SquareSlopeEnd);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -4862,21 +3421,14 @@ static void BolligerMabillardTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17148), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17149), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17148, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17149, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17148, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17149, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -4891,29 +3443,14 @@ static void BolligerMabillardTrack25DegUpLeftBanked(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17914), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17915), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17916), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17917), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17914, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17915, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17916, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17917, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -4935,29 +3472,14 @@ static void BolligerMabillardTrack25DegUpRightBanked(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17918), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17919), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17920), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17921), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17918, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17919, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17920, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17921, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -4979,31 +3501,16 @@ static void BolligerMabillardTrackOnRidePhoto(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17146, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 17147, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 17146, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 17147, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+    };
+
     TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, supportType);
 
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17146), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17147), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17146), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17147), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-    }
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -5033,32 +3540,17 @@ static void BolligerMabillardTrack90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17526, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17527, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17528, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17529, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17526), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17527), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17528), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17529), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 32);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -5082,32 +3574,17 @@ static void BolligerMabillardTrack60DegUpTo90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17518, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17519, { 0, 0, 0 }, { { 24, 6, 0 }, { 2, 20, 55 } } } },
+        { { 17520, { 0, 0, 0 }, { { 24, 6, 0 }, { 2, 20, 55 } } } },
+        { { 17521, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17518), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17519), { 0, 0, height },
-                        { { 24, 6, height }, { 2, 20, 55 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17520), { 0, 0, height },
-                        { { 24, 6, height }, { 2, 20, 55 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17521), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -5136,29 +3613,14 @@ static void BolligerMabillardTrack90DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17522), { 0, 0, height },
-                { { 0, 6, height + 8 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17523), { 0, 0, height },
-                { { 24, 6, height + 8 }, { 2, 20, 31 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17524), { 0, 0, height },
-                { { 24, 6, height + 8 }, { 2, 20, 31 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17525), { 0, 0, height },
-                { { 0, 6, height + 8 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17522, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17523, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17524, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17525, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     switch (direction)
     {
         case 1:
@@ -5177,32 +3639,17 @@ static void BolligerMabillardTrack60DegDownTo90DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17524, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17525, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17522, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17523, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17524), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17525), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17522), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17523), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 48, TunnelType::SquareSlopeEnd);
@@ -5221,32 +3668,29 @@ static void BolligerMabillardTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17546, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17550, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17554, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17558, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17547, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17551, { 0, 0, 0 }, { { 0, 0, 0 }, { 34, 16, 3 } } } },
+        { { 17555, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17559, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17548, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17552, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17556, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17560, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17546), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17550), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17554), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17558), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5257,29 +3701,7 @@ static void BolligerMabillardTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17547), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17551), { 0, 0, height },
-                        { { 0, 0, height }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17555), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17559), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5291,29 +3713,7 @@ static void BolligerMabillardTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17548), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17552), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17556), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17560), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5385,32 +3785,29 @@ static void BolligerMabillardTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17530, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17534, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17538, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17542, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17531, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17535, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17539, { 0, 0, 0 }, { { 0, 0, 0 }, { 34, 16, 3 } } } },
+        { { 17543, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17532, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17536, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17540, { 0, 0, 0 }, { { 4, 4, 0 }, { 28, 28, 3 } } } },
+        { { 17544, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17530), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17534), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17538), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17542), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5421,29 +3818,7 @@ static void BolligerMabillardTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17531), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17535), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17539), { 0, 0, height },
-                        { { 0, 0, height }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17543), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5455,29 +3830,7 @@ static void BolligerMabillardTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17532), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17536), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17540), { 0, 0, height },
-                        { { 4, 4, height }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17544), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5569,32 +3922,29 @@ static void BolligerMabillardTrackLeftEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17578, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17582, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17586, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17590, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17579, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17583, { 0, 0, 0 }, { { 0, 0, 27 }, { 34, 16, 0 } } } },
+        { { 17587, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17591, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17580, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17584, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } } },
+        { { 17588, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17592, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17578), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17582), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17586), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17590), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5605,29 +3955,7 @@ static void BolligerMabillardTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17579), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17583), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 34, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17587), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17591), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5639,29 +3967,7 @@ static void BolligerMabillardTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17580), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17584), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17588), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17592), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5733,32 +4039,29 @@ static void BolligerMabillardTrackRightEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17562, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17566, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17570, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17574, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17563, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17567, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17571, { 0, 0, 0 }, { { 0, 0, 27 }, { 34, 16, 0 } } } },
+        { { 17575, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17564, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17568, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17572, { 0, 0, 0 }, { { 4, 4, 27 }, { 28, 28, 0 } } } },
+        { { 17576, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17562), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17566), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17570), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17574), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5769,29 +4072,7 @@ static void BolligerMabillardTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17563), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17567), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17571), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 34, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17575), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5803,29 +4084,7 @@ static void BolligerMabillardTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17564), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17568), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17572), { 0, 0, height },
-                        { { 4, 4, height + 27 }, { 28, 28, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17576), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5931,30 +4190,53 @@ static void BolligerMabillardTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17873, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17803, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17870, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17800, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17872, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17802, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17873), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17803), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5969,25 +4251,11 @@ static void BolligerMabillardTrackDiag25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17870), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17800), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6001,25 +4269,11 @@ static void BolligerMabillardTrackDiag25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17872), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17802), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6100,30 +4354,53 @@ static void BolligerMabillardTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17885, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17815, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17882, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17812, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17884, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17814, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17885), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17815), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6137,26 +4414,12 @@ static void BolligerMabillardTrackDiag60DegUp(
             break;
         case 1:
             if (trackElement.HasChain())
-            {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17882), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+            {
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17812), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6170,25 +4433,11 @@ static void BolligerMabillardTrackDiag60DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17884), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17814), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6269,30 +4518,53 @@ static void BolligerMabillardTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17865, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17795, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17862, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17792, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17864, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17794, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17865), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17795), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6307,25 +4579,11 @@ static void BolligerMabillardTrackDiagFlatTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17862), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17792), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6339,25 +4597,11 @@ static void BolligerMabillardTrackDiagFlatTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17864), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17794), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6438,30 +4682,53 @@ static void BolligerMabillardTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17877, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17807, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17874, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17804, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17876, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17806, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17877), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17807), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6476,25 +4743,11 @@ static void BolligerMabillardTrackDiag25DegUpTo60DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17874), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17804), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6508,25 +4761,11 @@ static void BolligerMabillardTrackDiag25DegUpTo60DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17876), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17806), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6607,30 +4846,53 @@ static void BolligerMabillardTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17881, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17811, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17878, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17808, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17880, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17810, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17881), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17811), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6645,25 +4907,11 @@ static void BolligerMabillardTrackDiag60DegUpTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17878), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17808), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6677,25 +4925,11 @@ static void BolligerMabillardTrackDiag60DegUpTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17880), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17810), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6776,30 +5010,53 @@ static void BolligerMabillardTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17869, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17799, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17866, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17796, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17868, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17798, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17869), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17799), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6814,25 +5071,11 @@ static void BolligerMabillardTrackDiag25DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17866), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17796), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6846,25 +5089,11 @@ static void BolligerMabillardTrackDiag25DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17868), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17798), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6945,30 +5174,53 @@ static void BolligerMabillardTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17871, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17801, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17872, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17802, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17870, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17800, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
-    {
-        case 0:
-            if (trackElement.HasChain())
-            {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17871), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
-            }
-            else
-            {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17801), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+    {
+        case 0:
+            if (trackElement.HasChain())
+            {
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
+            }
+            else
+            {
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6983,25 +5235,11 @@ static void BolligerMabillardTrackDiag25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17872), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17802), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7015,25 +5253,11 @@ static void BolligerMabillardTrackDiag25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17870), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17800), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7114,30 +5338,53 @@ static void BolligerMabillardTrackDiag60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17883, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17813, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17884, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17814, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17882, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17812, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17883), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17813), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7152,25 +5399,11 @@ static void BolligerMabillardTrackDiag60DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17884), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17814), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7184,25 +5417,11 @@ static void BolligerMabillardTrackDiag60DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17882), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17812), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7283,30 +5502,53 @@ static void BolligerMabillardTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17867, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17797, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17868, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17798, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17866, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17796, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17867), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17797), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7320,25 +5562,11 @@ static void BolligerMabillardTrackDiagFlatTo25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17868), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17798), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7351,25 +5579,11 @@ static void BolligerMabillardTrackDiagFlatTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17866), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17796), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7450,30 +5664,53 @@ static void BolligerMabillardTrackDiag25DegDownTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17879, { -16, -16, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17809, { -16, -16, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17880, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17810, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17878, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17808, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17879), { -16, -16, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17809), { -16, -16, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7488,25 +5725,11 @@ static void BolligerMabillardTrackDiag25DegDownTo60DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17880), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17810), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7520,25 +5743,11 @@ static void BolligerMabillardTrackDiag25DegDownTo60DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17878), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17808), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7619,30 +5828,53 @@ static void BolligerMabillardTrackDiag60DegDownTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17875, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17805, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17876, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17806, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17874, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17804, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17875), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17805), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7657,25 +5889,11 @@ static void BolligerMabillardTrackDiag60DegDownTo25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17876), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17806), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7689,25 +5907,11 @@ static void BolligerMabillardTrackDiag60DegDownTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17874), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17804), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7788,30 +5992,53 @@ static void BolligerMabillardTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17863, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17793, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17864, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17794, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17862, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17792, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            if (trackElement.HasChain())
-            {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17863), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+            if (trackElement.HasChain())
+            {
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17793), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7826,25 +6053,11 @@ static void BolligerMabillardTrackDiag25DegDownToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17864), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17794), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7858,25 +6071,11 @@ static void BolligerMabillardTrackDiag25DegDownToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17862), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17792), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7957,30 +6156,53 @@ static void BolligerMabillardTrackDiagFlatTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17889, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17819, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17886, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17816, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17888, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17818, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17889), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17819), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7995,25 +6217,11 @@ static void BolligerMabillardTrackDiagFlatTo60DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17886), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17816), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8027,25 +6235,11 @@ static void BolligerMabillardTrackDiagFlatTo60DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17888), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17818), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8126,30 +6320,53 @@ static void BolligerMabillardTrackDiag60DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17893, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17823, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17890, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17820, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17892, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17822, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17893), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17823), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8164,25 +6381,11 @@ static void BolligerMabillardTrackDiag60DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17890), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17820), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8196,25 +6399,11 @@ static void BolligerMabillardTrackDiag60DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17892), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17822), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8295,30 +6484,53 @@ static void BolligerMabillardTrackDiagFlatTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17891, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17821, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17892, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17822, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17890, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17820, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17891), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17821), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8333,25 +6545,11 @@ static void BolligerMabillardTrackDiagFlatTo60DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17892), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17822), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8365,25 +6563,11 @@ static void BolligerMabillardTrackDiagFlatTo60DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17890), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17820), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8464,30 +6648,53 @@ static void BolligerMabillardTrackDiag60DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17887, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17817, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17888, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17818, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17886, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17816, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17887), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17817), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8502,25 +6709,11 @@ static void BolligerMabillardTrackDiag60DegDownToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17888), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17818), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8534,25 +6727,11 @@ static void BolligerMabillardTrackDiag60DegDownToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17886), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17816), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 4 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8633,17 +6812,32 @@ static void BolligerMabillardTrackDiagFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17831, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17828, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17832, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17830, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17831), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8655,17 +6849,7 @@ static void BolligerMabillardTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17828), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17832), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8676,14 +6860,7 @@ static void BolligerMabillardTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17830), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8735,17 +6912,32 @@ static void BolligerMabillardTrackDiagFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17836, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17833, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17835, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17837, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17836), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8757,14 +6949,7 @@ static void BolligerMabillardTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17833), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8775,17 +6960,7 @@ static void BolligerMabillardTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17835), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17837), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8837,17 +7012,32 @@ static void BolligerMabillardTrackDiagLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17834, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17835, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17837, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17833, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17834), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8859,17 +7049,7 @@ static void BolligerMabillardTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17835), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17837), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8880,14 +7060,7 @@ static void BolligerMabillardTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17833), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8939,17 +7112,32 @@ static void BolligerMabillardTrackDiagRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17829, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17830, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17828, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17832, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17829), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8961,14 +7149,7 @@ static void BolligerMabillardTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17830), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8979,17 +7160,7 @@ static void BolligerMabillardTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17828), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17832), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9041,17 +7212,32 @@ static void BolligerMabillardTrackDiagLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17851, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17848, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17852, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17850, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17851), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9063,17 +7249,7 @@ static void BolligerMabillardTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17848), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17852), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9084,14 +7260,7 @@ static void BolligerMabillardTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17850), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9143,17 +7312,32 @@ static void BolligerMabillardTrackDiagRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17856, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17853, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17855, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17857, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17856), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9165,14 +7349,7 @@ static void BolligerMabillardTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17853), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9183,17 +7360,7 @@ static void BolligerMabillardTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17855), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17857), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9245,17 +7412,32 @@ static void BolligerMabillardTrackDiag25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17841, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17838, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17842, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17840, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17841), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9267,17 +7449,7 @@ static void BolligerMabillardTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17838), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17842), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9288,14 +7460,7 @@ static void BolligerMabillardTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17840), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9347,17 +7512,32 @@ static void BolligerMabillardTrackDiag25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17846, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17843, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17845, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17847, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17846), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9369,14 +7549,7 @@ static void BolligerMabillardTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17843), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9387,17 +7560,7 @@ static void BolligerMabillardTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17845), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17847), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9449,17 +7612,32 @@ static void BolligerMabillardTrackDiagLeftBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17844, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17845, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17847, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17843, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17844), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9470,17 +7648,7 @@ static void BolligerMabillardTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17845), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17847), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9490,14 +7658,7 @@ static void BolligerMabillardTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17843), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9549,17 +7710,32 @@ static void BolligerMabillardTrackDiagRightBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17839), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17839, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17840, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17838, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17842, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
+    switch (trackSequence)
+    {
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9570,14 +7746,7 @@ static void BolligerMabillardTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17840), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9587,17 +7756,7 @@ static void BolligerMabillardTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17838), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17842), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9649,17 +7808,32 @@ static void BolligerMabillardTrackDiag25DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17854, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17855, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17857, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17853, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17854), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9671,17 +7845,7 @@ static void BolligerMabillardTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17855), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17857), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9692,14 +7856,7 @@ static void BolligerMabillardTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17853), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9751,17 +7908,32 @@ static void BolligerMabillardTrackDiag25DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17849, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17850, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17848, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17852, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17849), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9773,14 +7945,7 @@ static void BolligerMabillardTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17850), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9791,17 +7956,7 @@ static void BolligerMabillardTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17848), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17852), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9853,17 +8008,29 @@ static void BolligerMabillardTrackDiagLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17827, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17824, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17826, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17827), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9875,14 +8042,7 @@ static void BolligerMabillardTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17824), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9893,14 +8053,7 @@ static void BolligerMabillardTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17826), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9952,17 +8105,29 @@ static void BolligerMabillardTrackDiagRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17825, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17826, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17824, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17825), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9974,14 +8139,7 @@ static void BolligerMabillardTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17826), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9992,14 +8150,7 @@ static void BolligerMabillardTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17824), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10051,31 +8202,26 @@ static void BolligerMabillardTrackLeftBankToLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17725, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17727, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17731, { 0, 6, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17729, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17723, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17724, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17726, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17728, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17722, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17725), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17727), { 0, 6, height }, { 32, 20, 3 });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17731), { 0, 6, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17729), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17723), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10098,25 +8244,7 @@ static void BolligerMabillardTrackLeftBankToLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17724), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17726), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17728), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17722), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -10145,31 +8273,20 @@ static void BolligerMabillardTrackRightBankToRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17714, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17716, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17718, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17730, { 0, 6, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17720, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17714), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17716), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17718), { 0, 6, height }, { 32, 20, 3 });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17730), { 0, 6, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17720), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10246,6 +8363,16 @@ static void BolligerMabillardTrackLeftQuarterTurn325DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17716, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 17718, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17730, { 6, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17720, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17714, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -10297,28 +8424,7 @@ static void BolligerMabillardTrackLeftQuarterTurn325DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17716), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17718), { 6, 0, height }, { 20, 32, 3 });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17730), { 6, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17720), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17714), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -10347,28 +8453,26 @@ static void BolligerMabillardTrackRightQuarterTurn325DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17722, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17724, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17726, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17728, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17723, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17725, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 17727, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17731, { 6, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17729, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17722), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17724), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17726), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17728), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10391,28 +8495,7 @@ static void BolligerMabillardTrackRightQuarterTurn325DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17723), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17725), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17727), { 6, 0, height }, { 20, 32, 3 });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17731), { 6, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17729), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -10471,29 +8554,23 @@ static void BolligerMabillardTrackLeftBankedQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18025), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18027), { 0, 6, height },
-                        { { 0, 27, height }, { 32, 1, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18029), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18023), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 18025, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18027, { 0, 6, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 18029, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18023, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 18024, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 18026, { 6, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 18028, { 6, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 18022, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
+    switch (trackSequence)
+    {
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10516,27 +8593,7 @@ static void BolligerMabillardTrackLeftBankedQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18024), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18026), { 6, 0, height },
-                        { { 27, 0, height }, { 1, 32, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18028), { 6, 0, height },
-                        { { 27, 0, height }, { 1, 32, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18022), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -10565,29 +8622,17 @@ static void BolligerMabillardTrackRightBankedQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 18014, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18016, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18018, { 0, 6, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 18020, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18014), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18016), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18018), { 0, 6, height },
-                        { { 0, 27, height }, { 32, 1, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18020), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10686,32 +8731,41 @@ static void BolligerMabillardTrackLeftBankedQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17978, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17983, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17988, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17993, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17979, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17984, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17989, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17994, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17980, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17985, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17990, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17995, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17981, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17986, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17991, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17996, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17982, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17987, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17992, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17997, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17978), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17983), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17988), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17993), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10731,28 +8785,7 @@ static void BolligerMabillardTrackLeftBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17979), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17984), { 0, 0, height },
-                        { { 30, 30, height }, { 1, 1, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17989), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17994), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10764,28 +8797,7 @@ static void BolligerMabillardTrackLeftBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17980), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17985), { 0, 0, height },
-                        { { 30, 30, height }, { 1, 1, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17990), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17995), { 0, 0, height }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10800,29 +8812,7 @@ static void BolligerMabillardTrackLeftBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17981), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17986), { 0, 0, height },
-                        { { 30, 30, height }, { 1, 1, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17991), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17996), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10834,29 +8824,7 @@ static void BolligerMabillardTrackLeftBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17982), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17987), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17992), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17997), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -10885,32 +8853,41 @@ static void BolligerMabillardTrackRightBankedQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17958, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17963, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17968, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17973, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17959, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17964, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17969, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17974, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17960, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17965, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17970, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17975, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17961, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17966, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17971, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17976, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17962, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17967, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17972, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17977, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17958), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17963), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17968), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17973), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10930,28 +8907,7 @@ static void BolligerMabillardTrackRightBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17959), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17964), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17969), { 0, 0, height },
-                        { { 30, 30, height }, { 1, 1, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17974), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10963,28 +8919,7 @@ static void BolligerMabillardTrackRightBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17960), { 0, 0, height }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17965), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17970), { 0, 0, height },
-                        { { 30, 30, height }, { 1, 1, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17975), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10998,29 +8933,7 @@ static void BolligerMabillardTrackRightBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17961), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17966), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17971), { 0, 0, height },
-                        { { 30, 30, height }, { 1, 1, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17976), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -11032,29 +8945,7 @@ static void BolligerMabillardTrackRightBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17962), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17967), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17972), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17977), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -11089,46 +8980,31 @@ static void BolligerMabillardTrackLeftBankedQuarterTurn525DegDown(
 }
 
 template<MetalSupportType supportType>
-static void BolligerMabillardTrackRightBankedQuarterTurn525DegDown(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    trackSequence = kMapLeftQuarterTurn5TilesToRightQuarterTurn5Tiles[trackSequence];
-    BolligerMabillardTrackLeftBankedQuarterTurn525DegUp<supportType>(
-        session, ride, trackSequence, (direction - 1) & 3, height, trackElement);
-}
-
-template<MetalSupportType supportType>
-static void BolligerMabillardTrack25DegUpToLeftBanked25DegUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17922), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17923), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17930), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17924), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17925), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+static void BolligerMabillardTrackRightBankedQuarterTurn525DegDown(
+    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
+    const TrackElement& trackElement)
+{
+    trackSequence = kMapLeftQuarterTurn5TilesToRightQuarterTurn5Tiles[trackSequence];
+    BolligerMabillardTrackLeftBankedQuarterTurn525DegUp<supportType>(
+        session, ride, trackSequence, (direction - 1) & 3, height, trackElement);
+}
+
+template<MetalSupportType supportType>
+static void BolligerMabillardTrack25DegUpToLeftBanked25DegUp(
+    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
+    const TrackElement& trackElement)
+{
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17922, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17923, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17930, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17924, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17925, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -11150,32 +9026,17 @@ static void BolligerMabillardTrack25DegUpToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17926), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17927), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17928), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17931), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17929), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17926, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17927, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17928, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17931, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17929, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -11197,32 +9058,17 @@ static void BolligerMabillardTrackLeftBanked25DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17932), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17933), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17940), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17934), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17935), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17932, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17933, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17940, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17934, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17935, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -11244,32 +9090,17 @@ static void BolligerMabillardTrackRightBanked25DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17936), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17937), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17938), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17941), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17939), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17936, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17937, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17938, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17941, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17939, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -11327,29 +9158,14 @@ static void BolligerMabillardTrackLeftBankedFlatToLeftBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17942), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17943), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17944), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17945), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17942, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17943, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17944, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17945, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -11371,29 +9187,14 @@ static void BolligerMabillardTrackRightBankedFlatToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17946), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17947), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17948), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17949), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17946, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17947, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17948, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17949, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -11415,29 +9216,14 @@ static void BolligerMabillardTrackLeftBanked25DegUpToLeftBankedFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17950), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17951), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17952), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17953), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17950, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17951, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17952, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17953, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -11459,29 +9245,14 @@ static void BolligerMabillardTrackRightBanked25DegUpToRightBankedFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17954), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17955), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17956), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17957), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17954, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17955, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17956, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17957, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -11539,32 +9310,17 @@ static void BolligerMabillardTrackFlatToLeftBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17894), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17895), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17902), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17896), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17897), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17894, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17895, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17902, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17896, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17897, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -11586,32 +9342,17 @@ static void BolligerMabillardTrackFlatToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17898), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17899), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17900), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17903), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17901), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17898, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17899, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17900, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17903, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17901, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -11633,32 +9374,17 @@ static void BolligerMabillardTrackLeftBanked25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17904), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17905), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17912), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17906), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17907), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17904, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17905, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17912, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17906, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17907, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -11680,32 +9406,17 @@ static void BolligerMabillardTrackRightBanked25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17908), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17909), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17910), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17913), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17911), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17908, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17909, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17910, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17913, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17911, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -11763,38 +9474,23 @@ static void BolligerMabillardTrackLeftQuarterTurn190DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17998, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } } },
+        {
+            { 17999, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } },
+            { 18007, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } },
+        },
+        { { 18008, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        {
+            { 18001, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } },
+            { 18009, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17998), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17999), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18007), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18008), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18001), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18009), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 96);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -11810,38 +9506,23 @@ static void BolligerMabillardTrackRightQuarterTurn190DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 18002, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } },
+            { 18010, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } },
+        },
+        { { 18011, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        {
+            { 18004, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } },
+            { 18012, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } },
+        },
+        { { 18005, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18002), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18010), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18011), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18004), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18012), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18005), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 96);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -11876,70 +9557,39 @@ static void BolligerMabillardTrackFlatTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17464, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+        {
+            { 17465, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17468, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        {
+            { 17466, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17469, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        { { 17467, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17452, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+        {
+            { 17453, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17456, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        {
+            { 17454, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17457, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        { { 17455, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17464), { 0, 0, height },
-                    { { 0, 2, height }, { 32, 27, 4 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17465), { 0, 0, height },
-                    { { 29, 4, height + 2 }, { 1, 24, 43 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17468), { 0, 0, height },
-                    { { 0, 4, height }, { 32, 2, 43 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17466), { 0, 0, height },
-                    { { 29, 4, height + 2 }, { 1, 24, 43 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17469), { 0, 0, height },
-                    { { 0, 4, height }, { 32, 2, 43 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17467), { 0, 0, height },
-                    { { 0, 2, height }, { 32, 27, 4 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17452), { 0, 0, height },
-                    { { 0, 2, height }, { 32, 27, 4 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17453), { 0, 0, height },
-                    { { 29, 4, height + 2 }, { 1, 24, 43 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17456), { 0, 0, height },
-                    { { 0, 4, height }, { 32, 2, 43 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17454), { 0, 0, height },
-                    { { 29, 4, height + 2 }, { 1, 24, 43 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17457), { 0, 0, height },
-                    { { 0, 4, height }, { 32, 2, 43 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17455), { 0, 0, height },
-                    { { 0, 2, height }, { 32, 27, 4 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
     }
     if (direction == 0 || direction == 3)
@@ -11959,70 +9609,39 @@ static void BolligerMabillardTrack60DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17470, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+        {
+            { 17471, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17474, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        {
+            { 17472, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17475, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        { { 17473, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17458, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+        {
+            { 17459, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17462, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        {
+            { 17460, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17463, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        { { 17461, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17470), { 0, 0, height },
-                    { { 0, 2, height }, { 32, 27, 4 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17471), { 0, 0, height },
-                    { { 29, 4, height + 2 }, { 1, 24, 43 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17474), { 0, 0, height },
-                    { { 0, 4, height }, { 32, 2, 43 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17472), { 0, 0, height },
-                    { { 29, 4, height + 2 }, { 1, 24, 43 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17475), { 0, 0, height },
-                    { { 0, 4, height }, { 32, 2, 43 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17473), { 0, 0, height },
-                    { { 0, 2, height }, { 32, 27, 4 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 16, height, session.SupportColours);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17458), { 0, 0, height },
-                    { { 0, 2, height }, { 32, 27, 4 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17459), { 0, 0, height },
-                    { { 29, 4, height + 2 }, { 1, 24, 43 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17462), { 0, 0, height },
-                    { { 0, 4, height }, { 32, 2, 43 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17460), { 0, 0, height },
-                    { { 29, 4, height + 2 }, { 1, 24, 43 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17463), { 0, 0, height },
-                    { { 0, 4, height }, { 32, 2, 43 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17461), { 0, 0, height },
-                    { { 0, 2, height }, { 32, 27, 4 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 16, height, session.SupportColours);
     }
     if (direction == 0 || direction == 3)
@@ -12058,35 +9677,20 @@ static void BolligerMabillardTrackBrakeForDrop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17482), { 0, 0, height },
-                { { 29, 4, height + 2 }, { 1, 24, 43 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17485), { 0, 0, height },
-                { { 0, 4, height }, { 32, 2, 43 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17483), { 0, 0, height },
-                { { 0, 2, height }, { 32, 27, 4 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17480), { 0, 0, height },
-                { { 0, 2, height }, { 32, 27, 4 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17481), { 0, 0, height },
-                { { 29, 4, height + 2 }, { 1, 24, 43 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17484), { 0, 0, height },
-                { { 0, 4, height }, { 32, 2, 43 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17482, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17485, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        { { 17483, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+        { { 17480, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+        {
+            { 17481, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { 17484, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 16, height, session.SupportColours);
     if (direction == 0 || direction == 3)
     {
@@ -12106,28 +9710,29 @@ static void BolligerMabillardTrackHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17626, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17634, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 11 } } } },
+        { { 17633, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { 17641, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17628, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 17636, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 17631, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 12, 119 } } } },
+        { { 17639, { 16, 16, 0 }, { { 15, 6, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17629, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17637, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17630, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+        { { 17638, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17626), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17634), { 0, 6, height }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17633), { 0, 6, height }, { 32, 20, 9 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17641), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -12172,27 +9777,7 @@ static void BolligerMabillardTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17628), { 16, 0, height }, { 2, 16, 119 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17636), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17631), { 10, 16, height }, { 4, 12, 119 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17639), { 16, 16, height },
-                        { { 15, 6, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -12204,25 +9789,7 @@ static void BolligerMabillardTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17629), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17637), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17630), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17638), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
@@ -12247,32 +9814,29 @@ static void BolligerMabillardTrackLeftCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17690, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 17693, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 17696, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 17699, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17691, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 17694, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 17697, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 17700, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17692, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17695, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17698, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17701, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17690), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17693), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17696), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17699), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             TrackPaintUtilLeftCorkscrewUpSupports(session, direction, height);
 
@@ -12283,56 +9847,12 @@ static void BolligerMabillardTrackLeftCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17691), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17694), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17697), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17700), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17692), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17695), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17698), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17701), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -12363,32 +9883,29 @@ static void BolligerMabillardTrackRightCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17702, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 17705, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 17708, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 17711, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17703, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 17706, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 17709, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 17712, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17704, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17707, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17710, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17713, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17702), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17705), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17708), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17711), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -12405,56 +9922,12 @@ static void BolligerMabillardTrackRightCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17703), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17706), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17709), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17712), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17704), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17707), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17710), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17713), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -12503,32 +9976,35 @@ static void BolligerMabillardTrackFlatTo60DegUpLongBase(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 18030, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18034, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18038, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18042, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 18031, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18035, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18039, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18043, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 18032, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18036, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18040, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18044, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 18033, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18037, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 18041, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 18045, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18030), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18034), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18038), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18042), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -12542,29 +10018,7 @@ static void BolligerMabillardTrackFlatTo60DegUpLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18031), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18035), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18039), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18043), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
@@ -12574,29 +10028,7 @@ static void BolligerMabillardTrackFlatTo60DegUpLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18032), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18036), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18040), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18044), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 9, height, session.SupportColours);
@@ -12606,29 +10038,7 @@ static void BolligerMabillardTrackFlatTo60DegUpLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18033), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18037), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18041), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18045), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 18, height, session.SupportColours);
@@ -12655,32 +10065,35 @@ static void BolligerMabillardTrack60DegUpToFlatLongBase(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 18046, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18050, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 18054, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 18058, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 18047, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18051, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18055, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18059, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 18048, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18052, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18056, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18060, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 18049, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18053, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18057, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18061, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18046), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18050), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18054), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18058), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 20, height, session.SupportColours);
@@ -12694,29 +10107,7 @@ static void BolligerMabillardTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 80);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18047), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18051), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18055), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18059), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 16, height, session.SupportColours);
@@ -12726,29 +10117,7 @@ static void BolligerMabillardTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 80);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18048), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18052), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18056), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18060), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 13, height, session.SupportColours);
@@ -12758,29 +10127,7 @@ static void BolligerMabillardTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18049), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18053), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18057), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18061), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 5, height, session.SupportColours);
@@ -12824,6 +10171,43 @@ static void BolligerMabillardTrackLeftBarrelRollUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17643, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17667, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17646, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17670, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17649, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17673, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17652, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17676, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 17644, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17668, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17647, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17671, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17650, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17674, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17653, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17677, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -12885,41 +10269,7 @@ static void BolligerMabillardTrackLeftBarrelRollUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17643), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17667), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17646), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17670), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17649), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17673), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17652), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17676), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -12931,41 +10281,7 @@ static void BolligerMabillardTrackLeftBarrelRollUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17644), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17668), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17647), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17671), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17650), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17674), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17653), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17677), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             switch (direction)
             {
                 case 1:
@@ -12993,6 +10309,43 @@ static void BolligerMabillardTrackRightBarrelRollUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17655, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17679, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17658, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17682, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17661, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17685, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17664, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17688, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 17656, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17680, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17659, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17683, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17662, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17686, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 17665, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17689, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -13054,41 +10407,7 @@ static void BolligerMabillardTrackRightBarrelRollUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17655), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17679), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17658), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17682), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17661), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17685), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17664), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17688), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13100,41 +10419,7 @@ static void BolligerMabillardTrackRightBarrelRollUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17656), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17680), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17659), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17683), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17662), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17686), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17665), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17689), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             switch (direction)
             {
                 case 1:
@@ -13180,29 +10465,14 @@ static void BolligerMabillardTrackPoweredLift(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17476), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17477), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17478), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17479), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17476, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17477, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17478, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17479, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
     if (direction == 0 || direction == 3)
     {
@@ -13221,32 +10491,47 @@ static void BolligerMabillardTrackLeftLargeHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17732, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17739, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17746, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17753, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17733, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17740, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { 17747, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17754, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17734, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17741, { 0, 0, 0 }, { { 0, 0, 70 }, { 32, 16, 0 } } } },
+        { { 17748, { 0, 0, 0 }, { { 0, 16, 70 }, { 32, 16, 0 } } } },
+        { { 17755, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 17736, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17743, { 0, 0, 0 }, { { 0, 16, 110 }, { 16, 16, 0 } } } },
+        { { 17750, { 0, 0, 0 }, { { 0, 0, 100 }, { 16, 16, 0 } } } },
+        { { 17757, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17737, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17744, { 0, 0, 0 }, { { 0, 16, 200 }, { 32, 16, 0 } } } },
+        { { 17751, { 0, 0, 0 }, { { 0, 0, 200 }, { 32, 16, 0 } } } },
+        { { 17758, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17738, { 0, 0, 0 }, { { 0, 16, 32 }, { 32, 16, 0 } } } },
+        { { 17745, { 0, 0, 0 }, { { 0, 16, 32 }, { 32, 16, 0 } } } },
+        { { 17752, { 0, 0, 0 }, { { 0, 0, 32 }, { 32, 16, 0 } } } },
+        { { 17759, { 0, 0, 0 }, { { 0, 0, 32 }, { 32, 16, 0 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17732), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17739), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17746), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17753), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -13257,58 +10542,14 @@ static void BolligerMabillardTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17733), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17740), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 9 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17747), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17754), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 9, height, session.SupportColours);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17734), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17741), { 0, 0, height },
-                        { { 0, 0, height + 70 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17748), { 0, 0, height },
-                        { { 0, 16, height + 70 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17755), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13362,29 +10603,7 @@ static void BolligerMabillardTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17736), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17743), { 0, 0, height },
-                        { { 0, 16, height + 110 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17750), { 0, 0, height },
-                        { { 0, 0, height + 100 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17757), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13396,29 +10615,7 @@ static void BolligerMabillardTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 128);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17737), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17744), { 0, 0, height },
-                        { { 0, 16, height + 200 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17751), { 0, 0, height },
-                        { { 0, 0, height + 200 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17758), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13430,29 +10627,7 @@ static void BolligerMabillardTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17738), { 0, 0, height },
-                        { { 0, 16, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17745), { 0, 0, height },
-                        { { 0, 16, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17752), { 0, 0, height },
-                        { { 0, 0, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17759), { 0, 0, height },
-                        { { 0, 0, height + 32 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
@@ -13475,32 +10650,47 @@ static void BolligerMabillardTrackRightLargeHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17781, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17774, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17767, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17760, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17782, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17775, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17768, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { 17761, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17783, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17776, { 0, 0, 0 }, { { 0, 16, 70 }, { 32, 16, 0 } } } },
+        { { 17769, { 0, 0, 0 }, { { 0, 0, 70 }, { 32, 16, 0 } } } },
+        { { 17762, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 17785, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17778, { 0, 0, 0 }, { { 0, 0, 100 }, { 16, 16, 0 } } } },
+        { { 17771, { 0, 0, 0 }, { { 0, 16, 110 }, { 16, 16, 0 } } } },
+        { { 17764, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17786, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17779, { 0, 0, 0 }, { { 0, 0, 200 }, { 32, 16, 0 } } } },
+        { { 17772, { 0, 0, 0 }, { { 0, 16, 200 }, { 32, 16, 0 } } } },
+        { { 17765, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17787, { 0, 0, 0 }, { { 0, 0, 32 }, { 32, 16, 0 } } } },
+        { { 17780, { 0, 0, 0 }, { { 0, 0, 32 }, { 32, 16, 0 } } } },
+        { { 17773, { 0, 0, 0 }, { { 0, 16, 32 }, { 32, 16, 0 } } } },
+        { { 17766, { 0, 0, 0 }, { { 0, 16, 32 }, { 32, 16, 0 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17781), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17774), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17767), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17760), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -13511,58 +10701,14 @@ static void BolligerMabillardTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17782), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17775), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17768), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 9 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17761), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 9, height, session.SupportColours);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17783), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17776), { 0, 0, height },
-                        { { 0, 16, height + 70 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17769), { 0, 0, height },
-                        { { 0, 0, height + 70 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17762), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13616,29 +10762,7 @@ static void BolligerMabillardTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17785), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17778), { 0, 0, height },
-                        { { 0, 0, height + 100 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17771), { 0, 0, height },
-                        { { 0, 16, height + 110 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17764), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13650,63 +10774,19 @@ static void BolligerMabillardTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 128);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17786), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17779), { 0, 0, height },
-                        { { 0, 0, height + 200 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17772), { 0, 0, height },
-                        { { 0, 16, height + 200 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17765), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
-            PaintUtilSetSegmentSupportHeight(
-                session,
-                PaintUtilRotateSegments(
-                    EnumsToFlags(
-                        PaintSegment::topCorner, PaintSegment::leftCorner, PaintSegment::centre, PaintSegment::topLeftSide,
-                        PaintSegment::topRightSide, PaintSegment::bottomLeftSide),
-                    direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 224);
-            break;
-        case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17787), { 0, 0, height },
-                        { { 0, 0, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17780), { 0, 0, height },
-                        { { 0, 0, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17773), { 0, 0, height },
-                        { { 0, 16, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17766), { 0, 0, height },
-                        { { 0, 16, height + 32 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
+            PaintUtilSetSegmentSupportHeight(
+                session,
+                PaintUtilRotateSegments(
+                    EnumsToFlags(
+                        PaintSegment::topCorner, PaintSegment::leftCorner, PaintSegment::centre, PaintSegment::topLeftSide,
+                        PaintSegment::topRightSide, PaintSegment::bottomLeftSide),
+                    direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 224);
+            break;
+        case 6:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
@@ -13745,32 +10825,29 @@ static void BolligerMabillardTrack90DegToInvertedFlatQuarterLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 18062, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18065, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18068, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18071, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 18063, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+        { { 18066, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 18069, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 18072, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 18064, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 18067, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18070, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18073, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18062), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18065), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18068), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18071), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13779,29 +10856,7 @@ static void BolligerMabillardTrack90DegToInvertedFlatQuarterLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18063), { 0, 0, height },
-                        { { -8, 6, height }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18066), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18069), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18072), { 0, 0, height },
-                        { { -8, 6, height }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13810,29 +10865,7 @@ static void BolligerMabillardTrack90DegToInvertedFlatQuarterLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18064), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18067), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18070), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18073), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 16, TunnelType::SquareFlat);
@@ -13890,32 +10923,29 @@ static void BolligerMabillardTrackLeftTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27430, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27436, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27429, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27435, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27431, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27437, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27428, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27434, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27432, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27438, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27427, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27433, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27430), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27436), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27429), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27435), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height - 5, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -13932,25 +10962,7 @@ static void BolligerMabillardTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27431), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27437), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27428), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27434), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13962,25 +10974,7 @@ static void BolligerMabillardTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27432), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27438), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27427), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27433), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -14010,32 +11004,29 @@ static void BolligerMabillardTrackRightTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27442, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27448, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27441, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27447, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27443, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27449, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27440, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27446, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27444, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27450, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27439, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27445, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27442), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27448), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27441), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27447), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height - 5, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -14052,25 +11043,7 @@ static void BolligerMabillardTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27443), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27449), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27440), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27446), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -14082,25 +11055,7 @@ static void BolligerMabillardTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27444), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27450), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27439), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27445), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -14130,28 +11085,29 @@ static void BolligerMabillardTrackLeftTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27427, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27433, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27432, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27438, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27428, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27434, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27431, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27437, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27429, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27435, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27430, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27436, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27427), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27433), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27432), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27438), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -14169,25 +11125,7 @@ static void BolligerMabillardTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27428), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27434), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27431), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27437), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -14199,29 +11137,7 @@ static void BolligerMabillardTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27429), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27435), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27430), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27436), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height - 5, session.SupportColours);
             switch (direction)
             {
@@ -14250,28 +11166,29 @@ static void BolligerMabillardTrackRightTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27439, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27445, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27444, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 27450, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27440, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27446, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27443, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 27449, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27441, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27447, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27442, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+        { { 27448, { 0, 6, -5 }, { { 0, 0, 6 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27439), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27445), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27444), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27450), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -14289,25 +11206,7 @@ static void BolligerMabillardTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27440), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27446), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27443), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27449), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -14319,29 +11218,7 @@ static void BolligerMabillardTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27441), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27447), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27442), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27448), { 0, 6, height - 5 },
-                        { { 0, 0, height + 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height - 5, session.SupportColours);
             switch (direction)
             {
@@ -213,6 +213,25 @@ static void classicStandUpRCTrackBankedRightQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { kClassicStandUpRcRightTurn5TilesBanked0_1, { 0, 16, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked1_1, { 0, 16, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked2_1, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked3_1, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { kClassicStandUpRcRightTurn5TilesBanked0_2, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked1_2, { 16, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked2_2, { 16, 16, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked3_2, { 0, 16, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { kClassicStandUpRcRightTurn5TilesBanked0_3, { 16, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked1_3, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked2_3, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { kClassicStandUpRcRightTurn5TilesBanked3_3, { 16, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -251,29 +270,7 @@ static void classicStandUpRCTrackBankedRightQuarterTurn5(
             break;
 
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked0_1),
-                        { 0, 16, height }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked1_1),
-                        { 0, 16, height }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked2_1),
-                        { 0, 0, height }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked3_1),
-                        { 0, 0, height }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -285,29 +282,7 @@ static void classicStandUpRCTrackBankedRightQuarterTurn5(
             break;
 
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked0_2),
-                        { 0, 0, height }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked1_2),
-                        { 16, 0, height }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked2_2),
-                        { 16, 16, height }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked3_2),
-                        { 0, 16, height }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -321,29 +296,7 @@ static void classicStandUpRCTrackBankedRightQuarterTurn5(
             break;
 
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked0_3),
-                        { 16, 0, height }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked1_3),
-                        { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked2_3),
-                        { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(kClassicStandUpRcRightTurn5TilesBanked3_3),
-                        { 16, 0, height }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1130,17 +1083,35 @@ template<ImageIndex img0, ImageIndex img1, ImageIndex img2, ImageIndex img3>
 static void classicStandUpRCTrackDiagFlatTo25DegUpBanked(
     PaintSession& session, uint8_t trackSequence, uint8_t direction, int32_t height)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { img3, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { img0, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { img2, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { img1, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(img3), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1151,14 +1122,7 @@ static void classicStandUpRCTrackDiagFlatTo25DegUpBanked(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(img0), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1168,14 +1132,7 @@ static void classicStandUpRCTrackDiagFlatTo25DegUpBanked(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(img2), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1186,14 +1143,7 @@ static void classicStandUpRCTrackDiagFlatTo25DegUpBanked(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(img1), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalBSupportsPaintSetupRotated(
                 session, kSupportType, MetalSupportPlace::LeftCorner, direction, 4, height, session.SupportColours);
 
@@ -1253,17 +1203,35 @@ template<ImageIndex img0, ImageIndex img1, ImageIndex img2, ImageIndex img3>
 static void classicStandUpRCTrackDiag25DegUpToFlatBanked(
     PaintSession& session, uint8_t trackSequence, uint8_t direction, int32_t height)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { img3, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { img0, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { img2, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { img1, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(img3), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1274,14 +1242,7 @@ static void classicStandUpRCTrackDiag25DegUpToFlatBanked(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(img0), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1291,14 +1252,7 @@ static void classicStandUpRCTrackDiag25DegUpToFlatBanked(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(img2), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1309,14 +1263,7 @@ static void classicStandUpRCTrackDiag25DegUpToFlatBanked(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(img1), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalBSupportsPaintSetupRotated(
                 session, kSupportType, MetalSupportPlace::LeftCorner, direction, 8, height, session.SupportColours);
 
@@ -57,41 +57,26 @@ static void CompactInvertedRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26557, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26558, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26557, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26558, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26555, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26556, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26555, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26556, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26557), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26558), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26555), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26556), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -137,57 +122,26 @@ static void CompactInvertedRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26621, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26622, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26623, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26624, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26569, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26570, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26571, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26572, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26621), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26622), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26623), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26624), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26569), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26570), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26571), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26572), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -230,57 +184,26 @@ static void CompactInvertedRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26637, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+        { { 26638, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 26639, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 26640, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26585, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+        { { 26586, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 26587, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 26588, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26637), { 0, 0, height + 29 },
-                    { { 0, 6, height + 93 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26638), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 81 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26639), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 81 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26640), { 0, 0, height + 29 },
-                    { { 0, 6, height + 93 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26585), { 0, 0, height + 29 },
-                    { { 0, 6, height + 93 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26586), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 81 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26587), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 81 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26588), { 0, 0, height + 29 },
-                    { { 0, 6, height + 93 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
     if (direction == 0 || direction == 3)
     {
@@ -299,57 +222,26 @@ static void CompactInvertedRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26613, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26614, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26615, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26616, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26561, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26562, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26563, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26564, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26613), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26614), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26615), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26616), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26561), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26562), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26563), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26564), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -392,69 +284,38 @@ static void CompactInvertedRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26625, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 26629, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26626, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 26630, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26627, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 26628, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26573, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 26577, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26574, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 26578, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26575, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 26576, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26625), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26629), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26626), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26630), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26627), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26628), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26573), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26577), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26574), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26578), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26575), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26576), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
     if (direction == 0 || direction == 3)
     {
@@ -473,69 +334,38 @@ static void CompactInvertedRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26631, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 26635, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26632, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 26636, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26633, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 26634, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26579, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 26583, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26580, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 26584, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26581, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 26582, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26631), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26635), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26632), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26636), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26633), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26634), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26579), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26583), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26580), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26584), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26581), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26582), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -578,57 +408,26 @@ static void CompactInvertedRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26617, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26618, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26619, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26620, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26565, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26566, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26567, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26568, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26617), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26618), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26619), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26620), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26565), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26566), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26567), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26568), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -719,32 +518,41 @@ static void CompactInvertedRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26694, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26699, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26704, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26689, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26693, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26698, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26703, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26688, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26692, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26697, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26702, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26687, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26691, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26696, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26701, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26686, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26690, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26695, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26700, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26685, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26694), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26699), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26704), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26689), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -766,27 +574,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26693), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26698), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26703), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26688), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -798,28 +586,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26692), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26697), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26702), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26687), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -834,27 +601,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26691), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26696), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26701), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26686), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -866,29 +613,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26690), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26695), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26700), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26685), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -928,29 +653,14 @@ static void CompactInvertedRCTrackFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26657), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26658), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26659), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26660), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26657, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26658, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26659, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26660, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -974,29 +684,14 @@ static void CompactInvertedRCTrackFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26661), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26662), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26663), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26664), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26661, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26662, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26663, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26664, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1020,29 +715,14 @@ static void CompactInvertedRCTrackLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26663), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26664), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26661), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26662), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26663, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26664, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26661, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26662, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1066,29 +746,14 @@ static void CompactInvertedRCTrackRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26659), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26660), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26657), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26658), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26659, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26660, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26657, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26658, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1112,32 +777,41 @@ static void CompactInvertedRCTrackBankedLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26738, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26743, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26748, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26733, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26737, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26742, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26747, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26732, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26736, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26741, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26746, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26731, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26735, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26740, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26745, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26730, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26734, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26739, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26744, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26729, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26738), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26743), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26748), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26733), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1159,27 +833,7 @@ static void CompactInvertedRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26737), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26742), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26747), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26732), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1191,28 +845,7 @@ static void CompactInvertedRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26736), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26741), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26746), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26731), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1227,27 +860,7 @@ static void CompactInvertedRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26735), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26740), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26745), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26730), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1259,29 +872,7 @@ static void CompactInvertedRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26734), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26739), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26744), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26729), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1321,29 +912,14 @@ static void CompactInvertedRCTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26665), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26666), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26667), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26668), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26665, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26666, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26667, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26668, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1392,29 +968,14 @@ static void CompactInvertedRCTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26669), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26670), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26671), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26672), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26669, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26670, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26671, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26672, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1463,29 +1024,14 @@ static void CompactInvertedRCTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26673), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26674), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26675), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26676), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26673, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26674, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26675, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26676, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1534,29 +1080,14 @@ static void CompactInvertedRCTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26677), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26678), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26679), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26680), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26677, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26678, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26679, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26680, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1637,29 +1168,14 @@ static void CompactInvertedRCTrackLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26681), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26682), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26683), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26684), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26681, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26682, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26683, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26684, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1691,28 +1207,41 @@ static void CompactInvertedRCTrackLeftQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26949, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26954, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26959, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26964, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26950, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26955, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26960, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26965, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26951, { 0, 16, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26956, { 16, 16, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26961, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26966, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26952, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26957, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26962, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26967, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26953, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26958, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26963, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26968, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26949), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26954), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26959), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26964), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1734,25 +1263,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26950), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26955), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26960), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26965), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1764,25 +1275,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26951), { 0, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26956), { 16, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26961), { 16, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26966), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1797,25 +1290,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26952), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26957), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26962), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26967), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1827,25 +1302,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26953), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26958), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26963), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26968), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1876,28 +1333,41 @@ static void CompactInvertedRCTrackRightQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26929, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26934, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26939, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26944, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26930, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26935, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26940, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26945, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26931, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26936, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26941, { 16, 16, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26946, { 0, 16, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26932, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26937, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26942, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26947, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26933, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26938, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26943, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26948, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26929), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26934), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26939), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26944), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1919,25 +1389,7 @@ static void CompactInvertedRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26930), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26935), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26940), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26945), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1949,25 +1401,7 @@ static void CompactInvertedRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26931), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26936), { 16, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26941), { 16, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26946), { 0, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1981,25 +1415,7 @@ static void CompactInvertedRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26932), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26937), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26942), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26947), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2011,25 +1427,7 @@ static void CompactInvertedRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26933), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26938), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26943), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26948), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2078,32 +1476,35 @@ static void CompactInvertedRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26641, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26645, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26644, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26648, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26642, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26646, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26643, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26647, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26643, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26647, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26642, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26646, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26644, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26648, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26641, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26645, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26641), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26645), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26644), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26648), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2122,27 +1523,7 @@ static void CompactInvertedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26642), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26646), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26643), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26647), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2167,27 +1548,7 @@ static void CompactInvertedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26643), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26647), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26642), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26646), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2212,29 +1573,7 @@ static void CompactInvertedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26644), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26648), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26641), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26645), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2265,32 +1604,35 @@ static void CompactInvertedRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26649, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26653, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26652, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26656, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26650, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26654, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26651, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26655, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26651, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26655, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26650, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26654, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26652, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26656, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26649, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26653, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26649), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26653), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26652), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26656), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2309,27 +1651,7 @@ static void CompactInvertedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26650), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26654), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26651), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26655), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2354,27 +1676,7 @@ static void CompactInvertedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26651), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26655), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26650), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26654), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2399,29 +1701,7 @@ static void CompactInvertedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26652), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26656), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26649), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26653), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2452,32 +1732,59 @@ static void CompactInvertedRCTrackLeftVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27017, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27025, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27024, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27032, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 10, 7 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27018, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27026, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27023, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27031, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27019, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27027, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27022, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27030, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27020, { 0, 0, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27028, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27021, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27029, { 0, 16, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27021, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27029, { 0, 16, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27020, { 0, 0, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27028, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 27022, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27030, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+        { { 27019, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27027, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence8Sprites = {
+        { { 27023, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27031, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+        { { 27018, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27026, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 27024, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27032, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 10, 7 } } } },
+        { { 27017, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27025, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27017), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27025), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27024), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27032), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 10, 7 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2515,56 +1822,12 @@ static void CompactInvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27018), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27026), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27023), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27031), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27019), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27027), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27022), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27030), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2576,29 +1839,7 @@ static void CompactInvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27020), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27028), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27021), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27029), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2616,29 +1857,7 @@ static void CompactInvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27021), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27029), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27020), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27028), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2650,29 +1869,7 @@ static void CompactInvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27022), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27030), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27019), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27027), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2684,56 +1881,12 @@ static void CompactInvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 8:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27023), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27031), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27018), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27026), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence8Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27024), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27032), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 10, 7 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27017), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27025), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2783,32 +1936,59 @@ static void CompactInvertedRCTrackRightVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27048, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 10, 7 } } } },
+        { { 27040, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27041, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27033, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27047, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+        { { 27039, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27042, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27034, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27046, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+        { { 27038, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27043, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27035, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27045, { 0, 16, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27037, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27044, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27036, { 0, 0, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27044, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27036, { 0, 0, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27045, { 0, 16, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27037, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 27043, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27035, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27046, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+        { { 27038, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence8Sprites = {
+        { { 27042, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27034, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27047, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+        { { 27039, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 27041, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27033, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27048, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 10, 7 } } } },
+        { { 27040, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27048), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 10, 7 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27040), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27041), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27033), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2846,56 +2026,12 @@ static void CompactInvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27047), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27039), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27042), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27034), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27046), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27038), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27043), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27035), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2907,29 +2043,7 @@ static void CompactInvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27045), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27037), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27044), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27036), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2947,29 +2061,7 @@ static void CompactInvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27044), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27036), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27045), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27037), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2981,29 +2073,7 @@ static void CompactInvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27043), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27035), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27046), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27038), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3014,56 +2084,12 @@ static void CompactInvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 8:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27042), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27034), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27047), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27039), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence8Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27041), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27033), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27048), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 10, 7 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27040), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3113,32 +2139,29 @@ static void CompactInvertedRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26710, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26713, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26716, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26707, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26709, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26712, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26715, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26706, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26708, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26711, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26714, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26705, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26710), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26713), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26716), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26707), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3160,28 +2183,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26709), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26712), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26715), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26706), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3193,29 +2195,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26708), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26711), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26714), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26705), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3255,32 +2235,29 @@ static void CompactInvertedRCTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26722, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26725, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26728, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26719, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26721, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26724, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26727, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26718, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26720, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26723, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26726, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26717, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26722), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26725), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26728), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26719), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3302,29 +2279,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26721), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26724), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26727), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26718), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3336,29 +2291,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26720), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26723), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26726), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26717), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3398,28 +2331,23 @@ static void CompactInvertedRCTrackLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26924, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26926, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26928, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26922, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26923, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26925, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26927, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26921, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26924), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26926), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26928), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26922), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3444,25 +2372,7 @@ static void CompactInvertedRCTrackLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26923), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26925), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26927), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26921), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3493,28 +2403,23 @@ static void CompactInvertedRCTrackRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26913, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26915, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26917, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26919, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26914, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26916, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26918, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26920, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26913), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26915), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26917), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26919), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3539,25 +2444,7 @@ static void CompactInvertedRCTrackRightQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26914), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26916), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26918), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26920), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3606,28 +2493,29 @@ static void CompactInvertedRCTrackLeftTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26993, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26999, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26998, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27004, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26994, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27000, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26997, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27003, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26995, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27001, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26996, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27002, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26993), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26999), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26998), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27004), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3646,25 +2534,7 @@ static void CompactInvertedRCTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26994), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27000), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26997), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27003), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3676,25 +2546,7 @@ static void CompactInvertedRCTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26995), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27001), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26996), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27002), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -3723,28 +2575,29 @@ static void CompactInvertedRCTrackRightTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27005, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27011, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27010, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27016, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27006, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27012, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27009, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27015, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27007, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27013, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27008, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27014, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27005), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27011), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27010), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27016), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3763,25 +2616,7 @@ static void CompactInvertedRCTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27006), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27012), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27009), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27015), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3793,33 +2628,15 @@ static void CompactInvertedRCTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
+            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27007), { 0, 6, height }, { 32, 20, 3 });
-                    break;
                 case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27013), { 0, 6, height }, { 32, 20, 3 });
+                    PaintUtilPushTunnelRight(session, height, TunnelType::InvertedFlat);
                     break;
                 case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27008), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27014), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
-            switch (direction)
-            {
-                case 1:
-                    PaintUtilPushTunnelRight(session, height, TunnelType::InvertedFlat);
-                    break;
-                case 2:
-                    PaintUtilPushTunnelLeft(session, height, TunnelType::InvertedFlat);
+                    PaintUtilPushTunnelLeft(session, height, TunnelType::InvertedFlat);
                     break;
             }
             PaintUtilSetSegmentSupportHeight(
@@ -3840,28 +2657,29 @@ static void CompactInvertedRCTrackLeftTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26996, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27002, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26995, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27001, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26997, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27003, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26994, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27000, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26998, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27004, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26993, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26999, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26996), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27002), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26995), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27001), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3878,25 +2696,7 @@ static void CompactInvertedRCTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26997), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27003), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26994), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27000), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3908,25 +2708,7 @@ static void CompactInvertedRCTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26998), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27004), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26993), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26999), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3957,28 +2739,29 @@ static void CompactInvertedRCTrackRightTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27008, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27014, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27007, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27013, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27009, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27015, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27006, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27012, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27010, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27016, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27005, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27011, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27008), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27014), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27007), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27013), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3995,25 +2778,7 @@ static void CompactInvertedRCTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27009), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27015), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27006), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27012), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4025,25 +2790,7 @@ static void CompactInvertedRCTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27010), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27016), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27005), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27011), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4074,32 +2821,35 @@ static void CompactInvertedRCTrackHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27073, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27081, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27080, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27088, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27074, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27082, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27079, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27087, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27075, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27083, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27078, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27086, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27076, { 0, 0, 34 }, { { 0, 6, 34 }, { 32, 20, 3 } } } },
+        { { 27084, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27077, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27085, { 0, 16, 34 }, { { 0, 6, 34 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27073), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27081), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27080), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27088), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -4130,56 +2880,12 @@ static void CompactInvertedRCTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27074), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27082), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27079), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27087), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27075), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27083), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27078), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27086), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4191,29 +2897,7 @@ static void CompactInvertedRCTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27076), { 0, 0, height + 34 },
-                        { { 0, 6, height + 34 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27084), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27077), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27085), { 0, 16, height + 34 },
-                        { { 0, 6, height + 34 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 32, TunnelType::InvertedFlat);
@@ -4238,32 +2922,29 @@ static void CompactInvertedRCTrackLeftCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27049, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27052, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27055, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27058, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27050, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27053, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27056, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27059, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27051, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27054, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27057, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27060, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27049), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27052), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27055), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27058), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4282,56 +2963,12 @@ static void CompactInvertedRCTrackLeftCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27050), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27053), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27056), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27059), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27051), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27054), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27057), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27060), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height + 28, session.SupportColours);
             switch (direction)
             {
@@ -4360,32 +2997,29 @@ static void CompactInvertedRCTrackRightCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27061, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27064, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27067, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27070, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27062, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27065, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27068, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27071, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27063, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27066, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27069, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27072, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27061), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27064), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27067), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27070), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4404,56 +3038,12 @@ static void CompactInvertedRCTrackRightCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27062), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27065), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27068), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27071), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27063), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27066), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27069), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27072), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height + 28, session.SupportColours);
             switch (direction)
             {
@@ -4498,41 +3088,26 @@ static void CompactInvertedRCTrackLeftQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26910), { 0, 0, height + 5 },
-                { { 2, 2, height + 5 }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26906), { 0, 0, height + 5 },
-                { { 2, 2, height + 104 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26911), { 0, 0, height + 5 },
-                { { 2, 2, height + 5 }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26907), { 0, 0, height + 5 },
-                { { 2, 2, height + 104 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26912), { 0, 0, height + 5 },
-                { { 2, 2, height + 5 }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26908), { 0, 0, height + 5 },
-                { { 2, 2, height + 104 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26909), { 0, 0, height + 5 },
-                { { 2, 2, height + 5 }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26905), { 0, 0, height + 5 },
-                { { 2, 2, height + 104 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 26910, { 0, 0, 5 }, { { 2, 2, 5 }, { 28, 28, 3 } } },
+            { 26906, { 0, 0, 5 }, { { 2, 2, 104 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26911, { 0, 0, 5 }, { { 2, 2, 5 }, { 28, 28, 3 } } },
+            { 26907, { 0, 0, 5 }, { { 2, 2, 104 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26912, { 0, 0, 5 }, { { 2, 2, 5 }, { 28, 28, 3 } } },
+            { 26908, { 0, 0, 5 }, { { 2, 2, 104 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26909, { 0, 0, 5 }, { { 2, 2, 5 }, { 28, 28, 3 } } },
+            { 26905, { 0, 0, 5 }, { { 2, 2, 104 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilLeftQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::InvertedSlopeStart, +56, TunnelType::InvertedSlopeEnd);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -4544,41 +3119,26 @@ static void CompactInvertedRCTrackRightQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26901), { 0, 0, height + 5 },
-                { { 2, 2, height + 5 }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26897), { 0, 0, height + 5 },
-                { { 2, 2, height + 104 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26902), { 0, 0, height + 5 },
-                { { 2, 2, height + 5 }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26898), { 0, 0, height + 5 },
-                { { 2, 2, height + 104 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26903), { 0, 0, height + 5 },
-                { { 2, 2, height + 5 }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26899), { 0, 0, height + 5 },
-                { { 2, 2, height + 104 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26904), { 0, 0, height + 5 },
-                { { 2, 2, height + 5 }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26900), { 0, 0, height + 5 },
-                { { 2, 2, height + 104 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 26901, { 0, 0, 5 }, { { 2, 2, 5 }, { 28, 28, 3 } } },
+            { 26897, { 0, 0, 5 }, { { 2, 2, 104 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26902, { 0, 0, 5 }, { { 2, 2, 5 }, { 28, 28, 3 } } },
+            { 26898, { 0, 0, 5 }, { { 2, 2, 104 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26903, { 0, 0, 5 }, { { 2, 2, 5 }, { 28, 28, 3 } } },
+            { 26899, { 0, 0, 5 }, { { 2, 2, 104 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26904, { 0, 0, 5 }, { { 2, 2, 5 }, { 28, 28, 3 } } },
+            { 26900, { 0, 0, 5 }, { { 2, 2, 104 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilRightQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::InvertedSlopeStart, +56, TunnelType::InvertedSlopeEnd);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -4606,21 +3166,14 @@ static void CompactInvertedRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26559), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26560), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26559, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26560, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26559, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26560, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -4637,32 +3190,41 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27118, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27123, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27128, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27113, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27117, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27122, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27127, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27112, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27116, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27121, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27126, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27111, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27115, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27120, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27125, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27110, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27114, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27119, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27124, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27109, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27118), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27123), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27128), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27113), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4684,29 +3246,7 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27117), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27122), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27127), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27112), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4715,32 +3255,10 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeUp(
                         PaintSegment::topRightSide, PaintSegment::bottomLeftSide),
                     direction),
                 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 48);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27116), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27121), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27126), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27111), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            PaintUtilSetGeneralSupportHeight(session, height + 48);
+            break;
+        case 3:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4755,29 +3273,7 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27115), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27120), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27125), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27110), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4789,29 +3285,7 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27114), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27119), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27124), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27109), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4842,32 +3316,41 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27089, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27094, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27099, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27104, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27090, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27095, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27100, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27105, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27091, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27096, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27101, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27106, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27092, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27097, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27102, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27107, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27093, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27098, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27103, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27108, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27089), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27094), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27099), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27104), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4889,29 +3372,7 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27090), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27095), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27100), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27105), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4923,29 +3384,7 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27091), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27096), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27101), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27106), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4959,29 +3398,7 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27092), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27097), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27102), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27107), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4993,29 +3410,7 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27093), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27098), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27103), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27108), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5046,32 +3441,41 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27098, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27103, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27108, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27093, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27097, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27102, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27107, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27092, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27096, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27101, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27106, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27091, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27095, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27100, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27105, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27090, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27094, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27099, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27104, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27089, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27098), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27103), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27108), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27093), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5093,29 +3497,7 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27097), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27102), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27107), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27092), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5127,29 +3509,7 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27096), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27101), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27106), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27091), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5164,29 +3524,7 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27095), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27100), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27105), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27090), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5198,29 +3536,7 @@ static void CompactInvertedRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27094), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27099), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27104), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27089), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5251,32 +3567,41 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27109, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27114, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27119, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27124, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27110, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27115, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27120, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27125, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27111, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27116, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27121, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27126, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27112, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27117, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27122, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27127, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27113, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27118, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27123, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27128, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27109), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27114), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27119), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27124), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5298,29 +3623,7 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27110), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27115), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27120), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27125), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5332,29 +3635,7 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27111), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27116), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27121), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27126), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5368,29 +3649,7 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27112), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27117), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27122), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27127), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5402,29 +3661,7 @@ static void CompactInvertedRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27113), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27118), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27123), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27128), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5455,31 +3692,16 @@ static void CompactInvertedRCTrackOnRidePhoto(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26555, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26556, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26555, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26556, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, kSupportType);
 
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26555), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26556), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26555), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26556), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::InvertedFlat);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -5491,60 +3713,29 @@ static void CompactInvertedRCTrack90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        { { 26609, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        { { 26610, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } },
+        { { 26611, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } },
+        { { 26612, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26605, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        { { 26606, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } },
+        { { 26607, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } },
+        { { 26608, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26609), { 0, 0, height + 29 },
-                            { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26610), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26611), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26612), { 0, 0, height + 29 },
-                            { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26605), { 0, 0, height + 29 },
-                            { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26606), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26607), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26608), { 0, 0, height + 29 },
-                            { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetVerticalTunnel(session, height + 32);
             PaintUtilSetSegmentSupportHeight(
@@ -5569,60 +3760,29 @@ static void CompactInvertedRCTrack60DegUpTo90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        { { 26597, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 26598, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26599, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26600, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26589, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 26590, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26591, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26592, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26597), { 0, 0, height + 29 },
-                            { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26598), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26599), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26600), { 0, 0, height + 29 },
-                            { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26589), { 0, 0, height + 29 },
-                            { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26590), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26591), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26592), { 0, 0, height + 29 },
-                            { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             if (direction == 0 || direction == 3)
             {
@@ -5651,57 +3811,26 @@ static void CompactInvertedRCTrack90DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26601, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 26602, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26603, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26604, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26593, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 26594, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26595, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26596, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
-    {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26601), { 0, 0, height + 29 },
-                    { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26602), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26603), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26604), { 0, 0, height + 29 },
-                    { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                break;
-        }
-    }
-    else
-    {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26593), { 0, 0, height + 29 },
-                    { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26594), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26595), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26596), { 0, 0, height + 29 },
-                    { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                break;
-        }
+    {
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
+    }
+    else
+    {
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
     switch (direction)
     {
@@ -5721,60 +3850,29 @@ static void CompactInvertedRCTrack60DegDownTo90DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        { { 26603, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26604, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 26601, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 26602, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26595, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 26596, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 26593, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 26594, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26603), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26604), { 0, 0, height + 29 },
-                            { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26601), { 0, 0, height + 29 },
-                            { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26602), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26595), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26596), { 0, 0, height + 29 },
-                            { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26593), { 0, 0, height + 29 },
-                            { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26594), { 0, 0, height + 29 },
-                            { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             if (direction == 0 || direction == 3)
             {
@@ -5794,32 +3892,35 @@ static void CompactInvertedRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26765, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26769, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26773, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26777, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26766, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26770, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 26774, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26778, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26767, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26771, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26775, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26779, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26768, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26772, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 26776, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26780, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26765), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26769), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26773), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26777), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -5832,29 +3933,7 @@ static void CompactInvertedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26766), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26770), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26774), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26778), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5866,29 +3945,7 @@ static void CompactInvertedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26767), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26771), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26775), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26779), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5911,29 +3968,7 @@ static void CompactInvertedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26768), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26772), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26776), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26780), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5973,32 +4008,35 @@ static void CompactInvertedRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26749, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26753, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26757, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26761, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26750, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26754, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26758, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 26762, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26751, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26755, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26759, { 0, 0, 29 }, { { 4, 4, 29 }, { 28, 28, 3 } } } },
+        { { 26763, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26752, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26756, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26760, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 26764, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26749), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26753), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26757), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26761), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -6011,29 +4049,7 @@ static void CompactInvertedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26750), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26754), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26758), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26762), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6045,29 +4061,7 @@ static void CompactInvertedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26751), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26755), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26759), { 0, 0, height + 29 },
-                        { { 4, 4, height + 29 }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26763), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6090,29 +4084,7 @@ static void CompactInvertedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26752), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26756), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26760), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26764), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6170,32 +4142,35 @@ static void CompactInvertedRCTrackLeftEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26853, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26857, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26861, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26865, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26854, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26858, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 26862, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26866, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26855, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26859, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26863, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26867, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26856, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26860, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 26864, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26868, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26853), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26857), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26861), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26865), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6214,29 +4189,7 @@ static void CompactInvertedRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26854), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26858), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26862), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26866), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6248,29 +4201,7 @@ static void CompactInvertedRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26855), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26859), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26863), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26867), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6293,29 +4224,7 @@ static void CompactInvertedRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26856), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26860), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26864), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26868), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6355,32 +4264,35 @@ static void CompactInvertedRCTrackRightEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26837, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26841, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26845, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26849, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26838, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26842, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26846, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 26850, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26839, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26843, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26847, { 0, 0, 29 }, { { 4, 4, 29 }, { 28, 28, 3 } } } },
+        { { 26851, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26840, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26844, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26848, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 26852, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26837), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26841), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26845), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26849), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6399,29 +4311,7 @@ static void CompactInvertedRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26838), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26842), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26846), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26850), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6433,29 +4323,7 @@ static void CompactInvertedRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26839), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26843), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26847), { 0, 0, height + 29 },
-                        { { 4, 4, height + 29 }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26851), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6478,29 +4346,7 @@ static void CompactInvertedRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26840), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26844), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26848), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26852), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6599,30 +4445,65 @@ static void CompactInvertedRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26824, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26796, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26821, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26793, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26823, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26795, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26822, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26794, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26824), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26796), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6637,25 +4518,11 @@ static void CompactInvertedRCTrackDiag25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26821), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26793), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6669,25 +4536,11 @@ static void CompactInvertedRCTrackDiag25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26823), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26795), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6702,25 +4555,11 @@ static void CompactInvertedRCTrackDiag25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26822), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26794), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -6761,17 +4600,35 @@ static void CompactInvertedRCTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26808, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26805, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26807, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26806, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26808), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6783,14 +4640,7 @@ static void CompactInvertedRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26805), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6801,14 +4651,7 @@ static void CompactInvertedRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26807), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6820,14 +4663,7 @@ static void CompactInvertedRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26806), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6867,30 +4703,65 @@ static void CompactInvertedRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26816, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26788, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26813, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26785, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26815, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26787, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26814, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26786, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26816), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26788), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6905,25 +4776,11 @@ static void CompactInvertedRCTrackDiagFlatTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26813), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26785), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6937,25 +4794,11 @@ static void CompactInvertedRCTrackDiagFlatTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26815), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26787), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6970,25 +4813,11 @@ static void CompactInvertedRCTrackDiagFlatTo25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26814), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26786), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -7029,17 +4858,35 @@ static void CompactInvertedRCTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26800, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26797, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26799, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26798, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26800), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7051,14 +4898,7 @@ static void CompactInvertedRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26797), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7069,14 +4909,7 @@ static void CompactInvertedRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26799), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7088,14 +4921,7 @@ static void CompactInvertedRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26798), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7135,17 +4961,35 @@ static void CompactInvertedRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26804, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26801, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26803, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26802, { -16, -16, 29 }, { { 0, 0, 61 }, { 16, 16, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26804), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7157,14 +5001,7 @@ static void CompactInvertedRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26801), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7175,14 +5012,7 @@ static void CompactInvertedRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26803), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7194,14 +5024,7 @@ static void CompactInvertedRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26802), { -16, -16, height + 29 },
-                        { { 0, 0, height + 61 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7241,30 +5064,65 @@ static void CompactInvertedRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26820, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26792, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26817, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26789, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26819, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26791, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26818, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26790, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26820), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26792), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7279,25 +5137,11 @@ static void CompactInvertedRCTrackDiag25DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26817), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26789), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7311,25 +5155,11 @@ static void CompactInvertedRCTrackDiag25DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26819), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26791), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7344,25 +5174,11 @@ static void CompactInvertedRCTrackDiag25DegUpToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26818), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26790), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -7403,30 +5219,65 @@ static void CompactInvertedRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26822, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26794, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26823, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26795, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26821, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26793, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26824, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26796, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26822), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26794), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7441,25 +5292,11 @@ static void CompactInvertedRCTrackDiag25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26823), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26795), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7473,25 +5310,11 @@ static void CompactInvertedRCTrackDiag25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26821), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26793), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7506,25 +5329,11 @@ static void CompactInvertedRCTrackDiag25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26824), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26796), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -7565,17 +5374,35 @@ static void CompactInvertedRCTrackDiag60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26806, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26807, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26805, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26808, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26806), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7587,14 +5414,7 @@ static void CompactInvertedRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26807), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7605,14 +5425,7 @@ static void CompactInvertedRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26805), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7624,14 +5437,7 @@ static void CompactInvertedRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26808), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7671,30 +5477,65 @@ static void CompactInvertedRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26818, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26790, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26819, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26791, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26817, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26789, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26820, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26792, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26818), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26790), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7708,25 +5549,11 @@ static void CompactInvertedRCTrackDiagFlatTo25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26819), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26791), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7739,25 +5566,11 @@ static void CompactInvertedRCTrackDiagFlatTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26817), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26789), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7771,25 +5584,11 @@ static void CompactInvertedRCTrackDiagFlatTo25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26820), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26792), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -7830,17 +5629,35 @@ static void CompactInvertedRCTrackDiag25DegDownTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26802, { -16, -16, 29 }, { { 0, 0, 61 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26803, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26801, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26804, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26802), { -16, -16, height + 29 },
-                        { { 0, 0, height + 61 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7852,14 +5669,7 @@ static void CompactInvertedRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26803), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7870,14 +5680,7 @@ static void CompactInvertedRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26801), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7889,14 +5692,7 @@ static void CompactInvertedRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26804), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7936,17 +5732,35 @@ static void CompactInvertedRCTrackDiag60DegDownTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26798, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26799, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26797, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26800, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26798), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7958,14 +5772,7 @@ static void CompactInvertedRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26799), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7976,14 +5783,7 @@ static void CompactInvertedRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26797), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7995,14 +5795,7 @@ static void CompactInvertedRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26800), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8042,30 +5835,65 @@ static void CompactInvertedRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26814, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26786, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26815, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26787, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26813, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26785, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26816, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26788, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26814), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26786), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8080,25 +5908,11 @@ static void CompactInvertedRCTrackDiag25DegDownToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26815), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26787), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8112,25 +5926,11 @@ static void CompactInvertedRCTrackDiag25DegDownToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26813), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26785), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8145,25 +5945,11 @@ static void CompactInvertedRCTrackDiag25DegDownToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26816), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26788), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -8204,17 +5990,35 @@ static void CompactInvertedRCTrackDiagFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26876, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26873, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26875, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26874, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26876), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8226,14 +6030,7 @@ static void CompactInvertedRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26873), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8244,14 +6041,7 @@ static void CompactInvertedRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26875), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8263,14 +6053,7 @@ static void CompactInvertedRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26874), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8310,17 +6093,35 @@ static void CompactInvertedRCTrackDiagFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26880, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26877, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26879, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26878, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26880), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8332,14 +6133,7 @@ static void CompactInvertedRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26877), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8350,14 +6144,7 @@ static void CompactInvertedRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26879), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8369,14 +6156,7 @@ static void CompactInvertedRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26878), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8416,17 +6196,35 @@ static void CompactInvertedRCTrackDiagLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26878, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26879, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26877, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26880, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26878), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8438,14 +6236,7 @@ static void CompactInvertedRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26879), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8456,14 +6247,7 @@ static void CompactInvertedRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26877), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8475,14 +6259,7 @@ static void CompactInvertedRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26880), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8522,17 +6299,35 @@ static void CompactInvertedRCTrackDiagRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26874, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26875, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26873, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26876, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26874), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8544,14 +6339,7 @@ static void CompactInvertedRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26875), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8562,14 +6350,7 @@ static void CompactInvertedRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26873), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8581,14 +6362,7 @@ static void CompactInvertedRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26876), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8628,17 +6402,35 @@ static void CompactInvertedRCTrackDiagLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26892, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26889, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26891, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26890, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26892), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8650,14 +6442,7 @@ static void CompactInvertedRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26889), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8668,14 +6453,7 @@ static void CompactInvertedRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26891), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8687,14 +6465,7 @@ static void CompactInvertedRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26890), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8734,17 +6505,35 @@ static void CompactInvertedRCTrackDiagRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26896, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26893, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26895, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26894, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26896), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8756,14 +6545,7 @@ static void CompactInvertedRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26893), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8774,14 +6556,7 @@ static void CompactInvertedRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26895), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8793,14 +6568,7 @@ static void CompactInvertedRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26894), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8840,17 +6608,35 @@ static void CompactInvertedRCTrackDiag25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26884, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26881, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26883, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26882, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26884), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8862,14 +6648,7 @@ static void CompactInvertedRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26881), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8880,14 +6659,7 @@ static void CompactInvertedRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26883), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8899,14 +6671,7 @@ static void CompactInvertedRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26882), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8946,17 +6711,35 @@ static void CompactInvertedRCTrackDiag25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26888, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26885, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26887, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26886, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26888), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8968,14 +6751,7 @@ static void CompactInvertedRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26885), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8986,14 +6762,7 @@ static void CompactInvertedRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26887), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9005,14 +6774,7 @@ static void CompactInvertedRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26886), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9052,17 +6814,35 @@ static void CompactInvertedRCTrackDiagLeftBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26886, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26887, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26885, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26888, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26886), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9073,14 +6853,7 @@ static void CompactInvertedRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26887), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9090,14 +6863,7 @@ static void CompactInvertedRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26885), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9108,14 +6874,7 @@ static void CompactInvertedRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26888), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9155,17 +6914,35 @@ static void CompactInvertedRCTrackDiagRightBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26882, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26883, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26881, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26884, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26882), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9176,14 +6953,7 @@ static void CompactInvertedRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26883), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9193,14 +6963,7 @@ static void CompactInvertedRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26881), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9211,14 +6974,7 @@ static void CompactInvertedRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26884), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9258,17 +7014,35 @@ static void CompactInvertedRCTrackDiag25DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26894, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26895, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26893, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26896, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26894), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9280,14 +7054,7 @@ static void CompactInvertedRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26895), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9298,14 +7065,7 @@ static void CompactInvertedRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26893), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9317,14 +7077,7 @@ static void CompactInvertedRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26896), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9364,17 +7117,35 @@ static void CompactInvertedRCTrackDiag25DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26890, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26891, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26889, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26892, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26890), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9386,14 +7157,7 @@ static void CompactInvertedRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26891), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9404,14 +7168,7 @@ static void CompactInvertedRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26889), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9423,14 +7180,7 @@ static void CompactInvertedRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26892), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9470,17 +7220,35 @@ static void CompactInvertedRCTrackDiagLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26872, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26869, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26871, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26870, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26872), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9492,14 +7260,7 @@ static void CompactInvertedRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26869), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9510,14 +7271,7 @@ static void CompactInvertedRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26871), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9529,14 +7283,7 @@ static void CompactInvertedRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26870), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9576,17 +7323,35 @@ static void CompactInvertedRCTrackDiagRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26870, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26871, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26869, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26872, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26870), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9598,14 +7363,7 @@ static void CompactInvertedRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26871), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9616,14 +7374,7 @@ static void CompactInvertedRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26869), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9635,14 +7386,7 @@ static void CompactInvertedRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26872), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9682,21 +7426,14 @@ static void CompactInvertedRCTrackBlockBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26559), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26560), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26559, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26560, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26559, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26560, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
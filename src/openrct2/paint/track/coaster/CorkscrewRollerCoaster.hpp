@@ -65,31 +65,22 @@ static void CorkscrewRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 16226, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16227, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16228, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16229, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16224, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16225, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16224, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16225, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16226), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16227), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16228), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16229), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -97,21 +88,7 @@ static void CorkscrewRCTrackFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16224), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16225), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -164,31 +141,22 @@ static void CorkscrewRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 16314, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16315, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16316, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16317, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16286, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16287, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16288, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16289, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16314), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16315), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16316), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16317), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -196,29 +164,7 @@ static void CorkscrewRCTrack25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16286), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16287), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16288), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16289), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -242,31 +188,22 @@ static void CorkscrewRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 16330, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16331, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 16332, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 16333, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16302, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16303, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 16304, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 16305, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16330), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16331), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16332), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16333), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 32, height, session.SupportColours);
@@ -274,29 +211,7 @@ static void CorkscrewRCTrack60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16302), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16303), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16304), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16305), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 32, height, session.SupportColours);
@@ -320,31 +235,22 @@ static void CorkscrewRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 16306, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16307, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16308, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16309, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16278, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16279, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16280, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16281, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16306), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16307), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16308), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16309), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -352,29 +258,7 @@ static void CorkscrewRCTrackFlatTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16278), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16279), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16280), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16281), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -398,37 +282,34 @@ static void CorkscrewRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 16318, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 16319, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16322, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 16320, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16323, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 16321, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16290, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 16291, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16294, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 16292, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16295, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 16293, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16318), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16319), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16322), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16320), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16323), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16321), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 12, height, session.SupportColours);
@@ -436,35 +317,7 @@ static void CorkscrewRCTrack25DegUpTo60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16290), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16291), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16294), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16292), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16295), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16293), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 12, height, session.SupportColours);
@@ -488,37 +341,34 @@ static void CorkscrewRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 16324, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 16325, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16328, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 16326, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16329, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 16327, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16296, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 16297, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16300, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 16298, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16301, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 16299, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16324), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16325), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16328), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16326), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16329), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16327), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 20, height, session.SupportColours);
@@ -526,35 +376,7 @@ static void CorkscrewRCTrack60DegUpTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16296), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16297), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16300), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16298), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16301), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16299), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 20, height, session.SupportColours);
@@ -578,31 +400,22 @@ static void CorkscrewRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 16310, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16311, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16312, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16313, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16282, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16283, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16284, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16285, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16310), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16311), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16312), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16313), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -610,29 +423,7 @@ static void CorkscrewRCTrack25DegUpToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16282), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16283), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16284), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16285), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -710,32 +501,41 @@ static void CorkscrewRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16343, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16348, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16353, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16338, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16342, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16347, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16352, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16337, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16341, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16346, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16351, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16336, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 16340, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16345, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16350, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16335, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16339, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16344, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16349, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16334, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16343), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16348), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16353), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16338), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -755,29 +555,7 @@ static void CorkscrewRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16342), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16347), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16352), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16337), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -789,29 +567,7 @@ static void CorkscrewRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16341), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16346), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16351), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16336), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -826,29 +582,7 @@ static void CorkscrewRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16340), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16345), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16350), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16335), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -860,29 +594,7 @@ static void CorkscrewRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16339), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16344), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16349), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16334), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -922,35 +634,20 @@ static void CorkscrewRCTrackFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16238), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16246), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16239), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16247), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16240), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16241), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 16238, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16246, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 16239, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16247, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16240, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16241, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -966,35 +663,20 @@ static void CorkscrewRCTrackFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16242), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16243), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16244), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16248), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16245), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16249), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16242, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16243, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 16244, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16248, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 16245, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16249, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1010,35 +692,20 @@ static void CorkscrewRCTrackLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16244), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16248), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16245), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16249), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16242), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16243), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 16244, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16248, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 16245, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16249, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16242, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16243, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1054,35 +721,20 @@ static void CorkscrewRCTrackRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16240), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16241), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16238), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16246), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16239), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16247), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16240, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16241, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 16238, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16246, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 16239, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16247, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1098,35 +750,47 @@ static void CorkscrewRCTrackBankedLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16363), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16374), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16368), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16373), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16358), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 16363, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16374, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16368, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16373, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16358, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16362, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16367, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16372, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16357, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16361, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16366, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16371, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16356, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 16360, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16365, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16370, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16355, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16359, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16364, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16369, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16375, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16354, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
+    switch (trackSequence)
+    {
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1146,29 +810,7 @@ static void CorkscrewRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16362), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16367), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16372), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16357), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1180,29 +822,7 @@ static void CorkscrewRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16361), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16366), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16371), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16356), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1217,29 +837,7 @@ static void CorkscrewRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16360), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16365), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16370), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16355), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1251,32 +849,7 @@ static void CorkscrewRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16359), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16364), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16369), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16375), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16354), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -1317,35 +890,20 @@ static void CorkscrewRCTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16250), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16254), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16251), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16255), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16252), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16253), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 16250, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16254, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 16251, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16255, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 16252, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16253, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -1368,35 +926,20 @@ static void CorkscrewRCTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16256), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16257), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16258), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16260), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16259), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16261), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16256, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16257, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 16258, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16260, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 16259, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16261, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -1419,35 +962,20 @@ static void CorkscrewRCTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16262), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16266), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16263), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16267), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16264), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16265), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 16262, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16266, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 16263, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16267, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 16264, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16265, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -1470,35 +998,20 @@ static void CorkscrewRCTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16268), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16269), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16270), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16272), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16271), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16273), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16268, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16269, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 16270, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16272, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 16271, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16273, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -1557,29 +1070,14 @@ static void CorkscrewRCTrackLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16274), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16275), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16276), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16277), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16274, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16275, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16276, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16277, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1604,32 +1102,41 @@ static void CorkscrewRCTrackLeftQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16510, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16515, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16520, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16525, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16511, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16516, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16521, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16526, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16512, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16517, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16522, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16527, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 16513, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16518, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16523, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16528, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16514, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16519, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16524, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16529, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16510), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16515), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16520), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16525), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1649,27 +1156,7 @@ static void CorkscrewRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16511), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16516), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16521), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16526), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1681,28 +1168,7 @@ static void CorkscrewRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16512), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16517), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16522), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16527), { 0, 0, height }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1717,27 +1183,7 @@ static void CorkscrewRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16513), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16518), { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16523), { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16528), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1749,29 +1195,7 @@ static void CorkscrewRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16514), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16519), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16524), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16529), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -1801,32 +1225,41 @@ static void CorkscrewRCTrackRightQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16490, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16495, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16500, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16505, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16491, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16496, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16501, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16506, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16492, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16497, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16502, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16507, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 16493, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16498, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16503, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16508, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16494, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16499, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16504, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16509, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16490), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16495), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16500), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16505), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1846,27 +1279,7 @@ static void CorkscrewRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16491), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16496), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16501), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16506), { 0, 0, height }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1878,28 +1291,7 @@ static void CorkscrewRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16492), { 0, 0, height }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16497), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16502), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16507), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1913,27 +1305,7 @@ static void CorkscrewRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16493), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16498), { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16503), { 0, 0, height }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16508), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1945,29 +1317,7 @@ static void CorkscrewRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16494), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16499), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16504), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16509), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -2019,32 +1369,23 @@ static void CorkscrewRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16402, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16406, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16405, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16409, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16405, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16409, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16402, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16406, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16402), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16406), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16405), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16409), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2133,29 +1474,7 @@ static void CorkscrewRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16405), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16409), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16402), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16406), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -2185,32 +1504,23 @@ static void CorkscrewRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16410, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16414, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16413, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16417, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16413, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16417, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16410, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16414, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16410), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16414), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16413), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16417), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2299,29 +1609,7 @@ static void CorkscrewRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16413), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16417), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16410), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16414), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -2351,6 +1639,31 @@ static void CorkscrewRCTrackLeftVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16564, { 16, 0, 0 }, { { 16, 0, 0 }, { 3, 16, 119 } } } },
+        { { 16572, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 16567, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 16575, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16565, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16573, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16566, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 16574, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16566, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 16574, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 16565, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16573, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 16567, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 16575, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 16564, { 16, 0, 0 }, { { 16, 0, 0 }, { 3, 16, 119 } } } },
+        { { 16572, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -2434,29 +1747,7 @@ static void CorkscrewRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16564), { 16, 0, height },
-                        { { 16, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16572), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16567), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16575), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2468,25 +1759,7 @@ static void CorkscrewRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16565), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16573), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16566), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16574), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2504,25 +1777,7 @@ static void CorkscrewRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16566), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16574), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16565), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16573), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2534,29 +1789,7 @@ static void CorkscrewRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16567), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16575), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16564), { 16, 0, height },
-                        { { 16, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16572), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2661,28 +1894,47 @@ static void CorkscrewRCTrackRightVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16593, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+        { { 16585, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16586, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16578, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16591, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 16583, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 16588, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 16580, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16590, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 16582, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 16589, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16581, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16589, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16581, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16590, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 16582, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 16588, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 16580, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 16591, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 16583, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 16586, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16578, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16593, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+        { { 16585, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16593), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16585), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16586), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16578), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2721,51 +1973,11 @@ static void CorkscrewRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16591), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16583), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16588), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16580), { 16, 0, height },
-                        { { 16, 0, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16590), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16582), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16589), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16581), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
@@ -2775,51 +1987,11 @@ static void CorkscrewRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16589), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16581), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16590), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16582), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16588), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16580), { 16, 0, height },
-                        { { 16, 0, height }, { 2, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16591), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16583), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 8:
@@ -2853,25 +2025,7 @@ static void CorkscrewRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16586), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16578), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16593), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16585), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -2895,32 +2049,29 @@ static void CorkscrewRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16381, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16384, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16387, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16378, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16380, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16383, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16386, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16377, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16379, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16382, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16385, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16376, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16381), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16384), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16387), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16378), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2940,29 +2091,7 @@ static void CorkscrewRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16380), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16383), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16386), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16377), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2974,29 +2103,7 @@ static void CorkscrewRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16379), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16382), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16385), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16376), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -3036,35 +2143,35 @@ static void CorkscrewRCTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 16393, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16400, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16396, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16399, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16390, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16392, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16395, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16398, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16389, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16391, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16394, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16397, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16401, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16388, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16393), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16400), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16396), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16399), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16390), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3084,29 +2191,7 @@ static void CorkscrewRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16392), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16395), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16398), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16389), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3118,32 +2203,7 @@ static void CorkscrewRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16391), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16394), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16397), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16401), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16388), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -3183,28 +2243,23 @@ static void CorkscrewRCTrackLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16541, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16543, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16545, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16539, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16540, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16542, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16544, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16538, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16541), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16543), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16545), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16539), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3227,26 +2282,8 @@ static void CorkscrewRCTrackLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16540), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16542), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16544), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16538), { 6, 0, height }, { 20, 32, 3 });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
+            MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
                 case 2:
@@ -3275,28 +2312,17 @@ static void CorkscrewRCTrackRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16530, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16532, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16534, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16536, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16530), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16532), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16534), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16536), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3396,28 +2422,29 @@ static void CorkscrewRCTrackHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16594, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16602, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 11 } } } },
+        { { 16601, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { 16609, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16596, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 16604, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 16599, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 12, 119 } } } },
+        { { 16607, { 16, 16, 0 }, { { 15, 6, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16597, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16605, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16598, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+        { { 16606, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16594), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16602), { 0, 6, height }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16601), { 0, 6, height }, { 32, 20, 9 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16609), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3462,27 +2489,7 @@ static void CorkscrewRCTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16596), { 16, 0, height }, { 2, 16, 119 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16604), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16599), { 10, 16, height }, { 4, 12, 119 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16607), { 16, 16, height },
-                        { { 15, 6, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3494,25 +2501,7 @@ static void CorkscrewRCTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16597), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16605), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16598), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16606), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
@@ -3539,32 +2528,29 @@ static void CorkscrewRCTrackLeftCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16610, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16613, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16616, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16619, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16611, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16614, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16617, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16620, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16612, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16615, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16618, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16621, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16610), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16613), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16616), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16619), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             TrackPaintUtilLeftCorkscrewUpSupports(session, direction, height);
 
@@ -3575,56 +2561,12 @@ static void CorkscrewRCTrackLeftCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16611), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16614), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16617), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16620), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16612), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16615), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16618), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16621), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3656,32 +2598,29 @@ static void CorkscrewRCTrackRightCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16622, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16625, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16628, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16631, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16623, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16626, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16629, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16632, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16624, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16627, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16630, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16633, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16622), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16625), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16628), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16631), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3698,56 +2637,12 @@ static void CorkscrewRCTrackRightCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16623), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16626), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16629), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16632), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16624), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16627), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16630), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16633), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3797,35 +2692,59 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 16481, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16488, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16484, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16487, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16478, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16480, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16483, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16486, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16477, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16479, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16482, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16485, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16489, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16476, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 16478, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 16481, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16488, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16484, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 16487, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16477, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16480, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16483, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16486, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 16476, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 16479, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16482, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 16485, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16489, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16481), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16488), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16484), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16487), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16478), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3845,29 +2764,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16480), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16483), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16486), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16477), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3879,32 +2776,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16479), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16482), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16485), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16489), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16476), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -3926,32 +2798,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16478), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16481), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16488), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16484), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16487), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -3976,29 +2823,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16477), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16480), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16483), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16486), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4010,32 +2835,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16476), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16479), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16482), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16485), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16489), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4060,35 +2860,59 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16462, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16465, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16468, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 16471, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16475, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16463, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16466, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16469, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16472, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16464, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+        {
+            { 16467, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16474, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16470, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 16473, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 16465, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16468, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16471, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16475, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16462, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16466, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16469, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16472, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16463, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        {
+            { 16467, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16474, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16470, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16473, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16464, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16462), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16465), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16468), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16471), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16475), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4108,29 +2932,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16463), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16466), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16469), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16472), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4142,32 +2944,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16464), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16467), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16474), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16470), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16473), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -4189,32 +2966,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16465), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16468), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16471), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16475), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16462), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -4239,29 +2991,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16466), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16469), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16472), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16463), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4273,32 +3003,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16467), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16474), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16470), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16473), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16464), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4355,35 +3060,83 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 16449, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16460, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16454, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16459, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16444, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16448, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16453, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16458, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16443, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16447, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16452, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16457, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16442, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 16446, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16451, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16456, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16441, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16445, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16450, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16455, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16461, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16440, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 16444, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 16449, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16460, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16454, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 16459, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 16443, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16448, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16453, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16458, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        { { 16442, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16447, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16452, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16457, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        { { 16441, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16446, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16451, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16456, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        { { 16440, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 16445, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16450, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 16455, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16461, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16449), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16460), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16454), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16459), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16444), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4403,29 +3156,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16448), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16453), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16458), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16443), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4437,29 +3168,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16447), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16452), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16457), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16442), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4474,29 +3183,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16446), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16451), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16456), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16441), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4508,32 +3195,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16445), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16450), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16455), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16461), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16440), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -4555,40 +3217,15 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
+            MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
                 case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16444), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
+                    PaintUtilPushTunnelRight(session, height, TunnelType::StandardFlat);
                     break;
                 case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16449), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16460), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16454), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16459), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
-            switch (direction)
-            {
-                case 0:
-                    PaintUtilPushTunnelRight(session, height, TunnelType::StandardFlat);
-                    break;
-                case 1:
-                    PaintUtilPushTunnelLeft(session, height, TunnelType::StandardFlat);
+                    PaintUtilPushTunnelLeft(session, height, TunnelType::StandardFlat);
                     break;
             }
             PaintUtilSetSegmentSupportHeight(
@@ -4605,29 +3242,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16443), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16448), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16453), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16458), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4639,29 +3254,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16442), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16447), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16452), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16457), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4675,29 +3268,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16441), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16446), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16451), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16456), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4709,32 +3280,7 @@ static void CorkscrewRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16440), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16445), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16450), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16455), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16461), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4759,35 +3305,83 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16418, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16423, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16428, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 16433, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16439, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16419, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16424, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16429, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16434, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16420, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16425, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16430, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16435, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 16421, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16426, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16431, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16436, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16422, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+        {
+            { 16427, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16438, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16432, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 16437, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 16423, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16428, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16433, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16439, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16418, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 16424, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16429, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16434, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16419, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        { { 16425, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16430, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16435, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16420, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        { { 16426, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16431, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16436, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16421, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        {
+            { 16427, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16438, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16432, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16437, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16422, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16418), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16423), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16428), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16433), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16439), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4807,29 +3401,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16419), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16424), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16429), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16434), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4841,29 +3413,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16420), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16425), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16430), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16435), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4877,29 +3427,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16421), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16426), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16431), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16436), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4911,32 +3439,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16422), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16427), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16438), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16432), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16437), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -4958,32 +3461,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16423), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16428), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16433), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16439), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16418), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -5008,29 +3486,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16424), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16429), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16434), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16419), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5042,29 +3498,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16425), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16430), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16435), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16420), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5079,29 +3513,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16426), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16431), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16436), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16421), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5113,32 +3525,7 @@ static void CorkscrewRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16427), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16438), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16432), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16437), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16422), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5195,41 +3582,26 @@ static void CorkscrewRCTrackLeftQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16555), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16559), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16556), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16560), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16557), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16561), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16554), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16558), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 16555, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 16559, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 16556, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 16560, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 16557, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 16561, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 16554, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 16558, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilLeftQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::StandardSlopeStart, +56, TunnelType::StandardSlopeEnd);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -5242,41 +3614,26 @@ static void CorkscrewRCTrackRightQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16546), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16550), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16547), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16551), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16548), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16552), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16549), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16553), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 16546, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 16550, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 16547, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 16551, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 16548, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 16552, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 16549, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 16553, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilRightQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::StandardSlopeStart, +56, TunnelType::StandardSlopeEnd);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -5309,21 +3666,14 @@ static void CorkscrewRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16230), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16231), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16230, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16231, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16230, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16231, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -5339,31 +3689,16 @@ static void CorkscrewRCTrackOnRidePhoto(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16224, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 16225, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 16224, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 16225, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+    };
+
     TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, supportType);
 
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16224), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16225), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16224), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(16225), { 0, 0, height },
-                { { 0, 6, height + 3 }, { 32, 20, 0 } });
-            break;
-    }
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -5376,32 +3711,35 @@ static void CorkscrewRCTrackFlatTo60DegUpLongBase(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16788, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16792, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16796, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16800, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16789, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16793, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16797, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16801, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16790, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16794, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16798, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16802, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16791, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16795, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 16799, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 16803, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16788), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16792), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16796), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16800), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -5415,93 +3753,27 @@ static void CorkscrewRCTrackFlatTo60DegUpLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16789), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16793), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16797), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16801), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             }
             PaintUtilSetSegmentSupportHeight(
-                session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 48);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16790), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16794), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16798), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16802), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
-            {
-                MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 9, height, session.SupportColours);
-            }
-            PaintUtilSetSegmentSupportHeight(
-                session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 64);
-            break;
-        case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16791), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16795), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16799), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16803), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
+                session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 48);
+            break;
+        case 2:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
+            if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+            {
+                MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 9, height, session.SupportColours);
             }
+            PaintUtilSetSegmentSupportHeight(
+                session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 64);
+            break;
+        case 3:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 18, height, session.SupportColours);
@@ -5528,32 +3800,35 @@ static void CorkscrewRCTrack60DegUpToFlatLongBase(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16804, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16808, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 16812, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 16816, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16805, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16809, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16813, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16817, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16806, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16810, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16814, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16818, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16807, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16811, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16815, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16819, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16804), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16808), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16812), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16816), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 20, height, session.SupportColours);
@@ -5567,29 +3842,7 @@ static void CorkscrewRCTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 80);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16805), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16809), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16813), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16817), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 16, height, session.SupportColours);
@@ -5599,29 +3852,7 @@ static void CorkscrewRCTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 80);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16806), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16810), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16814), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16818), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 13, height, session.SupportColours);
@@ -5631,29 +3862,7 @@ static void CorkscrewRCTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16807), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16811), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16815), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16819), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 5, height, session.SupportColours);
@@ -5700,32 +3909,29 @@ static void CorkscrewRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16740, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16744, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16748, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16752, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16741, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16745, { 0, 0, 0 }, { { 0, 0, 0 }, { 34, 16, 3 } } } },
+        { { 16749, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16753, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16742, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16746, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16750, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16754, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16740), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16744), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16748), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16752), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5736,29 +3942,7 @@ static void CorkscrewRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16741), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16745), { 0, 0, height },
-                        { { 0, 0, height }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16749), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16753), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5770,29 +3954,7 @@ static void CorkscrewRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16742), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16746), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16750), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16754), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5865,32 +4027,29 @@ static void CorkscrewRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16724, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16728, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16732, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16736, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16725, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16729, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16733, { 0, 0, 0 }, { { 0, 0, 0 }, { 34, 16, 3 } } } },
+        { { 16737, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16726, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16730, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16734, { 0, 0, 0 }, { { 4, 4, 0 }, { 28, 28, 3 } } } },
+        { { 16738, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16724), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16728), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16732), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16736), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5901,29 +4060,7 @@ static void CorkscrewRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16725), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16729), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16733), { 0, 0, height },
-                        { { 0, 0, height }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16737), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5935,29 +4072,7 @@ static void CorkscrewRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16726), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16730), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16734), { 0, 0, height },
-                        { { 4, 4, height }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16738), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6050,32 +4165,29 @@ static void CorkscrewRCTrackLeftEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16772, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16776, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16780, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16784, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16773, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16777, { 0, 0, 0 }, { { 0, 0, 27 }, { 34, 16, 0 } } } },
+        { { 16781, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16785, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16774, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16778, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } } },
+        { { 16782, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16786, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16772), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16776), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16780), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16784), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -6086,29 +4198,7 @@ static void CorkscrewRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16773), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16777), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 34, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16781), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16785), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6120,29 +4210,7 @@ static void CorkscrewRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16774), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16778), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16782), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16786), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6215,32 +4283,29 @@ static void CorkscrewRCTrackRightEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16756, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16760, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16764, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16768, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16757, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16761, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16765, { 0, 0, 0 }, { { 0, 0, 27 }, { 34, 16, 0 } } } },
+        { { 16769, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16758, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16762, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16766, { 0, 0, 0 }, { { 4, 4, 27 }, { 28, 28, 0 } } } },
+        { { 16770, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16756), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16760), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16764), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16768), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -6251,29 +4316,7 @@ static void CorkscrewRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16757), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16761), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16765), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 34, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16769), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6285,29 +4328,7 @@ static void CorkscrewRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16758), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16762), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16766), { 0, 0, height },
-                        { { 4, 4, height + 27 }, { 28, 28, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16770), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6453,30 +4474,53 @@ static void CorkscrewRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16711, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16649, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16708, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16646, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16710, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16648, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16711), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16649), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6491,25 +4535,11 @@ static void CorkscrewRCTrackDiag25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16708), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16646), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6523,25 +4553,11 @@ static void CorkscrewRCTrackDiag25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16710), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16648), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6623,30 +4639,53 @@ static void CorkscrewRCTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16723, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16661, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16720, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16658, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16722, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16660, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16723), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16661), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6661,25 +4700,11 @@ static void CorkscrewRCTrackDiag60DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16720), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16658), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6693,25 +4718,11 @@ static void CorkscrewRCTrackDiag60DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16722), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16660), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6793,30 +4804,53 @@ static void CorkscrewRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16703, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16641, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16700, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16638, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16702, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16640, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16703), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16641), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6831,25 +4865,11 @@ static void CorkscrewRCTrackDiagFlatTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16700), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16638), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6863,25 +4883,11 @@ static void CorkscrewRCTrackDiagFlatTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16702), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16640), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6963,30 +4969,53 @@ static void CorkscrewRCTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16715, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16653, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16712, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16650, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16714, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16652, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16715), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16653), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7001,25 +5030,11 @@ static void CorkscrewRCTrackDiag25DegUpTo60DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16712), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16650), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7027,31 +5042,17 @@ static void CorkscrewRCTrackDiag25DegUpTo60DegUp(
                     EnumsToFlags(
                         PaintSegment::topCorner, PaintSegment::centre, PaintSegment::topLeftSide, PaintSegment::topRightSide),
                     direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 72);
-            break;
-        case 2:
-            if (trackElement.HasChain())
-            {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16714), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 72);
+            break;
+        case 2:
+            if (trackElement.HasChain())
+            {
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16652), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7133,30 +5134,53 @@ static void CorkscrewRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16719, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16657, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16716, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16654, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16718, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16656, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16719), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16657), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7171,25 +5195,11 @@ static void CorkscrewRCTrackDiag60DegUpTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16716), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16654), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7203,25 +5213,11 @@ static void CorkscrewRCTrackDiag60DegUpTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16718), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16656), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7303,30 +5299,53 @@ static void CorkscrewRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16707, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16645, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16704, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16642, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16706, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16644, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16707), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16645), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7341,25 +5360,11 @@ static void CorkscrewRCTrackDiag25DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16704), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16642), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7373,25 +5378,11 @@ static void CorkscrewRCTrackDiag25DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16706), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16644), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7473,30 +5464,53 @@ static void CorkscrewRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16709, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16647, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16710, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16648, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16708, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16646, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16709), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16647), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7511,25 +5525,11 @@ static void CorkscrewRCTrackDiag25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16710), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16648), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7543,25 +5543,11 @@ static void CorkscrewRCTrackDiag25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16708), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16646), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7643,30 +5629,53 @@ static void CorkscrewRCTrackDiag60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16721, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16659, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16722, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16660, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16720, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16658, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16721), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16659), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7681,25 +5690,11 @@ static void CorkscrewRCTrackDiag60DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16722), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16660), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7713,25 +5708,11 @@ static void CorkscrewRCTrackDiag60DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16720), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16658), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7813,30 +5794,53 @@ static void CorkscrewRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16705, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16643, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16706, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16644, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16704, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16642, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16705), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16643), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7850,25 +5854,11 @@ static void CorkscrewRCTrackDiagFlatTo25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16706), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
-            else
-            {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16644), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+            else
+            {
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7881,25 +5871,11 @@ static void CorkscrewRCTrackDiagFlatTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16704), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16642), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7981,30 +5957,53 @@ static void CorkscrewRCTrackDiag25DegDownTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16717, { -16, -16, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16655, { -16, -16, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16718, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16656, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16716, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16654, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16717), { -16, -16, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16655), { -16, -16, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8019,25 +6018,11 @@ static void CorkscrewRCTrackDiag25DegDownTo60DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16718), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16656), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8051,25 +6036,11 @@ static void CorkscrewRCTrackDiag25DegDownTo60DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16716), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16654), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8151,30 +6122,53 @@ static void CorkscrewRCTrackDiag60DegDownTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16713, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16651, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16714, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16652, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16712, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16650, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16713), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16651), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8189,25 +6183,11 @@ static void CorkscrewRCTrackDiag60DegDownTo25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16714), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16652), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8221,25 +6201,11 @@ static void CorkscrewRCTrackDiag60DegDownTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16712), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16650), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8321,30 +6287,53 @@ static void CorkscrewRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16701, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16639, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16702, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16640, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16700, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16638, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16701), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16639), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8359,25 +6348,11 @@ static void CorkscrewRCTrackDiag25DegDownToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16702), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16640), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8391,25 +6366,11 @@ static void CorkscrewRCTrackDiag25DegDownToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16700), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16638), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8491,17 +6452,32 @@ static void CorkscrewRCTrackDiagFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16669, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16666, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16670, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16668, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16669), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8513,17 +6489,7 @@ static void CorkscrewRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16666), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16670), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8534,14 +6500,7 @@ static void CorkscrewRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16668), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8594,17 +6553,32 @@ static void CorkscrewRCTrackDiagFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16674, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16671, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16673, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16675, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16674), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8616,14 +6590,7 @@ static void CorkscrewRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16671), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8634,17 +6601,7 @@ static void CorkscrewRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16673), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16675), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8697,17 +6654,32 @@ static void CorkscrewRCTrackDiagLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16672, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16673, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16675, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16671, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16672), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8719,17 +6691,7 @@ static void CorkscrewRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16673), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16675), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8737,17 +6699,10 @@ static void CorkscrewRCTrackDiagLeftBankToFlat(
                         PaintSegment::topCorner, PaintSegment::centre, PaintSegment::topLeftSide, PaintSegment::topRightSide),
                     direction),
                 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16671), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+            break;
+        case 2:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8800,17 +6755,32 @@ static void CorkscrewRCTrackDiagRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16667, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16668, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16666, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16670, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16667), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8822,14 +6792,7 @@ static void CorkscrewRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16668), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8840,17 +6803,7 @@ static void CorkscrewRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16666), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16670), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8903,17 +6856,32 @@ static void CorkscrewRCTrackDiagLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16689, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16686, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16690, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16688, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16689), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8925,17 +6893,7 @@ static void CorkscrewRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16686), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16690), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8946,14 +6904,7 @@ static void CorkscrewRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16688), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9006,17 +6957,32 @@ static void CorkscrewRCTrackDiagRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16694, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16691, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16693, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16695, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16694), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9028,14 +6994,7 @@ static void CorkscrewRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16691), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9046,17 +7005,7 @@ static void CorkscrewRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16693), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16695), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9109,17 +7058,32 @@ static void CorkscrewRCTrackDiag25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16679, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16676, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16680, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16678, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16679), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9131,17 +7095,7 @@ static void CorkscrewRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16676), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16680), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9152,14 +7106,7 @@ static void CorkscrewRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16678), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9212,17 +7159,32 @@ static void CorkscrewRCTrackDiag25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16684, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16681, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16683, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16685, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16684), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9234,14 +7196,7 @@ static void CorkscrewRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16681), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9252,17 +7207,7 @@ static void CorkscrewRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16683), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16685), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9315,17 +7260,32 @@ static void CorkscrewRCTrackDiagLeftBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16682, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16683, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16685, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16681, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16682), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9336,17 +7296,7 @@ static void CorkscrewRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16683), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16685), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9356,14 +7306,7 @@ static void CorkscrewRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16681), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9416,17 +7359,32 @@ static void CorkscrewRCTrackDiagRightBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16677, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16678, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16676, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16680, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16677), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9437,14 +7395,7 @@ static void CorkscrewRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16678), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9454,17 +7405,7 @@ static void CorkscrewRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16676), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16680), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9517,17 +7458,32 @@ static void CorkscrewRCTrackDiag25DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16692, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16693, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16695, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16691, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16692), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9539,17 +7495,7 @@ static void CorkscrewRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16693), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16695), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9560,14 +7506,7 @@ static void CorkscrewRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16691), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9620,17 +7559,32 @@ static void CorkscrewRCTrackDiag25DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16687, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16688, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16686, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16690, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16687), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9642,14 +7596,7 @@ static void CorkscrewRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16688), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9660,17 +7607,7 @@ static void CorkscrewRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16686), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16690), { -16, -16, height },
-                        { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9723,17 +7660,29 @@ static void CorkscrewRCTrackDiagLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16665, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16662, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16664, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16665), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9745,14 +7694,7 @@ static void CorkscrewRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16662), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9763,14 +7705,7 @@ static void CorkscrewRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16664), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9823,17 +7758,29 @@ static void CorkscrewRCTrackDiagRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16663, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16664, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16662, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16663), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9845,14 +7792,7 @@ static void CorkscrewRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16664), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9863,14 +7803,7 @@ static void CorkscrewRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16662), { -16, -16, height },
-                        { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9984,28 +7917,29 @@ static void CorkscrewRCTrackLeftTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26972, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26978, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26971, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26977, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26973, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26979, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26970, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26976, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26974, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26980, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26969, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26975, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26972), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26978), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26971), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26977), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10022,25 +7956,7 @@ static void CorkscrewRCTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26973), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26979), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26970), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26976), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10052,25 +7968,7 @@ static void CorkscrewRCTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26974), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26980), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26969), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26975), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10100,28 +7998,29 @@ static void CorkscrewRCTrackRightTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26984, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26990, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26983, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26989, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26985, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26991, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26982, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26988, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26986, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26992, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26981, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26987, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26984), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26990), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26983), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26989), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10138,25 +8037,7 @@ static void CorkscrewRCTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26985), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26991), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26982), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26988), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10168,25 +8049,7 @@ static void CorkscrewRCTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26986), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26992), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26981), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26987), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10216,28 +8079,29 @@ static void CorkscrewRCTrackLeftTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26969, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26975, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26974, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26980, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26970, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26976, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26973, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26979, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26971, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26977, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26972, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26978, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26969), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26975), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26974), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26980), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10255,25 +8119,7 @@ static void CorkscrewRCTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26970), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26976), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26973), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26979), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10285,25 +8131,7 @@ static void CorkscrewRCTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26971), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26977), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26972), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26978), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -10332,28 +8160,29 @@ static void CorkscrewRCTrackRightTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26981, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26987, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26986, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+        { { 26992, { 0, 6, -8 }, { { 0, 6, -8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26982, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26988, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26985, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 26991, { 0, 6, 8 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26983, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26989, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26984, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26990, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26981), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26987), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26986), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26992), { 0, 6, height - 8 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10371,55 +8200,19 @@ static void CorkscrewRCTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26982), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26988), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26985), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26991), { 0, 6, height + 8 }, { 32, 20, 3 });
-                    break;
-            }
-            PaintUtilSetSegmentSupportHeight(
-                session,
-                PaintUtilRotateSegments(
-                    EnumsToFlags(
-                        PaintSegment::topCorner, PaintSegment::leftCorner, PaintSegment::centre, PaintSegment::topLeftSide,
-                        PaintSegment::topRightSide, PaintSegment::bottomLeftSide),
-                    direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26983), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26989), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26984), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26990), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
+            PaintUtilSetSegmentSupportHeight(
+                session,
+                PaintUtilRotateSegments(
+                    EnumsToFlags(
+                        PaintSegment::topCorner, PaintSegment::leftCorner, PaintSegment::centre, PaintSegment::topLeftSide,
+                        PaintSegment::topRightSide, PaintSegment::bottomLeftSide),
+                    direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+            break;
+        case 2:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -10449,28 +8242,29 @@ static void LayDownRCTrackLeftFlyerTwistUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26972, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26978, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26971, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26977, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26973, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26979, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26970, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26976, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26974, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26980, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26969, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26975, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26972), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26978), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26971), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26977), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10487,26 +8281,7 @@ static void LayDownRCTrackLeftFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26973), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26979), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26970), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26976), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10518,26 +8293,7 @@ static void LayDownRCTrackLeftFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26974), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26980), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26969), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26975), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10569,28 +8325,29 @@ static void LayDownRCTrackRightFlyerTwistUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26984, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26990, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26983, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26989, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26985, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26991, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26982, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26988, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26986, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26992, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26981, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26987, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26984), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26990), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26983), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26989), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10607,25 +8364,7 @@ static void LayDownRCTrackRightFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26985), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26991), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26982), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26988), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10637,25 +8376,7 @@ static void LayDownRCTrackRightFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26986), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26992), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26981), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26987), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10687,28 +8408,29 @@ static void LayDownRCTrackFlyerHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16594, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16602, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 11 } } } },
+        { { 16601, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { 16609, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16596, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 16604, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 16599, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 12, 119 } } } },
+        { { 16607, { 16, 16, 0 }, { { 15, 6, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16597, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16605, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16598, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+        { { 16606, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16594), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16602), { 0, 6, height }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16601), { 0, 6, height }, { 32, 20, 9 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16609), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -10753,27 +8475,7 @@ static void LayDownRCTrackFlyerHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16596), { 16, 0, height }, { 2, 16, 119 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16604), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16599), { 10, 16, height }, { 4, 12, 119 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16607), { 16, 16, height },
-                        { { 15, 6, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10785,25 +8487,7 @@ static void LayDownRCTrackFlyerHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16597), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16605), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16598), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16606), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
@@ -10821,32 +8505,29 @@ static void LayDownRCTrackLeftFlyerCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16610, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16613, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16616, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16619, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16611, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16614, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16617, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16620, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16612, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16615, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16618, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16621, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16610), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16613), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16616), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16619), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             if (direction == 2)
             {
@@ -10879,56 +8560,12 @@ static void LayDownRCTrackLeftFlyerCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16611), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16614), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16617), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16620), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16612), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16615), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16618), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16621), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10960,32 +8597,29 @@ static void LayDownRCTrackRightFlyerCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16622, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16625, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16628, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 16631, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16623, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16626, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16629, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16632, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16624, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16627, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16630, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 16633, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16622), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16625), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16628), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16631), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -11002,56 +8636,12 @@ static void LayDownRCTrackRightFlyerCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16623), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16626), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16629), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16632), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16624), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16627), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16630), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16633), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -38,33 +38,36 @@ static void FlyingRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17486, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17487, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17488, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17489, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17146, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17147, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17146, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17147, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedChainSprites = {
+        { { 27131, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 27132, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 27131, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 27132, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27129, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 27130, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 27129, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 27130, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17486), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17487), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17488), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17489), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -72,21 +75,7 @@ static void FlyingRCTrackFlat(
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17146), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17147), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -101,39 +90,11 @@ static void FlyingRCTrackFlat(
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27131), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                    break;
-                case 1:
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27132), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kInvertedChainSprites);
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27129), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                    break;
-                case 1:
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27130), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         }
 
         PaintUtilSetSegmentSupportHeight(
@@ -211,59 +172,40 @@ static void FlyingRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17498, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17499, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17500, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17501, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17204, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17205, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17206, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17207, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedChainSprites = {
+        { { 27249, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27250, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27251, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27252, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27221, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27222, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27223, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27224, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17498), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17499), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17500), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17501), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17204), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17205), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17206), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17207), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         }
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
@@ -285,55 +227,11 @@ static void FlyingRCTrack25DegUp(
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27249), { 0, 0, height + 24 },
-                        { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27250), { 0, 0, height + 24 },
-                        { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27251), { 0, 0, height + 24 },
-                        { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27252), { 0, 0, height + 24 },
-                        { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kInvertedChainSprites);
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27221), { 0, 0, height + 24 },
-                        { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27222), { 0, 0, height + 24 },
-                        { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27223), { 0, 0, height + 24 },
-                        { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27224), { 0, 0, height + 24 },
-                        { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         }
 
         PaintUtilSetSegmentSupportHeight(
@@ -378,31 +276,22 @@ static void FlyingRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17220, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17221, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 17222, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 17223, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27237, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+        { { 27238, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 27239, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 27240, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17220), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17221), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17222), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17223), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 32, height, session.SupportColours);
@@ -421,29 +310,7 @@ static void FlyingRCTrack60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27237), { 0, 0, height + 24 },
-                    { { 0, 6, height + 88 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27238), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 81 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27239), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 81 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27240), { 0, 0, height + 24 },
-                    { { 0, 6, height + 88 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         if (direction == 0 || direction == 3)
         {
             PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -463,59 +330,40 @@ static void FlyingRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17490, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17491, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17492, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17493, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17196, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17197, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17198, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17199, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedChainSprites = {
+        { { 27241, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27242, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27243, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27244, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27213, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27214, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27215, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27216, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17490), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17491), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17492), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17493), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17196), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17197), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17198), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17199), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         }
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
@@ -537,55 +385,11 @@ static void FlyingRCTrackFlatTo25DegUp(
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27241), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27242), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27243), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27244), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kInvertedChainSprites);
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27213), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27214), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27215), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27216), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         }
 
         PaintUtilSetSegmentSupportHeight(
@@ -630,37 +434,34 @@ static void FlyingRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17208, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17209, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17212, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 17210, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17213, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 17211, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27225, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 27229, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 27226, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 27230, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 27227, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 27228, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17208), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17209), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17212), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17210), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17213), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17211), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 12, height, session.SupportColours);
@@ -679,35 +480,7 @@ static void FlyingRCTrack25DegUpTo60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27225), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27229), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27226), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27230), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27227), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27228), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         if (direction == 0 || direction == 3)
         {
             PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -727,37 +500,34 @@ static void FlyingRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17214, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17215, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17218, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 17216, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17219, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 17217, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27231, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 27235, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 27232, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 27236, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 27233, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 27234, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17214), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17215), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17218), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17216), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17219), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17217), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 20, height, session.SupportColours);
@@ -776,35 +546,7 @@ static void FlyingRCTrack60DegUpTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27231), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27235), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27232), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27236), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27233), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27234), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -848,59 +590,40 @@ static void FlyingRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17494, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17495, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17496, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17497, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17200, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17201, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17202, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17203, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedChainSprites = {
+        { { 27245, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27246, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27247, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27248, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27217, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27218, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27219, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27220, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17494), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17495), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17496), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17497), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17200), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17201), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17202), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17203), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         }
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
@@ -922,55 +645,11 @@ static void FlyingRCTrack25DegUpToFlat(
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27245), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27246), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27247), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27248), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kInvertedChainSprites);
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27217), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27218), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27219), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27220), { 0, 0, height + 24 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         }
 
         PaintUtilSetSegmentSupportHeight(
@@ -1063,34 +742,73 @@ static void FlyingRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17259, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17264, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17269, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17254, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17258, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17263, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17268, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17253, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17257, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17262, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17267, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17252, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17256, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17261, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17266, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17251, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17255, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17260, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17265, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17250, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27142, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27147, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27152, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27137, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27141, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 27146, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 27151, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 27136, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27140, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27145, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27150, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27135, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5InvertedSprites = {
+        { { 27139, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 32, 3 } } } },
+        { { 27144, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 32, 3 } } } },
+        { { 27149, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 32, 3 } } } },
+        { { 27134, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6InvertedSprites = {
+        { { 27138, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27143, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27148, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27133, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17259), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17264), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17269), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17254), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -1110,29 +828,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17258), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17263), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17268), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17253), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1144,29 +840,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17257), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17262), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17267), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17252), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1181,29 +855,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17256), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17261), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17266), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17251), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1215,29 +867,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17255), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17260), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17265), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17250), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -1265,29 +895,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27142), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27147), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27152), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27137), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -1310,29 +918,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27141), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27146), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27151), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27136), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1344,29 +930,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27140), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27145), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27150), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27135), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1381,29 +945,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27139), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27144), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27149), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27134), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1415,29 +957,7 @@ static void FlyingRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27138), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27143), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27148), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27133), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -1479,37 +999,28 @@ static void FlyingRCTrackFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17156, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17164, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 17157, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17165, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17158, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17159, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27269, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27270, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27271, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27272, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17156), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17164), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17157), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17165), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17158), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17159), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1521,29 +1032,7 @@ static void FlyingRCTrackFlatToLeftBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27269), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27270), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27271), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27272), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -1568,37 +1057,28 @@ static void FlyingRCTrackFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17160, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17161, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17162, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17166, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 17163, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17167, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27273, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27274, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27275, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27276, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17160), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17161), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17162), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17166), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17163), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17167), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1610,29 +1090,7 @@ static void FlyingRCTrackFlatToRightBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27273), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27274), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27275), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27276), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -1657,37 +1115,28 @@ static void FlyingRCTrackLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17162, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17166, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 17163, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17167, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17160, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17161, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27275, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27276, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27273, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27274, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17162), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17166), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17163), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17167), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17160), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17161), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1699,29 +1148,7 @@ static void FlyingRCTrackLeftBankToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27275), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27276), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27273), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27274), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -1746,37 +1173,28 @@ static void FlyingRCTrackRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17158, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17159, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17156, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17164, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 17157, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17165, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27271, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27272, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27269, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27270, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17158), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17159), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17156), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17164), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17157), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17165), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1788,29 +1206,7 @@ static void FlyingRCTrackRightBankToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27271), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27272), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27269), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27270), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -1835,37 +1231,79 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 17279, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17290, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17284, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17289, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17274, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17278, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17283, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17288, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17273, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17277, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17282, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17287, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17272, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17276, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17281, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17286, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17271, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17275, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17280, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17285, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17291, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17270, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27162, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27167, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27172, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27157, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27161, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 27166, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 27171, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 27156, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27160, { 0, 0, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+        { { 27165, { 0, 0, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 27170, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 27155, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5InvertedSprites = {
+        { { 27159, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27164, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27169, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27154, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6InvertedSprites = {
+        { { 27158, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27163, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27168, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27153, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17279), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17290), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17284), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17289), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17274), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -1885,29 +1323,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17278), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17283), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17288), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17273), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1919,29 +1335,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17277), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17282), { 0, 0, height },
-                            { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17287), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17272), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1956,29 +1350,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17276), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17281), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17286), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17271), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1990,32 +1362,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17275), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17280), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17285), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17291), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 26 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17270), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -2043,29 +1390,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27162), { 0, 0, height + 24 },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27167), { 0, 0, height + 24 },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27172), { 0, 0, height + 24 },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27157), { 0, 0, height + 24 },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -2088,27 +1413,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27161), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27166), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27171), { 0, 0, height + 24 },
-                            { { 0, 16, height + 24 }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27156), { 0, 0, height + 24 },
-                            { { 0, 16, height + 24 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -2120,28 +1425,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27160), { 0, 0, height + 24 },
-                            { { 0, 16, height + 24 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27165), { 0, 0, height + 24 },
-                            { { 16, 16, height + 24 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27170), { 0, 0, height + 24 },
-                            { { 16, 0, height + 24 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27155), { 0, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -2156,27 +1440,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27159), { 0, 0, height + 24 },
-                            { { 16, 0, height + 24 }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27164), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27169), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27154), { 0, 0, height + 24 },
-                            { { 16, 0, height + 24 }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -2188,29 +1452,7 @@ static void FlyingRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27158), { 0, 0, height + 24 },
-                            { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27163), { 0, 0, height + 24 },
-                            { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27168), { 0, 0, height + 24 },
-                            { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27153), { 0, 0, height + 24 },
-                            { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -2252,37 +1494,28 @@ static void FlyingRCTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17168, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17172, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 17169, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17173, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17170, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17171, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27277, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27278, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27279, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27280, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17168), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17172), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17169), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17173), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17170), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17171), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -2301,29 +1534,7 @@ static void FlyingRCTrackLeftBankTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27277), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27278), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27279), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27280), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2373,37 +1584,28 @@ static void FlyingRCTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17174, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17175, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17176, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17178, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 17177, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17179, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27281, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27282, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27283, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27284, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17174), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17175), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17176), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17178), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17177), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17179), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -2422,29 +1624,7 @@ static void FlyingRCTrackRightBankTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27281), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27282), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27283), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27284), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2494,38 +1674,29 @@ static void FlyingRCTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17180, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17184, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 17181, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17185, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17182, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17183, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27285, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27286, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27287, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27288, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17180), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17184), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17181), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17185), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17182), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17183), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
-        if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
+        if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
         }
@@ -2543,29 +1714,7 @@ static void FlyingRCTrack25DegUpToLeftBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27285), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27286), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27287), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27288), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2615,37 +1764,28 @@ static void FlyingRCTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17186, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17187, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17188, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17190, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 17189, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17191, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27289, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27290, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27291, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27292, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17186), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17187), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17188), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17190), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17189), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17191), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -2664,29 +1804,7 @@ static void FlyingRCTrack25DegUpToRightBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27289), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27290), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27291), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27292), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2768,31 +1886,22 @@ static void FlyingRCTrackLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17192, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17193, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17194, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17195, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27293, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27294, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27295, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27296, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17192), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17193), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17194), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17195), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -2804,29 +1913,7 @@ static void FlyingRCTrackLeftBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27293), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27294), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27295), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27296), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2859,34 +1946,73 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17344, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17349, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17354, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17359, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17345, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17350, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17355, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17360, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17346, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17351, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17356, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17361, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17347, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17352, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17357, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17362, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17348, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17353, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17358, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17363, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27317, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27322, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27327, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27332, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27318, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 27323, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 27328, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 27333, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27319, { 0, 16, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+        { { 27324, { 16, 16, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 27329, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 27334, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5InvertedSprites = {
+        { { 27320, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27325, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27330, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27335, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6InvertedSprites = {
+        { { 27321, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27326, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27331, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27336, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17344), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17349), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17354), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17359), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -2906,27 +2032,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17345), { 0, 0, height }, { 32, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17350), { 0, 0, height }, { 32, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17355), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17360), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -2938,28 +2044,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17346), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17351), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17356), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17361), { 0, 0, height }, { 16, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -2974,27 +2059,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17347), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17352), { 0, 0, height }, { 16, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17357), { 0, 0, height }, { 16, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17362), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3006,29 +2071,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17348), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17353), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17358), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17363), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 switch (direction)
                 {
@@ -3056,25 +2099,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27317), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27322), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27327), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27332), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3097,25 +2122,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27318), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27323), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27328), { 0, 16, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27333), { 0, 16, height + 24 }, { 32, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3127,25 +2134,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27319), { 0, 16, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27324), { 16, 16, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27329), { 16, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27334), { 0, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3160,25 +2149,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27320), { 16, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27325), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27330), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27335), { 16, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3190,25 +2161,7 @@ static void FlyingRCTrackLeftQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27321), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27326), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27331), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27336), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3241,34 +2194,73 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17324, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17329, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17334, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17339, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17325, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17330, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17335, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17340, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17326, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17331, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17336, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17341, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17327, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17332, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17337, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17342, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17328, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17333, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17338, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17343, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27297, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27302, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27307, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27312, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27298, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 27303, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 27308, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 27313, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27299, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+        { { 27304, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 27309, { 16, 16, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 27314, { 0, 16, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5InvertedSprites = {
+        { { 27300, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27305, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27310, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27315, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6InvertedSprites = {
+        { { 27301, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27306, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27311, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27316, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17324), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17329), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17334), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17339), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -3288,27 +2280,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17325), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17330), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17335), { 0, 0, height }, { 32, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17340), { 0, 0, height }, { 32, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3320,28 +2292,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17326), { 0, 0, height }, { 16, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17331), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17336), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17341), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3356,27 +2307,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17327), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17332), { 0, 0, height }, { 16, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17337), { 0, 0, height }, { 16, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17342), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3388,29 +2319,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17328), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17333), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17338), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17343), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 switch (direction)
                 {
@@ -3438,25 +2347,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27297), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27302), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27307), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27312), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3479,25 +2370,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27298), { 0, 16, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27303), { 0, 16, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27308), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27313), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3509,25 +2382,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27299), { 0, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27304), { 16, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27309), { 16, 16, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27314), { 0, 16, height + 24 }, { 16, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3542,25 +2397,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27300), { 16, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27305), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27310), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27315), { 16, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3572,25 +2409,7 @@ static void FlyingRCTrackRightQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27301), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27306), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27311), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27316), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3641,34 +2460,49 @@ static void FlyingRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17308, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17312, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17311, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17315, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17311, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17315, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17308, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17312, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27253, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27257, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27256, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27260, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27254, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 27258, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 27255, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 27259, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27255, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 27259, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 27254, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 27258, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27256, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27260, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27253, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27257, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17308), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17312), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17311), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17315), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -3757,29 +2591,7 @@ static void FlyingRCTrackSBendLeft(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17311), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17315), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17308), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17312), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -3807,29 +2619,7 @@ static void FlyingRCTrackSBendLeft(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27253), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27257), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27256), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27260), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3849,29 +2639,7 @@ static void FlyingRCTrackSBendLeft(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27254), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27258), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27255), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27259), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3896,29 +2664,7 @@ static void FlyingRCTrackSBendLeft(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27255), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27259), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27254), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27258), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3943,29 +2689,7 @@ static void FlyingRCTrackSBendLeft(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27256), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27260), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27253), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27257), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3998,34 +2722,49 @@ static void FlyingRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17316, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17320, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17319, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17323, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17319, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17323, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17316, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17320, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27261, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27265, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27264, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27268, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27262, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 27266, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 27263, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 27267, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27263, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 27267, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 27262, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 27266, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27264, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27268, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27261, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27265, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17316), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17320), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17319), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17323), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -4114,29 +2853,7 @@ static void FlyingRCTrackSBendRight(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17319), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17323), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17316), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17320), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -4164,29 +2881,7 @@ static void FlyingRCTrackSBendRight(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27261), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27265), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27264), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27268), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -4206,43 +2901,21 @@ static void FlyingRCTrackSBendRight(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
+
+                PaintUtilSetSegmentSupportHeight(
+                    session,
+                    PaintUtilRotateSegments(
+                        EnumsToFlags(
+                            PaintSegment::rightCorner, PaintSegment::bottomCorner, PaintSegment::centre,
+                            PaintSegment::topRightSide, PaintSegment::bottomLeftSide, PaintSegment::bottomRightSide),
+                        direction),
+                    0xFFFF, 0);
                 switch (direction)
                 {
                     case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27262), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27266), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27263), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27267), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                }
-
-                PaintUtilSetSegmentSupportHeight(
-                    session,
-                    PaintUtilRotateSegments(
-                        EnumsToFlags(
-                            PaintSegment::rightCorner, PaintSegment::bottomCorner, PaintSegment::centre,
-                            PaintSegment::topRightSide, PaintSegment::bottomLeftSide, PaintSegment::bottomRightSide),
-                        direction),
-                    0xFFFF, 0);
-                switch (direction)
-                {
-                    case 0:
-                        MetalASupportsPaintSetup(
-                            session, kSupportType, MetalSupportPlace::BottomRightSide, 0, height + 39, session.SupportColours);
+                        MetalASupportsPaintSetup(
+                            session, kSupportType, MetalSupportPlace::BottomRightSide, 0, height + 39, session.SupportColours);
                         break;
                     case 1:
                         MetalASupportsPaintSetup(
@@ -4253,29 +2926,7 @@ static void FlyingRCTrackSBendRight(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27263), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27267), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27262), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27266), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -4300,29 +2951,7 @@ static void FlyingRCTrackSBendRight(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27264), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27268), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27261), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27265), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -4355,34 +2984,49 @@ static void FlyingRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17229, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17232, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17235, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17226, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17228, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17231, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17234, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17225, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17227, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17230, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17233, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17224, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27392, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27395, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27398, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27389, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27391, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27394, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27397, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27388, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27390, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27393, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27396, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27387, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17229), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17232), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17235), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17226), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -4402,29 +3046,7 @@ static void FlyingRCTrackLeftQuarterTurn3(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17228), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17231), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17234), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17225), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -4436,29 +3058,7 @@ static void FlyingRCTrackLeftQuarterTurn3(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17227), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17230), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17233), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17224), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -4486,29 +3086,7 @@ static void FlyingRCTrackLeftQuarterTurn3(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27392), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27395), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27398), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27389), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -4531,29 +3109,7 @@ static void FlyingRCTrackLeftQuarterTurn3(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27391), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27394), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27397), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27388), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -4565,29 +3121,7 @@ static void FlyingRCTrackLeftQuarterTurn3(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27390), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27393), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27396), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27387), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -4629,37 +3163,55 @@ static void FlyingRCTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 17241, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17248, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17244, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17247, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17238, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17240, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17243, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17246, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17237, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17239, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17242, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17245, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17249, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17236, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27404, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27407, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27410, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27401, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27403, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27406, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27409, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27400, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27402, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27405, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27408, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 27399, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17241), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17248), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17244), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17247), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17238), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -4679,29 +3231,7 @@ static void FlyingRCTrackLeftQuarterTurn3Bank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17240), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17243), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17246), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17237), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -4713,32 +3243,7 @@ static void FlyingRCTrackLeftQuarterTurn3Bank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17239), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17242), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17245), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17249), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 26 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17236), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -4766,29 +3271,7 @@ static void FlyingRCTrackLeftQuarterTurn3Bank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27404), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27407), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27410), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27401), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -4811,29 +3294,7 @@ static void FlyingRCTrackLeftQuarterTurn3Bank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27403), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27406), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27409), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27400), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -4845,29 +3306,7 @@ static void FlyingRCTrackLeftQuarterTurn3Bank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27402), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27405), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27408), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27399), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -4909,32 +3348,39 @@ static void FlyingRCTrackLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17375, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17377, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17379, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17373, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17374, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17376, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17378, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17372, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27422, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27424, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27426, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27420, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27421, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27423, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27425, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27419, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17375), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17377), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17379), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17373), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                }
-                MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
-                if (direction == 0 || direction == 3)
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
+                MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
+                if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
                 }
@@ -4955,25 +3401,7 @@ static void FlyingRCTrackLeftQuarterTurn325DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17374), { 6, 0, height }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17376), { 6, 0, height }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17378), { 6, 0, height }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17372), { 6, 0, height }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 switch (direction)
                 {
@@ -5001,25 +3429,7 @@ static void FlyingRCTrackLeftQuarterTurn325DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27422), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27424), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27426), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27420), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -5045,25 +3455,7 @@ static void FlyingRCTrackLeftQuarterTurn325DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27421), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27423), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27425), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27419), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -5096,30 +3488,31 @@ static void FlyingRCTrackRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17364, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17366, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17368, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17370, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27411, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27413, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27415, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27417, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27412, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27414, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27416, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27418, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17364), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17366), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17368), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17370), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -5195,25 +3588,7 @@ static void FlyingRCTrackRightQuarterTurn325DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27411), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27413), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27415), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27417), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -5239,25 +3614,7 @@ static void FlyingRCTrackRightQuarterTurn325DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27412), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27414), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27416), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27418), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -5308,35 +3665,59 @@ static void FlyingRCTrackLeftHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 17399, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17406, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17402, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17405, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17396, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17398, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17401, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17404, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17395, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17397, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17400, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17403, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17407, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17394, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 17396, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 17399, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17406, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17402, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 17405, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17395, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17398, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17401, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17404, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 17394, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17397, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17400, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 17403, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17407, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17399), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17406), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17402), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17405), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17396), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5356,29 +3737,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17398), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17401), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17404), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17395), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5390,32 +3749,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17397), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17400), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17403), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17407), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17394), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -5437,32 +3771,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17396), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17399), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17406), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17402), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17405), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -5487,29 +3796,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17395), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17398), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17401), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17404), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5521,32 +3808,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17394), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17397), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17400), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17403), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17407), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5570,35 +3832,59 @@ static void FlyingRCTrackRightHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17380, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17383, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17386, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 17389, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17393, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17381, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17384, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17387, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17390, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17382, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+        {
+            { 17385, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17392, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17388, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 17391, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 17383, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17386, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17389, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17393, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17380, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17384, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17387, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 17390, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17381, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        {
+            { 17385, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17392, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17388, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17391, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17382, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17380), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17383), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17386), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17389), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17393), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5618,29 +3904,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17381), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17384), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17387), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17390), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5652,32 +3916,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17382), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17385), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17392), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17388), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17391), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -5699,37 +3938,12 @@ static void FlyingRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
+            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17383), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17386), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17389), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17393), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17380), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
-            switch (direction)
-            {
-                case 2:
-                    PaintUtilPushTunnelRight(session, height, TunnelType::SquareFlat);
+                case 2:
+                    PaintUtilPushTunnelRight(session, height, TunnelType::SquareFlat);
                     break;
                 case 3:
                     PaintUtilPushTunnelLeft(session, height, TunnelType::SquareFlat);
@@ -5749,29 +3963,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17384), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17387), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17390), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17381), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5783,32 +3975,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17385), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17392), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17388), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17391), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17382), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5860,35 +4027,83 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 17439, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17450, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17444, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17449, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17434, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17438, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17443, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17448, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17433, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17437, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17442, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17447, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17432, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17436, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17441, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17446, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17431, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17435, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17440, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17445, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17451, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17430, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 17434, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 17439, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17450, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17444, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 17449, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 17433, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17438, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17443, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17448, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        { { 17432, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17437, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17442, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17447, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        { { 17431, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17436, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17441, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17446, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        { { 17430, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17435, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17440, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 17445, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17451, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17439), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17450), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17444), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17449), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17434), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5908,29 +4123,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17438), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17443), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17448), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17433), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5942,29 +4135,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17437), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17442), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17447), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17432), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5979,29 +4150,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17436), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17441), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17446), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17431), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6013,32 +4162,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17435), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17440), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17445), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17451), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17430), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -6060,32 +4184,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17434), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17439), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17450), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17444), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17449), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -6110,29 +4209,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17433), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17438), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17443), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17448), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6144,29 +4221,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17432), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17437), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17442), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17447), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6180,29 +4235,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17431), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17436), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17441), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17446), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6214,32 +4247,7 @@ static void FlyingRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17430), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17435), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17440), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17445), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17451), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -6263,35 +4271,83 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17408, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17413, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17418, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 17423, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17429, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17409, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17414, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17419, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17424, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17410, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17415, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17420, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17425, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17411, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17416, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17421, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17426, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17412, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+        {
+            { 17417, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17428, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17422, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 17427, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 17413, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17418, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 17423, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 17429, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 17408, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 17414, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17419, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 17424, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17409, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        { { 17415, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17420, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 17425, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17410, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        { { 17416, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17421, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 17426, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17411, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        {
+            { 17417, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17428, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 17422, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17427, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17412, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17408), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17413), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17418), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17423), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17429), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -6311,29 +4367,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17409), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17414), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17419), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17424), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6345,65 +4379,21 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17410), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17415), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17420), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17425), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
-            PaintUtilSetSegmentSupportHeight(
-                session,
-                PaintUtilRotateSegments(
-                    EnumsToFlags(
-                        PaintSegment::topCorner, PaintSegment::centre, PaintSegment::topLeftSide, PaintSegment::topRightSide),
-                    direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-            break;
-        case 4:
-            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-            break;
-        case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17411), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17416), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17421), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17426), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
+            PaintUtilSetSegmentSupportHeight(
+                session,
+                PaintUtilRotateSegments(
+                    EnumsToFlags(
+                        PaintSegment::topCorner, PaintSegment::centre, PaintSegment::topLeftSide, PaintSegment::topRightSide),
+                    direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+            break;
+        case 4:
+            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+            break;
+        case 5:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6415,32 +4405,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17412), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17417), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17428), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17422), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17427), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -6462,32 +4427,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17413), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17418), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17423), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17429), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17408), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -6512,29 +4452,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17414), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17419), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17424), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17409), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6546,29 +4464,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17415), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17420), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17425), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17410), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6583,29 +4479,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17416), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17421), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17426), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17411), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6617,32 +4491,7 @@ static void FlyingRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17417), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17428), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17422), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17427), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17412), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -6694,81 +4543,50 @@ static void FlyingRCTrackLeftQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17301, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17305, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17302, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17306, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17303, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17307, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17300, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17304, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        {
+            { 27352, { 0, 0, -5 }, { { 2, 2, -5 }, { 28, 28, 3 } } },
+            { 27348, { 0, 0, -5 }, { { 2, 2, 94 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27353, { 0, 0, -5 }, { { 2, 2, -5 }, { 28, 28, 3 } } },
+            { 27349, { 0, 0, -5 }, { { 2, 2, 94 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27354, { 0, 0, -5 }, { { 2, 2, -5 }, { 28, 28, 3 } } },
+            { 27350, { 0, 0, -5 }, { { 2, 2, 94 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27351, { 0, 0, -5 }, { { 2, 2, -5 }, { 28, 28, 3 } } },
+            { 27347, { 0, 0, -5 }, { { 2, 2, 94 }, { 28, 28, 1 } } },
+        },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17301), { 0, 0, height },
-                    { { 2, 2, height }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17305), { 0, 0, height },
-                    { { 2, 2, height + 99 }, { 28, 28, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17302), { 0, 0, height },
-                    { { 2, 2, height }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17306), { 0, 0, height },
-                    { { 2, 2, height + 99 }, { 28, 28, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17303), { 0, 0, height },
-                    { { 2, 2, height }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17307), { 0, 0, height },
-                    { { 2, 2, height + 99 }, { 28, 28, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17300), { 0, 0, height },
-                    { { 2, 2, height }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17304), { 0, 0, height },
-                    { { 2, 2, height + 99 }, { 28, 28, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27352), { 0, 0, height - 5 },
-                    { { 2, 2, height - 5 }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27348), { 0, 0, height - 5 },
-                    { { 2, 2, height + 94 }, { 28, 28, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27353), { 0, 0, height - 5 },
-                    { { 2, 2, height - 5 }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27349), { 0, 0, height - 5 },
-                    { { 2, 2, height + 94 }, { 28, 28, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27354), { 0, 0, height - 5 },
-                    { { 2, 2, height - 5 }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27350), { 0, 0, height - 5 },
-                    { { 2, 2, height + 94 }, { 28, 28, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27351), { 0, 0, height - 5 },
-                    { { 2, 2, height - 5 }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27347), { 0, 0, height - 5 },
-                    { { 2, 2, height + 94 }, { 28, 28, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
     }
 
     TrackPaintUtilLeftQuarterTurn1TileTunnel(
@@ -6782,81 +4600,50 @@ static void FlyingRCTrackRightQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 17292, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17296, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17293, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17297, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17294, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17298, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 17295, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 17299, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        {
+            { 27343, { 0, 0, -5 }, { { 2, 2, -5 }, { 28, 28, 3 } } },
+            { 27339, { 0, 0, -5 }, { { 2, 2, 94 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27344, { 0, 0, -5 }, { { 2, 2, -5 }, { 28, 28, 3 } } },
+            { 27340, { 0, 0, -5 }, { { 2, 2, 94 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27345, { 0, 0, -5 }, { { 2, 2, -5 }, { 28, 28, 3 } } },
+            { 27341, { 0, 0, -5 }, { { 2, 2, 94 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27346, { 0, 0, -5 }, { { 2, 2, -5 }, { 28, 28, 3 } } },
+            { 27342, { 0, 0, -5 }, { { 2, 2, 94 }, { 28, 28, 1 } } },
+        },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17292), { 0, 0, height },
-                    { { 2, 2, height }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17296), { 0, 0, height },
-                    { { 2, 2, height + 99 }, { 28, 28, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17293), { 0, 0, height },
-                    { { 2, 2, height }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17297), { 0, 0, height },
-                    { { 2, 2, height + 99 }, { 28, 28, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17294), { 0, 0, height },
-                    { { 2, 2, height }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17298), { 0, 0, height },
-                    { { 2, 2, height + 99 }, { 28, 28, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17295), { 0, 0, height },
-                    { { 2, 2, height }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17299), { 0, 0, height },
-                    { { 2, 2, height + 99 }, { 28, 28, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27343), { 0, 0, height - 5 },
-                    { { 2, 2, height - 5 }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27339), { 0, 0, height - 5 },
-                    { { 2, 2, height + 94 }, { 28, 28, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27344), { 0, 0, height - 5 },
-                    { { 2, 2, height - 5 }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27340), { 0, 0, height - 5 },
-                    { { 2, 2, height + 94 }, { 28, 28, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27345), { 0, 0, height - 5 },
-                    { { 2, 2, height - 5 }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27341), { 0, 0, height - 5 },
-                    { { 2, 2, height + 94 }, { 28, 28, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27346), { 0, 0, height - 5 },
-                    { { 2, 2, height - 5 }, { 28, 28, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27342), { 0, 0, height - 5 },
-                    { { 2, 2, height + 94 }, { 28, 28, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
     }
     TrackPaintUtilRightQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::SquareSlopeStart, +56, TunnelType::SquareSlopeEnd);
@@ -6885,23 +4672,22 @@ static void FlyingRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17148, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17149, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17148, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17149, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27337, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27338, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27337, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27338, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17148), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17149), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -6913,21 +4699,7 @@ static void FlyingRCTrackBrakes(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27337), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27338), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -6973,32 +4745,41 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27202, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27207, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27212, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27197, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27201, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27206, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27211, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27196, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27200, { 0, 0, 24 }, { { 0, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27205, { 0, 0, 24 }, { { 16, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27210, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27195, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27199, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27204, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27209, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27194, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27198, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27203, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27208, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27193, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27202), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27207), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27212), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27197), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7020,29 +4801,7 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27201), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27206), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27211), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27196), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7054,66 +4813,22 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27200), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27205), { 0, 0, height + 24 },
-                        { { 16, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27210), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27195), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
-                PaintUtilRotateSegments(
-                    EnumsToFlags(
-                        PaintSegment::rightCorner, PaintSegment::centre, PaintSegment::topRightSide,
-                        PaintSegment::bottomRightSide),
-                    direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 48);
-            break;
-        case 4:
-            PaintUtilSetGeneralSupportHeight(session, height + 48);
-            break;
-        case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27199), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27204), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27209), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27194), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-            }
+                PaintUtilRotateSegments(
+                    EnumsToFlags(
+                        PaintSegment::rightCorner, PaintSegment::centre, PaintSegment::topRightSide,
+                        PaintSegment::bottomRightSide),
+                    direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 48);
+            break;
+        case 4:
+            PaintUtilSetGeneralSupportHeight(session, height + 48);
+            break;
+        case 5:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7125,29 +4840,7 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27198), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27203), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27208), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27193), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7178,32 +4871,41 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27173, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27178, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27183, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27188, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27174, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27179, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27184, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27189, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27175, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27180, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27185, { 0, 0, 24 }, { { 16, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27190, { 0, 0, 24 }, { { 0, 16, 38 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27176, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27181, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27186, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27191, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27177, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27182, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27187, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27192, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27173), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27178), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27183), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27188), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7225,29 +4927,7 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27174), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27179), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27184), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27189), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7259,29 +4939,7 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27175), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27180), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27185), { 0, 0, height + 24 },
-                        { { 16, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27190), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7295,29 +4953,7 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27176), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27181), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27186), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27191), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7329,29 +4965,7 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27177), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27182), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27187), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27192), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7382,32 +4996,41 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27182, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27187, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27192, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27177, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27181, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27186, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27191, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27176, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27180, { 0, 0, 24 }, { { 0, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27185, { 0, 0, 24 }, { { 16, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27190, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27175, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27179, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27184, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27189, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27174, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27178, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27183, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27188, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27173, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27182), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27187), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27192), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27177), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7429,29 +5052,7 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27181), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27186), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27191), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27176), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7463,29 +5064,7 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27180), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27185), { 0, 0, height + 24 },
-                        { { 16, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27190), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27175), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7500,29 +5079,7 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27179), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27184), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27189), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27174), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7534,29 +5091,7 @@ static void FlyingRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27178), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27183), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27188), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27173), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7587,32 +5122,41 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27193, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27198, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27203, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27208, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27194, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27199, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27204, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27209, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27195, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27200, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27205, { 0, 0, 24 }, { { 16, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27210, { 0, 0, 24 }, { { 0, 16, 38 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27196, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27201, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27206, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27211, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27197, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27202, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27207, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27212, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27193), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27198), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27203), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27208), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7634,29 +5178,7 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27194), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27199), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27204), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27209), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7668,29 +5190,7 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27195), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27200), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27205), { 0, 0, height + 24 },
-                        { { 16, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27210), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7704,29 +5204,7 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27196), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27201), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27206), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27211), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7738,29 +5216,7 @@ static void FlyingRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27197), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27202), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27207), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27212), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7791,31 +5247,22 @@ static void FlyingRCTrack25DegUpLeftBanked(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17914, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17915, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17916, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17917, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27711, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27712, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27713, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27714, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17914), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17915), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17916), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17917), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -7834,29 +5281,7 @@ static void FlyingRCTrack25DegUpLeftBanked(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27711), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27712), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27713), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27714), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -7900,31 +5325,22 @@ static void FlyingRCTrack25DegUpRightBanked(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17918, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17919, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17920, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17921, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27715, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27716, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27717, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27718, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17918), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17919), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17920), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17921), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -7943,29 +5359,7 @@ static void FlyingRCTrack25DegUpRightBanked(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27715), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27716), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27717), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27718), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -8009,33 +5403,24 @@ static void FlyingRCTrackOnRidePhoto(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17146, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 17147, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 17146, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 17147, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27129, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27130, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27129, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27130, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, kSupportType);
 
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17146), { 0, 0, height },
-                    { { 0, 6, height + 3 }, { 32, 20, 0 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17147), { 0, 0, height },
-                    { { 0, 6, height + 3 }, { 32, 20, 0 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17146), { 0, 0, height },
-                    { { 0, 6, height + 3 }, { 32, 20, 0 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17147), { 0, 0, height },
-                    { { 0, 6, height + 3 }, { 32, 20, 0 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
         PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
         PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -8045,29 +5430,7 @@ static void FlyingRCTrackOnRidePhoto(
     {
         TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, kSupportType);
 
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27129), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27130), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27129), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27130), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
         PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
         PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -8096,34 +5459,55 @@ static void FlyingRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17546, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17550, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17554, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17558, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17547, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17551, { 0, 0, 0 }, { { 0, 0, 0 }, { 34, 16, 3 } } } },
+        { { 17555, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17559, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17548, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17552, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17556, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17560, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27507, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27511, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27515, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27519, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27508, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 27512, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 27516, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 27520, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27509, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27513, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27517, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27521, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4InvertedSprites = {
+        { { 27510, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27514, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 27518, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27522, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17546), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17550), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17554), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17558), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -8134,29 +5518,7 @@ static void FlyingRCTrackLeftEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17547), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17551), { 0, 0, height },
-                            { { 0, 0, height }, { 34, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17555), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17559), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8168,29 +5530,7 @@ static void FlyingRCTrackLeftEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17548), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17552), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17556), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17560), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8261,29 +5601,7 @@ static void FlyingRCTrackLeftEighthToDiag(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27507), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27511), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27515), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27519), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -8297,29 +5615,7 @@ static void FlyingRCTrackLeftEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27508), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27512), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27516), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27520), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8331,29 +5627,7 @@ static void FlyingRCTrackLeftEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27509), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27513), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27517), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27521), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8376,29 +5650,7 @@ static void FlyingRCTrackLeftEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 4:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27510), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27514), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27518), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27522), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence4InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8439,34 +5691,55 @@ static void FlyingRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17530, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17534, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17538, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17542, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17531, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17535, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17539, { 0, 0, 0 }, { { 0, 0, 0 }, { 34, 16, 3 } } } },
+        { { 17543, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17532, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17536, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17540, { 0, 0, 0 }, { { 4, 4, 0 }, { 28, 28, 3 } } } },
+        { { 17544, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27491, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27495, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27499, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27503, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27492, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 27496, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 27500, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 27504, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27493, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27497, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27501, { 0, 0, 24 }, { { 4, 4, 22 }, { 28, 28, 3 } } } },
+        { { 27505, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4InvertedSprites = {
+        { { 27494, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27498, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27502, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 27506, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17530), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17534), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17538), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17542), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -8477,29 +5750,7 @@ static void FlyingRCTrackRightEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17531), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17535), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17539), { 0, 0, height },
-                            { { 0, 0, height }, { 34, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17543), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8511,29 +5762,7 @@ static void FlyingRCTrackRightEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17532), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17536), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17540), { 0, 0, height },
-                            { { 4, 4, height }, { 28, 28, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17544), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8604,65 +5833,21 @@ static void FlyingRCTrackRightEighthToDiag(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27491), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27495), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27499), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27503), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
                 MetalASupportsPaintSetup(
                     session, kSupportType, MetalSupportPlace::Centre, 0, height + 39, session.SupportColours);
-
-                if (direction == 0 || direction == 3)
-                {
-                    PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
-                }
-                PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-                break;
-            case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27492), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27496), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27500), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27504), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
+
+                if (direction == 0 || direction == 3)
+                {
+                    PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
                 }
+                PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+                break;
+            case 1:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8674,29 +5859,7 @@ static void FlyingRCTrackRightEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27493), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27497), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27501), { 0, 0, height + 24 },
-                            { { 4, 4, height + 22 }, { 28, 28, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27505), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8719,29 +5882,7 @@ static void FlyingRCTrackRightEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 4:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27494), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27498), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27502), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27506), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence4InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8800,34 +5941,55 @@ static void FlyingRCTrackLeftEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17578, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17582, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17586, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17590, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17579, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17583, { 0, 0, 0 }, { { 0, 0, 27 }, { 34, 16, 0 } } } },
+        { { 17587, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17591, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17580, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17584, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } } },
+        { { 17588, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17592, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27539, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27543, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27547, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27551, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27540, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 27544, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 27548, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 27552, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27541, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27545, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27549, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27553, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4InvertedSprites = {
+        { { 27542, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 27546, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 27550, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27554, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17578), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17582), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17586), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17590), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -8838,29 +6000,7 @@ static void FlyingRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17579), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17583), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 34, 16, 0 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17587), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17591), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8872,29 +6012,7 @@ static void FlyingRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17580), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17584), { 0, 0, height },
-                            { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17588), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17592), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8965,29 +6083,7 @@ static void FlyingRCTrackLeftEighthBankToDiag(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27539), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27543), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27547), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27551), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9007,29 +6103,7 @@ static void FlyingRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27540), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27544), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27548), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27552), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9041,29 +6115,7 @@ static void FlyingRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27541), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27545), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27549), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27553), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9086,29 +6138,7 @@ static void FlyingRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 4:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27542), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27546), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27550), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27554), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence4InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9150,34 +6180,55 @@ static void FlyingRCTrackRightEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17562, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17566, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17570, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 17574, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17563, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17567, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17571, { 0, 0, 0 }, { { 0, 0, 27 }, { 34, 16, 0 } } } },
+        { { 17575, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17564, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17568, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17572, { 0, 0, 0 }, { { 4, 4, 27 }, { 28, 28, 0 } } } },
+        { { 17576, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27523, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27527, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27531, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 27535, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27524, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 27528, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 27532, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 27536, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27525, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27529, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27533, { 0, 0, 24 }, { { 4, 4, 22 }, { 28, 28, 3 } } } },
+        { { 27537, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4InvertedSprites = {
+        { { 27526, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27530, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 27534, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 27538, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17562), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17566), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17570), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17574), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -9188,29 +6239,7 @@ static void FlyingRCTrackRightEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17563), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17567), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17571), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 34, 16, 0 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17575), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9222,29 +6251,7 @@ static void FlyingRCTrackRightEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17564), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17568), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17572), { 0, 0, height },
-                            { { 4, 4, height + 27 }, { 28, 28, 0 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17576), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9315,29 +6322,7 @@ static void FlyingRCTrackRightEighthBankToDiag(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27523), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27527), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27531), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27535), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9357,29 +6342,7 @@ static void FlyingRCTrackRightEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27524), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27528), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27532), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27536), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9391,29 +6354,7 @@ static void FlyingRCTrackRightEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27525), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27529), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27533), { 0, 0, height + 24 },
-                            { { 4, 4, height + 22 }, { 28, 28, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27537), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9434,31 +6375,9 @@ static void FlyingRCTrackRightEighthBankToDiag(
                         direction),
                     0xFFFF, 0);
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-                break;
-            case 4:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27526), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27530), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27534), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27538), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                break;
+            case 4:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence4InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9517,6 +6436,91 @@ static void FlyingRCTrackDiagFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17861, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17791, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17858, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17788, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17860, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17790, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedChainSprites = {
+        {},
+        {},
+        {},
+        { { 27614, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27558, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedChainSprites = {
+        { { 27611, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27555, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedChainSprites = {
+        {},
+        {},
+        { { 27613, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27557, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedChainSprites = {
+        {},
+        { { 27612, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27556, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -9524,25 +6528,11 @@ static void FlyingRCTrackDiagFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17861), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17791), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9557,25 +6547,11 @@ static void FlyingRCTrackDiagFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17858), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17788), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9590,25 +6566,11 @@ static void FlyingRCTrackDiagFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17860), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17790), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9690,25 +6652,11 @@ static void FlyingRCTrackDiagFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27614), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27558), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9723,25 +6671,11 @@ static void FlyingRCTrackDiagFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27611), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27555), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9756,25 +6690,11 @@ static void FlyingRCTrackDiagFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27613), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27557), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9789,25 +6709,11 @@ static void FlyingRCTrackDiagFlat(
             case 3:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27612), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27556), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 }
 
                 PaintUtilSetSegmentSupportHeight(
@@ -9893,6 +6799,91 @@ static void FlyingRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17873, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17803, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17870, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17800, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17872, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17802, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedChainSprites = {
+        {},
+        {},
+        {},
+        { { 27626, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27570, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedChainSprites = {
+        { { 27623, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27567, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedChainSprites = {
+        {},
+        {},
+        { { 27625, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27569, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedChainSprites = {
+        {},
+        { { 27624, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27568, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -9900,25 +6891,11 @@ static void FlyingRCTrackDiag25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17873), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17803), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9933,25 +6910,11 @@ static void FlyingRCTrackDiag25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17870), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17800), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9966,25 +6929,11 @@ static void FlyingRCTrackDiag25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17872), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17802), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10066,25 +7015,11 @@ static void FlyingRCTrackDiag25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27626), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27570), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10099,25 +7034,11 @@ static void FlyingRCTrackDiag25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27623), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27567), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10132,25 +7053,11 @@ static void FlyingRCTrackDiag25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27625), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27569), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10165,25 +7072,11 @@ static void FlyingRCTrackDiag25DegUp(
             case 3:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27624), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27568), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 }
 
                 PaintUtilSetSegmentSupportHeight(
@@ -10225,6 +7118,67 @@ static void FlyingRCTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17885, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17815, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17882, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17812, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17884, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17814, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27582, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27579, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27581, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27580, { -16, -16, 24 }, { { -16, -16, 24 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -10232,25 +7186,11 @@ static void FlyingRCTrackDiag60DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17885), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17815), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10265,25 +7205,11 @@ static void FlyingRCTrackDiag60DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17882), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17812), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10298,25 +7224,11 @@ static void FlyingRCTrackDiag60DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17884), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17814), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10396,14 +7308,7 @@ static void FlyingRCTrackDiag60DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27582), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10415,14 +7320,7 @@ static void FlyingRCTrackDiag60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27579), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10434,14 +7332,7 @@ static void FlyingRCTrackDiag60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27581), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10452,15 +7343,8 @@ static void FlyingRCTrackDiag60DegUp(
                     0xFFFF, 0);
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
-            case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27580), { -16, -16, height + 24 },
-                            { { -16, -16, height + 24 }, { 32, 32, 3 } });
-                        break;
-                }
+            case 3:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10501,6 +7385,91 @@ static void FlyingRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17865, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17795, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17862, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17792, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17864, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17794, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedChainSprites = {
+        {},
+        {},
+        {},
+        { { 27618, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27562, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedChainSprites = {
+        { { 27615, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27559, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedChainSprites = {
+        {},
+        {},
+        { { 27617, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27561, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedChainSprites = {
+        {},
+        { { 27616, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27560, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -10508,25 +7477,11 @@ static void FlyingRCTrackDiagFlatTo25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17865), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17795), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10541,25 +7496,11 @@ static void FlyingRCTrackDiagFlatTo25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17862), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17792), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10574,25 +7515,11 @@ static void FlyingRCTrackDiagFlatTo25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17864), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17794), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10674,25 +7601,11 @@ static void FlyingRCTrackDiagFlatTo25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27618), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27562), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10707,25 +7620,11 @@ static void FlyingRCTrackDiagFlatTo25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27615), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27559), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10740,25 +7639,11 @@ static void FlyingRCTrackDiagFlatTo25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27617), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27561), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10773,25 +7658,11 @@ static void FlyingRCTrackDiagFlatTo25DegUp(
             case 3:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27616), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27560), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 }
 
                 PaintUtilSetSegmentSupportHeight(
@@ -10833,6 +7704,67 @@ static void FlyingRCTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17877, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17807, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17874, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17804, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17876, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17806, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27574, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27571, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27573, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27572, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -10840,25 +7772,11 @@ static void FlyingRCTrackDiag25DegUpTo60DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17877), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17807), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10873,25 +7791,11 @@ static void FlyingRCTrackDiag25DegUpTo60DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17874), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17804), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10906,25 +7810,11 @@ static void FlyingRCTrackDiag25DegUpTo60DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17876), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17806), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11004,14 +7894,7 @@ static void FlyingRCTrackDiag25DegUpTo60DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27574), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11023,14 +7906,7 @@ static void FlyingRCTrackDiag25DegUpTo60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27571), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11042,14 +7918,7 @@ static void FlyingRCTrackDiag25DegUpTo60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27573), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11061,14 +7930,7 @@ static void FlyingRCTrackDiag25DegUpTo60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27572), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11109,6 +7971,67 @@ static void FlyingRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17881, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17811, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17878, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17808, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17880, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17810, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27578, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27575, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27577, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27576, { -16, -16, 24 }, { { 0, 0, 56 }, { 16, 16, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -11116,25 +8039,11 @@ static void FlyingRCTrackDiag60DegUpTo25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17881), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17811), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11149,25 +8058,11 @@ static void FlyingRCTrackDiag60DegUpTo25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17878), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17808), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11182,25 +8077,11 @@ static void FlyingRCTrackDiag60DegUpTo25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17880), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17810), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11280,14 +8161,7 @@ static void FlyingRCTrackDiag60DegUpTo25DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27578), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11299,14 +8173,7 @@ static void FlyingRCTrackDiag60DegUpTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27575), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11318,14 +8185,7 @@ static void FlyingRCTrackDiag60DegUpTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27577), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11337,14 +8197,7 @@ static void FlyingRCTrackDiag60DegUpTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27576), { -16, -16, height + 24 },
-                            { { 0, 0, height + 56 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11385,6 +8238,91 @@ static void FlyingRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17869, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17799, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17866, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17796, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17868, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17798, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedChainSprites = {
+        {},
+        {},
+        {},
+        { { 27622, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27566, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedChainSprites = {
+        { { 27619, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27563, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedChainSprites = {
+        {},
+        {},
+        { { 27621, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27565, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedChainSprites = {
+        {},
+        { { 27620, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27564, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -11392,25 +8330,11 @@ static void FlyingRCTrackDiag25DegUpToFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17869), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17799), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11425,25 +8349,11 @@ static void FlyingRCTrackDiag25DegUpToFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17866), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17796), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11458,25 +8368,11 @@ static void FlyingRCTrackDiag25DegUpToFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17868), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17798), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11558,25 +8454,11 @@ static void FlyingRCTrackDiag25DegUpToFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27622), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27566), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11591,25 +8473,11 @@ static void FlyingRCTrackDiag25DegUpToFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27619), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27563), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11624,25 +8492,11 @@ static void FlyingRCTrackDiag25DegUpToFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27621), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27565), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11657,25 +8511,11 @@ static void FlyingRCTrackDiag25DegUpToFlat(
             case 3:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27620), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(27564), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 }
 
                 PaintUtilSetSegmentSupportHeight(
@@ -11717,6 +8557,67 @@ static void FlyingRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17871, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17801, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17872, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17802, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17870, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17800, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27568, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27569, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27567, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27570, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -11724,25 +8625,11 @@ static void FlyingRCTrackDiag25DegDown(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17871), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17801), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11757,25 +8644,11 @@ static void FlyingRCTrackDiag25DegDown(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17872), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17802), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11790,25 +8663,11 @@ static void FlyingRCTrackDiag25DegDown(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17870), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17800), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11888,14 +8747,7 @@ static void FlyingRCTrackDiag25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27568), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11907,14 +8759,7 @@ static void FlyingRCTrackDiag25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27569), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11926,14 +8771,7 @@ static void FlyingRCTrackDiag25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27567), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11945,14 +8783,7 @@ static void FlyingRCTrackDiag25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27570), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11993,6 +8824,67 @@ static void FlyingRCTrackDiag60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17883, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17813, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17884, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17814, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17882, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17812, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27580, { -16, -16, 24 }, { { -16, -16, 24 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27581, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27579, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27582, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -12000,25 +8892,11 @@ static void FlyingRCTrackDiag60DegDown(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17883), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17813), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12033,25 +8911,11 @@ static void FlyingRCTrackDiag60DegDown(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17884), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17814), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12066,25 +8930,11 @@ static void FlyingRCTrackDiag60DegDown(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17882), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17812), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12164,14 +9014,7 @@ static void FlyingRCTrackDiag60DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27580), { -16, -16, height + 24 },
-                            { { -16, -16, height + 24 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12183,14 +9026,7 @@ static void FlyingRCTrackDiag60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27581), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12202,14 +9038,7 @@ static void FlyingRCTrackDiag60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27579), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12221,14 +9050,7 @@ static void FlyingRCTrackDiag60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27582), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12269,6 +9091,67 @@ static void FlyingRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17867, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17797, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17868, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17798, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17866, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17796, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27564, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27565, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27563, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27566, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -12276,25 +9159,11 @@ static void FlyingRCTrackDiagFlatTo25DegDown(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17867), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17797), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12308,25 +9177,11 @@ static void FlyingRCTrackDiagFlatTo25DegDown(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17868), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17798), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12339,26 +9194,12 @@ static void FlyingRCTrackDiagFlatTo25DegDown(
                 break;
             case 2:
                 if (trackElement.HasChain())
-                {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17866), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
-                }
-                else
-                {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17796), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                {
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
+                }
+                else
+                {
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12436,14 +9277,7 @@ static void FlyingRCTrackDiagFlatTo25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27564), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12454,14 +9288,7 @@ static void FlyingRCTrackDiagFlatTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27565), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12472,14 +9299,7 @@ static void FlyingRCTrackDiagFlatTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27563), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12490,14 +9310,7 @@ static void FlyingRCTrackDiagFlatTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27566), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12538,6 +9351,67 @@ static void FlyingRCTrackDiag25DegDownTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17879, { -16, -16, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17809, { -16, -16, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17880, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17810, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17878, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17808, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27576, { -16, -16, 24 }, { { 0, 0, 56 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27577, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27575, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27578, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -12545,25 +9419,11 @@ static void FlyingRCTrackDiag25DegDownTo60DegDown(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17879), { -16, -16, height },
-                                { { 0, 0, height }, { 16, 16, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17809), { -16, -16, height },
-                                { { 0, 0, height }, { 16, 16, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12578,25 +9438,11 @@ static void FlyingRCTrackDiag25DegDownTo60DegDown(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17880), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17810), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12611,25 +9457,11 @@ static void FlyingRCTrackDiag25DegDownTo60DegDown(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17878), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17808), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12709,14 +9541,7 @@ static void FlyingRCTrackDiag25DegDownTo60DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27576), { -16, -16, height + 24 },
-                            { { 0, 0, height + 56 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12728,14 +9553,7 @@ static void FlyingRCTrackDiag25DegDownTo60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27577), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12747,14 +9565,7 @@ static void FlyingRCTrackDiag25DegDownTo60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27575), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12766,14 +9577,7 @@ static void FlyingRCTrackDiag25DegDownTo60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27578), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12814,6 +9618,67 @@ static void FlyingRCTrackDiag60DegDownTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17875, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17805, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17876, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17806, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17874, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17804, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27572, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27573, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27571, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27574, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -12821,25 +9686,11 @@ static void FlyingRCTrackDiag60DegDownTo25DegDown(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17875), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17805), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12854,25 +9705,11 @@ static void FlyingRCTrackDiag60DegDownTo25DegDown(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17876), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17806), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12887,25 +9724,11 @@ static void FlyingRCTrackDiag60DegDownTo25DegDown(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17874), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17804), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12985,14 +9808,7 @@ static void FlyingRCTrackDiag60DegDownTo25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27572), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13004,14 +9820,7 @@ static void FlyingRCTrackDiag60DegDownTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27573), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13023,14 +9832,7 @@ static void FlyingRCTrackDiag60DegDownTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27571), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13042,14 +9844,7 @@ static void FlyingRCTrackDiag60DegDownTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27574), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13090,6 +9885,67 @@ static void FlyingRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 17863, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17793, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 17864, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17794, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 17862, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17792, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27560, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27561, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27559, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27562, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -13097,25 +9953,11 @@ static void FlyingRCTrackDiag25DegDownToFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17863), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17793), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13130,25 +9972,11 @@ static void FlyingRCTrackDiag25DegDownToFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17864), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17794), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13163,25 +9991,11 @@ static void FlyingRCTrackDiag25DegDownToFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17862), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(17792), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13261,14 +10075,7 @@ static void FlyingRCTrackDiag25DegDownToFlat(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27560), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13280,14 +10087,7 @@ static void FlyingRCTrackDiag25DegDownToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27561), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13299,14 +10099,7 @@ static void FlyingRCTrackDiag25DegDownToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27559), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13318,14 +10111,7 @@ static void FlyingRCTrackDiag25DegDownToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27562), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13366,19 +10152,58 @@ static void FlyingRCTrackDiagFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17831, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17828, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17832, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17830, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27590, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27587, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27589, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27588, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17831), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13386,21 +10211,11 @@ static void FlyingRCTrackDiagFlatToLeftBank(
                             PaintSegment::rightCorner, PaintSegment::centre, PaintSegment::topRightSide,
                             PaintSegment::bottomRightSide),
                         direction),
-                    0xFFFF, 0);
-                PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-                break;
-            case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17828), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17832), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                    0xFFFF, 0);
+                PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+                break;
+            case 1:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13412,14 +10227,7 @@ static void FlyingRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17830), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13470,14 +10278,7 @@ static void FlyingRCTrackDiagFlatToLeftBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27590), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13489,14 +10290,7 @@ static void FlyingRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27587), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13508,14 +10302,7 @@ static void FlyingRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27589), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13527,14 +10314,7 @@ static void FlyingRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27588), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13575,19 +10355,58 @@ static void FlyingRCTrackDiagFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17836, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17833, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17835, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17837, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27594, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27591, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27593, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27592, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17836), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13599,14 +10418,7 @@ static void FlyingRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17833), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13618,17 +10430,7 @@ static void FlyingRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17835), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17837), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13679,14 +10481,7 @@ static void FlyingRCTrackDiagFlatToRightBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27594), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13698,14 +10493,7 @@ static void FlyingRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27591), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13717,14 +10505,7 @@ static void FlyingRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27593), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13736,14 +10517,7 @@ static void FlyingRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27592), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13784,19 +10558,58 @@ static void FlyingRCTrackDiagLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17834, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17835, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17837, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17833, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27592, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27593, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27591, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27594, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17834), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13808,17 +10621,7 @@ static void FlyingRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17835), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17837), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13830,14 +10633,7 @@ static void FlyingRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17833), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13888,14 +10684,7 @@ static void FlyingRCTrackDiagLeftBankToFlat(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27592), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13907,14 +10696,7 @@ static void FlyingRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27593), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13926,14 +10708,7 @@ static void FlyingRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27591), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13945,14 +10720,7 @@ static void FlyingRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27594), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13993,19 +10761,58 @@ static void FlyingRCTrackDiagRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17829, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17830, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17828, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17832, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27588, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27589, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27587, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27590, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17829), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14017,14 +10824,7 @@ static void FlyingRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17830), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14036,17 +10836,7 @@ static void FlyingRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17828), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17832), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14097,14 +10887,7 @@ static void FlyingRCTrackDiagRightBankToFlat(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27588), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14116,14 +10899,7 @@ static void FlyingRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27589), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14135,14 +10911,7 @@ static void FlyingRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27587), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14154,14 +10923,7 @@ static void FlyingRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27590), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -14202,19 +10964,58 @@ static void FlyingRCTrackDiagLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17851, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17848, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17852, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17850, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27606, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27603, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27605, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27604, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17851), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14226,17 +11027,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17848), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17852), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14248,14 +11039,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17850), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14306,14 +11090,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27606), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14325,14 +11102,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27603), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14344,14 +11114,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27605), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14363,14 +11126,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27604), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -14411,19 +11167,58 @@ static void FlyingRCTrackDiagRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17856, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17853, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17855, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17857, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27610, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27607, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27609, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27608, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17856), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14435,36 +11230,19 @@ static void FlyingRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17853), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
                         EnumsToFlags(
                             PaintSegment::topCorner, PaintSegment::centre, PaintSegment::topLeftSide,
                             PaintSegment::topRightSide),
-                        direction),
-                    0xFFFF, 0);
-                PaintUtilSetGeneralSupportHeight(session, height + 48);
-                break;
-            case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17855), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17857), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                        direction),
+                    0xFFFF, 0);
+                PaintUtilSetGeneralSupportHeight(session, height + 48);
+                break;
+            case 2:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14515,14 +11293,7 @@ static void FlyingRCTrackDiagRightBankTo25DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27610), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14534,14 +11305,7 @@ static void FlyingRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27607), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14553,14 +11317,7 @@ static void FlyingRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27609), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14572,14 +11329,7 @@ static void FlyingRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27608), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -14620,19 +11370,58 @@ static void FlyingRCTrackDiag25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17841, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17838, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17842, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17840, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27598, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27595, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27597, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27596, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17841), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14644,17 +11433,7 @@ static void FlyingRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17838), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17842), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14666,14 +11445,7 @@ static void FlyingRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17840), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14724,14 +11496,7 @@ static void FlyingRCTrackDiag25DegUpToLeftBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27598), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14743,14 +11508,7 @@ static void FlyingRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27595), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14762,14 +11520,7 @@ static void FlyingRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27597), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14781,14 +11532,7 @@ static void FlyingRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27596), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -14829,19 +11573,58 @@ static void FlyingRCTrackDiag25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17846, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17843, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17845, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17847, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27602, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27599, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27601, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27600, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17846), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14853,14 +11636,7 @@ static void FlyingRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17843), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14872,17 +11648,7 @@ static void FlyingRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17845), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17847), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14933,14 +11699,7 @@ static void FlyingRCTrackDiag25DegUpToRightBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27602), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14952,14 +11711,7 @@ static void FlyingRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27599), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14971,14 +11723,7 @@ static void FlyingRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27601), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14990,14 +11735,7 @@ static void FlyingRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27600), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -15038,19 +11776,58 @@ static void FlyingRCTrackDiagLeftBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17844, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17845, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17847, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17843, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27600, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27601, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27599, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27602, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17844), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15061,17 +11838,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17845), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17847), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15082,14 +11849,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17843), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15138,14 +11898,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27600), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15156,14 +11909,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27601), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15174,14 +11920,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27599), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15192,14 +11931,7 @@ static void FlyingRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27602), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -15240,19 +11972,58 @@ static void FlyingRCTrackDiagRightBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17839, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17840, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17838, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17842, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27596, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27597, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27595, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27598, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17839), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15263,14 +12034,7 @@ static void FlyingRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17840), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15281,17 +12045,7 @@ static void FlyingRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17838), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17842), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15340,14 +12094,7 @@ static void FlyingRCTrackDiagRightBankTo25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27596), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15358,14 +12105,7 @@ static void FlyingRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27597), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15376,14 +12116,7 @@ static void FlyingRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27595), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15394,14 +12127,7 @@ static void FlyingRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27598), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -15442,19 +12168,58 @@ static void FlyingRCTrackDiag25DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17854, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 17855, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17857, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17853, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27608, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27609, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27607, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27610, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17854), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15466,17 +12231,7 @@ static void FlyingRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17855), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17857), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15488,14 +12243,7 @@ static void FlyingRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17853), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15541,19 +12289,12 @@ static void FlyingRCTrackDiag25DegDownToLeftBank(
                 break;
         }
     }
-    else
-    {
-        switch (trackSequence)
-        {
-            case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27608), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+    else
+    {
+        switch (trackSequence)
+        {
+            case 0:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15565,14 +12306,7 @@ static void FlyingRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27609), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15584,14 +12318,7 @@ static void FlyingRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27607), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15603,14 +12330,7 @@ static void FlyingRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27610), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -15651,19 +12371,58 @@ static void FlyingRCTrackDiag25DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17849, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17850, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 17848, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 17852, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27604, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27605, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27603, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27606, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17849), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15675,14 +12434,7 @@ static void FlyingRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17850), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15694,17 +12446,7 @@ static void FlyingRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17848), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17852), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15755,14 +12497,7 @@ static void FlyingRCTrackDiag25DegDownToRightBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27604), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15774,14 +12509,7 @@ static void FlyingRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27605), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15793,14 +12521,7 @@ static void FlyingRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27603), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15812,14 +12533,7 @@ static void FlyingRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27606), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -15860,19 +12574,55 @@ static void FlyingRCTrackDiagLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17827, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17824, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17826, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27586, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27583, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27585, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27584, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17827), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15884,14 +12634,7 @@ static void FlyingRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17824), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15903,14 +12646,7 @@ static void FlyingRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17826), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15961,14 +12697,7 @@ static void FlyingRCTrackDiagLeftBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27586), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15980,14 +12709,7 @@ static void FlyingRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27583), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -15999,14 +12721,7 @@ static void FlyingRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27585), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -16018,14 +12733,7 @@ static void FlyingRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27584), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -16066,19 +12774,55 @@ static void FlyingRCTrackDiagRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 17825, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17826, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 17824, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 27584, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 27585, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 27583, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 27586, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17825), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -16090,14 +12834,7 @@ static void FlyingRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17826), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -16109,14 +12846,7 @@ static void FlyingRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17824), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -16167,14 +12897,7 @@ static void FlyingRCTrackDiagRightBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27584), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -16186,14 +12909,7 @@ static void FlyingRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27585), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -16205,14 +12921,7 @@ static void FlyingRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27583), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -16224,14 +12933,7 @@ static void FlyingRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27586), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -16272,32 +12974,29 @@ static void FlyingRCTrackLeftFlyerTwistUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27430, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27436, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27429, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27435, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27431, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27437, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27428, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27434, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27432, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27438, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27427, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27433, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27430), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27436), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27429), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27435), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height - 5, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -16314,26 +13013,7 @@ static void FlyingRCTrackLeftFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27431), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27437), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27428), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27434), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -16345,26 +13025,7 @@ static void FlyingRCTrackLeftFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27432), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27438), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27427), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27433), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -16395,32 +13056,29 @@ static void FlyingRCTrackRightFlyerTwistUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27442, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27448, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27441, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27447, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27443, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27449, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27440, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27446, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27444, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27450, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27439, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27445, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27442), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27448), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27441), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27447), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height - 5, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -16437,25 +13095,7 @@ static void FlyingRCTrackRightFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27443), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27449), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27440), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27446), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -16467,25 +13107,7 @@ static void FlyingRCTrackRightFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27444), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27450), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27439), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27445), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -16516,29 +13138,29 @@ static void FlyingRCTrackLeftFlyerTwistDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27427, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27433, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27432, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27438, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27428, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27434, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27431, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27437, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27429, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27435, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27430, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27436, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27427), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27433), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27432), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27438), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -16557,26 +13179,7 @@ static void FlyingRCTrackLeftFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27428), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27434), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27431), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27437), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -16588,29 +13191,7 @@ static void FlyingRCTrackLeftFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27429), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27435), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27430), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27436), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height - 5, session.SupportColours);
             switch (direction)
             {
@@ -16639,28 +13220,29 @@ static void FlyingRCTrackRightFlyerTwistDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27439, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27445, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27444, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27450, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27440, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27446, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27443, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27449, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27441, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27447, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27442, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+        { { 27448, { 0, 6, -5 }, { { 0, 6, 6 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27439), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27445), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27444), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27450), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -16679,25 +13261,7 @@ static void FlyingRCTrackRightFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27440), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27446), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27443), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27449), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -16709,29 +13273,7 @@ static void FlyingRCTrackRightFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27441), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27447), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27442), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27448), { 0, 6, height - 5 },
-                        { { 0, 6, height + 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height - 5, session.SupportColours);
             switch (direction)
             {
@@ -16760,28 +13302,29 @@ static void FlyingRCTrackFlyerHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17626, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17634, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 11 } } } },
+        { { 17633, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { 17641, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17628, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 17636, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 17631, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 12, 119 } } } },
+        { { 17639, { 16, 16, 0 }, { { 15, 6, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17629, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17637, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17630, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+        { { 17638, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17626), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17634), { 0, 6, height }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17633), { 0, 6, height }, { 32, 20, 9 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17641), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -16826,27 +13369,7 @@ static void FlyingRCTrackFlyerHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17628), { 16, 0, height }, { 2, 16, 119 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17636), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17631), { 10, 16, height }, { 4, 12, 119 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17639), { 16, 16, height },
-                        { { 15, 6, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -16858,25 +13381,7 @@ static void FlyingRCTrackFlyerHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17629), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17637), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17630), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17638), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
@@ -16893,28 +13398,29 @@ static void FlyingRCTrackFlyerHalfLoopDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17629, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17637, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 17630, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+        { { 17638, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 17628, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 17636, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 17631, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 12, 119 } } } },
+        { { 17639, { 16, 16, 0 }, { { 15, 6, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17626, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17634, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 11 } } } },
+        { { 17633, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { 17641, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17629), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17637), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17630), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17638), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
@@ -16924,27 +13430,7 @@ static void FlyingRCTrackFlyerHalfLoopDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17628), { 16, 0, height }, { 2, 16, 119 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17636), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17631), { 10, 16, height }, { 4, 12, 119 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17639), { 16, 16, height },
-                        { { 15, 6, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -16990,25 +13476,7 @@ static void FlyingRCTrackFlyerHalfLoopDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17626), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17634), { 0, 6, height }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17633), { 0, 6, height }, { 32, 20, 9 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17641), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -17026,23 +13494,22 @@ static void FlyingRCTrackBlockBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17150, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17151, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17150, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17151, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27337, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27338, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27337, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27338, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17150), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17151), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
         PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
         PaintUtilSetSegmentSupportHeight(
@@ -17051,21 +13518,7 @@ static void FlyingRCTrackBlockBrakes(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27337), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27338), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -17084,31 +13537,37 @@ static void FlyingRCTrackLeftBankedQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 18025, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18027, { 0, 6, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 18029, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18023, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 18024, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 18026, { 6, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 18028, { 6, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 18022, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27762, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27764, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27766, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27760, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27761, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27763, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27765, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27759, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18025), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18027), { 0, 6, height },
-                            { { 0, 27, height }, { 32, 1, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18029), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18023), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -17131,27 +13590,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn325DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18024), { 6, 0, height }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18026), { 6, 0, height },
-                            { { 27, 0, height }, { 1, 32, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18028), { 6, 0, height },
-                            { { 27, 0, height }, { 1, 32, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18022), { 6, 0, height }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 switch (direction)
                 {
@@ -17171,33 +13610,15 @@ static void FlyingRCTrackLeftBankedQuarterTurn325DegUp(
                         direction),
                     0xFFFF, 0);
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
-                break;
-        }
-    }
-    else
-    {
-        switch (trackSequence)
-        {
-            case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27762), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27764), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27766), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27760), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                }
+                break;
+        }
+    }
+    else
+    {
+        switch (trackSequence)
+        {
+            case 0:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -17223,25 +13644,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn325DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27761), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27763), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27765), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27759), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -17274,31 +13677,31 @@ static void FlyingRCTrackRightBankedQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 18014, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18016, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 18018, { 0, 6, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 18020, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27751, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27753, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27755, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27757, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27752, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27754, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27756, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27758, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18014), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18016), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18018), { 0, 6, height },
-                            { { 0, 27, height }, { 32, 1, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(18020), { 0, 6, height }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -17376,25 +13779,7 @@ static void FlyingRCTrackRightBankedQuarterTurn325DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27751), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27753), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27755), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27757), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -17420,25 +13805,7 @@ static void FlyingRCTrackRightBankedQuarterTurn325DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27752), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27754), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27756), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27758), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -17489,34 +13856,73 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17978, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17983, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17988, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17993, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17979, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 17984, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17989, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17994, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17980, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 17985, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17990, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17995, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17981, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17986, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17991, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17996, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17982, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17987, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17992, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17997, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27787, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27792, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27797, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27802, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27788, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 27793, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 27798, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 27803, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27789, { 0, 16, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+        { { 27794, { 16, 16, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 27799, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 27804, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5InvertedSprites = {
+        { { 27790, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27795, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27800, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27805, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6InvertedSprites = {
+        { { 27791, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27796, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27801, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27806, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17978), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17983), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17988), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17993), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -17536,28 +13942,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17979), { 0, 0, height }, { 32, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17984), { 0, 0, height },
-                            { { 30, 30, height }, { 1, 1, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17989), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17994), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -17569,28 +13954,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17980), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17985), { 0, 0, height },
-                            { { 30, 30, height }, { 1, 1, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17990), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17995), { 0, 0, height }, { 16, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -17605,29 +13969,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17981), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17986), { 0, 0, height },
-                            { { 30, 30, height }, { 1, 1, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17991), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17996), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -17639,29 +13981,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17982), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17987), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17992), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17997), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 switch (direction)
                 {
@@ -17689,25 +14009,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27787), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27792), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27797), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27802), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -17730,25 +14032,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27788), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27793), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27798), { 0, 16, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27803), { 0, 16, height + 24 }, { 32, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -17760,25 +14044,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27789), { 0, 16, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27794), { 16, 16, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27799), { 16, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27804), { 0, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -17793,25 +14059,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27790), { 16, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27795), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27800), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27805), { 16, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -17823,25 +14071,7 @@ static void FlyingRCTrackLeftBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27791), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27796), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27801), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27806), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -17874,34 +14104,73 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17958, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17963, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17968, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17973, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17959, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17964, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 17969, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17974, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17960, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17965, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 17970, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17975, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 17961, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 17966, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17971, { 0, 0, 0 }, { { 30, 30, 0 }, { 1, 1, 34 } } } },
+        { { 17976, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 17962, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 17967, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17972, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 34 } } } },
+        { { 17977, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 27767, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27772, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27777, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 27782, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 27768, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 27773, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 27778, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 27783, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 27769, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+        { { 27774, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 27779, { 16, 16, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 27784, { 0, 16, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5InvertedSprites = {
+        { { 27770, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27775, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27780, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 27785, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6InvertedSprites = {
+        { { 27771, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27776, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27781, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 27786, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17958), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17963), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17968), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17973), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -17920,29 +14189,8 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
             case 1:
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
-            case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17959), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17964), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17969), { 0, 0, height },
-                            { { 30, 30, height }, { 1, 1, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17974), { 0, 0, height }, { 32, 16, 3 });
-                        break;
-                }
+            case 2:
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -17954,28 +14202,7 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17960), { 0, 0, height }, { 16, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17965), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17970), { 0, 0, height },
-                            { { 30, 30, height }, { 1, 1, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17975), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -17990,29 +14217,7 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17961), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17966), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17971), { 0, 0, height },
-                            { { 30, 30, height }, { 1, 1, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17976), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -18024,29 +14229,7 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17962), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17967), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 34 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17972), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 34 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(17977), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
                 switch (direction)
                 {
@@ -18074,25 +14257,7 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27767), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27772), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27777), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27782), { 0, 6, height + 24 }, { 32, 20, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -18115,25 +14280,7 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27768), { 0, 16, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27773), { 0, 16, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27778), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27783), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -18145,25 +14292,7 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27769), { 0, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27774), { 16, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27779), { 16, 16, height + 24 }, { 16, 16, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27784), { 0, 16, height + 24 }, { 16, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -18178,25 +14307,7 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27770), { 16, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27775), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27780), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27785), { 16, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -18208,25 +14319,7 @@ static void FlyingRCTrackRightBankedQuarterTurn525DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27771), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27776), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27781), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27786), { 6, 0, height + 24 }, { 20, 32, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -18277,34 +14370,25 @@ static void FlyingRCTrack25DegUpToLeftBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17922, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17923, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17930, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17924, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17925, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27719, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27720, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27721, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27722, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17922), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17923), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17930), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17924), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17925), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -18323,29 +14407,7 @@ static void FlyingRCTrack25DegUpToLeftBanked25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27719), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27720), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27721), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27722), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -18389,34 +14451,25 @@ static void FlyingRCTrack25DegUpToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17926, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17927, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17928, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17931, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17929, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27723, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27724, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27725, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27726, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17926), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17927), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17928), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17931), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17929), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -18435,29 +14488,7 @@ static void FlyingRCTrack25DegUpToRightBanked25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27723), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27724), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27725), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27726), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -18501,34 +14532,25 @@ static void FlyingRCTrackLeftBanked25DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17932, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17933, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17940, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17934, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17935, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27727, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27728, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27729, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27730, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17932), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17933), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17940), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17934), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17935), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -18547,29 +14569,7 @@ static void FlyingRCTrackLeftBanked25DegUpTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27727), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27728), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27729), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27730), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -18613,34 +14613,25 @@ static void FlyingRCTrackRightBanked25DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17936, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17937, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17938, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17941, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17939, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27731, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27732, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27733, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 27734, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17936), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17937), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17938), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17941), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17939), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -18659,29 +14650,7 @@ static void FlyingRCTrackRightBanked25DegUpTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27731), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27732), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27733), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27734), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -18757,31 +14726,22 @@ static void FlyingRCTrackLeftBankedFlatToLeftBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17942, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17943, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17944, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17945, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27735, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27736, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27737, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27738, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17942), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17943), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17944), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17945), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -18800,29 +14760,7 @@ static void FlyingRCTrackLeftBankedFlatToLeftBanked25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27735), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27736), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27737), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27738), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -18866,31 +14804,22 @@ static void FlyingRCTrackRightBankedFlatToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17946, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17947, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17948, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17949, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27739, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27740, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27741, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27742, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17946), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17947), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17948), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17949), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -18904,34 +14833,12 @@ static void FlyingRCTrackRightBankedFlatToRightBanked25DegUp(
             PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareSlopeEnd);
         }
         PaintUtilSetSegmentSupportHeight(
-            session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
-        PaintUtilSetGeneralSupportHeight(session, height + 48);
-    }
-    else
-    {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27739), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27740), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27741), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27742), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+            session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
+        PaintUtilSetGeneralSupportHeight(session, height + 48);
+    }
+    else
+    {
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -18975,31 +14882,22 @@ static void FlyingRCTrackLeftBanked25DegUpToLeftBankedFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17950, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17951, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17952, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17953, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27743, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27744, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27745, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27746, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17950), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17951), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17952), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17953), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -19018,29 +14916,7 @@ static void FlyingRCTrackLeftBanked25DegUpToLeftBankedFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27743), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27744), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27745), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27746), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -19084,31 +14960,22 @@ static void FlyingRCTrackRightBanked25DegUpToRightBankedFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17954, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17955, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17956, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } } },
+        { { 17957, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27747, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27748, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27749, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27750, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17954), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17955), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17956), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17957), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -19127,29 +14994,7 @@ static void FlyingRCTrackRightBanked25DegUpToRightBankedFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27747), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27748), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27749), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27750), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -19225,34 +15070,25 @@ static void FlyingRCTrackFlatToLeftBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17894, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17895, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17902, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17896, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17897, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27695, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27696, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27697, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27698, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17894), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17895), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17902), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17896), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17897), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -19271,29 +15107,7 @@ static void FlyingRCTrackFlatToLeftBanked25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27695), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27696), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27697), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27698), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -19337,34 +15151,25 @@ static void FlyingRCTrackFlatToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17898, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17899, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17900, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17903, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17901, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27699, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27700, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27701, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27702, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17898), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17899), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17900), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17903), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17901), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -19383,29 +15188,7 @@ static void FlyingRCTrackFlatToRightBanked25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27699), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27700), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27701), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27702), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -19449,34 +15232,25 @@ static void FlyingRCTrackLeftBanked25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17904, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17905, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17912, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17906, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17907, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27703, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27704, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27705, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27706, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17904), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17905), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17912), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17906), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17907), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -19495,29 +15269,7 @@ static void FlyingRCTrackLeftBanked25DegUpToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27703), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27704), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27705), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27706), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -19561,34 +15313,25 @@ static void FlyingRCTrackRightBanked25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17908, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17909, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 17910, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 17913, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 17911, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 27707, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27708, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27709, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 27710, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17908), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17909), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17910), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17913), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17911), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -19607,29 +15350,7 @@ static void FlyingRCTrackRightBanked25DegUpToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27707), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27708), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27709), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27710), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -19704,6 +15425,13 @@ static void FlyingRCTrack90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17526, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17527, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17528, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17529, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+
     if (trackElement.IsInverted())
     {
         direction = (direction + 2) & 3;
@@ -19711,29 +15439,7 @@ static void FlyingRCTrack90DegUp(
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17526), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17527), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17528), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17529), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 32);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -19755,34 +15461,19 @@ static void FlyingRCTrack60DegUpTo90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17518, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 17519, { 0, 0, 0 }, { { 24, 6, 0 }, { 2, 20, 55 } } } },
+        { { 17520, { 0, 0, 0 }, { { 24, 6, 0 }, { 2, 20, 55 } } } },
+        { { 17521, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.IsInverted())
         return;
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17518), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17519), { 0, 0, height },
-                        { { 24, 6, height }, { 2, 20, 55 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17520), { 0, 0, height },
-                        { { 24, 6, height }, { 2, 20, 55 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17521), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -19808,31 +15499,16 @@ static void FlyingRCTrack90DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17522, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17523, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17524, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17525, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.IsInverted())
         return;
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17522), { 0, 0, height },
-                { { 0, 6, height + 8 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17523), { 0, 0, height },
-                { { 24, 6, height + 8 }, { 2, 20, 31 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17524), { 0, 0, height },
-                { { 24, 6, height + 8 }, { 2, 20, 31 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17525), { 0, 0, height },
-                { { 0, 6, height + 8 }, { 32, 20, 3 } });
-            break;
-    }
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     switch (direction)
     {
         case 1:
@@ -19850,34 +15526,19 @@ static void FlyingRCTrack60DegDownTo90DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17524, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 17525, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17522, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 17523, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+    };
+
     if (trackElement.IsInverted())
         return;
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17524), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17525), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17522), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17523), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 48, TunnelType::SquareSlopeEnd);
@@ -19895,94 +15556,47 @@ static void FlyingRCTrack90DegToInvertedFlatQuarterLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 18062, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18065, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18068, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18071, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 18063, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+        { { 18066, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 18069, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 18072, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 18064, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 18067, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18070, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 18073, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18062), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18065), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18068), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18071), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
-            PaintUtilSetSegmentSupportHeight(
-                session,
-                PaintUtilRotateSegments(
-                    EnumsToFlags(PaintSegment::centre, PaintSegment::topLeftSide, PaintSegment::bottomRightSide), direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 88);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18063), { 0, 0, height },
-                        { { -8, 6, height }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18066), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18069), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18072), { 0, 0, height },
-                        { { -8, 6, height }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
-                    EnumsToFlags(PaintSegment::centre, PaintSegment::topLeftSide, PaintSegment::bottomRightSide), direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 64);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18064), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18067), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18070), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(18073), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-            }
+                    EnumsToFlags(PaintSegment::centre, PaintSegment::topLeftSide, PaintSegment::bottomRightSide), direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 88);
+            break;
+        case 1:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
+            PaintUtilSetSegmentSupportHeight(
+                session,
+                PaintUtilRotateSegments(
+                    EnumsToFlags(PaintSegment::centre, PaintSegment::topLeftSide, PaintSegment::bottomRightSide), direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 64);
+            break;
+        case 2:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 16, TunnelType::SquareFlat);
@@ -20045,32 +15659,35 @@ static void FlyingRCTrackHalfLoopInvertedUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27451, { 0, 6, 24 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27459, { 0, 6, 24 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27458, { 0, 6, 24 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27466, { 0, 6, 24 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27452, { 0, 0, 24 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27460, { 0, 14, 24 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27457, { 0, 6, 24 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27465, { 0, 6, 24 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27453, { 16, 0, -3 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27461, { 12, 0, -3 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27456, { 10, 16, -3 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27464, { 16, 16, -3 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27454, { 0, 0, 29 }, { { 0, 6, 34 }, { 32, 20, 3 } } } },
+        { { 27462, { 0, 0, 29 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27455, { 0, 16, 29 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27463, { 0, 16, 29 }, { { 0, 6, 34 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27451), { 0, 6, height + 24 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27459), { 0, 6, height + 24 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27458), { 0, 6, height + 24 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27466), { 0, 6, height + 24 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -20101,56 +15718,12 @@ static void FlyingRCTrackHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27452), { 0, 0, height + 24 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27460), { 0, 14, height + 24 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27457), { 0, 6, height + 24 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27465), { 0, 6, height + 24 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27453), { 16, 0, height - 3 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27461), { 12, 0, height - 3 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27456), { 10, 16, height - 3 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27464), { 16, 16, height - 3 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -20162,29 +15735,7 @@ static void FlyingRCTrackHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27454), { 0, 0, height + 29 },
-                        { { 0, 6, height + 34 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27462), { 0, 0, height + 29 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27455), { 0, 16, height + 29 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27463), { 0, 16, height + 29 },
-                        { { 0, 6, height + 34 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 32, TunnelType::SquareFlat);
@@ -20207,32 +15758,47 @@ static void FlyingRCTrackLeftFlyingLargeHalfLoopInvertedUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27639, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27646, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27653, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27660, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27640, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27647, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 9 } } } },
+        { { 27654, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27661, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27641, { 0, 0, -4 }, { { 8, 0, 40 }, { 24, 16, 3 } } } },
+        { { 27648, { 0, 0, -4 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27655, { 0, 0, -4 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27662, { 0, 0, -4 }, { { 30, 16, 70 }, { 2, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27642, { 0, 0, -4 }, { { 24, 0, 29 }, { 8, 16, 3 } } } },
+        { { 27649, { 0, 0, -4 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27656, { 0, 0, -4 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27663, { 0, 0, -4 }, { { 30, 16, 100 }, { 2, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 27643, { 0, 0, -4 }, { { 30, 30, 80 }, { 2, 2, 3 } } } },
+        { { 27650, { 0, 0, -4 }, { { 0, 16, 0 }, { 16, 16, 0 } } } },
+        { { 27657, { 0, 0, -4 }, { { 0, 0, 0 }, { 16, 16, 0 } } } },
+        { { 27664, { 0, 0, -4 }, { { 30, 0, 90 }, { 2, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27644, { 0, 0, -4 }, { { 30, 16, 0 }, { 2, 16, 3 } } } },
+        { { 27651, { 0, 0, -4 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27658, { 0, 0, -4 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27665, { 0, 0, -4 }, { { 30, 0, 140 }, { 2, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27639), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27646), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27653), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27660), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -20242,57 +15808,13 @@ static void FlyingRCTrackLeftFlyingLargeHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27640), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27647), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 9 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27654), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27661), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27641), { 0, 0, height - 4 },
-                        { { 8, 0, height + 40 }, { 24, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27648), { 0, 0, height - 4 },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27655), { 0, 0, height - 4 },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27662), { 0, 0, height - 4 },
-                        { { 30, 16, height + 70 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -20304,29 +15826,7 @@ static void FlyingRCTrackLeftFlyingLargeHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27642), { 0, 0, height - 4 },
-                        { { 24, 0, height + 29 }, { 8, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27649), { 0, 0, height - 4 },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27656), { 0, 0, height - 4 },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27663), { 0, 0, height - 4 },
-                        { { 30, 16, height + 100 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -20338,29 +15838,7 @@ static void FlyingRCTrackLeftFlyingLargeHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27643), { 0, 0, height - 4 },
-                        { { 30, 30, height + 80 }, { 2, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27650), { 0, 0, height - 4 },
-                        { { 0, 16, height }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27657), { 0, 0, height - 4 },
-                        { { 0, 0, height }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27664), { 0, 0, height - 4 },
-                        { { 30, 0, height + 90 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -20372,29 +15850,7 @@ static void FlyingRCTrackLeftFlyingLargeHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 128);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27644), { 0, 0, height - 4 },
-                        { { 30, 16, height }, { 2, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27651), { 0, 0, height - 4 },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27658), { 0, 0, height - 4 },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27665), { 0, 0, height - 4 },
-                        { { 30, 0, height + 140 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -20458,32 +15914,47 @@ static void FlyingRCTrackRightFlyingLargeHalfLoopInvertedUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27688, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27681, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27674, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27667, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27689, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27682, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27675, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 19 } } } },
+        { { 27668, { 0, 0, -4 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27690, { 0, 0, -4 }, { { 0, 16, 70 }, { 32, 16, 3 } } } },
+        { { 27683, { 0, 0, -4 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27676, { 0, 0, -4 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27669, { 0, 0, -4 }, { { 0, 0, 70 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27691, { 0, 0, -4 }, { { 0, 16, 100 }, { 32, 16, 3 } } } },
+        { { 27684, { 0, 0, -4 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27677, { 0, 0, -4 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27670, { 0, 0, -4 }, { { 0, 0, 100 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 27692, { 0, 0, -4 }, { { 16, 7, 90 }, { 16, 16, 3 } } } },
+        { { 27685, { 0, 0, -4 }, { { 0, -7, 0 }, { 16, 16, 0 } } } },
+        { { 27678, { 0, 0, -4 }, { { -7, 16, 0 }, { 16, 16, 0 } } } },
+        { { 27671, { 0, 0, -4 }, { { 30, 23, 110 }, { 2, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27693, { 0, 0, -4 }, { { 30, 7, 140 }, { 2, 16, 3 } } } },
+        { { 27686, { 0, 0, -4 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27679, { 0, 0, -4 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27672, { 0, 0, -4 }, { { 30, 16, 140 }, { 2, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27688), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27681), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27674), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27667), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -20493,57 +15964,13 @@ static void FlyingRCTrackRightFlyingLargeHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27689), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27682), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27675), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 19 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27668), { 0, 0, height - 4 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27690), { 0, 0, height - 4 },
-                        { { 0, 16, height + 70 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27683), { 0, 0, height - 4 },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27676), { 0, 0, height - 4 },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27669), { 0, 0, height - 4 },
-                        { { 0, 0, height + 70 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -20555,29 +15982,7 @@ static void FlyingRCTrackRightFlyingLargeHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27691), { 0, 0, height - 4 },
-                        { { 0, 16, height + 100 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27684), { 0, 0, height - 4 },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27677), { 0, 0, height - 4 },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27670), { 0, 0, height - 4 },
-                        { { 0, 0, height + 100 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -20589,29 +15994,7 @@ static void FlyingRCTrackRightFlyingLargeHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27692), { 0, 0, height - 4 },
-                        { { 16, 7, height + 90 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27685), { 0, 0, height - 4 },
-                        { { 0, -7, height }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27678), { 0, 0, height - 4 },
-                        { { -7, 16, height }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27671), { 0, 0, height - 4 },
-                        { { 30, 23, height + 110 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -20623,29 +16006,7 @@ static void FlyingRCTrackRightFlyingLargeHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 128);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27693), { 0, 0, height - 4 },
-                        { { 30, 7, height + 140 }, { 2, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27686), { 0, 0, height - 4 },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27679), { 0, 0, height - 4 },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27672), { 0, 0, height - 4 },
-                        { { 30, 16, height + 140 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -31,67 +31,50 @@ static void HeartlineTwisterRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        {
+            { 21354, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21356, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21355, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21357, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21358, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21360, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21359, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21361, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 21294, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21296, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21295, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21297, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21294, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21296, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21295, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21297, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21354), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21356), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21355), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21357), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21358), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21360), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21359), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21361), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21294), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21296), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21295), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21297), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     DrawSupportForSequenceA<TrackElemType::Flat>(
@@ -131,81 +114,50 @@ static void HeartlineTwisterRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        {
+            { 21378, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21382, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 21379, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21383, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 21380, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21384, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 21381, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21385, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 21322, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21326, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 21323, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21327, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 21324, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21328, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+        {
+            { 21325, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21329, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 50 } } },
+        },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21378), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21382), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21379), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21383), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21380), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21384), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21381), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21385), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21322), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21326), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21323), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21327), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21324), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21328), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21325), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21329), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 50 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     DrawSupportForSequenceA<TrackElemType::Up25>(
@@ -325,81 +277,50 @@ static void HeartlineTwisterRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        {
+            { 21362, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21366, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 21363, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21367, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 21364, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21368, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 21365, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21369, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 21306, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21310, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 21307, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21311, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 21308, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21312, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+        {
+            { 21309, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21313, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 42 } } },
+        },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21362), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21366), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21363), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21367), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21364), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21368), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21365), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21369), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21306), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21310), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21307), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21311), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21308), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21312), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21309), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21313), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 42 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     DrawSupportForSequenceA<TrackElemType::FlatToUp25>(
@@ -616,81 +537,50 @@ static void HeartlineTwisterRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        {
+            { 21370, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21374, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21371, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21375, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21372, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21376, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21373, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21377, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 21314, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21318, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21315, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21319, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21316, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21320, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21317, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21321, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21370), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21374), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21371), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21375), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21372), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21376), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21373), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21377), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21314), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21318), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21315), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21319), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21316), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21320), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21317), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 2 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(21321), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     DrawSupportForSequenceA<TrackElemType::Up25ToFlat>(
@@ -761,44 +651,65 @@ static void HeartlineTwisterRCTrackHeartlineTransferUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 21306, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21310, { 0, 0, 0 }, { { 0, 6, 23 }, { 32, 20, 0 } } },
+        },
+        {
+            { 21307, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21311, { 0, 0, 0 }, { { 0, 6, 23 }, { 32, 20, 0 } } },
+        },
+        {
+            { 21308, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21312, { 0, 0, 0 }, { { 0, 6, 23 }, { 32, 20, 0 } } },
+        },
+        {
+            { 21309, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21313, { 0, 0, 0 }, { { 0, 6, 23 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 21298, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21302, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21299, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21303, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21300, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21304, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21301, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21305, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 21316, { 0, 0, -8 }, { { 0, 6, -7 }, { 32, 20, 2 } } },
+            { 21320, { 0, 0, -8 }, { { 0, 27, -8 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21317, { 0, 0, -8 }, { { 0, 6, -7 }, { 32, 20, 2 } } },
+            { 21321, { 0, 0, -8 }, { { 0, 27, -8 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21314, { 0, 0, -8 }, { { 0, 6, -7 }, { 32, 20, 2 } } },
+            { 21318, { 0, 0, -8 }, { { 0, 27, -8 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21315, { 0, 0, -8 }, { { 0, 6, -7 }, { 32, 20, 2 } } },
+            { 21319, { 0, 0, -8 }, { { 0, 27, -8 }, { 32, 1, 34 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21306), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21310), { 0, 0, height },
-                        { { 0, 6, height + 23 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21307), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21311), { 0, 0, height },
-                        { { 0, 6, height + 23 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21308), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21312), { 0, 0, height },
-                        { { 0, 6, height + 23 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21309), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21313), { 0, 0, height },
-                        { { 0, 6, height + 23 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             DrawSupportForSequenceA<TrackElemType::HeartLineTransferUp>(
                 session, kSupportType, trackSequence, direction, height, session.SupportColours);
@@ -882,41 +793,7 @@ static void HeartlineTwisterRCTrackHeartlineTransferUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21298), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21302), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21299), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21303), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21300), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21304), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21301), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21305), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             DrawSupportForSequenceA<TrackElemType::HeartLineTransferUp>(
                 session, kSupportType, trackSequence, direction, height, session.SupportColours);
@@ -925,41 +802,7 @@ static void HeartlineTwisterRCTrackHeartlineTransferUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21316), { 0, 0, height - 8 },
-                        { { 0, 6, height - 7 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21320), { 0, 0, height - 8 },
-                        { { 0, 27, height - 8 }, { 32, 1, 34 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21317), { 0, 0, height - 8 },
-                        { { 0, 6, height - 7 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21321), { 0, 0, height - 8 },
-                        { { 0, 27, height - 8 }, { 32, 1, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21314), { 0, 0, height - 8 },
-                        { { 0, 6, height - 7 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21318), { 0, 0, height - 8 },
-                        { { 0, 27, height - 8 }, { 32, 1, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21315), { 0, 0, height - 8 },
-                        { { 0, 6, height - 7 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21319), { 0, 0, height - 8 },
-                        { { 0, 27, height - 8 }, { 32, 1, 34 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
@@ -979,44 +822,65 @@ static void HeartlineTwisterRCTrackHeartlineTransferDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 21316, { 0, 0, -8 }, { { 0, 6, -7 }, { 32, 20, 2 } } },
+            { 21320, { 0, 0, -8 }, { { 0, 27, -8 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21317, { 0, 0, -8 }, { { 0, 6, -7 }, { 32, 20, 2 } } },
+            { 21321, { 0, 0, -8 }, { { 0, 27, -8 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21314, { 0, 0, -8 }, { { 0, 6, -7 }, { 32, 20, 2 } } },
+            { 21318, { 0, 0, -8 }, { { 0, 27, -8 }, { 32, 1, 34 } } },
+        },
+        {
+            { 21315, { 0, 0, -8 }, { { 0, 6, -7 }, { 32, 20, 2 } } },
+            { 21319, { 0, 0, -8 }, { { 0, 27, -8 }, { 32, 1, 34 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 21298, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21302, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21299, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21303, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21300, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21304, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21301, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21305, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 21306, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21310, { 0, 0, 0 }, { { 0, 6, 23 }, { 32, 20, 0 } } },
+        },
+        {
+            { 21307, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21311, { 0, 0, 0 }, { { 0, 6, 23 }, { 32, 20, 0 } } },
+        },
+        {
+            { 21308, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21312, { 0, 0, 0 }, { { 0, 6, 23 }, { 32, 20, 0 } } },
+        },
+        {
+            { 21309, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21313, { 0, 0, 0 }, { { 0, 6, 23 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21316), { 0, 0, height - 8 },
-                        { { 0, 6, height - 7 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21320), { 0, 0, height - 8 },
-                        { { 0, 27, height - 8 }, { 32, 1, 34 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21317), { 0, 0, height - 8 },
-                        { { 0, 6, height - 7 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21321), { 0, 0, height - 8 },
-                        { { 0, 27, height - 8 }, { 32, 1, 34 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21314), { 0, 0, height - 8 },
-                        { { 0, 6, height - 7 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21318), { 0, 0, height - 8 },
-                        { { 0, 27, height - 8 }, { 32, 1, 34 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21315), { 0, 0, height - 8 },
-                        { { 0, 6, height - 7 }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21319), { 0, 0, height - 8 },
-                        { { 0, 27, height - 8 }, { 32, 1, 34 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
@@ -1096,41 +960,7 @@ static void HeartlineTwisterRCTrackHeartlineTransferDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21298), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21302), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21299), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21303), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21300), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21304), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21301), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21305), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             DrawSupportForSequenceA<TrackElemType::HeartLineTransferDown>(
                 session, kSupportType, trackSequence, direction, height, session.SupportColours);
@@ -1139,41 +969,7 @@ static void HeartlineTwisterRCTrackHeartlineTransferDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21306), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21310), { 0, 0, height },
-                        { { 0, 6, height + 23 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21307), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21311), { 0, 0, height },
-                        { { 0, 6, height + 23 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21308), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21312), { 0, 0, height },
-                        { { 0, 6, height + 23 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21309), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21313), { 0, 0, height },
-                        { { 0, 6, height + 23 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             DrawSupportForSequenceA<TrackElemType::HeartLineTransferDown>(
                 session, kSupportType, trackSequence, direction, height, session.SupportColours);
@@ -1197,229 +993,134 @@ static void HeartlineTwisterRCTrackLeftHeartlineRoll(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 21410, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21422, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21413, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21425, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21416, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21428, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21419, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21431, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 21411, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21423, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21414, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21426, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21417, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21429, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21420, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21432, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 21412, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21424, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21415, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21427, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21418, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21430, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21421, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21433, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 21418, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21430, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21421, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21433, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21412, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21424, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21415, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21427, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        {
+            { 21417, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21429, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21420, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21432, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21411, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21423, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21414, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21426, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        {
+            { 21416, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21428, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21419, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21431, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21410, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21422, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21413, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21425, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21410), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21422), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21413), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21425), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21416), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21428), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21419), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21431), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21411), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21423), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21414), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21426), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21417), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21429), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21420), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21432), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21412), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21424), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21415), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21427), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21418), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21430), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21421), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21433), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21418), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21430), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21421), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21433), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21412), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21424), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21415), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21427), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21417), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21429), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21420), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21432), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21411), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21423), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21414), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21426), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21416), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21428), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21419), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21431), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21410), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21422), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21413), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21425), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             break;
     }
 
@@ -1436,229 +1137,134 @@ static void HeartlineTwisterRCTrackRightHeartlineRoll(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 21434, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21446, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21437, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21449, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21440, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21452, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21443, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21455, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 21435, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21447, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21438, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21450, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21441, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21453, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21444, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21456, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 21436, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21448, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21439, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21451, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21442, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21454, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21445, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21457, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {
+            { 21442, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21454, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21445, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21457, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21436, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21448, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21439, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21451, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        {
+            { 21441, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21453, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21444, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21456, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21435, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21447, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21438, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21450, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        {
+            { 21440, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21452, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21443, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21455, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21434, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21446, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 21437, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 2 } } },
+            { 21449, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21434), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21446), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21437), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21449), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21440), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21452), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21443), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21455), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21435), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21447), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21438), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21450), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21441), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21453), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21444), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21456), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21436), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21448), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21439), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21451), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21442), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21454), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21445), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21457), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21442), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21454), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21445), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21457), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21436), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21448), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21439), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21451), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21441), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21453), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21444), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21456), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21435), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21447), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21438), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21450), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21440), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21452), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21443), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21455), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21434), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21446), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21437), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21449), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             break;
     }
 
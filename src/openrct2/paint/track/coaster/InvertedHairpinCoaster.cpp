@@ -30,49 +30,26 @@ static void InvertedHairpinRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17030, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17031, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17032, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17033, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17026, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17027, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17026, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17027, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17030), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17031), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17032), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17033), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17026), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17027), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -118,57 +95,26 @@ static void InvertedHairpinRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17070, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 17071, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 17072, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 17073, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17042, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 17043, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 17044, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 17045, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17070), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17071), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17072), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17073), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17042), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17043), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17044), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17045), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -211,57 +157,26 @@ static void InvertedHairpinRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17086, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+        { { 17087, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 17088, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 17089, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17058, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+        { { 17059, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 17060, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 17061, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17086), { 0, 0, height + 24 },
-                    { { 0, 6, height + 88 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17087), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 81 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17088), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 81 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17089), { 0, 0, height + 24 },
-                    { { 0, 6, height + 88 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17058), { 0, 0, height + 24 },
-                    { { 0, 6, height + 88 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17059), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 81 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17060), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 81 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17061), { 0, 0, height + 24 },
-                    { { 0, 6, height + 88 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
     if (direction == 0 || direction == 3)
     {
@@ -280,57 +195,26 @@ static void InvertedHairpinRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17062, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17063, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17064, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17065, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17034, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17035, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17036, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17037, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17062), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17063), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17064), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17065), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17034), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17035), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17036), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17037), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -373,69 +257,38 @@ static void InvertedHairpinRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17074, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 17078, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17075, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 17079, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17076, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 17077, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17046, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 17050, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17047, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 17051, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17048, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 17049, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17074), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17078), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17075), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17079), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17076), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17077), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17046), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17050), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17047), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17051), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17048), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17049), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
     if (direction == 0 || direction == 3)
     {
@@ -454,69 +307,38 @@ static void InvertedHairpinRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17080, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 17084, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17081, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 17085, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17082, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 17083, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17052, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 17056, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17053, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 17057, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17054, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 17055, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17080), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17084), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17081), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17085), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17082), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17083), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17052), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17056), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17053), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17057), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17054), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17055), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -559,57 +381,26 @@ static void InvertedHairpinRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17066, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17067, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17068, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17069, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17038, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17039, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17040, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 17041, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17066), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17067), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17068), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17069), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17038), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17039), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17040), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17041), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -700,32 +491,29 @@ static void InvertedHairpinRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17123, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 17126, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 17129, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 17120, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 17122, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 17125, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 17128, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 17119, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17121, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 17124, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 17127, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 17118, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17123), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17126), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17129), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17120), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -747,29 +535,7 @@ static void InvertedHairpinRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17122), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17125), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17128), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17119), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -781,29 +547,7 @@ static void InvertedHairpinRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17121), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17124), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17127), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17118), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -843,28 +587,23 @@ static void InvertedHairpinRCTrackLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17141, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 17143, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 17145, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 17139, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17140, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17142, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17144, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17138, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17141), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17143), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17145), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17139), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -889,25 +628,7 @@ static void InvertedHairpinRCTrackLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17140), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17142), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17144), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17138), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -938,28 +659,23 @@ static void InvertedHairpinRCTrackRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 17130, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 17132, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 17134, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 17136, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 17131, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17133, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17135, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 17137, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17130), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17132), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17134), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17136), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -984,25 +700,7 @@ static void InvertedHairpinRCTrackRightQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17131), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17133), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17135), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(17137), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1051,29 +749,14 @@ static void InvertedHairpinRCTrackLeftQuarterTurn1(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17114), { 0, 0, height + 24 },
-                { { 6, 2, height + 24 }, { 26, 24, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17115), { 0, 0, height + 24 },
-                { { 0, 0, height + 24 }, { 26, 26, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17116), { 0, 0, height + 24 },
-                { { 2, 6, height + 24 }, { 24, 26, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17117), { 0, 0, height + 24 },
-                { { 6, 6, height + 24 }, { 24, 24, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17114, { 0, 0, 24 }, { { 6, 2, 24 }, { 26, 24, 3 } } } },
+        { { 17115, { 0, 0, 24 }, { { 0, 0, 24 }, { 26, 26, 3 } } } },
+        { { 17116, { 0, 0, 24 }, { { 2, 6, 24 }, { 24, 26, 3 } } } },
+        { { 17117, { 0, 0, 24 }, { { 6, 6, 24 }, { 24, 24, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1113,69 +796,38 @@ static void InvertedHairpinRCTrackFlatTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17102, { 0, 0, 24 }, { { 0, 6, 56 }, { 30, 20, 3 } } } },
+        {
+            { 17106, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17103, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 17107, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17104, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 17105, { 0, 0, 24 }, { { 0, 6, 56 }, { 30, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17090, { 0, 0, 24 }, { { 0, 6, 56 }, { 30, 20, 3 } } } },
+        {
+            { 17094, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17091, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 17095, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 17092, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 17093, { 0, 0, 24 }, { { 0, 6, 56 }, { 30, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17102), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 30, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17106), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17103), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17107), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17104), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17105), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 30, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17090), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 30, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17094), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17091), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17095), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17092), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17093), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 30, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
     if (direction == 0 || direction == 3)
     {
@@ -1194,69 +846,38 @@ static void InvertedHairpinRCTrack60DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 17108, { 0, 0, 24 }, { { 0, 6, 48 }, { 30, 20, 3 } } } },
+        {
+            { 17112, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 41 } } },
+            { 17109, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 41 } } },
+        },
+        {
+            { 17113, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 41 } } },
+            { 17110, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 41 } } },
+        },
+        { { 17111, { 0, 0, 24 }, { { 0, 6, 48 }, { 30, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17096, { 0, 0, 24 }, { { 0, 6, 48 }, { 30, 20, 3 } } } },
+        {
+            { 17100, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 41 } } },
+            { 17097, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 41 } } },
+        },
+        {
+            { 17101, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 41 } } },
+            { 17098, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 41 } } },
+        },
+        { { 17099, { 0, 0, 24 }, { { 0, 6, 48 }, { 30, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17108), { 0, 0, height + 24 },
-                    { { 0, 6, height + 48 }, { 30, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17112), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 41 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17109), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 41 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17113), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 41 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17110), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 41 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17111), { 0, 0, height + 24 },
-                    { { 0, 6, height + 48 }, { 30, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17096), { 0, 0, height + 24 },
-                    { { 0, 6, height + 48 }, { 30, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17100), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 41 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17097), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 41 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17101), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 41 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17098), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 41 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(17099), { 0, 0, height + 24 },
-                    { { 0, 6, height + 48 }, { 30, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -1312,21 +933,14 @@ static void InvertedHairpinRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17028), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 1 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17029), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17028, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17029, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17028, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17029, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -1343,21 +957,14 @@ static void InvertedHairpinRCTrackBlockBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17028), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 1 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(17029), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 17028, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17029, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17028, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 17029, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -30,21 +30,14 @@ static void InvertedImpulseRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19662), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19663), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 19662, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 19663, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 19662, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 19663, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -89,29 +82,14 @@ static void InvertedImpulseRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19672), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19673), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19674), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19675), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 19672, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 19673, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 19674, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 19675, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -153,29 +131,14 @@ static void InvertedImpulseRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19688), { 0, 0, height + 29 },
-                { { 0, 6, height + 93 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19689), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 81 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19690), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 81 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19691), { 0, 0, height + 29 },
-                { { 0, 6, height + 93 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 19688, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+        { { 19689, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 19690, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 19691, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -193,29 +156,14 @@ static void InvertedImpulseRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19664), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19665), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19666), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19667), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 19664, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 19665, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 19666, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 19667, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     switch (direction)
@@ -254,35 +202,20 @@ static void InvertedImpulseRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19676), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19680), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19677), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19681), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19678), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19679), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 19676, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 19680, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 19677, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 19681, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 19678, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 19679, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -300,35 +233,20 @@ static void InvertedImpulseRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19682), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19686), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19683), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19687), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19684), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19685), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 19682, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 19686, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 19683, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 19687, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 19684, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 19685, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -346,29 +264,14 @@ static void InvertedImpulseRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19668), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19669), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19670), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19671), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 19668, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 19669, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 19670, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 19671, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     switch (direction)
@@ -455,32 +358,17 @@ static void InvertedImpulseRCTrack90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 19700, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        { { 19701, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } },
+        { { 19702, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } } },
+        { { 19703, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19700), { 0, 0, height + 29 },
-                        { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19701), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19702), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19703), { 0, 0, height + 29 },
-                        { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 32);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -504,32 +392,17 @@ static void InvertedImpulseRCTrack60DegUpTo90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 19692, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 19693, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 19694, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 19695, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19692), { 0, 0, height + 29 },
-                        { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19693), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19694), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19695), { 0, 0, height + 29 },
-                        { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -557,29 +430,14 @@ static void InvertedImpulseRCTrack90DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19696), { 0, 0, height + 29 },
-                { { 0, 6, height + 85 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19697), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 55 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19698), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 55 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(19699), { 0, 0, height + 29 },
-                { { 0, 6, height + 85 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 19696, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 19697, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 19698, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 19699, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     switch (direction)
     {
         case 1:
@@ -598,32 +456,17 @@ static void InvertedImpulseRCTrack60DegDownTo90DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 19698, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+        { { 19699, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 19696, { 0, 0, 29 }, { { 0, 6, 85 }, { 32, 20, 3 } } } },
+        { { 19697, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 55 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19698), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19699), { 0, 0, height + 29 },
-                        { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19696), { 0, 0, height + 29 },
-                        { { 0, 6, height + 85 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19697), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 55 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 48, TunnelType::InvertedSlopeEnd);
@@ -642,41 +485,26 @@ static void InvertedImpulseRCTrackLeftQuarterTurn190DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 19708, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } } },
+        {
+            { 19709, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+            { 19717, { 0, 0, 29 }, { { 4, 0, 11 }, { 2, 32, 31 } } },
+        },
+        {
+            { 19710, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+            { 19718, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } },
+        },
+        {
+            { 19711, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+            { 19719, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19708), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19709), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19717), { 0, 0, height + 29 },
-                        { { 4, 0, height + 11 }, { 2, 32, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19710), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19718), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19711), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19719), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 96);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -692,41 +520,26 @@ static void InvertedImpulseRCTrackRightQuarterTurn190DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 19704, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+            { 19712, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } },
+        },
+        {
+            { 19705, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+            { 19713, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } },
+        },
+        {
+            { 19706, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } },
+            { 19714, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 31 } } },
+        },
+        { { 19707, { 0, 0, 29 }, { { 0, 6, 125 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19704), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19712), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19705), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19713), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19706), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19714), { 0, 0, height + 29 },
-                        { { 0, 4, height + 11 }, { 32, 2, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(19707), { 0, 0, height + 29 },
-                        { { 0, 6, height + 125 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 96);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -41,41 +41,26 @@ static void InvertedRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 27131, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27132, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27131, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27132, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27129, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27130, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27129, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27130, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27131), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27132), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27129), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27130), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -121,57 +106,26 @@ static void InvertedRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 27249, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27250, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27251, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27252, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27221, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27222, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27223, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27224, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27249), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27250), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27251), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27252), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27221), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27222), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27223), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27224), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -214,29 +168,14 @@ static void InvertedRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27237), { 0, 0, height + 29 },
-                { { 0, 6, height + 93 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27238), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 81 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27239), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 81 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27240), { 0, 0, height + 29 },
-                { { 0, 6, height + 93 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27237, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+        { { 27238, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 27239, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 27240, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -254,57 +193,26 @@ static void InvertedRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 27241, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27242, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27243, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27244, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27213, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27214, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27215, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27216, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27241), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27242), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27243), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27244), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27213), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27214), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27215), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27216), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -347,35 +255,20 @@ static void InvertedRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27225), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27229), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27226), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27230), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27227), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27228), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27225, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 27229, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 27226, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 27230, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 27227, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 27228, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -393,35 +286,20 @@ static void InvertedRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27231), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27235), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27232), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27236), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27233), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27234), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27231, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 27235, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 27232, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 27236, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 27233, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 27234, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -463,57 +341,26 @@ static void InvertedRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 27245, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27246, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27247, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27248, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27217, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27218, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27219, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27220, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27245), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27246), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27247), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27248), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27217), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27218), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27219), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(27220), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -604,32 +451,41 @@ static void InvertedRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27142, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27147, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27152, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27137, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27141, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27146, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27151, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27136, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27140, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27145, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27150, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27135, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27139, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27144, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27149, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27134, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27138, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27143, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27148, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27133, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27142), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27147), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27152), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27137), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -651,27 +507,7 @@ static void InvertedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27141), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27146), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27151), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27136), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -683,28 +519,7 @@ static void InvertedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27140), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27145), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27150), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27135), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -719,27 +534,7 @@ static void InvertedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27139), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27144), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27149), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27134), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -751,29 +546,7 @@ static void InvertedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27138), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27143), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27148), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27133), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -813,29 +586,14 @@ static void InvertedRCTrackFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27269), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27270), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27271), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27272), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27269, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27270, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27271, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27272, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -859,29 +617,14 @@ static void InvertedRCTrackFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27273), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27274), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27275), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27276), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27273, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27274, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27275, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27276, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -905,29 +648,14 @@ static void InvertedRCTrackLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27275), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27276), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27273), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27274), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27275, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27276, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27273, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27274, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -951,29 +679,14 @@ static void InvertedRCTrackRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27271), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27272), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27269), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27270), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27271, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27272, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27269, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27270, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -997,32 +710,41 @@ static void InvertedRCTrackBankedLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27162, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27167, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27172, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27157, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27161, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27166, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27171, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27156, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27160, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27165, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27170, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27155, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27159, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27164, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27169, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27154, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27158, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27163, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27168, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27153, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27162), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27167), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27172), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27157), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1044,27 +766,7 @@ static void InvertedRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27161), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27166), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27171), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27156), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1076,28 +778,7 @@ static void InvertedRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27160), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27165), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27170), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27155), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1112,27 +793,7 @@ static void InvertedRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27159), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27164), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27169), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27154), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1144,29 +805,7 @@ static void InvertedRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27158), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27163), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27168), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27153), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1206,29 +845,14 @@ static void InvertedRCTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27277), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27278), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27279), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27280), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27277, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27278, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27279, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27280, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1277,29 +901,14 @@ static void InvertedRCTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27281), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27282), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27283), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27284), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27281, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27282, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27283, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27284, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1348,29 +957,14 @@ static void InvertedRCTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27285), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27286), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27287), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27288), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27285, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27286, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27287, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27288, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1419,29 +1013,14 @@ static void InvertedRCTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27289), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27290), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27291), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27292), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27289, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27290, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27291, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27292, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1522,29 +1101,14 @@ static void InvertedRCTrackLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27293), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27294), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27295), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27296), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27293, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27294, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27295, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27296, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1576,28 +1140,41 @@ static void InvertedRCTrackLeftQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27317, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27322, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27327, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27332, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27318, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27323, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27328, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27333, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27319, { 0, 16, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27324, { 16, 16, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27329, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27334, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27320, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27325, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27330, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27335, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27321, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27326, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27331, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27336, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27317), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27322), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27327), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27332), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1619,25 +1196,7 @@ static void InvertedRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27318), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27323), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27328), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27333), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1649,25 +1208,7 @@ static void InvertedRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27319), { 0, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27324), { 16, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27329), { 16, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27334), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1682,25 +1223,7 @@ static void InvertedRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27320), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27325), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27330), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27335), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1712,25 +1235,7 @@ static void InvertedRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27321), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27326), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27331), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27336), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1761,28 +1266,41 @@ static void InvertedRCTrackRightQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27297, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27302, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27307, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27312, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27298, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27303, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27308, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27313, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27299, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27304, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27309, { 16, 16, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27314, { 0, 16, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27300, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27305, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27310, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27315, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27301, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27306, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27311, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27316, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27297), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27302), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27307), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27312), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1804,25 +1322,7 @@ static void InvertedRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27298), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27303), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27308), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27313), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1834,25 +1334,7 @@ static void InvertedRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27299), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27304), { 16, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27309), { 16, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27314), { 0, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1866,25 +1348,7 @@ static void InvertedRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27300), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27305), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27310), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27315), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1896,25 +1360,7 @@ static void InvertedRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27301), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27306), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27311), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27316), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1963,32 +1409,35 @@ static void InvertedRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27253, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27257, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27256, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27260, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27254, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 27258, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 27255, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 27259, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27255, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 27259, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 27254, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 27258, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27256, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27260, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27253, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27257, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27253), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27257), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27256), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27260), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2007,27 +1456,7 @@ static void InvertedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27254), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27258), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27255), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27259), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2052,27 +1481,7 @@ static void InvertedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27255), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27259), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27254), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27258), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2097,29 +1506,7 @@ static void InvertedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27256), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27260), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27253), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27257), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2150,32 +1537,35 @@ static void InvertedRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27261, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27265, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27264, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27268, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27262, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 27266, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 27263, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 27267, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27263, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 27267, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 27262, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 27266, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27264, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27268, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27261, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27265, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27261), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27265), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27264), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27268), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2194,27 +1584,7 @@ static void InvertedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27262), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27266), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27263), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27267), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2239,27 +1609,7 @@ static void InvertedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27263), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27267), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27262), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27266), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2284,29 +1634,7 @@ static void InvertedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27264), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27268), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27261), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27265), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2337,32 +1665,59 @@ static void InvertedRCTrackLeftVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27355, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27363, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27362, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27370, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 10, 7 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27356, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27364, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27361, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27369, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27357, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27365, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27360, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27368, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27358, { 0, 0, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27366, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27359, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27367, { 0, 16, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27359, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27367, { 0, 16, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27358, { 0, 0, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27366, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 27360, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27368, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+        { { 27357, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27365, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence8Sprites = {
+        { { 27361, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27369, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+        { { 27356, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27364, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 27362, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27370, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 10, 7 } } } },
+        { { 27355, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27363, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27355), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27363), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27362), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27370), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 10, 7 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2400,56 +1755,12 @@ static void InvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27356), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27364), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27361), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27369), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27357), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27365), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27360), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27368), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2461,29 +1772,7 @@ static void InvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27358), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27366), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27359), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27367), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2501,29 +1790,7 @@ static void InvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27359), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27367), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27358), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27366), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2535,29 +1802,7 @@ static void InvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27360), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27368), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27357), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27365), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2569,56 +1814,12 @@ static void InvertedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 8:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27361), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27369), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27356), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27364), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence8Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27362), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27370), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 10, 7 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27355), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27363), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2668,32 +1869,59 @@ static void InvertedRCTrackRightVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27386, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 10, 7 } } } },
+        { { 27378, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27379, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27371, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27385, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+        { { 27377, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27380, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27372, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27384, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+        { { 27376, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27381, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27373, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27383, { 0, 16, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27375, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27382, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27374, { 0, 0, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27382, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27374, { 0, 0, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27383, { 0, 16, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27375, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 27381, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27373, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27384, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+        { { 27376, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence8Sprites = {
+        { { 27380, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27372, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27385, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+        { { 27377, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 27379, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27371, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27386, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 10, 7 } } } },
+        { { 27378, { 0, 6, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27386), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 10, 7 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27378), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27379), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27371), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2731,56 +1959,12 @@ static void InvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27385), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27377), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27380), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27372), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27384), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27376), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27381), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27373), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2792,29 +1976,7 @@ static void InvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27383), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27375), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27382), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27374), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2832,29 +1994,7 @@ static void InvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27382), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27374), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27383), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27375), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2866,29 +2006,7 @@ static void InvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27381), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27373), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27384), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27376), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2899,56 +2017,12 @@ static void InvertedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 8:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27380), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27372), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27385), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27377), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence8Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27379), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27371), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27386), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 10, 7 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27378), { 0, 6, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2998,32 +2072,29 @@ static void InvertedRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27392, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27395, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27398, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27389, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27391, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27394, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27397, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27388, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27390, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27393, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27396, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27387, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27392), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27395), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27398), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27389), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3045,28 +2116,7 @@ static void InvertedRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27391), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27394), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27397), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27388), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3078,29 +2128,7 @@ static void InvertedRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27390), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27393), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27396), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27387), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3140,32 +2168,29 @@ static void InvertedRCTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27404, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27407, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27410, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27401, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27403, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27406, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27409, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27400, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27402, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27405, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27408, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27399, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27404), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27407), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27410), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27401), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3187,29 +2212,7 @@ static void InvertedRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27403), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27406), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27409), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27400), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3221,29 +2224,7 @@ static void InvertedRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27402), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27405), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27408), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27399), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3283,28 +2264,23 @@ static void InvertedRCTrackLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27422, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27424, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27426, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27420, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27421, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27423, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27425, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27419, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27422), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27424), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27426), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27420), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3329,25 +2305,7 @@ static void InvertedRCTrackLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27421), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27423), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27425), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27419), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3378,28 +2336,23 @@ static void InvertedRCTrackRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27411, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27413, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27415, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27417, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27412, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27414, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27416, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27418, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27411), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27413), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27415), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27417), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3424,25 +2377,7 @@ static void InvertedRCTrackRightQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27412), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27414), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27416), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27418), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3491,28 +2426,29 @@ static void InvertedRCTrackLeftTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27427, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27433, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27432, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27438, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27428, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27434, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27431, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27437, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27429, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27435, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27430, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27436, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27427), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27433), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27432), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27438), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3531,25 +2467,7 @@ static void InvertedRCTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27428), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27434), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27431), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27437), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3561,25 +2479,7 @@ static void InvertedRCTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27429), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27435), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27430), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27436), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -3608,28 +2508,29 @@ static void InvertedRCTrackRightTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27439, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27445, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27444, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27450, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27440, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27446, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27443, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27449, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27441, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27447, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27442, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27448, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27439), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27445), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27444), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27450), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3648,25 +2549,7 @@ static void InvertedRCTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27440), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27446), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27443), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27449), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3678,25 +2561,7 @@ static void InvertedRCTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27441), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27447), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27442), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27448), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -3725,28 +2590,29 @@ static void InvertedRCTrackLeftTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27430, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27436, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27429, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27435, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27431, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27437, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27428, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27434, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27432, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27438, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27427, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27433, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27430), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27436), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27429), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27435), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3763,25 +2629,7 @@ static void InvertedRCTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27431), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27437), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27428), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27434), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3793,25 +2641,7 @@ static void InvertedRCTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27432), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27438), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27427), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27433), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3842,30 +2672,31 @@ static void InvertedRCTrackRightTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27442, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27448, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27441, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 27447, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27443, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27449, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27440, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27446, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27444, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27450, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27439, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27445, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27442), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27448), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27441), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27447), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
-            if (direction == 0 || direction == 3)
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
+            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
+            if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::InvertedFlat);
             }
@@ -3880,25 +2711,7 @@ static void InvertedRCTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27443), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27449), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27440), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27446), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3910,25 +2723,7 @@ static void InvertedRCTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27444), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27450), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27439), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27445), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3959,32 +2754,35 @@ static void InvertedRCTrackHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27451, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27459, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27458, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27466, { 0, 6, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27452, { 0, 0, 29 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27460, { 0, 14, 29 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27457, { 0, 6, 29 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27465, { 0, 6, 29 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27453, { 16, 0, 2 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27461, { 12, 0, 2 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27456, { 10, 16, 2 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27464, { 16, 16, 2 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27454, { 0, 0, 34 }, { { 0, 6, 34 }, { 32, 20, 3 } } } },
+        { { 27462, { 0, 0, 34 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27455, { 0, 16, 34 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27463, { 0, 16, 34 }, { { 0, 6, 34 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27451), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27459), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27458), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27466), { 0, 6, height + 29 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -4015,56 +2813,12 @@ static void InvertedRCTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27452), { 0, 0, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27460), { 0, 14, height + 29 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27457), { 0, 6, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27465), { 0, 6, height + 29 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27453), { 16, 0, height + 2 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27461), { 12, 0, height + 2 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27456), { 10, 16, height + 2 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27464), { 16, 16, height + 2 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4076,29 +2830,7 @@ static void InvertedRCTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27454), { 0, 0, height + 34 },
-                        { { 0, 6, height + 34 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27462), { 0, 0, height + 34 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27455), { 0, 16, height + 34 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27463), { 0, 16, height + 34 },
-                        { { 0, 6, height + 34 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 32, TunnelType::InvertedFlat);
@@ -4123,32 +2855,29 @@ static void InvertedRCTrackLeftCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27467, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27470, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27473, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27476, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27468, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27471, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27474, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27477, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27469, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27472, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27475, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27478, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27467), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27470), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27473), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27476), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4167,56 +2896,12 @@ static void InvertedRCTrackLeftCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27468), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27471), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27474), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27477), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27469), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27472), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27475), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27478), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height + 28, session.SupportColours);
             switch (direction)
             {
@@ -4245,32 +2930,29 @@ static void InvertedRCTrackRightCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27479, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27482, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27485, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+        { { 27488, { 0, 0, 29 }, { { 0, 6, 33 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27480, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27483, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27486, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+        { { 27489, { 0, 0, 14 }, { { 6, 6, 24 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27481, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27484, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27487, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+        { { 27490, { 0, 0, 29 }, { { 6, 0, 39 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27479), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27482), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27485), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27488), { 0, 0, height + 29 },
-                        { { 0, 6, height + 33 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4289,56 +2971,12 @@ static void InvertedRCTrackRightCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27480), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27483), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27486), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27489), { 0, 0, height + 14 },
-                        { { 6, 6, height + 24 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27481), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27484), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27487), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27490), { 0, 0, height + 29 },
-                        { { 6, 0, height + 39 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height + 28, session.SupportColours);
             switch (direction)
             {
@@ -4383,41 +3021,26 @@ static void InvertedRCTrackLeftQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27352), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27348), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27353), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27349), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27354), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27350), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27351), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27347), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 27352, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 27348, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27353, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 27349, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27354, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 27350, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27351, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 27347, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilLeftQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::InvertedSlopeStart, +56, TunnelType::InvertedSlopeEnd);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -4429,41 +3052,26 @@ static void InvertedRCTrackRightQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27343), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27339), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27344), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27340), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27345), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27341), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27346), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27342), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 27343, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 27339, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27344, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 27340, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27345, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 27341, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 27346, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 27342, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilRightQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::InvertedSlopeStart, +56, TunnelType::InvertedSlopeEnd);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -4491,21 +3099,14 @@ static void InvertedRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27337), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27338), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27337, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27338, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27337, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27338, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -4522,32 +3123,41 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27202, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27207, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27212, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27197, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27201, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27206, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27211, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27196, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27200, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27205, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27210, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27195, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27199, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27204, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27209, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27194, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27198, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27203, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27208, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27193, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27202), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27207), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27212), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27197), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4569,29 +3179,7 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27201), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27206), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27211), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27196), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4603,29 +3191,7 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27200), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27205), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27210), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27195), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4640,29 +3206,7 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27199), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27204), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27209), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27194), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4674,29 +3218,7 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27198), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27203), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27208), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27193), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4727,32 +3249,41 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27173, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27178, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27183, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 27188, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27174, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27179, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27184, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27189, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27175, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27180, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27185, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27190, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27176, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27181, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27186, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27191, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27177, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27182, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27187, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 27192, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27173), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27178), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27183), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27188), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4774,29 +3305,7 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27174), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27179), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27184), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27189), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4808,29 +3317,7 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27175), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27180), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27185), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27190), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4844,29 +3331,7 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27176), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27181), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27186), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27191), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4878,29 +3343,7 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27177), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27182), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27187), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27192), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4931,32 +3374,41 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27182, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27187, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27192, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27177, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27181, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27186, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27191, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27176, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27180, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27185, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27190, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27175, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27179, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27184, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27189, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27174, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27178, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27183, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27188, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27173, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27182), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27187), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27192), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27177), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4978,29 +3430,7 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27181), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27186), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27191), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27176), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5012,29 +3442,7 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27180), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27185), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27190), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27175), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5049,29 +3457,7 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27179), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27184), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27189), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27174), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5083,29 +3469,7 @@ static void InvertedRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27178), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27183), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27188), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27173), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5136,32 +3500,41 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27193, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27198, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27203, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 27208, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27194, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27199, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 27204, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 27209, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27195, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27200, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 27205, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 27210, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27196, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27201, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27206, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 27211, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27197, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27202, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27207, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 27212, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27193), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27198), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27203), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27208), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5183,29 +3556,7 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27194), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27199), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27204), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27209), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5217,29 +3568,7 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27195), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27200), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27205), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27210), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5253,29 +3582,7 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27196), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27201), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27206), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27211), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5287,29 +3594,7 @@ static void InvertedRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27197), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27202), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27207), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27212), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5340,29 +3625,14 @@ static void InvertedRCTrack25DegUpLeftBanked(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27711), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27712), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27713), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27714), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27711, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27712, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27713, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27714, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -5404,29 +3674,14 @@ static void InvertedRCTrack25DegUpRightBanked(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27715), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27716), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27717), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27718), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27715, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27716, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27717, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27718, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -5468,31 +3723,16 @@ static void InvertedRCTrackOnRidePhoto(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27129, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27130, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27129, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27130, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, kSupportType);
 
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27129), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27130), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27129), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27130), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::InvertedFlat);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -5520,32 +3760,35 @@ static void InvertedRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27507, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27511, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27515, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27519, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27508, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27512, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 27516, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27520, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27509, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27513, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27517, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27521, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 27510, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27514, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 27518, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27522, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27507), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27511), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27515), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27519), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -5558,29 +3801,7 @@ static void InvertedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27508), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27512), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27516), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27520), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5592,29 +3813,7 @@ static void InvertedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27509), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27513), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27517), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27521), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5637,29 +3836,7 @@ static void InvertedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27510), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27514), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27518), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27522), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5699,32 +3876,35 @@ static void InvertedRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27491, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27495, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27499, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27503, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27492, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27496, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27500, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 27504, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27493, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27497, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27501, { 0, 0, 29 }, { { 4, 4, 29 }, { 28, 28, 3 } } } },
+        { { 27505, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 27494, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27498, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27502, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 27506, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27491), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27495), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27499), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27503), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -5737,29 +3917,7 @@ static void InvertedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27492), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27496), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27500), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27504), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5771,29 +3929,7 @@ static void InvertedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27493), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27497), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27501), { 0, 0, height + 29 },
-                        { { 4, 4, height + 29 }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27505), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5816,29 +3952,7 @@ static void InvertedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27494), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27498), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27502), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27506), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5896,32 +4010,35 @@ static void InvertedRCTrackLeftEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27539, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27543, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27547, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27551, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27540, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27544, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 27548, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27552, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27541, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27545, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27549, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27553, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 27542, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27546, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 27550, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27554, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27539), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27543), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27547), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27551), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5940,29 +4057,7 @@ static void InvertedRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27540), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27544), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27548), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27552), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5974,29 +4069,7 @@ static void InvertedRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27541), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27545), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27549), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27553), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6019,29 +4092,7 @@ static void InvertedRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27542), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27546), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27550), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27554), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6081,32 +4132,35 @@ static void InvertedRCTrackRightEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27523, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27527, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27531, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27535, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27524, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27528, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27532, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 27536, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27525, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27529, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27533, { 0, 0, 29 }, { { 4, 4, 29 }, { 28, 28, 3 } } } },
+        { { 27537, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 27526, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27530, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27534, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 27538, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27523), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27527), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27531), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27535), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6125,29 +4179,7 @@ static void InvertedRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27524), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27528), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27532), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27536), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6159,29 +4191,7 @@ static void InvertedRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27525), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27529), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27533), { 0, 0, height + 29 },
-                        { { 4, 4, height + 29 }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27537), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6204,29 +4214,7 @@ static void InvertedRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27526), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27530), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27534), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27538), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6317,30 +4305,65 @@ static void InvertedRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 27626, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27570, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 27623, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27567, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 27625, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27569, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 27624, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27568, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27626), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27570), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6355,25 +4378,11 @@ static void InvertedRCTrackDiag25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27623), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27567), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6387,25 +4396,11 @@ static void InvertedRCTrackDiag25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27625), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27569), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6420,25 +4415,11 @@ static void InvertedRCTrackDiag25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27624), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27568), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -6479,17 +4460,35 @@ static void InvertedRCTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27582, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27579, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27581, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27580, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27582), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6501,14 +4500,7 @@ static void InvertedRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27579), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6519,14 +4511,7 @@ static void InvertedRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27581), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6538,14 +4523,7 @@ static void InvertedRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27580), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6585,30 +4563,65 @@ static void InvertedRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 27618, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27562, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 27615, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27559, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 27617, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27561, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 27616, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27560, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27618), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27562), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6623,25 +4636,11 @@ static void InvertedRCTrackDiagFlatTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27615), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27559), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6655,25 +4654,11 @@ static void InvertedRCTrackDiagFlatTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27617), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27561), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6688,25 +4673,11 @@ static void InvertedRCTrackDiagFlatTo25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27616), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27560), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -6747,17 +4718,35 @@ static void InvertedRCTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27574, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27571, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27573, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27572, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27574), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6769,14 +4758,7 @@ static void InvertedRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27571), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6787,14 +4769,7 @@ static void InvertedRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27573), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6806,14 +4781,7 @@ static void InvertedRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27572), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6853,17 +4821,35 @@ static void InvertedRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27578, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27575, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27577, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27576, { -16, -16, 29 }, { { 0, 0, 61 }, { 16, 16, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27578), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6875,14 +4861,7 @@ static void InvertedRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27575), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6893,14 +4872,7 @@ static void InvertedRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27577), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6912,14 +4884,7 @@ static void InvertedRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27576), { -16, -16, height + 29 },
-                        { { 0, 0, height + 61 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6959,30 +4924,65 @@ static void InvertedRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 27622, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27566, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 27619, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27563, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 27621, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27565, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 27620, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27564, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27622), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27566), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6997,25 +4997,11 @@ static void InvertedRCTrackDiag25DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27619), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27563), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7029,25 +5015,11 @@ static void InvertedRCTrackDiag25DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27621), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27565), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7062,25 +5034,11 @@ static void InvertedRCTrackDiag25DegUpToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27620), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27564), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -7121,30 +5079,65 @@ static void InvertedRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 27624, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27568, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 27625, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27569, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 27623, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27567, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 27626, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27570, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27624), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27568), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7159,25 +5152,11 @@ static void InvertedRCTrackDiag25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27625), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27569), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7191,25 +5170,11 @@ static void InvertedRCTrackDiag25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27623), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27567), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7224,25 +5189,11 @@ static void InvertedRCTrackDiag25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27626), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27570), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -7283,17 +5234,35 @@ static void InvertedRCTrackDiag60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27580, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27581, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27579, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27582, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27580), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7305,14 +5274,7 @@ static void InvertedRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27581), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7323,14 +5285,7 @@ static void InvertedRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27579), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7342,14 +5297,7 @@ static void InvertedRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27582), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7389,30 +5337,65 @@ static void InvertedRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 27620, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27564, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 27621, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27565, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 27619, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27563, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 27622, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27566, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27620), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27564), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7426,25 +5409,11 @@ static void InvertedRCTrackDiagFlatTo25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27621), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27565), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7457,25 +5426,11 @@ static void InvertedRCTrackDiagFlatTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27619), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27563), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7489,25 +5444,11 @@ static void InvertedRCTrackDiagFlatTo25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27622), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27566), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -7548,17 +5489,35 @@ static void InvertedRCTrackDiag25DegDownTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27576, { -16, -16, 29 }, { { 0, 0, 61 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27577, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27575, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27578, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27576), { -16, -16, height + 29 },
-                        { { 0, 0, height + 61 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7570,14 +5529,7 @@ static void InvertedRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27577), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7588,14 +5540,7 @@ static void InvertedRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27575), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7607,14 +5552,7 @@ static void InvertedRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27578), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7654,17 +5592,35 @@ static void InvertedRCTrackDiag60DegDownTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27572, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27573, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27571, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27574, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27572), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7676,14 +5632,7 @@ static void InvertedRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27573), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7694,14 +5643,7 @@ static void InvertedRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27571), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7713,14 +5655,7 @@ static void InvertedRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27574), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7760,30 +5695,65 @@ static void InvertedRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 27616, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27560, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 27617, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27561, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 27615, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27559, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 27618, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27562, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27616), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27560), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7798,25 +5768,11 @@ static void InvertedRCTrackDiag25DegDownToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27617), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27561), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7830,25 +5786,11 @@ static void InvertedRCTrackDiag25DegDownToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27615), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27559), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7863,25 +5805,11 @@ static void InvertedRCTrackDiag25DegDownToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27618), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(27562), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -7922,17 +5850,35 @@ static void InvertedRCTrackDiagFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27590, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27587, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27589, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27588, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27590), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7944,14 +5890,7 @@ static void InvertedRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27587), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7962,14 +5901,7 @@ static void InvertedRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27589), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7981,14 +5913,7 @@ static void InvertedRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27588), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8028,17 +5953,35 @@ static void InvertedRCTrackDiagFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27594, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27591, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27593, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27592, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27594), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8050,14 +5993,7 @@ static void InvertedRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27591), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8068,14 +6004,7 @@ static void InvertedRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27593), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8087,14 +6016,7 @@ static void InvertedRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27592), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8134,17 +6056,35 @@ static void InvertedRCTrackDiagLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27592, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27593, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27591, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27594, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27592), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8156,14 +6096,7 @@ static void InvertedRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27593), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8174,14 +6107,7 @@ static void InvertedRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27591), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8193,14 +6119,7 @@ static void InvertedRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27594), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8240,17 +6159,35 @@ static void InvertedRCTrackDiagRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27588, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27589, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27587, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27590, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27588), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8262,14 +6199,7 @@ static void InvertedRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27589), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8280,14 +6210,7 @@ static void InvertedRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27587), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8299,14 +6222,7 @@ static void InvertedRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27590), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8346,17 +6262,35 @@ static void InvertedRCTrackDiagLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27606, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27603, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27605, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27604, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27606), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8368,14 +6302,7 @@ static void InvertedRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27603), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8386,14 +6313,7 @@ static void InvertedRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27605), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8405,14 +6325,7 @@ static void InvertedRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27604), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8452,17 +6365,35 @@ static void InvertedRCTrackDiagRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27610, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27607, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27609, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27608, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27610), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8474,14 +6405,7 @@ static void InvertedRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27607), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8492,14 +6416,7 @@ static void InvertedRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27609), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8511,14 +6428,7 @@ static void InvertedRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27608), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8558,17 +6468,35 @@ static void InvertedRCTrackDiag25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27598, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27595, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27597, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27596, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27598), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8580,14 +6508,7 @@ static void InvertedRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27595), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8598,14 +6519,7 @@ static void InvertedRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27597), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8617,14 +6531,7 @@ static void InvertedRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27596), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8664,17 +6571,35 @@ static void InvertedRCTrackDiag25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27602, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27599, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27601, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27600, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27602), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8686,14 +6611,7 @@ static void InvertedRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27599), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8704,14 +6622,7 @@ static void InvertedRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27601), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8723,14 +6634,7 @@ static void InvertedRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27600), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8770,35 +6674,46 @@ static void InvertedRCTrackDiagLeftBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27600, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27601, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27599, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27602, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27600), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
                     EnumsToFlags(
                         PaintSegment::rightCorner, PaintSegment::centre, PaintSegment::topRightSide,
-                        PaintSegment::bottomRightSide),
-                    direction),
-                0xFFFF, 0);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27601), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+                        PaintSegment::bottomRightSide),
+                    direction),
+                0xFFFF, 0);
+            break;
+        case 1:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8808,14 +6723,7 @@ static void InvertedRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27599), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8826,14 +6734,7 @@ static void InvertedRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27602), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8873,17 +6774,35 @@ static void InvertedRCTrackDiagRightBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27596, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27597, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27595, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27598, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27596), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8894,14 +6813,7 @@ static void InvertedRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27597), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8911,14 +6823,7 @@ static void InvertedRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27595), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8929,14 +6834,7 @@ static void InvertedRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27598), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8976,17 +6874,35 @@ static void InvertedRCTrackDiag25DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27608, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27609, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27607, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27610, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27608), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8998,14 +6914,7 @@ static void InvertedRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27609), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9016,14 +6925,7 @@ static void InvertedRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27607), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9035,14 +6937,7 @@ static void InvertedRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27610), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9082,17 +6977,35 @@ static void InvertedRCTrackDiag25DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27604, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27605, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27603, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27606, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27604), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9104,14 +7017,7 @@ static void InvertedRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27605), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9122,14 +7028,7 @@ static void InvertedRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27603), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9141,14 +7040,7 @@ static void InvertedRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27606), { -16, -16, height + 29 },
-                        { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9188,17 +7080,35 @@ static void InvertedRCTrackDiagLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27586, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27583, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27585, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27584, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27586), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9210,14 +7120,7 @@ static void InvertedRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27583), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9228,14 +7131,7 @@ static void InvertedRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27585), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9247,14 +7143,7 @@ static void InvertedRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27584), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9294,17 +7183,35 @@ static void InvertedRCTrackDiagRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 27584, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27585, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 27583, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 27586, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27584), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9316,14 +7223,7 @@ static void InvertedRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27585), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9334,14 +7234,7 @@ static void InvertedRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27583), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9353,14 +7246,7 @@ static void InvertedRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27586), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9400,32 +7286,47 @@ static void InvertedRCTrackLeftLargeHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27639, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27646, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27653, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27660, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27640, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27647, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 9 } } } },
+        { { 27654, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27661, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27641, { 0, 0, 0 }, { { 8, 0, 40 }, { 24, 16, 3 } } } },
+        { { 27648, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27655, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27662, { 0, 0, 0 }, { { 30, 16, 70 }, { 2, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27642, { 0, 0, 0 }, { { 24, 0, 29 }, { 8, 16, 3 } } } },
+        { { 27649, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27656, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27663, { 0, 0, 0 }, { { 30, 16, 100 }, { 2, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 27643, { 0, 0, 0 }, { { 30, 30, 80 }, { 2, 2, 3 } } } },
+        { { 27650, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 0 } } } },
+        { { 27657, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 0 } } } },
+        { { 27664, { 0, 0, 0 }, { { 30, 0, 90 }, { 2, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27644, { 0, 0, 0 }, { { 30, 16, 0 }, { 2, 16, 3 } } } },
+        { { 27651, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27658, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27665, { 0, 0, 0 }, { { 30, 0, 140 }, { 2, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27639), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27646), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27653), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27660), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -9435,57 +7336,13 @@ static void InvertedRCTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27640), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27647), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 9 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27654), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27661), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27641), { 0, 0, height },
-                        { { 8, 0, height + 40 }, { 24, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27648), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27655), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27662), { 0, 0, height },
-                        { { 30, 16, height + 70 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9497,63 +7354,19 @@ static void InvertedRCTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27642), { 0, 0, height },
-                        { { 24, 0, height + 29 }, { 8, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27649), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27656), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27663), { 0, 0, height },
-                        { { 30, 16, height + 100 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
-                    EnumsToFlags(
-                        PaintSegment::topCorner, PaintSegment::leftCorner, PaintSegment::centre, PaintSegment::topLeftSide,
-                        PaintSegment::topRightSide, PaintSegment::bottomLeftSide),
-                    direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 224);
-            break;
-        case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27643), { 0, 0, height },
-                        { { 30, 30, height + 80 }, { 2, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27650), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27657), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27664), { 0, 0, height },
-                        { { 30, 0, height + 90 }, { 2, 16, 3 } });
-                    break;
-            }
+                    EnumsToFlags(
+                        PaintSegment::topCorner, PaintSegment::leftCorner, PaintSegment::centre, PaintSegment::topLeftSide,
+                        PaintSegment::topRightSide, PaintSegment::bottomLeftSide),
+                    direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 224);
+            break;
+        case 4:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9565,29 +7378,7 @@ static void InvertedRCTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 128);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27644), { 0, 0, height },
-                        { { 30, 16, height }, { 2, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27651), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27658), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27665), { 0, 0, height },
-                        { { 30, 0, height + 140 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9652,32 +7443,47 @@ static void InvertedRCTrackRightLargeHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27688, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27681, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27674, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27667, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27689, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27682, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27675, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 19 } } } },
+        { { 27668, { 0, 0, 0 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27690, { 0, 0, 0 }, { { 0, 16, 70 }, { 32, 16, 3 } } } },
+        { { 27683, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27676, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27669, { 0, 0, 0 }, { { 0, 0, 70 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27691, { 0, 0, 0 }, { { 0, 16, 100 }, { 32, 16, 3 } } } },
+        { { 27684, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27677, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27670, { 0, 0, 0 }, { { 0, 0, 100 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 27692, { 0, 0, 0 }, { { 16, 0, 90 }, { 16, 16, 3 } } } },
+        { { 27685, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 0 } } } },
+        { { 27678, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 0 } } } },
+        { { 27671, { 0, 0, 0 }, { { 30, 16, 110 }, { 2, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27693, { 0, 0, 0 }, { { 30, 0, 140 }, { 2, 16, 3 } } } },
+        { { 27686, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 0 } } } },
+        { { 27679, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 0 } } } },
+        { { 27672, { 0, 0, 0 }, { { 30, 16, 140 }, { 2, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27688), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27681), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27674), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27667), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -9687,57 +7493,13 @@ static void InvertedRCTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27689), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27682), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27675), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 19 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27668), { 0, 0, height },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27690), { 0, 0, height },
-                        { { 0, 16, height + 70 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27683), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27676), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27669), { 0, 0, height },
-                        { { 0, 0, height + 70 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9749,29 +7511,7 @@ static void InvertedRCTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27691), { 0, 0, height },
-                        { { 0, 16, height + 100 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27684), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27677), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27670), { 0, 0, height },
-                        { { 0, 0, height + 100 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9783,29 +7523,7 @@ static void InvertedRCTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27692), { 0, 0, height },
-                        { { 16, 0, height + 90 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27685), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27678), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27671), { 0, 0, height },
-                        { { 30, 16, height + 110 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9817,29 +7535,7 @@ static void InvertedRCTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 128);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27693), { 0, 0, height },
-                        { { 30, 0, height + 140 }, { 2, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27686), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27679), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27672), { 0, 0, height },
-                        { { 30, 16, height + 140 }, { 2, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -9920,21 +7616,14 @@ static void InvertedRCTrackBlockBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27337), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27338), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27337, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27338, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27337, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27338, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -9951,28 +7640,23 @@ static void InvertedRCTrackLeftBankedQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27762, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27764, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27766, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27760, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27761, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27763, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27765, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27759, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27762), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27764), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27766), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27760), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -9997,25 +7681,7 @@ static void InvertedRCTrackLeftBankedQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27761), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27763), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27765), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27759), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10046,28 +7712,23 @@ static void InvertedRCTrackRightBankedQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27751, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27753, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27755, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27757, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27752, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27754, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27756, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27758, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27751), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27753), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27755), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27757), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10092,25 +7753,7 @@ static void InvertedRCTrackRightBankedQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27752), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27754), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27756), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27758), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10159,28 +7802,41 @@ static void InvertedRCTrackLeftBankedQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27787, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27792, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27797, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27802, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27788, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27793, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27798, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27803, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27789, { 0, 16, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27794, { 16, 16, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27799, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27804, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27790, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27795, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27800, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27805, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27791, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27796, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27801, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27806, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27787), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27792), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27797), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27802), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10202,25 +7858,7 @@ static void InvertedRCTrackLeftBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27788), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27793), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27798), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27803), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10231,26 +7869,8 @@ static void InvertedRCTrackLeftBankedQuarterTurn525DegUp(
                 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
-        case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27789), { 0, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27794), { 16, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27799), { 16, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27804), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+        case 3:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10265,25 +7885,7 @@ static void InvertedRCTrackLeftBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27790), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27795), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27800), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27805), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10295,25 +7897,7 @@ static void InvertedRCTrackLeftBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27791), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27796), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27801), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27806), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10344,28 +7928,41 @@ static void InvertedRCTrackRightBankedQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27767, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27772, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27777, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 27782, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27768, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27773, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 27778, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 27783, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27769, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27774, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 27779, { 16, 16, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 27784, { 0, 16, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27770, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27775, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27780, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 27785, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27771, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27776, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27781, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 27786, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27767), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27772), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27777), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27782), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10387,25 +7984,7 @@ static void InvertedRCTrackRightBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27768), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27773), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27778), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27783), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10417,25 +7996,7 @@ static void InvertedRCTrackRightBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27769), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27774), { 16, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27779), { 16, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27784), { 0, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10449,25 +8010,7 @@ static void InvertedRCTrackRightBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27770), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27775), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27780), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27785), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -10479,25 +8022,7 @@ static void InvertedRCTrackRightBankedQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27771), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27776), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27781), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27786), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -10546,29 +8071,14 @@ static void InvertedRCTrack25DegUpToLeftBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27719), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27720), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27721), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27722), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27719, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27720, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27721, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27722, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -10610,29 +8120,14 @@ static void InvertedRCTrack25DegUpToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27723), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27724), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27725), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27726), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27723, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27724, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27725, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27726, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -10674,29 +8169,14 @@ static void InvertedRCTrackLeftBanked25DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27727), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27728), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27729), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27730), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27727, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27728, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27729, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27730, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -10738,29 +8218,14 @@ static void InvertedRCTrackRightBanked25DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27731), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27732), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27733), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27734), { 0, 0, height + 29 },
-                { { 0, 6, height + 45 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27731, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27732, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27733, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27734, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -10834,29 +8299,14 @@ static void InvertedRCTrackLeftBankedFlatToLeftBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27735), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27736), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27737), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27738), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27735, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27736, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27737, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27738, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -10898,29 +8348,14 @@ static void InvertedRCTrackRightBankedFlatToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27739), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27740), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27741), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27742), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27739, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27740, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27741, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27742, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -10962,29 +8397,14 @@ static void InvertedRCTrackLeftBanked25DegUpToLeftBankedFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27743), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27744), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27745), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27746), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27743, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27744, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27745, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27746, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -11026,29 +8446,14 @@ static void InvertedRCTrackRightBanked25DegUpToRightBankedFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27747), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27748), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27749), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27750), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27747, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27748, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27749, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27750, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -11122,29 +8527,14 @@ static void InvertedRCTrackFlatToLeftBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27695), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27696), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27697), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27698), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27695, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27696, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27697, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27698, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -11186,29 +8576,14 @@ static void InvertedRCTrackFlatToRightBanked25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27699), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27700), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27701), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27702), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27699, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27700, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27701, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27702, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -11250,29 +8625,14 @@ static void InvertedRCTrackLeftBanked25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27703), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27704), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27705), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27706), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27703, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27704, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27705, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27706, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -11314,29 +8674,14 @@ static void InvertedRCTrackRightBanked25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27707), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27708), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27709), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(27710), { 0, 0, height + 29 },
-                { { 0, 6, height + 37 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 27707, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27708, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27709, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 27710, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
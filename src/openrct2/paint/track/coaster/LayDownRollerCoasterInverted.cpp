@@ -58,41 +58,26 @@ static void LayDownRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26557, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26558, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26557, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26558, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26555, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26556, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26555, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26556, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26557), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26558), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26555), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26556), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -138,57 +123,26 @@ static void LayDownRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26621, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26622, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26623, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26624, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26569, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26570, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26571, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26572, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26621), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26622), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26623), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26624), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26569), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26570), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26571), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26572), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -231,29 +185,14 @@ static void LayDownRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26585), { 0, 0, height + 24 },
-                { { 0, 6, height + 88 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26586), { 0, 0, height + 24 },
-                { { 0, 4, height + 6 }, { 32, 2, 81 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26587), { 0, 0, height + 24 },
-                { { 0, 4, height + 6 }, { 32, 2, 81 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26588), { 0, 0, height + 24 },
-                { { 0, 6, height + 88 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26585, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+        { { 26586, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 26587, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 26588, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::StandardSlopeStart);
@@ -271,57 +210,26 @@ static void LayDownRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26613, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26614, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26615, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26616, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26561, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26562, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26563, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26564, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26613), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26614), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26615), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26616), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26561), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26562), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26563), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26564), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -364,35 +272,20 @@ static void LayDownRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26573), { 0, 0, height + 24 },
-                { { 0, 6, height + 56 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26577), { 0, 0, height + 24 },
-                { { 0, 10, height + 6 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26574), { 0, 0, height + 24 },
-                { { 0, 4, height + 6 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26578), { 0, 0, height + 24 },
-                { { 0, 10, height + 6 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26575), { 0, 0, height + 24 },
-                { { 0, 4, height + 6 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26576), { 0, 0, height + 24 },
-                { { 0, 6, height + 56 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26573, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 26577, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 26574, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 26578, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 26575, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 26576, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::StandardSlopeStart);
@@ -410,35 +303,20 @@ static void LayDownRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26579), { 0, 0, height + 24 },
-                { { 0, 6, height + 56 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26583), { 0, 0, height + 24 },
-                { { 0, 10, height + 6 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26580), { 0, 0, height + 24 },
-                { { 0, 4, height + 6 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26584), { 0, 0, height + 24 },
-                { { 0, 10, height + 6 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26581), { 0, 0, height + 24 },
-                { { 0, 4, height + 6 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26582), { 0, 0, height + 24 },
-                { { 0, 6, height + 56 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26579, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 26583, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 26580, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 26584, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 26581, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 26582, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -480,57 +358,26 @@ static void LayDownRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26617, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26618, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26619, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26620, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26565, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26566, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26567, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26568, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26617), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26618), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26619), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26620), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26565), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26566), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26567), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26568), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -621,32 +468,41 @@ static void LayDownRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26694, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26699, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26704, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26689, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26693, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 26698, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 26703, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26688, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26692, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26697, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26702, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26687, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26691, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 32, 3 } } } },
+        { { 26696, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 32, 3 } } } },
+        { { 26701, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 32, 3 } } } },
+        { { 26686, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26690, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26695, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26700, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26685, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26694), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26699), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26704), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26689), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -668,29 +524,7 @@ static void LayDownRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26693), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26698), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26703), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26688), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -702,29 +536,7 @@ static void LayDownRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26692), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26697), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26702), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26687), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -739,29 +551,7 @@ static void LayDownRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26691), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26696), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26701), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26686), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -773,29 +563,7 @@ static void LayDownRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26690), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26695), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26700), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26685), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -835,29 +603,14 @@ static void LayDownRCTrackFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26657), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26658), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26659), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26660), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26657, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26658, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26659, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26660, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -881,29 +634,14 @@ static void LayDownRCTrackFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26661), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26662), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26663), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26664), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26661, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26662, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26663, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26664, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -927,29 +665,14 @@ static void LayDownRCTrackLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26663), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26664), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26661), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26662), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26663, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26664, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26661, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26662, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -973,29 +696,14 @@ static void LayDownRCTrackRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26659), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26660), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26657), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26658), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26659, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26660, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26657, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26658, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1019,32 +727,41 @@ static void LayDownRCTrackBankedLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26738, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26743, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26748, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26733, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26737, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 26742, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 26747, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 26732, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26736, { 0, 0, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+        { { 26741, { 0, 0, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 26746, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 26731, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26735, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26740, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26745, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26730, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26734, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26739, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26744, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26729, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26738), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26743), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26748), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26733), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1066,27 +783,7 @@ static void LayDownRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26737), { 0, 0, height + 24 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26742), { 0, 0, height + 24 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26747), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26732), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1098,28 +795,7 @@ static void LayDownRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26736), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26741), { 0, 0, height + 24 },
-                        { { 16, 16, height + 24 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26746), { 0, 0, height + 24 },
-                        { { 16, 0, height + 24 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26731), { 0, 0, height + 24 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1134,27 +810,7 @@ static void LayDownRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26735), { 0, 0, height + 24 },
-                        { { 16, 0, height + 24 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26740), { 0, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26745), { 0, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26730), { 0, 0, height + 24 },
-                        { { 16, 0, height + 24 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1166,29 +822,7 @@ static void LayDownRCTrackBankedLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26734), { 0, 0, height + 24 },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26739), { 0, 0, height + 24 },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26744), { 0, 0, height + 24 },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26729), { 0, 0, height + 24 },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1228,29 +862,14 @@ static void LayDownRCTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26665), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26666), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26667), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26668), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26665, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26666, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26667, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26668, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1299,29 +918,14 @@ static void LayDownRCTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26669), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26670), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26671), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26672), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26669, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26670, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26671, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26672, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1370,29 +974,14 @@ static void LayDownRCTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26673), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26674), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26675), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26676), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26673, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26674, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26675, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26676, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1441,29 +1030,14 @@ static void LayDownRCTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26677), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26678), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26679), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26680), { 0, 0, height + 24 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26677, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26678, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26679, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26680, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1544,29 +1118,14 @@ static void LayDownRCTrackLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26681), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26682), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26683), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26684), { 0, 0, height + 24 },
-                { { 0, 6, height + 22 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26681, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26682, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26683, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26684, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(
         session,
@@ -1598,28 +1157,41 @@ static void LayDownRCTrackLeftQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26949, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26954, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26959, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26964, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26950, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 26955, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 26960, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 26965, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26951, { 0, 16, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+        { { 26956, { 16, 16, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 26961, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 26966, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26952, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26957, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26962, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26967, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26953, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26958, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26963, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26968, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26949), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26954), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26959), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26964), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1641,25 +1213,7 @@ static void LayDownRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26950), { 0, 0, height + 24 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26955), { 0, 0, height + 24 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26960), { 0, 16, height + 24 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26965), { 0, 16, height + 24 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1671,25 +1225,7 @@ static void LayDownRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26951), { 0, 16, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26956), { 16, 16, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26961), { 16, 0, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26966), { 0, 0, height + 24 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1704,25 +1240,7 @@ static void LayDownRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26952), { 16, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26957), { 0, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26962), { 0, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26967), { 16, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1734,25 +1252,7 @@ static void LayDownRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26953), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26958), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26963), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26968), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1783,28 +1283,41 @@ static void LayDownRCTrackRightQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26929, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26934, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26939, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26944, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26930, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 26935, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 26940, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 26945, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26931, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+        { { 26936, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 26941, { 16, 16, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 26946, { 0, 16, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26932, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26937, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26942, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26947, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26933, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26938, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26943, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26948, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26929), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26934), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26939), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26944), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1826,25 +1339,7 @@ static void LayDownRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26930), { 0, 16, height + 24 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26935), { 0, 16, height + 24 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26940), { 0, 0, height + 24 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26945), { 0, 0, height + 24 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1856,25 +1351,7 @@ static void LayDownRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26931), { 0, 0, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26936), { 16, 0, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26941), { 16, 16, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26946), { 0, 16, height + 24 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1888,25 +1365,7 @@ static void LayDownRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26932), { 16, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26937), { 0, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26942), { 0, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26947), { 16, 0, height + 24 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1918,25 +1377,7 @@ static void LayDownRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26933), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26938), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26943), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26948), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1985,32 +1426,35 @@ static void LayDownRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26641, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26645, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26644, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26648, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26642, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26646, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26643, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26647, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26643, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26647, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26642, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26646, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26644, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26648, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26641, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26645, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26641), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26645), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26644), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26648), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2029,29 +1473,7 @@ static void LayDownRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26642), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26646), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26643), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26647), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2076,29 +1498,7 @@ static void LayDownRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26643), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26647), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26642), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26646), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2123,29 +1523,7 @@ static void LayDownRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26644), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26648), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26641), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26645), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2176,32 +1554,35 @@ static void LayDownRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26649, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26653, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26652, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26656, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26650, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26654, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26651, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26655, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26651, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26655, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26650, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26654, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26652, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26656, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26649, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26653, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26649), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26653), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26652), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26656), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2220,29 +1601,7 @@ static void LayDownRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26650), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26654), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26651), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26655), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2267,29 +1626,7 @@ static void LayDownRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26651), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26655), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26650), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26654), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2314,29 +1651,7 @@ static void LayDownRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26652), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26656), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26649), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26653), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2367,32 +1682,29 @@ static void LayDownRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26710, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26713, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26716, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26707, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26709, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26712, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26715, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26706, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26708, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26711, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26714, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26705, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26710), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26713), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26716), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26707), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2414,29 +1726,7 @@ static void LayDownRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26709), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26712), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26715), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26706), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2448,29 +1738,7 @@ static void LayDownRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26708), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26711), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26714), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26705), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2510,32 +1778,29 @@ static void LayDownRCTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26722, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26725, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26728, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26719, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26721, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26724, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26727, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26718, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26720, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26723, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26726, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26717, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26722), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26725), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26728), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26719), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2557,29 +1822,7 @@ static void LayDownRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26721), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26724), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26727), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26718), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2591,29 +1834,7 @@ static void LayDownRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26720), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26723), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26726), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26717), { 0, 0, height + 24 },
-                        { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2653,28 +1874,23 @@ static void LayDownRCTrackLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26924, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26926, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26928, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26922, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26923, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26925, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26927, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26921, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26924), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26926), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26928), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26922), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2699,25 +1915,7 @@ static void LayDownRCTrackLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26923), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26925), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26927), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26921), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2748,28 +1946,23 @@ static void LayDownRCTrackRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26913, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26915, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26917, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26919, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26914, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26916, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26918, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26920, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26913), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26915), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26917), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26919), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2794,25 +1987,7 @@ static void LayDownRCTrackRightQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26914), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26916), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26918), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26920), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2861,41 +2036,26 @@ static void LayDownRCTrackLeftQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26910), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26906), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26911), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26907), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26912), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26908), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26909), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26905), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 26910, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 26906, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26911, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 26907, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26912, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 26908, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26909, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 26905, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     TrackPaintUtilLeftQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::StandardSlopeStart, +56, TunnelType::StandardSlopeEnd);
@@ -2908,41 +2068,26 @@ static void LayDownRCTrackRightQuarterTurn160DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26901), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26897), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26902), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26898), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26903), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26899), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26904), { 0, 0, height },
-                { { 2, 2, height }, { 28, 28, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26900), { 0, 0, height },
-                { { 2, 2, height + 99 }, { 28, 28, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 26901, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 26897, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26902, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 26898, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26903, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 26899, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+        {
+            { 26904, { 0, 0, 0 }, { { 2, 2, 0 }, { 28, 28, 3 } } },
+            { 26900, { 0, 0, 0 }, { { 2, 2, 99 }, { 28, 28, 1 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     TrackPaintUtilRightQuarterTurn1TileTunnel(
         session, direction, height, -8, TunnelType::StandardSlopeStart, +56, TunnelType::StandardSlopeEnd);
@@ -2971,21 +2116,14 @@ static void LayDownRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26559), { 0, 0, height + 24 },
-                { { 0, 6, height + 24 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26560), { 0, 0, height + 24 },
-                { { 0, 6, height + 24 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26559, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26560, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26559, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26560, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -3002,31 +2140,16 @@ static void LayDownRCTrackOnRidePhoto(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26555, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26556, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26555, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26556, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, kSupportType);
 
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26555), { 0, 0, height + 24 },
-                { { 0, 6, height + 24 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26556), { 0, 0, height + 24 },
-                { { 0, 6, height + 24 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26555), { 0, 0, height + 24 },
-                { { 0, 6, height + 24 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26556), { 0, 0, height + 24 },
-                { { 0, 6, height + 24 }, { 32, 20, 3 } });
-            break;
-    }
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
     PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -3038,32 +2161,35 @@ static void LayDownRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26765, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26769, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26773, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26777, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26766, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 26770, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 26774, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26778, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26767, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26771, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26775, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26779, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26768, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26772, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 26776, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26780, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26765), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26769), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26773), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26777), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -3076,29 +2202,7 @@ static void LayDownRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26766), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26770), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26774), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26778), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3110,29 +2214,7 @@ static void LayDownRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26767), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26771), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26775), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26779), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3155,29 +2237,7 @@ static void LayDownRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26768), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26772), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26776), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26780), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3217,32 +2277,35 @@ static void LayDownRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26749, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26753, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26757, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26761, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26750, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26754, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26758, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 26762, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26751, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26755, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26759, { 0, 0, 24 }, { { 4, 4, 22 }, { 28, 28, 3 } } } },
+        { { 26763, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26752, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26756, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26760, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 26764, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26749), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26753), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26757), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26761), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -3255,29 +2318,7 @@ static void LayDownRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26750), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26754), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26758), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26762), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3289,29 +2330,7 @@ static void LayDownRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26751), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26755), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26759), { 0, 0, height + 24 },
-                        { { 4, 4, height + 22 }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26763), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3334,29 +2353,7 @@ static void LayDownRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26752), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26756), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26760), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26764), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3414,32 +2411,35 @@ static void LayDownRCTrackLeftEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26853, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26857, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26861, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26865, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26854, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 26858, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 26862, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26866, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26855, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26859, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26863, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26867, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26856, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26860, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 26864, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26868, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26853), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26857), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26861), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26865), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3458,29 +2458,7 @@ static void LayDownRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26854), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26858), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26862), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26866), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3492,29 +2470,7 @@ static void LayDownRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26855), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26859), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26863), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26867), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3537,29 +2493,7 @@ static void LayDownRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26856), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26860), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26864), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26868), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3599,32 +2533,35 @@ static void LayDownRCTrackRightEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26837, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26841, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26845, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26849, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26838, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26842, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26846, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 26850, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26839, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26843, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26847, { 0, 0, 24 }, { { 4, 4, 22 }, { 28, 28, 3 } } } },
+        { { 26851, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26840, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26844, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26848, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 26852, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26837), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26841), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26845), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26849), { 0, 0, height + 24 },
-                        { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3643,29 +2580,7 @@ static void LayDownRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26838), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26842), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26846), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26850), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3677,29 +2592,7 @@ static void LayDownRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26839), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26843), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26847), { 0, 0, height + 24 },
-                        { { 4, 4, height + 22 }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26851), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3722,29 +2615,7 @@ static void LayDownRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26840), { 0, 0, height + 24 },
-                        { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26844), { 0, 0, height + 24 },
-                        { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26848), { 0, 0, height + 24 },
-                        { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26852), { 0, 0, height + 24 },
-                        { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3868,30 +2739,65 @@ static void LayDownRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26824, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26796, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26821, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26793, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26823, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26795, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26822, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26794, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26824), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26796), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3906,25 +2812,11 @@ static void LayDownRCTrackDiag25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26821), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26793), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3938,25 +2830,11 @@ static void LayDownRCTrackDiag25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26823), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26795), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3971,25 +2849,11 @@ static void LayDownRCTrackDiag25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26822), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26794), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -4030,17 +2894,35 @@ static void LayDownRCTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26808, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26805, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26807, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26806, { -16, -16, 24 }, { { -16, -16, 24 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26808), { -16, -16, height + 24 },
-                        { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4052,14 +2934,7 @@ static void LayDownRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26805), { -16, -16, height + 24 },
-                        { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4070,14 +2945,7 @@ static void LayDownRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26807), { -16, -16, height + 24 },
-                        { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4089,14 +2957,7 @@ static void LayDownRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26806), { -16, -16, height + 24 },
-                        { { -16, -16, height + 24 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4136,30 +2997,65 @@ static void LayDownRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26816, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26788, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26813, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26785, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26815, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26787, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26814, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26786, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26816), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26788), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4174,25 +3070,11 @@ static void LayDownRCTrackDiagFlatTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26813), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26785), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4206,25 +3088,11 @@ static void LayDownRCTrackDiagFlatTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26815), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26787), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4239,25 +3107,11 @@ static void LayDownRCTrackDiagFlatTo25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26814), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26786), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -4298,17 +3152,35 @@ static void LayDownRCTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26800, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26797, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26799, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26798, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26800), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4320,14 +3192,7 @@ static void LayDownRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26797), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4338,14 +3203,7 @@ static void LayDownRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26799), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4357,14 +3215,7 @@ static void LayDownRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26798), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4404,17 +3255,35 @@ static void LayDownRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26804, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26801, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26803, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26802, { -16, -16, 24 }, { { 0, 0, 56 }, { 16, 16, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26804), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4426,14 +3295,7 @@ static void LayDownRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26801), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4444,14 +3306,7 @@ static void LayDownRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26803), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4463,14 +3318,7 @@ static void LayDownRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26802), { -16, -16, height + 24 },
-                        { { 0, 0, height + 56 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4510,30 +3358,65 @@ static void LayDownRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26820, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26792, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26817, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26789, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26819, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26791, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26818, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26790, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26820), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26792), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4548,25 +3431,11 @@ static void LayDownRCTrackDiag25DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26817), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26789), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4580,25 +3449,11 @@ static void LayDownRCTrackDiag25DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26819), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26791), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4613,25 +3468,11 @@ static void LayDownRCTrackDiag25DegUpToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26818), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26790), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -4672,17 +3513,35 @@ static void LayDownRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26794, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26795, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26793, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26796, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26794), { -16, -16, height + 24 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4694,14 +3553,7 @@ static void LayDownRCTrackDiag25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26795), { -16, -16, height + 24 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4712,14 +3564,7 @@ static void LayDownRCTrackDiag25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26793), { -16, -16, height + 24 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4731,14 +3576,7 @@ static void LayDownRCTrackDiag25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26796), { -16, -16, height + 24 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4778,17 +3616,35 @@ static void LayDownRCTrackDiag60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26806, { -16, -16, 24 }, { { -16, -16, 24 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26807, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26805, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26808, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26806), { -16, -16, height + 24 },
-                        { { -16, -16, height + 24 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4800,14 +3656,7 @@ static void LayDownRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26807), { -16, -16, height + 24 },
-                        { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4818,14 +3667,7 @@ static void LayDownRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26805), { -16, -16, height + 24 },
-                        { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4837,14 +3679,7 @@ static void LayDownRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26808), { -16, -16, height + 24 },
-                        { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4884,17 +3719,35 @@ static void LayDownRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26790, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26791, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26789, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26792, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26790), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4905,14 +3758,7 @@ static void LayDownRCTrackDiagFlatTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26791), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4922,14 +3768,7 @@ static void LayDownRCTrackDiagFlatTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26789), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4940,14 +3779,7 @@ static void LayDownRCTrackDiagFlatTo25DegDown(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26792), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4987,17 +3819,35 @@ static void LayDownRCTrackDiag25DegDownTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26802, { -16, -16, 24 }, { { 0, 0, 56 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26803, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26801, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26804, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26802), { -16, -16, height + 24 },
-                        { { 0, 0, height + 56 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5009,14 +3859,7 @@ static void LayDownRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26803), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5027,14 +3870,7 @@ static void LayDownRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26801), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5046,14 +3882,7 @@ static void LayDownRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26804), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5093,17 +3922,35 @@ static void LayDownRCTrackDiag60DegDownTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26798, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26799, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26797, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26800, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26798), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5115,14 +3962,7 @@ static void LayDownRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26799), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5133,14 +3973,7 @@ static void LayDownRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26797), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5152,14 +3985,7 @@ static void LayDownRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26800), { -16, -16, height + 24 },
-                        { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5199,17 +4025,35 @@ static void LayDownRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26786, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26787, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26785, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26788, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26786), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5221,14 +4065,7 @@ static void LayDownRCTrackDiag25DegDownToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26787), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5239,14 +4076,7 @@ static void LayDownRCTrackDiag25DegDownToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26785), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5258,14 +4088,7 @@ static void LayDownRCTrackDiag25DegDownToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26788), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5305,17 +4128,35 @@ static void LayDownRCTrackDiagFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26876, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26873, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26875, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26874, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26876), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5327,14 +4168,7 @@ static void LayDownRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26873), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5345,14 +4179,7 @@ static void LayDownRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26875), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5364,14 +4191,7 @@ static void LayDownRCTrackDiagFlatToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26874), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5411,17 +4231,35 @@ static void LayDownRCTrackDiagFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26880, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26877, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26879, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26878, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26880), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5433,14 +4271,7 @@ static void LayDownRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26877), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5451,14 +4282,7 @@ static void LayDownRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26879), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5470,14 +4294,7 @@ static void LayDownRCTrackDiagFlatToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26878), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5517,17 +4334,35 @@ static void LayDownRCTrackDiagLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26878, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26879, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26877, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26880, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26878), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5539,14 +4374,7 @@ static void LayDownRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26879), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5557,14 +4385,7 @@ static void LayDownRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26877), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5576,14 +4397,7 @@ static void LayDownRCTrackDiagLeftBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26880), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5623,17 +4437,35 @@ static void LayDownRCTrackDiagRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26874, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26875, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26873, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26876, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26874), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5645,14 +4477,7 @@ static void LayDownRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26875), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5663,14 +4488,7 @@ static void LayDownRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26873), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5682,14 +4500,7 @@ static void LayDownRCTrackDiagRightBankToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26876), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5729,17 +4540,35 @@ static void LayDownRCTrackDiagLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26892, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26889, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26891, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26890, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26892), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5751,14 +4580,7 @@ static void LayDownRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26889), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5769,14 +4591,7 @@ static void LayDownRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26891), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5788,14 +4603,7 @@ static void LayDownRCTrackDiagLeftBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26890), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5835,17 +4643,35 @@ static void LayDownRCTrackDiagRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26896, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26893, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26895, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26894, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26896), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5857,14 +4683,7 @@ static void LayDownRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26893), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5875,14 +4694,7 @@ static void LayDownRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26895), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5894,14 +4706,7 @@ static void LayDownRCTrackDiagRightBankTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26894), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -5941,17 +4746,35 @@ static void LayDownRCTrackDiag25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26884, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26881, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26883, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26882, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26884), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5963,14 +4786,7 @@ static void LayDownRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26881), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5981,14 +4797,7 @@ static void LayDownRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26883), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6000,14 +4809,7 @@ static void LayDownRCTrackDiag25DegUpToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26882), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6047,17 +4849,35 @@ static void LayDownRCTrackDiag25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26888, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26885, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26887, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26886, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26888), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6069,14 +4889,7 @@ static void LayDownRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26885), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6087,14 +4900,7 @@ static void LayDownRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26887), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6106,14 +4912,7 @@ static void LayDownRCTrackDiag25DegUpToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26886), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6153,17 +4952,35 @@ static void LayDownRCTrackDiagLeftBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26886, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26887, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26885, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26888, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26886), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6174,14 +4991,7 @@ static void LayDownRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26887), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6191,14 +5001,7 @@ static void LayDownRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26885), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6209,14 +5012,7 @@ static void LayDownRCTrackDiagLeftBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26888), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6256,17 +5052,35 @@ static void LayDownRCTrackDiagRightBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26882, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26883, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26881, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26884, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26882), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6277,14 +5091,7 @@ static void LayDownRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26883), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6294,14 +5101,7 @@ static void LayDownRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26881), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6312,14 +5112,7 @@ static void LayDownRCTrackDiagRightBankTo25DegDown(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26884), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6359,17 +5152,35 @@ static void LayDownRCTrackDiag25DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26894, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26895, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26893, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26896, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26894), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6381,14 +5192,7 @@ static void LayDownRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26895), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6399,14 +5203,7 @@ static void LayDownRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26893), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6418,14 +5215,7 @@ static void LayDownRCTrackDiag25DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26896), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6465,17 +5255,35 @@ static void LayDownRCTrackDiag25DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26890, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26891, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26889, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26892, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26890), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6487,14 +5295,7 @@ static void LayDownRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26891), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6505,14 +5306,7 @@ static void LayDownRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26889), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6524,14 +5318,7 @@ static void LayDownRCTrackDiag25DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26892), { -16, -16, height + 24 },
-                        { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6571,17 +5358,35 @@ static void LayDownRCTrackDiagLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26872, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26869, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26871, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26870, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26872), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6593,14 +5398,7 @@ static void LayDownRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26869), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6611,14 +5409,7 @@ static void LayDownRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26871), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6630,14 +5421,7 @@ static void LayDownRCTrackDiagLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26870), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6677,17 +5461,35 @@ static void LayDownRCTrackDiagRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26870, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26871, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26869, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26872, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26870), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6699,14 +5501,7 @@ static void LayDownRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26871), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6717,14 +5512,7 @@ static void LayDownRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26869), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6736,14 +5524,7 @@ static void LayDownRCTrackDiagRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26872), { -16, -16, height + 24 },
-                        { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6783,29 +5564,29 @@ static void LayDownRCTrackLeftFlyerTwistDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26969, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26975, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26974, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26980, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26970, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26976, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26973, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26979, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26971, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26977, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26972, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26978, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26969), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26975), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26974), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26980), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6824,26 +5605,7 @@ static void LayDownRCTrackLeftFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26970), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26976), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26973), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26979), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6855,25 +5617,7 @@ static void LayDownRCTrackLeftFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26971), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26977), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26972), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26978), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -6902,28 +5646,29 @@ static void LayDownRCTrackRightFlyerTwistDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26981, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26987, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26986, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26992, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26982, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26988, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26985, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26991, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26983, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26989, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26984, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26990, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26981), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26987), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26986), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26992), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -6942,25 +5687,7 @@ static void LayDownRCTrackRightFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26982), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26988), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26985), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26991), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -6972,25 +5699,7 @@ static void LayDownRCTrackRightFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26983), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26989), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26984), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26990), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -7019,28 +5728,29 @@ static void LayDownRCTrackFlyerHalfLoopDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16597, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16605, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 16598, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+        { { 16606, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16596, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 16604, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 16599, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 12, 119 } } } },
+        { { 16607, { 16, 16, 0 }, { { 15, 6, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16594, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16602, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 11 } } } },
+        { { 16601, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { 16609, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16597), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16605), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16598), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16606), { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
@@ -7050,27 +5760,7 @@ static void LayDownRCTrackFlyerHalfLoopDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16596), { 16, 0, height }, { 2, 16, 119 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16604), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16599), { 10, 16, height }, { 4, 12, 119 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16607), { 16, 16, height },
-                        { { 15, 6, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7116,25 +5806,7 @@ static void LayDownRCTrackFlyerHalfLoopDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16594), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16602), { 0, 6, height }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16601), { 0, 6, height }, { 32, 20, 9 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16609), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -7152,32 +5824,29 @@ static void LayDownRCTrackLeftFlyerCorkscrewDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16627, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 16630, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 16633, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 16624, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16626, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16629, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16632, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 16623, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16625, { 0, 0, 0 }, { { 6, 0, 4 }, { 20, 32, 3 } } } },
+        { { 16628, { 0, 0, 0 }, { { 6, 0, 4 }, { 20, 32, 3 } } } },
+        { { 16631, { 0, 0, 0 }, { { 6, 0, 4 }, { 20, 32, 3 } } } },
+        { { 16622, { 0, 0, 0 }, { { 6, 0, 4 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16627), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16630), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16633), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16624), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7196,57 +5865,13 @@ static void LayDownRCTrackLeftFlyerCorkscrewDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16626), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16629), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16632), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16623), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
-            PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 72);
-            break;
-        case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16625), { 0, 0, height },
-                        { { 6, 0, height + 4 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16628), { 0, 0, height },
-                        { { 6, 0, height + 4 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16631), { 0, 0, height },
-                        { { 6, 0, height + 4 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16622), { 0, 0, height },
-                        { { 6, 0, height + 4 }, { 20, 32, 3 } });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
+            PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 72);
+            break;
+        case 2:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
+            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
                 case 2:
@@ -7284,21 +5909,14 @@ static void LayDownRCTrackBlockBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26559), { 0, 0, height + 24 },
-                { { 0, 6, height + 24 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26560), { 0, 0, height + 24 },
-                { { 0, 6, height + 24 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26559, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26560, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26559, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26560, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -7314,32 +5932,41 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27118, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27123, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27128, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27113, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27117, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27122, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27127, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27112, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27116, { 0, 0, 24 }, { { 0, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27121, { 0, 0, 24 }, { { 16, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27126, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27111, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27115, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27120, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27125, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27110, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27114, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27119, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27124, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27109, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27118), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27123), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27128), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27113), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7361,29 +5988,7 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27117), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27122), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27127), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27112), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7395,29 +6000,7 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27116), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27121), { 0, 0, height + 24 },
-                        { { 16, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27126), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27111), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7432,29 +6015,7 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27115), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27120), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27125), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27110), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7466,29 +6027,7 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27114), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27119), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27124), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27109), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7518,32 +6057,41 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27089, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27094, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27099, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+        { { 27104, { 0, 0, 24 }, { { 0, 6, 30 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27090, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27095, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27100, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27105, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27091, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27096, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27101, { 0, 0, 24 }, { { 16, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27106, { 0, 0, 24 }, { { 0, 16, 38 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27092, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27097, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27102, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27107, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27093, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27098, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27103, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+        { { 27108, { 0, 0, 24 }, { { 6, 0, 38 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27089), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27094), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27099), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27104), { 0, 0, height + 24 },
-                        { { 0, 6, height + 30 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7565,29 +6113,7 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27090), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27095), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27100), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27105), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7599,29 +6125,7 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27091), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27096), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27101), { 0, 0, height + 24 },
-                        { { 16, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27106), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7635,29 +6139,7 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27092), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27097), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27102), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27107), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7669,29 +6151,7 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27093), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27098), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27103), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27108), { 0, 0, height + 24 },
-                        { { 6, 0, height + 38 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7721,32 +6181,41 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27098, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27103, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27108, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27093, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27097, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27102, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27107, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27092, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27096, { 0, 0, 24 }, { { 0, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27101, { 0, 0, 24 }, { { 16, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27106, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27091, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27095, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27100, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27105, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27090, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27094, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27099, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27104, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27089, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27098), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27103), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27108), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27093), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7768,29 +6237,7 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27097), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27102), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27107), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27092), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7802,29 +6249,7 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27096), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27101), { 0, 0, height + 24 },
-                        { { 16, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27106), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27091), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7839,29 +6264,7 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27095), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27100), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27105), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27090), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -7873,29 +6276,7 @@ static void LayDownRCTrackLeftQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27094), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27099), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27104), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27089), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7925,32 +6306,41 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27109, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27114, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27119, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+        { { 27124, { 0, 0, 24 }, { { 0, 6, 38 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27110, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27115, { 0, 0, 24 }, { { 0, 16, 38 }, { 32, 16, 3 } } } },
+        { { 27120, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+        { { 27125, { 0, 0, 24 }, { { 0, 0, 38 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27111, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27116, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 16, 3 } } } },
+        { { 27121, { 0, 0, 24 }, { { 16, 16, 38 }, { 16, 16, 3 } } } },
+        { { 27126, { 0, 0, 24 }, { { 0, 16, 38 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 27112, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27117, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27122, { 0, 0, 24 }, { { 0, 0, 38 }, { 16, 32, 3 } } } },
+        { { 27127, { 0, 0, 24 }, { { 16, 0, 38 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 27113, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27118, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27123, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+        { { 27128, { 0, 0, 24 }, { { 6, 0, 30 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27109), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27114), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27119), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27124), { 0, 0, height + 24 },
-                        { { 0, 6, height + 38 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -7972,29 +6362,7 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27110), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27115), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27120), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27125), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8006,29 +6374,7 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27111), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27116), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27121), { 0, 0, height + 24 },
-                        { { 16, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27126), { 0, 0, height + 24 },
-                        { { 0, 16, height + 38 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8042,29 +6388,7 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27112), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27117), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27122), { 0, 0, height + 24 },
-                        { { 0, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27127), { 0, 0, height + 24 },
-                        { { 16, 0, height + 38 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8076,29 +6400,7 @@ static void LayDownRCTrackRightQuarterBankedHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27113), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27118), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27123), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27128), { 0, 0, height + 24 },
-                        { { 6, 0, height + 30 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -8128,32 +6430,35 @@ static void LayDownRCTrackHalfLoopInvertedUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 27073, { 0, 6, 24 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27081, { 0, 6, 24 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27080, { 0, 6, 24 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 27088, { 0, 6, 24 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 27074, { 0, 0, 24 }, { { 0, 29, 29 }, { 32, 2, 3 } } } },
+        { { 27082, { 0, 14, 24 }, { { 0, 29, 29 }, { 32, 2, 63 } } } },
+        { { 27079, { 0, 6, 24 }, { { 0, 0, 29 }, { 32, 2, 3 } } } },
+        { { 27087, { 0, 6, 24 }, { { 29, 20, 29 }, { 2, 2, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 27075, { 16, 0, -3 }, { { 16, 29, 2 }, { 5, 2, 119 } } } },
+        { { 27083, { 12, 0, -3 }, { { 0, -6, 2 }, { 32, 2, 119 } } } },
+        { { 27078, { 10, 16, -3 }, { { 10, 0, 2 }, { 4, 2, 119 } } } },
+        { { 27086, { 16, 16, -3 }, { { 29, 29, 2 }, { 2, 2, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 27076, { 0, 0, 29 }, { { 0, 6, 34 }, { 32, 20, 3 } } } },
+        { { 27084, { 0, 0, 29 }, { { 0, 0, -6 }, { 2, 2, 3 } } } },
+        { { 27077, { 0, 16, 29 }, { { 0, 0, -6 }, { 32, 2, 3 } } } },
+        { { 27085, { 0, 16, 29 }, { { 0, 6, 34 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27073), { 0, 6, height + 24 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27081), { 0, 6, height + 24 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27080), { 0, 6, height + 24 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27088), { 0, 6, height + 24 },
-                        { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -8184,56 +6489,12 @@ static void LayDownRCTrackHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27074), { 0, 0, height + 24 },
-                        { { 0, 29, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27082), { 0, 14, height + 24 },
-                        { { 0, 29, height + 29 }, { 32, 2, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27079), { 0, 6, height + 24 },
-                        { { 0, 0, height + 29 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27087), { 0, 6, height + 24 },
-                        { { 29, 20, height + 29 }, { 2, 2, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27075), { 16, 0, height - 3 },
-                        { { 16, 29, height + 2 }, { 5, 2, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27083), { 12, 0, height - 3 },
-                        { { 0, -6, height + 2 }, { 32, 2, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27078), { 10, 16, height - 3 },
-                        { { 10, 0, height + 2 }, { 4, 2, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27086), { 16, 16, height - 3 },
-                        { { 29, 29, height + 2 }, { 2, 2, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -8245,29 +6506,7 @@ static void LayDownRCTrackHalfLoopInvertedUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27076), { 0, 0, height + 29 },
-                        { { 0, 6, height + 34 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27084), { 0, 0, height + 29 },
-                        { { 0, 0, height - 6 }, { 2, 2, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27077), { 0, 16, height + 29 },
-                        { { 0, 0, height - 6 }, { 32, 2, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(27085), { 0, 16, height + 29 },
-                        { { 0, 6, height + 34 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 32, TunnelType::StandardFlat);
@@ -77,6 +77,43 @@ static void LimLaunchedRCTrackLeftVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 15389, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 26, 3 } } } },
+        { { 15397, { 0, 14, 0 }, { { 0, 14, 0 }, { 32, 2, 63 } } } },
+        { { 15394, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 26, 3 } } } },
+        { { 15402, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15390, { 16, 0, 0 }, { { 16, 0, 0 }, { 3, 16, 119 } } } },
+        { { 15398, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 15393, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 15401, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 15391, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 15399, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 15392, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 15400, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 15392, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 15400, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 15391, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 15399, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 15393, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 15401, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 15390, { 16, 0, 0 }, { { 16, 0, 0 }, { 3, 16, 119 } } } },
+        { { 15398, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence8Sprites = {
+        { { 15394, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 26, 3 } } } },
+        { { 15402, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 26, 3 } } } },
+        { { 15389, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 26, 3 } } } },
+        { { 15397, { 0, 14, 0 }, { { 0, 14, 0 }, { 32, 2, 63 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -122,25 +159,7 @@ static void LimLaunchedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15389), { 0, 0, height }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15397), { 0, 14, height }, { 32, 2, 63 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15394), { 0, 6, height }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15402), { 0, 6, height }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -152,29 +171,7 @@ static void LimLaunchedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15390), { 16, 0, height },
-                        { { 16, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15398), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15393), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15401), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -186,25 +183,7 @@ static void LimLaunchedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15391), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15399), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15392), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15400), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -222,25 +201,7 @@ static void LimLaunchedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15392), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15400), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15391), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15399), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -252,29 +213,7 @@ static void LimLaunchedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15393), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15401), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15390), { 16, 0, height },
-                        { { 16, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15398), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -286,25 +225,7 @@ static void LimLaunchedRCTrackLeftVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 8:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15394), { 0, 6, height }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15402), { 0, 6, height }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15389), { 0, 0, height }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15397), { 0, 14, height }, { 32, 2, 63 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence8Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -370,28 +291,59 @@ static void LimLaunchedRCTrackRightVerticalLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15419, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+        { { 15411, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15412, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15404, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 15418, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 26, 3 } } } },
+        { { 15410, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 26, 3 } } } },
+        { { 15413, { 0, 14, 0 }, { { 0, 14, 0 }, { 32, 2, 63 } } } },
+        { { 15405, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15417, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 15409, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+        { { 15414, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 15406, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 15416, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 15408, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 15415, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 15407, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 15415, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 15407, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 15416, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 15408, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 15414, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { 15406, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { 15417, { 16, 16, 0 }, { { 16, 16, 0 }, { 2, 16, 119 } } } },
+        { { 15409, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence8Sprites = {
+        { { 15413, { 0, 14, 0 }, { { 0, 14, 0 }, { 32, 2, 63 } } } },
+        { { 15405, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 26, 3 } } } },
+        { { 15418, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 26, 3 } } } },
+        { { 15410, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 15412, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15404, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15419, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+        { { 15411, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15419), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15411), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15412), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15404), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -400,73 +352,15 @@ static void LimLaunchedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15418), { 0, 6, height }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15410), { 0, 6, height }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15413), { 0, 14, height }, { 32, 2, 63 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15405), { 0, 0, height }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15417), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15409), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15414), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15406), { 16, 0, height },
-                        { { 16, 0, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15416), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15408), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15415), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15407), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
@@ -476,95 +370,19 @@ static void LimLaunchedRCTrackRightVerticalLoop(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15415), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15407), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15416), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15408), { 0, 16, height + 32 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15414), { 12, 0, height },
-                        { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15406), { 16, 0, height },
-                        { { 16, 0, height }, { 2, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15417), { 16, 16, height },
-                        { { 16, 16, height }, { 2, 16, 119 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15409), { 10, 16, height },
-                        { { 10, 16, height }, { 4, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 8:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15413), { 0, 14, height }, { 32, 2, 63 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15405), { 0, 0, height }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15418), { 0, 6, height }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15410), { 0, 6, height }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence8Sprites);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15412), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15404), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15419), { 0, 6, height }, { 32, 20, 7 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15411), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             switch (direction)
             {
@@ -587,44 +405,65 @@ static void LimLaunchedRCTrackLeftTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 15758, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15782, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15761, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15785, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15764, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15788, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15767, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15791, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 15759, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15783, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15762, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15786, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15765, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15789, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15768, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15792, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 15760, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15784, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15763, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15787, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15766, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15790, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15769, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15793, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15758), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15782), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15761), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15785), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15764), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15788), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15767), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15791), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -641,41 +480,7 @@ static void LimLaunchedRCTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15759), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15783), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15762), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15786), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15765), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15789), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15768), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15792), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -687,41 +492,7 @@ static void LimLaunchedRCTrackLeftTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15760), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15784), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15763), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15787), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15766), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15790), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15769), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15793), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             switch (direction)
             {
                 case 1:
@@ -749,44 +520,65 @@ static void LimLaunchedRCTrackRightTwistDownToUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 15770, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15794, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15773, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15797, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15776, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15800, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15779, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15803, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 15771, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15795, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15774, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15798, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15777, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15801, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15780, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15804, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 15772, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15796, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15775, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15799, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15778, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15802, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15781, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15805, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15770), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15794), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15773), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15797), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15776), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15800), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15779), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15803), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -803,41 +595,7 @@ static void LimLaunchedRCTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15771), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15795), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15774), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15798), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15777), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15801), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15780), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15804), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -849,41 +607,7 @@ static void LimLaunchedRCTrackRightTwistDownToUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15772), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15796), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15775), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15799), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15778), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15802), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15781), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15805), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             switch (direction)
             {
                 case 1:
@@ -911,44 +635,65 @@ static void LimLaunchedRCTrackLeftTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 15766, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15790, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15769, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15793, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15760, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15784, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15763, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15787, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 15765, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15789, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15768, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15792, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15759, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15783, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15762, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15786, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 15764, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15788, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15767, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15791, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15758, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15782, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15761, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15785, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15766), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15790), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15769), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15793), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15760), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15784), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15763), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15787), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 32, TunnelType::InvertedFlat);
@@ -964,41 +709,7 @@ static void LimLaunchedRCTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15765), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15789), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15768), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15792), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15759), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15783), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15762), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15786), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1010,41 +721,7 @@ static void LimLaunchedRCTrackLeftTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15764), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15788), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15767), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15791), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15758), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15782), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15761), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15785), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -1073,44 +750,65 @@ static void LimLaunchedRCTrackRightTwistUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 15778, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15802, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15781, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15805, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15772, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15796, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15775, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15799, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 15777, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15801, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15780, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15804, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15771, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15795, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15774, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15798, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 15776, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15800, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15779, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15803, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15770, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15794, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { 15773, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15797, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15778), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15802), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15781), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15805), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15772), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15796), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15775), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15799), { 0, 0, height },
-                        { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 32, TunnelType::InvertedFlat);
@@ -1126,41 +824,7 @@ static void LimLaunchedRCTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15777), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15801), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15780), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15804), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15771), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15795), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15774), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15798), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1172,41 +836,7 @@ static void LimLaunchedRCTrackRightTwistUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15776), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15800), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15779), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15803), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15770), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15794), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15773), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15797), { 0, 0, height },
-                        { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -1235,32 +865,29 @@ static void LimLaunchedRCTrackLeftCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15734, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 15737, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 15740, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 15743, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 15735, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 15738, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 15741, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 15744, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15736, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 15739, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 15742, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 15745, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15734), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15737), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15740), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15743), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             TrackPaintUtilLeftCorkscrewUpSupports(session, direction, height);
 
@@ -1271,56 +898,12 @@ static void LimLaunchedRCTrackLeftCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15735), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15738), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15741), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15744), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15736), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15739), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15742), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15745), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1351,32 +934,29 @@ static void LimLaunchedRCTrackRightCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15746, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 15749, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 15752, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { 15755, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 15747, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 15750, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 15753, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+        { { 15756, { 0, 0, 0 }, { { 6, 6, 10 }, { 20, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15748, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 15751, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 15754, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 15757, { 0, 0, 0 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15746), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15749), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15752), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15755), { 0, 0, height },
-                        { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+    {
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -1393,56 +973,12 @@ static void LimLaunchedRCTrackRightCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15747), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15750), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15753), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15756), { 0, 0, height },
-                        { { 6, 6, height + 10 }, { 20, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15748), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15751), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15754), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15757), { 0, 0, height },
-                        { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1489,21 +1025,14 @@ static void LimLaunchedRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15018), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15019), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15018, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15019, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15018, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15019, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1518,32 +1047,17 @@ static void LimLaunchedRCTrack90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15702, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15703, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15704, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15705, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15702), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15703), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15704), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15705), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 32);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -1567,32 +1081,17 @@ static void LimLaunchedRCTrack60DegUpTo90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15694, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15695, { 0, 0, 0 }, { { 24, 6, 0 }, { 2, 20, 55 } } } },
+        { { 15696, { 0, 0, 0 }, { { 24, 6, 0 }, { 2, 20, 55 } } } },
+        { { 15697, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15694), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15695), { 0, 0, height },
-                        { { 24, 6, height }, { 2, 20, 55 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15696), { 0, 0, height },
-                        { { 24, 6, height }, { 2, 20, 55 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15697), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::StandardSlopeStart);
@@ -1620,29 +1119,14 @@ static void LimLaunchedRCTrack90DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15698), { 0, 0, height },
-                { { 0, 6, height + 2 }, { 6, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15699), { 0, 0, height },
-                { { 39, 6, height + 8 }, { 2, 20, 31 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15700), { 0, 0, height },
-                { { 39, 6, height + 8 }, { 2, 20, 31 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15701), { 0, 0, height },
-                { { 0, 6, height + 2 }, { 6, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15698, { 0, 0, 0 }, { { 0, 6, 2 }, { 6, 20, 3 } } } },
+        { { 15699, { 0, 0, 0 }, { { 39, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15700, { 0, 0, 0 }, { { 39, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15701, { 0, 0, 0 }, { { 0, 6, 2 }, { 6, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     switch (direction)
     {
         case 1:
@@ -1661,32 +1145,17 @@ static void LimLaunchedRCTrack60DegDownTo90DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15700, { 0, 0, 0 }, { { 39, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15701, { 0, 0, 0 }, { { 0, 6, 2 }, { 6, 20, 3 } } } },
+        { { 15698, { 0, 0, 0 }, { { 0, 6, 2 }, { 6, 20, 3 } } } },
+        { { 15699, { 0, 0, 0 }, { { 39, 6, 8 }, { 2, 20, 31 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15700), { 0, 0, height },
-                        { { 39, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15701), { 0, 0, height },
-                        { { 0, 6, height + 2 }, { 6, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15698), { 0, 0, height },
-                        { { 0, 6, height + 2 }, { 6, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15699), { 0, 0, height },
-                        { { 39, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 48, TunnelType::StandardSlopeEnd);
@@ -1705,32 +1174,29 @@ static void LimLaunchedRCTrack90DegToInvertedFlatQuarterLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15722, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15725, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15728, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15731, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 15723, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+        { { 15726, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 15729, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 15732, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15724, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 15727, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15730, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 15733, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15722), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15725), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15728), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15731), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1739,29 +1205,7 @@ static void LimLaunchedRCTrack90DegToInvertedFlatQuarterLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15723), { 0, 0, height },
-                        { { -8, 6, height }, { 2, 20, 31 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15726), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15729), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15732), { 0, 0, height },
-                        { { -8, 6, height }, { 2, 20, 31 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1770,29 +1214,7 @@ static void LimLaunchedRCTrack90DegToInvertedFlatQuarterLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15724), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15727), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15730), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15733), { 0, 0, height },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height + 16, TunnelType::StandardFlat);
@@ -1838,38 +1260,23 @@ static void LimLaunchedRCTrackLeftQuarterTurn190DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15706, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } } },
+        {
+            { 15707, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } },
+            { 15715, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } },
+        },
+        { { 15716, { 0, 0, 0 }, { { 24, 24, 8 }, { 2, 2, 63 } } } },
+        {
+            { 15709, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } },
+            { 15717, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15706), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15707), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15715), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15716), { 0, 0, height },
-                        { { 24, 24, height + 8 }, { 2, 2, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15709), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15717), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 96);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -1885,38 +1292,23 @@ static void LimLaunchedRCTrackRightQuarterTurn190DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 15710, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } },
+            { 15718, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } },
+        },
+        { { 15719, { 0, 0, 0 }, { { 24, 24, 8 }, { 2, 2, 63 } } } },
+        {
+            { 15712, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } },
+            { 15720, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } },
+        },
+        { { 15713, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 63 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15710), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15718), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15719), { 0, 0, height },
-                        { { 24, 24, height + 8 }, { 2, 2, 63 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15712), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15720), { 0, 0, height },
-                        { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15713), { 0, 0, height },
-                        { { 4, 6, height + 8 }, { 2, 20, 63 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetVerticalTunnel(session, height + 96);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -1947,6 +1339,43 @@ static void LimLaunchedRCTrackLeftBarrelRollUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 2, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 3, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 8, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 9, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 14, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 15, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 20, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 21, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 4, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 5, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 10, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 11, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 16, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 17, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 22, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 23, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -1967,82 +1396,48 @@ static void LimLaunchedRCTrackLeftBarrelRollUpToDown(
                         session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 6),
                         { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
                     PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 7),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    MetalASupportsPaintSetup(
-                        session, kSupportType, MetalSupportPlace::BottomCorner, 4, height + 1, session.SupportColours);
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 12),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 13),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    MetalASupportsPaintSetup(
-                        session, kSupportType, MetalSupportPlace::LeftCorner, 0, height + 1, session.SupportColours);
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 18),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 19),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    MetalASupportsPaintSetup(
-                        session, kSupportType, MetalSupportPlace::TopCorner, 0, height, session.SupportColours);
-                    break;
-            }
-            if (direction == 0 || direction == 3)
-            {
-                PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
-            }
-            PaintUtilSetSegmentSupportHeight(
-                session,
-                PaintUtilRotateSegments(
-                    EnumsToFlags(
-                        PaintSegment::rightCorner, PaintSegment::centre, PaintSegment::topRightSide,
-                        PaintSegment::bottomLeftSide, PaintSegment::bottomRightSide),
-                    direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 2),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 3),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 8),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 9),
+                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 7),
                         { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
+                    MetalASupportsPaintSetup(
+                        session, kSupportType, MetalSupportPlace::BottomCorner, 4, height + 1, session.SupportColours);
                     break;
                 case 2:
                     PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 14),
+                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 12),
                         { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
                     PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 15),
+                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 13),
                         { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
+                    MetalASupportsPaintSetup(
+                        session, kSupportType, MetalSupportPlace::LeftCorner, 0, height + 1, session.SupportColours);
                     break;
                 case 3:
                     PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 20),
+                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 18),
                         { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
                     PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 21),
+                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 19),
                         { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
+                    MetalASupportsPaintSetup(
+                        session, kSupportType, MetalSupportPlace::TopCorner, 0, height, session.SupportColours);
                     break;
             }
+            if (direction == 0 || direction == 3)
+            {
+                PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
+            }
+            PaintUtilSetSegmentSupportHeight(
+                session,
+                PaintUtilRotateSegments(
+                    EnumsToFlags(
+                        PaintSegment::rightCorner, PaintSegment::centre, PaintSegment::topRightSide,
+                        PaintSegment::bottomLeftSide, PaintSegment::bottomRightSide),
+                    direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+            break;
+        case 1:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2054,41 +1449,7 @@ static void LimLaunchedRCTrackLeftBarrelRollUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 4),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 5),
-                        { 0, 0, height }, { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 10),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 11),
-                        { 0, 0, height }, { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 16),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 17),
-                        { 0, 0, height }, { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 22),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 23),
-                        { 0, 0, height }, { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             switch (direction)
             {
                 case 1:
@@ -2115,6 +1476,43 @@ static void LimLaunchedRCTrackRightBarrelRollUpToDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 26, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 27, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 32, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 33, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 38, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 39, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 44, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 45, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 0 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 28, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 29, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 34, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 35, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 40, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 41, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 46, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 47, { 0, 0, 0 }, { { 0, 6, 44 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -2176,41 +1574,7 @@ static void LimLaunchedRCTrackRightBarrelRollUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 26),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 27),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 32),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 33),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 38),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 39),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 44),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 45),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2222,41 +1586,7 @@ static void LimLaunchedRCTrackRightBarrelRollUpToDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 28),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 29),
-                        { 0, 0, height }, { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 34),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 35),
-                        { 0, 0, height }, { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 40),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 41),
-                        { 0, 0, height }, { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 46),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_BARREL_ROLL + 47),
-                        { 0, 0, height }, { { 0, 6, height + 44 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             switch (direction)
             {
                 case 1:
@@ -2297,32 +1627,29 @@ static void LimLaunchedRCTrackHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 0, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 4, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 11 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 8, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 9 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 12, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 7 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 2, { 16, 0, 0 }, { { 16, 0, 0 }, { 2, 16, 119 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 6, { 12, 0, 0 }, { { 12, 0, 0 }, { 3, 16, 119 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 10, { 10, 16, 0 }, { { 10, 16, 0 }, { 4, 12, 119 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 14, { 16, 16, 0 }, { { 15, 6, 0 }, { 2, 16, 119 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 3, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 7, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 11, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 15, { 0, 16, 32 }, { { 0, 16, 32 }, { 32, 12, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 0),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 4),
-                        { 0, 6, height }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 8),
-                        { 0, 6, height }, { 32, 20, 9 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 12),
-                        { 0, 6, height }, { 32, 20, 7 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -2368,29 +1695,7 @@ static void LimLaunchedRCTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 2),
-                        { 16, 0, height }, { 2, 16, 119 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 6),
-                        { 12, 0, height }, { { 12, 0, height }, { 3, 16, 119 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 10),
-                        { 10, 16, height }, { 4, 12, 119 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 14),
-                        { 16, 16, height }, { { 15, 6, height }, { 2, 16, 119 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2402,29 +1707,7 @@ static void LimLaunchedRCTrackHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 168);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 3),
-                        { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 7),
-                        { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 11),
-                        { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_HALF_LOOP + 15),
-                        { 0, 16, height + 32 }, { 32, 12, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
@@ -2447,32 +1730,35 @@ static void LimLaunchedRCTrackFlatTo60DegUpLongBase(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 0, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 4, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 8, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 12, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 1, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 5, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 9, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 13, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 2, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 6, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 10, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 14, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 3, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 7, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 11, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 15, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 0),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 4),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 8),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 12),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -2486,29 +1772,7 @@ static void LimLaunchedRCTrackFlatTo60DegUpLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 1),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 5),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 9),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 13),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 9, height, session.SupportColours);
@@ -2518,29 +1782,7 @@ static void LimLaunchedRCTrackFlatTo60DegUpLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 2),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 6),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 10),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 14),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 10, height, session.SupportColours);
@@ -2550,29 +1792,7 @@ static void LimLaunchedRCTrackFlatTo60DegUpLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 3),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 7),
-                        { 0, 0, height }, { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 11),
-                        { 0, 0, height }, { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 15),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 19, height, session.SupportColours);
@@ -2596,32 +1816,35 @@ static void LimLaunchedRCTrack60DegUpToFlatLongBase(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 16),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 20),
-                        { 0, 0, height }, { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 24),
-                        { 0, 0, height }, { { 0, 27, height }, { 32, 1, 98 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 28),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 16, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 20, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 24, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 28, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 17, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 21, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 25, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 29, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 18, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 22, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 26, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 30, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 19, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 23, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 27, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 31, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
+    switch (trackSequence)
+    {
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 24, height, session.SupportColours);
@@ -2635,29 +1858,7 @@ static void LimLaunchedRCTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 80);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 17),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 21),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 25),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 29),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 18, height, session.SupportColours);
@@ -2667,29 +1868,7 @@ static void LimLaunchedRCTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 80);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 18),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 22),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 26),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 30),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 13, height, session.SupportColours);
@@ -2699,29 +1878,7 @@ static void LimLaunchedRCTrack60DegUpToFlatLongBase(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 19),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 23),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 27),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_FLAT_TO_STEEP + 31),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 5, height, session.SupportColours);
@@ -2760,32 +1917,29 @@ static void LimLaunchedRCTrackLeftLargeCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 0, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 5, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 10, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 15, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 2, { 0, 0, 0 }, { { 0, 31, 0 }, { 48, 1, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 7, { 0, 0, 0 }, { { 2, 2, 40 }, { 28, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 12, { 0, 0, 0 }, { { 2, 2, 48 }, { 28, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 17, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 4, { 0, 0, 0 }, { { 2, 2, 40 }, { 28, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 9, { 0, 0, 0 }, { { 2, 2, 40 }, { 28, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 14, { 0, 0, 0 }, { { 2, 2, 40 }, { 26, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 19, { 0, 0, 0 }, { { 2, 2, 40 }, { 26, 28, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 0),
-                        { 0, 0, height }, { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 5),
-                        { 0, 0, height }, { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 10),
-                        { 0, 0, height }, { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 15),
-                        { 0, 0, height }, { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
 
@@ -2846,29 +2000,7 @@ static void LimLaunchedRCTrackLeftLargeCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 2),
-                        { 0, 0, height }, { { 0, 31, height }, { 48, 1, 64 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 7),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 28, 28, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 12),
-                        { 0, 0, height }, { { 2, 2, height + 48 }, { 28, 28, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 17),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2926,29 +2058,7 @@ static void LimLaunchedRCTrackLeftLargeCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 4),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 28, 28, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 9),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 28, 28, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 14),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 26, 28, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 19),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 26, 28, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2976,32 +2086,29 @@ static void LimLaunchedRCTrackRightLargeCorkscrewUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 20, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 25, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 30, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 35, { 0, 0, 0 }, { { 0, 6, 4 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 22, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 27, { 0, 0, 0 }, { { 2, 2, 48 }, { 28, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 32, { 0, 0, 0 }, { { 2, 2, 48 }, { 28, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 37, { 0, 0, 0 }, { { 0, 31, 0 }, { 48, 1, 64 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 24, { 0, 0, 0 }, { { 2, 2, 40 }, { 26, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 29, { 0, 0, 0 }, { { 2, 2, 40 }, { 26, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 34, { 0, 0, 0 }, { { 2, 2, 40 }, { 28, 28, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 39, { 0, 0, 0 }, { { 2, 2, 40 }, { 28, 28, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 20),
-                        { 0, 0, height }, { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 25),
-                        { 0, 0, height }, { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 30),
-                        { 0, 0, height }, { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 35),
-                        { 0, 0, height }, { { 0, 6, height + 4 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
 
@@ -3062,29 +2169,7 @@ static void LimLaunchedRCTrackRightLargeCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 22),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 27),
-                        { 0, 0, height }, { { 2, 2, height + 48 }, { 28, 28, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 32),
-                        { 0, 0, height }, { { 2, 2, height + 48 }, { 28, 28, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 37),
-                        { 0, 0, height }, { { 0, 31, height }, { 48, 1, 64 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3141,29 +2226,7 @@ static void LimLaunchedRCTrackRightLargeCorkscrewUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 24),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 26, 28, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 29),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 26, 28, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 34),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 28, 28, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_CORKSCREW + 39),
-                        { 0, 0, height }, { { 2, 2, height + 40 }, { 28, 28, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3205,32 +2268,35 @@ static void LimLaunchedRCTrackLeftMediumHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 0, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 5, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 10, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 15, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 1, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 6, { 0, 0, 0 }, { { 0, 31, 0 }, { 0, 32, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 11, { 0, 0, 0 }, { { 0, 32, 0 }, { 40, 0, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 16, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 3, { 0, 0, 0 }, { { 0, 0, 0 }, { 0, 32, 160 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 8, { 0, 0, 0 }, { { 30, 0, 0 }, { 0, 32, 160 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 13, { 0, 0, 0 }, { { 29, 0, 0 }, { 1, 32, 160 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 18, { 0, 0, 0 }, { { 0, 0, 0 }, { 1, 32, 160 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 4, { 0, 0, 0 }, { { 0, 2, 48 }, { 32, 32, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 9, { 0, 0, 0 }, { { 0, 2, 48 }, { 32, 32, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 14, { 0, 0, 0 }, { { 0, 0, 48 }, { 32, 32, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 19, { 0, 0, 0 }, { { 0, 0, 48 }, { 32, 32, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 0),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 5),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 10),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 15),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
 
@@ -3243,29 +2309,7 @@ static void LimLaunchedRCTrackLeftMediumHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 1),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 6),
-                        { 0, 0, height }, { { 0, 31, height }, { 0, 32, 64 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 11),
-                        { 0, 0, height }, { { 0, 32, height }, { 40, 0, 64 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 16),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3320,29 +2364,7 @@ static void LimLaunchedRCTrackLeftMediumHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 144);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 3),
-                        { 0, 0, height }, { { 0, 0, height }, { 0, 32, 160 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 8),
-                        { 0, 0, height }, { { 30, 0, height }, { 0, 32, 160 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 13),
-                        { 0, 0, height }, { { 29, 0, height }, { 1, 32, 160 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 18),
-                        { 0, 0, height }, { { 0, 0, height }, { 1, 32, 160 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3354,29 +2376,7 @@ static void LimLaunchedRCTrackLeftMediumHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 144);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 4),
-                        { 0, 0, height }, { { 0, 2, height + 48 }, { 32, 32, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 9),
-                        { 0, 0, height }, { { 0, 2, height + 48 }, { 32, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 14),
-                        { 0, 0, height }, { { 0, 0, height + 48 }, { 32, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 19),
-                        { 0, 0, height }, { { 0, 0, height + 48 }, { 32, 32, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3397,35 +2397,38 @@ static void LimLaunchedRCTrackLeftMediumHalfLoopUp(
 }
 
 static void LimLaunchedRCTrackRightMediumHalfLoopUp(
-    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
-    const TrackElement& trackElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 20),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 25),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 30),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 35),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+    PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
+    const TrackElement& trackElement)
+{
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 20, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 25, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 30, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 35, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 21, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 26, { 0, 0, 0 }, { { 0, 32, 0 }, { 40, 0, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 31, { 0, 0, 0 }, { { 0, 31, 0 }, { 0, 32, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 36, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 23, { 0, 0, 0 }, { { -12, 0, 0 }, { 0, 32, 160 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 28, { 0, 0, 0 }, { { 29, 0, 0 }, { 0, 32, 160 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 33, { 0, 0, 0 }, { { 30, 0, 0 }, { 0, 32, 160 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 38, { 0, 0, 0 }, { { 2, 0, 0 }, { 1, 32, 160 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 24, { 0, 0, 0 }, { { 0, 0, 48 }, { 32, 32, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 29, { 0, 0, 0 }, { { 0, 0, 48 }, { 32, 32, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 34, { 0, 0, 0 }, { { 0, 0, 48 }, { 32, 32, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 39, { 0, 0, 0 }, { { 0, 0, 48 }, { 32, 32, 1 } } } },
+    };
+
+    switch (trackSequence)
+    {
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
 
@@ -3438,29 +2441,7 @@ static void LimLaunchedRCTrackRightMediumHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 21),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 26),
-                        { 0, 0, height }, { { 0, 32, height }, { 40, 0, 64 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 31),
-                        { 0, 0, height }, { { 0, 31, height }, { 0, 32, 64 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 36),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3515,29 +2496,7 @@ static void LimLaunchedRCTrackRightMediumHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 144);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 23),
-                        { 0, 0, height }, { { -12, 0, height }, { 0, 32, 160 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 28),
-                        { 0, 0, height }, { { 29, 0, height }, { 0, 32, 160 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 33),
-                        { 0, 0, height }, { { 30, 0, height }, { 0, 32, 160 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 38),
-                        { 0, 0, height }, { { 2, 0, height }, { 1, 32, 160 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3550,29 +2509,7 @@ static void LimLaunchedRCTrackRightMediumHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 144);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 24),
-                        { 0, 0, height }, { { 0, 0, height + 48 }, { 32, 32, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 29),
-                        { 0, 0, height }, { { 0, 0, height + 48 }, { 32, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 34),
-                        { 0, 0, height }, { { 0, 0, height + 48 }, { 32, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_MEDIUM_HALF_LOOP + 39),
-                        { 0, 0, height }, { { 0, 0, height + 48 }, { 32, 32, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3609,6 +2546,25 @@ static void LimLaunchedRCTrackLeftZeroGRollUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 2, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 6, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 9, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 13, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 3, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 7, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 1 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 10, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 11, { 0, 0, 0 }, { { 0, 6, 33 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 14, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 15, { 0, 0, 0 }, { { 0, 6, 33 }, { 32, 20, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -3659,29 +2615,7 @@ static void LimLaunchedRCTrackLeftZeroGRollUp(
             PaintUtilSetGeneralSupportHeight(session, height + 40);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 2),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 6),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 9),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 13),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3693,35 +2627,7 @@ static void LimLaunchedRCTrackLeftZeroGRollUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 3),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 7),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 10),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 11),
-                        { 0, 0, height }, { { 0, 6, height + 33 }, { 32, 20, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 14),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 15),
-                        { 0, 0, height }, { { 0, 6, height + 33 }, { 32, 20, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             switch (direction)
             {
                 case 1:
@@ -3749,6 +2655,25 @@ static void LimLaunchedRCTrackRightZeroGRollUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 17, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 21, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 26, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 30, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 18, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 19, { 0, 0, 0 }, { { 0, 6, 33 }, { 32, 20, 0 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 22, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 23, { 0, 0, 0 }, { { 0, 6, 33 }, { 32, 20, 0 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 27, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 1 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 31, { 0, 0, 0 }, { { 0, 6, 28 }, { 32, 20, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -3798,29 +2723,7 @@ static void LimLaunchedRCTrackRightZeroGRollUp(
             PaintUtilSetGeneralSupportHeight(session, height + 40);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 17),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 21),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 26),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 30),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3832,35 +2735,7 @@ static void LimLaunchedRCTrackRightZeroGRollUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 18),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 19),
-                        { 0, 0, height }, { { 0, 6, height + 33 }, { 32, 20, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 22),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 23),
-                        { 0, 0, height }, { { 0, 6, height + 33 }, { 32, 20, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 27),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_ZERO_G_ROLL + 31),
-                        { 0, 0, height }, { { 0, 6, height + 28 }, { 32, 20, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             switch (direction)
             {
                 case 1:
@@ -3902,35 +2777,38 @@ static void LimLaunchedRCTrackLeftLargeZeroGRollUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 0, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 5, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 96 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 9, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 10, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 96 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 15, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 1, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 2, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 96 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 6, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 11, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 0, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 16, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 3, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 7, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 48 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 12, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 0, 48 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 17, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 0, 32 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 18, { 0, 0, 0 }, { { 0, 6, 40 }, { 32, 20, 3 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 0),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 5),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 96 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 9),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 10),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 96 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 15),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 25, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -3941,63 +2819,13 @@ static void LimLaunchedRCTrackLeftLargeZeroGRollUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 1),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 2),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 96 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 6),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 64 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 11),
-                        { 0, 0, height }, { { 0, 2, height }, { 32, 0, 64 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 16),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 3),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 64 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 7),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 48 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 12),
-                        { 0, 0, height }, { { 0, 2, height }, { 32, 0, 48 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 17),
-                        { 0, 0, height }, { { 0, 2, height }, { 32, 0, 32 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 18),
-                        { 0, 0, height }, { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4069,102 +2897,55 @@ static void LimLaunchedRCTrackRightLargeZeroGRollUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 20),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 25),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 26),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 96 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 31),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 96 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 35),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
-            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 25, height, session.SupportColours);
-            if (direction == 0 || direction == 3)
-            {
-                PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::StandardSlopeStart);
-            }
-            PaintUtilSetSegmentSupportHeight(
-                session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 88);
-            break;
-        case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 21),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 27),
-                        { 0, 0, height }, { { 0, 2, height }, { 32, 0, 64 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 32),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 64 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 36),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 37),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 96 } });
-                    break;
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 20, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 25, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 26, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 96 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 31, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 96 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 35, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 21, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 27, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 0, 64 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 32, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 64 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 36, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 37, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 96 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 22, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 0, 32 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 23, { 0, 0, 0 }, { { 0, 6, 40 }, { 32, 20, 3 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 28, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 0, 48 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 33, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 48 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 38, { 0, 0, 0 }, { { 0, 30, 0 }, { 32, 0, 64 } } } },
+    };
+
+    switch (trackSequence)
+    {
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
+            MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 25, height, session.SupportColours);
+            if (direction == 0 || direction == 3)
+            {
+                PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::StandardSlopeStart);
             }
+            PaintUtilSetSegmentSupportHeight(
+                session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 88);
+            break;
+        case 1:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 22),
-                        { 0, 0, height }, { { 0, 2, height }, { 32, 0, 32 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 23),
-                        { 0, 0, height }, { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 28),
-                        { 0, 0, height }, { { 0, 2, height }, { 32, 0, 48 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 33),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 48 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_ZERO_G_ROLL + 38),
-                        { 0, 0, height }, { { 0, 30, height }, { 32, 0, 64 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4251,35 +3032,26 @@ static void LimLaunchedRCTrackLeftBankToLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 0, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 2, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 3, { 0, 6, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 5, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 7, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 1, { 6, 0, 0 }, { { 0, 6, -6 }, { 20, 32, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 4, { 6, 0, 0 }, { { 0, 6, -6 }, { 20, 32, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 6, { 6, 0, 0 }, { { 0, 6, -6 }, { 20, 32, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 8, { 6, 0, 0 }, { { 0, 6, -6 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 0),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 2),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 3),
-                        { 0, 6, height }, { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 5),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 7),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4302,29 +3074,7 @@ static void LimLaunchedRCTrackLeftBankToLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 1),
-                        { 6, 0, height }, { { 0, 6, height - 6 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 4),
-                        { 6, 0, height }, { { 0, 6, height - 6 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 6),
-                        { 6, 0, height }, { { 0, 6, height - 6 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 8),
-                        { 6, 0, height }, { { 0, 6, height - 6 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height - 6, session.SupportColours);
             switch (direction)
             {
@@ -4352,35 +3102,26 @@ static void LimLaunchedRCTrackRightBankToRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 9, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 11, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 13, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 14, { 0, 6, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 16, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 10, { 6, 0, 0 }, { { 0, 6, -6 }, { 20, 32, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 12, { 6, 0, 0 }, { { 0, 6, -6 }, { 20, 32, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 15, { 6, 0, 0 }, { { 0, 6, -6 }, { 20, 32, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 17, { 6, 0, 0 }, { { 0, 6, -6 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 9),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 11),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 13),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 14),
-                        { 0, 6, height }, { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 16),
-                        { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4403,29 +3144,7 @@ static void LimLaunchedRCTrackRightBankToRightQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 10),
-                        { 6, 0, height }, { { 0, 6, height - 6 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 12),
-                        { 6, 0, height }, { { 0, 6, height - 6 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 15),
-                        { 6, 0, height }, { { 0, 6, height - 6 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 17),
-                        { 6, 0, height }, { { 0, 6, height - 6 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height - 6, session.SupportColours);
             switch (direction)
             {
@@ -4453,32 +3172,26 @@ static void LimLaunchedRCTrackLeftQuarterTurn325DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 12, { 0, 6, 0 }, { { 0, 6, -6 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 15, { 0, 6, 0 }, { { 0, 6, -6 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 17, { 0, 6, 0 }, { { 0, 6, -6 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 10, { 0, 6, 0 }, { { 0, 6, -6 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 11, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 13, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 14, { 6, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 16, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 9, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 12),
-                        { 0, 6, height }, { { 0, 6, height - 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 15),
-                        { 0, 6, height }, { { 0, 6, height - 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 17),
-                        { 0, 6, height }, { { 0, 6, height - 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 10),
-                        { 0, 6, height }, { { 0, 6, height - 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height - 6, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4501,32 +3214,7 @@ static void LimLaunchedRCTrackLeftQuarterTurn325DegDownToLeftBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 11),
-                        { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 13),
-                        { 6, 0, height }, { 20, 32, 3 });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 14),
-                        { 6, 0, height }, { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 16),
-                        { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 9),
-                        { 6, 0, height }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
             switch (direction)
             {
@@ -4554,32 +3242,26 @@ static void LimLaunchedRCTrackRightQuarterTurn325DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 8, { 0, 6, 0 }, { { 0, 6, -6 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 1, { 0, 6, 0 }, { { 0, 6, -6 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 4, { 0, 6, 0 }, { { 0, 6, -6 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 6, { 0, 6, 0 }, { { 0, 6, -6 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 7, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 0, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 2, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 3, { 6, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 5, { 6, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 8),
-                        { 0, 6, height }, { { 0, 6, height - 6 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 1),
-                        { 0, 6, height }, { { 0, 6, height - 6 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 4),
-                        { 0, 6, height }, { { 0, 6, height - 6 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 6),
-                        { 0, 6, height }, { { 0, 6, height - 6 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height - 6, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4602,32 +3284,7 @@ static void LimLaunchedRCTrackRightQuarterTurn325DegDownToRightBank(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 7),
-                        { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 0),
-                        { 6, 0, height }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 2),
-                        { 6, 0, height }, { 20, 32, 3 });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 3),
-                        { 6, 0, height }, { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_TURN_BANK_TRANSITION + 5),
-                        { 6, 0, height }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
             switch (direction)
             {
@@ -4655,32 +3312,41 @@ static void LimLaunchedRCTrackLeftLargeHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 0, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 7, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 14, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 21, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 2, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 9, { 0, 0, 0 }, { { 0, 0, 70 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 16, { 0, 0, 0 }, { { 0, 16, 70 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 23, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 4, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 11, { 0, 0, 0 }, { { 0, 16, 110 }, { 16, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 18, { 0, 0, 0 }, { { 0, 0, 100 }, { 16, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 25, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 5, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 12, { 0, 0, 0 }, { { 0, 16, 200 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 19, { 0, 0, 0 }, { { 0, 0, 200 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 26, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 6, { 0, 0, 0 }, { { 0, 16, 32 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 13, { 0, 0, 0 }, { { 0, 16, 32 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 20, { 0, 0, 0 }, { { 0, 0, 32 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 27, { 0, 0, 0 }, { { 0, 0, 32 }, { 32, 16, 0 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 0),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 7),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 14),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 21),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4727,29 +3393,7 @@ static void LimLaunchedRCTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 2),
-                        { 0, 0, height }, { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 9),
-                        { 0, 0, height }, { { 0, 0, height + 70 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 16),
-                        { 0, 0, height }, { { 0, 16, height + 70 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 23),
-                        { 0, 0, height }, { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4803,63 +3447,19 @@ static void LimLaunchedRCTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 4),
-                        { 0, 0, height }, { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 11),
-                        { 0, 0, height }, { { 0, 16, height + 110 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 18),
-                        { 0, 0, height }, { { 0, 0, height + 100 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 25),
-                        { 0, 0, height }, { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
                     EnumsToFlags(
                         PaintSegment::bottomCorner, PaintSegment::centre, PaintSegment::bottomLeftSide,
-                        PaintSegment::bottomRightSide),
-                    direction),
-                0xFFFF, 0);
-            PaintUtilSetGeneralSupportHeight(session, height + 128);
-            break;
-        case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 5),
-                        { 0, 0, height }, { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 12),
-                        { 0, 0, height }, { { 0, 16, height + 200 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 19),
-                        { 0, 0, height }, { { 0, 0, height + 200 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 26),
-                        { 0, 0, height }, { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+                        PaintSegment::bottomRightSide),
+                    direction),
+                0xFFFF, 0);
+            PaintUtilSetGeneralSupportHeight(session, height + 128);
+            break;
+        case 5:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4871,29 +3471,7 @@ static void LimLaunchedRCTrackLeftLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 6),
-                        { 0, 0, height }, { { 0, 16, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 13),
-                        { 0, 0, height }, { { 0, 16, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 20),
-                        { 0, 0, height }, { { 0, 0, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 27),
-                        { 0, 0, height }, { { 0, 0, height + 32 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
@@ -4915,32 +3493,41 @@ static void LimLaunchedRCTrackRightLargeHalfLoopUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 28, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 35, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 42, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 49, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 30, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 37, { 0, 0, 0 }, { { 0, 16, 70 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 44, { 0, 0, 0 }, { { 0, 0, 70 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 51, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 32, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 39, { 0, 0, 0 }, { { 0, 0, 100 }, { 16, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 46, { 0, 0, 0 }, { { 0, 16, 110 }, { 16, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 53, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 33, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 40, { 0, 0, 0 }, { { 0, 0, 200 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 47, { 0, 0, 0 }, { { 0, 16, 200 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 54, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 34, { 0, 0, 0 }, { { 0, 0, 32 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 41, { 0, 0, 0 }, { { 0, 0, 32 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 48, { 0, 0, 0 }, { { 0, 16, 32 }, { 32, 16, 0 } } } },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 55, { 0, 0, 0 }, { { 0, 16, 32 }, { 32, 16, 0 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 28),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 35),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 42),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 49),
-                        { 0, 0, height }, { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4987,29 +3574,7 @@ static void LimLaunchedRCTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 30),
-                        { 0, 0, height }, { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 37),
-                        { 0, 0, height }, { { 0, 16, height + 70 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 44),
-                        { 0, 0, height }, { { 0, 0, height + 70 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 51),
-                        { 0, 0, height }, { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5063,29 +3628,7 @@ static void LimLaunchedRCTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 32),
-                        { 0, 0, height }, { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 39),
-                        { 0, 0, height }, { { 0, 0, height + 100 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 46),
-                        { 0, 0, height }, { { 0, 16, height + 110 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 53),
-                        { 0, 0, height }, { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5097,29 +3640,7 @@ static void LimLaunchedRCTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 128);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 33),
-                        { 0, 0, height }, { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 40),
-                        { 0, 0, height }, { { 0, 0, height + 200 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 47),
-                        { 0, 0, height }, { { 0, 16, height + 200 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 54),
-                        { 0, 0, height }, { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5131,29 +3652,7 @@ static void LimLaunchedRCTrackRightLargeHalfLoopUp(
             PaintUtilSetGeneralSupportHeight(session, height + 224);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 34),
-                        { 0, 0, height }, { { 0, 0, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 41),
-                        { 0, 0, height }, { { 0, 0, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 48),
-                        { 0, 0, height }, { { 0, 16, height + 32 }, { 32, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_LARGE_HALF_LOOP + 55),
-                        { 0, 0, height }, { { 0, 16, height + 32 }, { 32, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             if (direction == 0 || direction == 3)
             {
                 PaintUtilPushTunnelRotated(session, direction, height, TunnelType::StandardFlat);
@@ -5238,35 +3737,20 @@ static void LimLaunchedRCTrack60DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 6),
-                { 0, 0, height }, { { 0, 2, height }, { 32, 27, 4 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 7),
-                { 0, 0, height }, { { 0, 4, height }, { 32, 2, 43 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 8),
-                { 0, 0, height }, { { 29, 4, height + 2 }, { 1, 24, 43 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 10),
-                { 0, 0, height }, { { 29, 4, height + 2 }, { 1, 24, 43 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 9),
-                { 0, 0, height }, { { 0, 4, height }, { 32, 2, 43 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 11),
-                { 0, 0, height }, { { 0, 2, height }, { 32, 27, 4 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 6, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 7, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 8, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+        },
+        {
+            { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 10, { 0, 0, 0 }, { { 29, 4, 2 }, { 1, 24, 43 } } },
+            { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 9, { 0, 0, 0 }, { { 0, 4, 0 }, { 32, 2, 43 } } },
+        },
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 11, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 4 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 16, height, session.SupportColours);
     if (direction == 0 || direction == 3)
     {
@@ -5298,17 +3782,29 @@ static void LimLaunchedRCTrackDiagFlatTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 15, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 12, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 14, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 15),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5320,14 +3816,7 @@ static void LimLaunchedRCTrackDiagFlatTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 12),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5338,14 +3827,7 @@ static void LimLaunchedRCTrackDiagFlatTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 14),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5396,17 +3878,29 @@ static void LimLaunchedRCTrackDiag60DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 19, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 16, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 18, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 19),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5418,14 +3912,7 @@ static void LimLaunchedRCTrackDiag60DegUpToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 16),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5436,14 +3923,7 @@ static void LimLaunchedRCTrackDiag60DegUpToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 18),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5494,17 +3974,29 @@ static void LimLaunchedRCTrackDiagFlatTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 17, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 18, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 16, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 17),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5516,14 +4008,7 @@ static void LimLaunchedRCTrackDiagFlatTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 18),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5534,14 +4019,7 @@ static void LimLaunchedRCTrackDiagFlatTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 16),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5592,17 +4070,29 @@ static void LimLaunchedRCTrackDiag60DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 13, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 14, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 12, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 4 } } } },
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 13),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5614,14 +4104,7 @@ static void LimLaunchedRCTrackDiag60DegDownToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 14),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5632,14 +4115,7 @@ static void LimLaunchedRCTrackDiag60DegDownToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_G2_LIM_LAUNCHED_TRACK_SMALL_FLAT_TO_STEEP + 12),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 4 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5690,27 +4166,26 @@ static void LimLaunchedRCTrackBooster(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15012), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15014), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15013), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 3 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(15015), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 26 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 15012, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15014, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 15013, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15015, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 15012, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15014, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 15013, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15015, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
     {
         MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -169,57 +169,26 @@ static void MineTrainRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 20102, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20103, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20104, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20105, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 20074, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20075, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20076, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20077, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20102), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20103), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20104), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20105), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20074), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20075), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20076), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20077), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     WoodenASupportsPaintSetupRotated(
@@ -288,57 +257,26 @@ static void MineTrainRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 20094, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20095, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20096, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20097, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 20066, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20067, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20068, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20069, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20094), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20095), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20096), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20097), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20066), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20067), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20068), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20069), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     WoodenASupportsPaintSetupRotated(
@@ -464,57 +402,26 @@ static void MineTrainRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 20098, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20099, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20100, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20101, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 20070, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20071, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20072, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20073, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20098), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20099), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20100), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20101), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20070), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20071), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20072), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(20073), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     WoodenASupportsPaintSetupRotated(
@@ -1253,35 +1160,20 @@ static void MineTrainRCTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20118), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20122), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20119), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20123), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20120), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20121), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 20118, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } },
+            { 20122, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 20119, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } },
+            { 20123, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 20120, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20121, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     WoodenASupportsPaintSetupRotated(
         session, kSupportType, WoodenSupportSubType::NeSw, direction, height, session.SupportColours,
@@ -1304,35 +1196,20 @@ static void MineTrainRCTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20124), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20125), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20126), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20128), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20127), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20129), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 20124, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20125, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        {
+            { 20126, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } },
+            { 20128, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 20127, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } },
+            { 20129, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     WoodenASupportsPaintSetupRotated(
         session, kSupportType, WoodenSupportSubType::NeSw, direction, height, session.SupportColours,
@@ -1355,35 +1232,20 @@ static void MineTrainRCTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20130), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20134), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20131), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20135), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20132), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20133), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 20130, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } },
+            { 20134, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 20131, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } },
+            { 20135, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 20132, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20133, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     WoodenASupportsPaintSetupRotated(
         session, kSupportType, WoodenSupportSubType::NeSw, direction, height, session.SupportColours,
@@ -1406,35 +1268,20 @@ static void MineTrainRCTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20136), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20137), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20138), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20140), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20139), { 0, 0, height },
-                { { 0, 6, height }, { 32, 20, 1 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(20141), { 0, 0, height },
-                { { 0, 27, height }, { 32, 1, 34 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 20136, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        { { 20137, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } } },
+        {
+            { 20138, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } },
+            { 20140, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 20139, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 1 } } },
+            { 20141, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     WoodenASupportsPaintSetupRotated(
         session, kSupportType, WoodenSupportSubType::NeSw, direction, height, session.SupportColours,
@@ -1534,32 +1381,17 @@ static void MineTrainRCTrackLeftQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 20250, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 1 } } } },
+        { { 20255, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 1 } } } },
+        { { 20260, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 1 } } } },
+        { { 20265, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20250), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20255), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20260), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20265), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             WoodenASupportsPaintSetupRotated(
                 session, kSupportType, WoodenSupportSubType::NeSw, direction, height, session.SupportColours,
@@ -1773,32 +1605,17 @@ static void MineTrainRCTrackRightQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 20230, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 1 } } } },
+        { { 20235, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 1 } } } },
+        { { 20240, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 1 } } } },
+        { { 20245, { 0, 0, 0 }, { { 0, 2, 0 }, { 32, 27, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20230), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20235), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20240), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20245), { 0, 0, height },
-                        { { 0, 2, height }, { 32, 27, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             WoodenASupportsPaintSetupRotated(
                 session, kSupportType, WoodenSupportSubType::NeSw, direction, height, session.SupportColours,
@@ -2374,6 +2191,13 @@ static void MineTrainRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 20192, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20195, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20198, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20189, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -2422,28 +2246,7 @@ static void MineTrainRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20192), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20195), { 0, 0, height }, { 16, 16, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20198), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20189), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2515,6 +2318,13 @@ static void MineTrainRCTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 20204, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20207, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 20210, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20201, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -2566,29 +2376,7 @@ static void MineTrainRCTrackLeftQuarterTurn3Bank(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20204), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20207), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20210), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20201), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2885,6 +2673,19 @@ static void MineTrainRCTrackLeftHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 20304, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20307, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 20310, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20301, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 20301, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20304, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20307, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 20310, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -2951,29 +2752,7 @@ static void MineTrainRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20304), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20307), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20310), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20301), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3114,29 +2893,7 @@ static void MineTrainRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20301), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20304), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20307), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20310), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3212,6 +2969,19 @@ static void MineTrainRCTrackRightHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 20287, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20290, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20293, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 20296, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 20290, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20293, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 20296, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20287, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -3278,29 +3048,7 @@ static void MineTrainRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20287), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20290), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20293), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20296), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3442,29 +3190,7 @@ static void MineTrainRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20290), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20293), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20296), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20287), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4771,6 +4497,13 @@ static void MineTrainRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 20455, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20459, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 18, 1 } } } },
+        { { 20463, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20467, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -4890,29 +4623,7 @@ static void MineTrainRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20455), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20459), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 18, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20463), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20467), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
@@ -4924,6 +4635,13 @@ static void MineTrainRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 20439, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20443, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20447, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 18, 1 } } } },
+        { { 20451, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -5043,29 +4761,7 @@ static void MineTrainRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20439), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20443), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20447), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 18, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20451), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
@@ -5095,6 +4791,13 @@ static void MineTrainRCTrackLeftEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 20487, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+        { { 20491, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 18, 0 } } } },
+        { { 20495, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20499, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -5214,29 +4917,7 @@ static void MineTrainRCTrackLeftEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20487), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20491), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 18, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20495), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20499), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
@@ -5248,6 +4929,13 @@ static void MineTrainRCTrackRightEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 20471, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20475, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 1 } } } },
+        { { 20479, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 18, 0 } } } },
+        { { 20483, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -5367,29 +5055,7 @@ static void MineTrainRCTrackRightEighthBankToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20471), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20475), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20479), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 18, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20483), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
@@ -5732,17 +5398,17 @@ static void MineTrainRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 20381, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20381), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
@@ -6668,17 +6334,17 @@ static void MineTrainRCTrackDiag25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 20424, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20424), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 56);
             break;
@@ -6732,17 +6398,17 @@ static void MineTrainRCTrackDiagLeftBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 20422, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(20422), { -16, -16, height },
-                        { { -16, -16, height }, { 32, 32, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             break;
         case 1:
             if (direction == 0)
@@ -35,37 +35,26 @@ static void MiniSuspendedRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 28433, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28434, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28433, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28434, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 28383, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28384, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28383, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28384, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28433), { 0, 6, height + 24 }, { 32, 20, 1 });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28434), { 0, 6, height + 24 }, { 32, 20, 1 });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28383), { 0, 6, height + 24 }, { 32, 20, 1 });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28384), { 0, 6, height + 24 }, { 32, 20, 1 });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -122,57 +111,26 @@ static void MiniSuspendedRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 28435, { 0, 6, 24 }, { { 0, 6, 40 }, { 32, 20, 1 } } } },
+        { { 28441, { 0, 6, 24 }, { { 0, 6, 40 }, { 32, 20, 1 } } } },
+        { { 28437, { 0, 6, 24 }, { { 0, 6, 40 }, { 32, 20, 1 } } } },
+        { { 28442, { 0, 6, 24 }, { { 0, 6, 40 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 28385, { 0, 6, 24 }, { { 0, 6, 40 }, { 32, 20, 1 } } } },
+        { { 28391, { 0, 6, 24 }, { { 0, 6, 40 }, { 32, 20, 1 } } } },
+        { { 28387, { 0, 6, 24 }, { { 0, 6, 40 }, { 32, 20, 1 } } } },
+        { { 28392, { 0, 6, 24 }, { { 0, 6, 40 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28435), { 0, 6, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28441), { 0, 6, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28437), { 0, 6, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28442), { 0, 6, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28385), { 0, 6, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28391), { 0, 6, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28387), { 0, 6, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28392), { 0, 6, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -216,57 +174,26 @@ static void MiniSuspendedRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 28436, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28443, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28438, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28444, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 28386, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28393, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28388, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28394, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28436), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28443), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28438), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28444), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28386), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28393), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28388), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28394), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -310,57 +237,26 @@ static void MiniSuspendedRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 28440, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28446, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28439, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28445, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 28390, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28396, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28389, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+        { { 28395, { 0, 6, 24 }, { { 0, 6, 32 }, { 32, 20, 1 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28440), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28446), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28439), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28445), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28390), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28396), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28389), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(28395), { 0, 6, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -428,28 +324,41 @@ static void MiniSuspendedRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 28406, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28411, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28416, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28401, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 28405, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 1 } } } },
+        { { 28410, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 1 } } } },
+        { { 28415, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 1 } } } },
+        { { 28400, { 0, 16, 24 }, { { 0, 16, 24 }, { 32, 16, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 28404, { 0, 16, 24 }, { { 0, 16, 24 }, { 16, 16, 1 } } } },
+        { { 28409, { 16, 16, 24 }, { { 16, 16, 24 }, { 16, 16, 1 } } } },
+        { { 28414, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 1 } } } },
+        { { 28399, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 28403, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 1 } } } },
+        { { 28408, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 1 } } } },
+        { { 28413, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 1 } } } },
+        { { 28398, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 28402, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 1 } } } },
+        { { 28407, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 1 } } } },
+        { { 28412, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 1 } } } },
+        { { 28397, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28406), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28411), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28416), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28401), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -483,25 +392,7 @@ static void MiniSuspendedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28405), { 0, 0, height + 24 }, { 32, 16, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28410), { 0, 0, height + 24 }, { 32, 16, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28415), { 0, 16, height + 24 }, { 32, 16, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28400), { 0, 16, height + 24 }, { 32, 16, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -513,25 +404,7 @@ static void MiniSuspendedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28404), { 0, 16, height + 24 }, { 16, 16, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28409), { 16, 16, height + 24 }, { 16, 16, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28414), { 16, 0, height + 24 }, { 16, 16, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28399), { 0, 0, height + 24 }, { 16, 16, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -546,25 +419,7 @@ static void MiniSuspendedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28403), { 16, 0, height + 24 }, { 16, 32, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28408), { 0, 0, height + 24 }, { 16, 32, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28413), { 0, 0, height + 24 }, { 16, 32, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28398), { 16, 0, height + 24 }, { 16, 32, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -576,25 +431,7 @@ static void MiniSuspendedRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28402), { 6, 0, height + 24 }, { 20, 32, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28407), { 6, 0, height + 24 }, { 20, 32, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28412), { 6, 0, height + 24 }, { 20, 32, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28397), { 6, 0, height + 24 }, { 20, 32, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -646,28 +483,35 @@ static void MiniSuspendedRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 28421, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28428, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28424, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28425, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28422, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 26, 1 } } } },
+        { { 28427, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 26, 1 } } } },
+        { { 28423, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 26, 1 } } } },
+        { { 28426, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 26, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 28423, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 26, 1 } } } },
+        { { 28426, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 26, 1 } } } },
+        { { 28422, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 26, 1 } } } },
+        { { 28427, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 26, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 28424, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28425, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28421, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28428, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28421), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28428), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28424), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28425), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -698,25 +542,7 @@ static void MiniSuspendedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28422), { 0, 0, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28427), { 0, 0, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28423), { 0, 6, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28426), { 0, 6, height + 24 }, { 32, 26, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -742,25 +568,7 @@ static void MiniSuspendedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28423), { 0, 6, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28426), { 0, 6, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28422), { 0, 0, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28427), { 0, 0, height + 24 }, { 32, 26, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -786,25 +594,7 @@ static void MiniSuspendedRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28424), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28425), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28421), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28428), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -847,28 +637,35 @@ static void MiniSuspendedRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 28417, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28432, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28420, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28429, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28418, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 26, 1 } } } },
+        { { 28431, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 26, 1 } } } },
+        { { 28419, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 26, 1 } } } },
+        { { 28430, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 26, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 28419, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 26, 1 } } } },
+        { { 28430, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 26, 1 } } } },
+        { { 28418, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 26, 1 } } } },
+        { { 28431, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 26, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 28420, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28429, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28417, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28432, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28417), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28432), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28420), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28429), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -899,25 +696,7 @@ static void MiniSuspendedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28418), { 0, 6, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28431), { 0, 6, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28419), { 0, 0, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28430), { 0, 0, height + 24 }, { 32, 26, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -943,25 +722,7 @@ static void MiniSuspendedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28419), { 0, 0, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28430), { 0, 0, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28418), { 0, 6, height + 24 }, { 32, 26, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28431), { 0, 6, height + 24 }, { 32, 26, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -987,25 +748,7 @@ static void MiniSuspendedRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28420), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28429), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28417), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28432), { 0, 6, height + 24 }, { 32, 20, 1 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1048,28 +791,29 @@ static void MiniSuspendedRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 28452, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 28455, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 28458, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 28449, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 28451, { 16, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 28454, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+        { { 28457, { 0, 16, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+        { { 28448, { 16, 16, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 28450, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 28453, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 28456, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 28447, { 6, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28452), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28455), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28458), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28449), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1103,25 +847,7 @@ static void MiniSuspendedRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28451), { 16, 0, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28454), { 0, 0, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28457), { 0, 16, height + 24 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28448), { 16, 16, height + 24 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1133,25 +859,7 @@ static void MiniSuspendedRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28450), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28453), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28456), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28447), { 6, 0, height + 24 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1203,32 +911,35 @@ static void MiniSuspendedRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 28475, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28479, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28483, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28487, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28476, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 1 } } } },
+        { { 28480, { 0, 0, 24 }, { { 0, 0, 24 }, { 34, 16, 1 } } } },
+        { { 28484, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 1 } } } },
+        { { 28488, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 28477, { 0, 0, 24 }, { { 0, 16, 24 }, { 16, 16, 1 } } } },
+        { { 28481, { 0, 0, 24 }, { { 16, 16, 24 }, { 16, 16, 1 } } } },
+        { { 28485, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 1 } } } },
+        { { 28489, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 28478, { 0, 0, 24 }, { { 16, 16, 24 }, { 16, 16, 1 } } } },
+        { { 28482, { 0, 0, 24 }, { { 0, 16, 24 }, { 16, 18, 1 } } } },
+        { { 28486, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 1 } } } },
+        { { 28490, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28475), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28479), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28483), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28487), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1259,29 +970,7 @@ static void MiniSuspendedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28476), { 0, 0, height + 24 },
-                        { { 0, 0, height + 24 }, { 32, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28480), { 0, 0, height + 24 },
-                        { { 0, 0, height + 24 }, { 34, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28484), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28488), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 32, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1293,29 +982,7 @@ static void MiniSuspendedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28477), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28481), { 0, 0, height + 24 },
-                        { { 16, 16, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28485), { 0, 0, height + 24 },
-                        { { 16, 0, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28489), { 0, 0, height + 24 },
-                        { { 0, 0, height + 24 }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1338,29 +1005,7 @@ static void MiniSuspendedRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28478), { 0, 0, height + 24 },
-                        { { 16, 16, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28482), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 16, 18, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28486), { 0, 0, height + 24 },
-                        { { 0, 0, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28490), { 0, 0, height + 24 },
-                        { { 16, 0, height + 24 }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1402,32 +1047,35 @@ static void MiniSuspendedRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 28459, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28463, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28467, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+        { { 28471, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28460, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 1 } } } },
+        { { 28464, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 1 } } } },
+        { { 28468, { 0, 0, 24 }, { { 0, 0, 24 }, { 34, 16, 1 } } } },
+        { { 28472, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 28461, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 1 } } } },
+        { { 28465, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 1 } } } },
+        { { 28469, { 0, 0, 24 }, { { 4, 2, 24 }, { 28, 28, 1 } } } },
+        { { 28473, { 0, 0, 24 }, { { 0, 16, 24 }, { 16, 16, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 28462, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 1 } } } },
+        { { 28466, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 1 } } } },
+        { { 28470, { 0, 0, 24 }, { { 0, 16, 24 }, { 16, 18, 1 } } } },
+        { { 28474, { 0, 0, 24 }, { { 16, 16, 24 }, { 16, 16, 1 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28459), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28463), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28467), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28471), { 0, 0, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1458,29 +1106,7 @@ static void MiniSuspendedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28460), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 32, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28464), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28468), { 0, 0, height + 24 },
-                        { { 0, 0, height + 24 }, { 34, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28472), { 0, 0, height + 24 },
-                        { { 0, 0, height + 24 }, { 32, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1492,29 +1118,7 @@ static void MiniSuspendedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28461), { 0, 0, height + 24 },
-                        { { 0, 0, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28465), { 0, 0, height + 24 },
-                        { { 16, 0, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28469), { 0, 0, height + 24 },
-                        { { 4, 2, height + 24 }, { 28, 28, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28473), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1537,29 +1141,7 @@ static void MiniSuspendedRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28462), { 0, 0, height + 24 },
-                        { { 16, 0, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28466), { 0, 0, height + 24 },
-                        { { 0, 0, height + 24 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28470), { 0, 0, height + 24 },
-                        { { 0, 16, height + 24 }, { 16, 18, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(28474), { 0, 0, height + 24 },
-                        { { 16, 16, height + 24 }, { 16, 16, 1 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1638,30 +1220,65 @@ static void MiniSuspendedRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 28522, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 28506, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 28519, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28503, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 28521, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 28505, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 28520, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 28504, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28522), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28506), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1676,25 +1293,11 @@ static void MiniSuspendedRCTrackDiag25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28519), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28503), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1708,25 +1311,11 @@ static void MiniSuspendedRCTrackDiag25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28521), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28505), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1741,25 +1330,11 @@ static void MiniSuspendedRCTrackDiag25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28520), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28504), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -1802,30 +1377,65 @@ static void MiniSuspendedRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 28514, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 28498, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 28511, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28495, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 28513, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 28497, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 28512, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 28496, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28514), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28498), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1840,25 +1450,11 @@ static void MiniSuspendedRCTrackDiagFlatTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28511), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28495), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1872,25 +1468,11 @@ static void MiniSuspendedRCTrackDiagFlatTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28513), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28497), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1905,25 +1487,11 @@ static void MiniSuspendedRCTrackDiagFlatTo25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28512), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28496), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -1966,30 +1534,65 @@ static void MiniSuspendedRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 28518, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 28502, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 28515, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28499, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 28517, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 28501, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 28516, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 28500, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28518), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28502), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2004,25 +1607,11 @@ static void MiniSuspendedRCTrackDiag25DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28515), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28499), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2036,25 +1625,11 @@ static void MiniSuspendedRCTrackDiag25DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28517), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28501), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2069,25 +1644,11 @@ static void MiniSuspendedRCTrackDiag25DegUpToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28516), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28500), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -2130,30 +1691,65 @@ static void MiniSuspendedRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 28520, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 28504, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 28521, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28505, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 28519, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 28503, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 28522, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 28506, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28520), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28504), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2168,25 +1764,11 @@ static void MiniSuspendedRCTrackDiag25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28521), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28505), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2200,25 +1782,11 @@ static void MiniSuspendedRCTrackDiag25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28519), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28503), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2233,25 +1801,11 @@ static void MiniSuspendedRCTrackDiag25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28522), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28506), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -2294,30 +1848,65 @@ static void MiniSuspendedRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 28516, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 28500, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 28517, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28501, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 28515, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 28499, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 28518, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 28502, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28516), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28500), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2331,25 +1920,11 @@ static void MiniSuspendedRCTrackDiagFlatTo25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28517), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28501), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2362,25 +1937,11 @@ static void MiniSuspendedRCTrackDiagFlatTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28515), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28499), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2394,25 +1955,11 @@ static void MiniSuspendedRCTrackDiagFlatTo25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28518), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28502), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -2455,30 +2002,65 @@ static void MiniSuspendedRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 28512, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 28496, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 28513, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 28497, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 28511, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 28495, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 28514, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 28498, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 1 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28512), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28496), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2493,25 +2075,11 @@ static void MiniSuspendedRCTrackDiag25DegDownToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28513), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28497), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2525,25 +2093,11 @@ static void MiniSuspendedRCTrackDiag25DegDownToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28511), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28495), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2558,25 +2112,11 @@ static void MiniSuspendedRCTrackDiag25DegDownToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28514), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(28498), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 1 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
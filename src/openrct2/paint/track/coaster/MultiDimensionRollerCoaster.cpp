@@ -91,25 +91,30 @@ static void MultiDimensionRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 15808, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15809, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15808, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15809, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15806, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15807, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15806, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15807, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26227, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26228, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26227, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+        { { 26228, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 1 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15808), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15809), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -117,21 +122,7 @@ static void MultiDimensionRCTrackFlat(
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15806), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15807), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -143,21 +134,7 @@ static void MultiDimensionRCTrackFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26227), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26228), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 1 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -234,33 +211,30 @@ static void MultiDimensionRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 15908, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15909, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15910, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15911, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15880, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15881, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15882, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15883, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26253, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26254, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26255, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 26256, { 0, 0, 24 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15908), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15909), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15910), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15911), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -268,29 +242,7 @@ static void MultiDimensionRCTrack25DegUp(
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15880), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15881), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15882), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15883), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -309,29 +261,7 @@ static void MultiDimensionRCTrack25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26253), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26254), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26255), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26256), { 0, 0, height + 24 },
-                    { { 0, 6, height + 40 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -375,31 +305,22 @@ static void MultiDimensionRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15896, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15897, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 15898, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 98 } } } },
+        { { 15899, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26269, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+        { { 26270, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 26271, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 81 } } } },
+        { { 26272, { 0, 0, 24 }, { { 0, 6, 88 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15896), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15897), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15898), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 98 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15899), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 24, height, session.SupportColours);
@@ -417,29 +338,7 @@ static void MultiDimensionRCTrack60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26269), { 0, 0, height + 24 },
-                    { { 0, 6, height + 88 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26270), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 81 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26271), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 81 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26272), { 0, 0, height + 24 },
-                    { { 0, 6, height + 88 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         if (direction == 0 || direction == 3)
         {
             PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -459,33 +358,30 @@ static void MultiDimensionRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 15900, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15901, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15902, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15903, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15872, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15873, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15874, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15875, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26245, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26246, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26247, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26248, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15900), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15901), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15902), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15903), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -493,29 +389,7 @@ static void MultiDimensionRCTrackFlatTo25DegUp(
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15872), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15873), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15874), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15875), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -534,29 +408,7 @@ static void MultiDimensionRCTrackFlatTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26245), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26246), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26247), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26248), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -600,37 +452,34 @@ static void MultiDimensionRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15884, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 15885, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15888, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 15886, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15889, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 15887, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26257, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 26261, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 26258, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 26262, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 26259, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 26260, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15884), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15885), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15888), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15886), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15889), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15887), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 8, height, session.SupportColours);
@@ -648,35 +497,7 @@ static void MultiDimensionRCTrack25DegUpTo60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26257), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26261), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26258), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26262), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26259), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26260), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         if (direction == 0 || direction == 3)
         {
             PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -696,37 +517,34 @@ static void MultiDimensionRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15890, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 15891, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15894, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        {
+            { 15892, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15895, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 66 } } },
+        },
+        { { 15893, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26263, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        {
+            { 26267, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 26264, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        {
+            { 26268, { 0, 0, 24 }, { { 0, 10, 6 }, { 32, 10, 49 } } },
+            { 26265, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 49 } } },
+        },
+        { { 26266, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15890), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15891), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15894), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15892), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15895), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 66 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15893), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 16, height, session.SupportColours);
@@ -744,35 +562,7 @@ static void MultiDimensionRCTrack60DegUpTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26263), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26267), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26264), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26268), { 0, 0, height + 24 },
-                    { { 0, 10, height + 6 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26265), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26266), { 0, 0, height + 24 },
-                    { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -816,33 +606,30 @@ static void MultiDimensionRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 15904, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15905, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15906, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15907, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15876, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15877, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15878, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15879, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26249, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26250, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26251, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26252, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         if (trackElement.HasChain())
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15904), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15905), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15906), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15907), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -850,29 +637,7 @@ static void MultiDimensionRCTrack25DegUpToFlat(
         }
         else
         {
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15876), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15877), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15878), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(15879), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSprites);
             if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
             {
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -891,29 +656,7 @@ static void MultiDimensionRCTrack25DegUpToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26249), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26250), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26251), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26252), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -1005,34 +748,73 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15921, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15926, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15931, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15916, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15920, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 15925, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 15930, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 15915, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 15919, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 15924, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 15929, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 15914, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 15918, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 15923, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 15928, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 15913, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 15917, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 15922, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 15927, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 15912, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26310, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26315, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26320, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26305, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26309, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 26314, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 26319, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26304, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 26308, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26313, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26318, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26303, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5InvertedSprites = {
+        { { 26307, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 32, 3 } } } },
+        { { 26312, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 32, 3 } } } },
+        { { 26317, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 32, 3 } } } },
+        { { 26302, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6InvertedSprites = {
+        { { 26306, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26311, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26316, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26301, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15921), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15926), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15931), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15916), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -1045,29 +827,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15920), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15925), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15930), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15915), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1079,29 +839,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15919), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15924), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15929), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15914), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1116,29 +854,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15918), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15923), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15928), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15913), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1150,29 +866,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15917), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15922), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15927), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15912), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -1200,29 +894,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26310), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26315), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26320), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26305), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -1245,29 +917,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26309), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26314), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26319), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26304), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1279,29 +929,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26308), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26313), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26318), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26303), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1316,29 +944,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26307), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26312), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26317), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26302), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1350,29 +956,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26306), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26311), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26316), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26301), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -1414,37 +998,28 @@ static void MultiDimensionRCTrackFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 15832, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15840, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 15833, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15841, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 15834, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15835, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26273, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26274, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26275, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26276, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15832), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15840), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15833), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15841), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15834), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15835), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1455,29 +1030,7 @@ static void MultiDimensionRCTrackFlatToLeftBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26273), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26274), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26275), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26276), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -1502,37 +1055,28 @@ static void MultiDimensionRCTrackFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15836, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15837, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 15838, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15842, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 15839, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15843, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26277, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26278, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26279, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26280, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15836), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15837), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15838), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15842), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15839), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15843), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1543,29 +1087,7 @@ static void MultiDimensionRCTrackFlatToRightBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26277), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26278), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26279), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26280), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -1590,37 +1112,28 @@ static void MultiDimensionRCTrackLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 15838, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15842, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 15839, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15843, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 15836, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15837, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26279, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26280, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26277, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26278, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15838), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15842), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15839), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15843), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15836), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15837), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1631,29 +1144,7 @@ static void MultiDimensionRCTrackLeftBankToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26279), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26280), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26277), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26278), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -1678,37 +1169,28 @@ static void MultiDimensionRCTrackRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15834, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15835, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 15832, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15840, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        {
+            { 15833, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15841, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26275, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26276, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26273, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26274, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15834), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15835), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15832), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15840), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15833), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15841), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -1719,29 +1201,7 @@ static void MultiDimensionRCTrackRightBankToFlat(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26275), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26276), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26273), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26274), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -1766,37 +1226,79 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 15941, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15952, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 15946, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 15951, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15936, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15940, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 15945, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 15950, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 15935, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 15939, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 15944, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 15949, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 15934, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 15938, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 15943, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 15948, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 15933, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 15937, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 15942, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 15947, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 15953, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 15932, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26354, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26359, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26364, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26349, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26353, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 26358, { 0, 0, 24 }, { { 0, 0, 24 }, { 32, 16, 3 } } } },
+        { { 26363, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+        { { 26348, { 0, 0, 24 }, { { 0, 16, 24 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 26352, { 0, 0, 24 }, { { 0, 16, 24 }, { 16, 16, 3 } } } },
+        { { 26357, { 0, 0, 24 }, { { 16, 16, 24 }, { 16, 16, 3 } } } },
+        { { 26362, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 16, 3 } } } },
+        { { 26347, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5InvertedSprites = {
+        { { 26351, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26356, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26361, { 0, 0, 24 }, { { 0, 0, 24 }, { 16, 32, 3 } } } },
+        { { 26346, { 0, 0, 24 }, { { 16, 0, 24 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6InvertedSprites = {
+        { { 26350, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26355, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26360, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+        { { 26345, { 0, 0, 24 }, { { 6, 0, 24 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15941), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15952), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15946), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15951), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15936), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -1809,29 +1311,7 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15940), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15945), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15950), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15935), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1843,29 +1323,7 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15939), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15944), { 0, 0, height },
-                            { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15949), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15934), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1880,29 +1338,7 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15938), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15943), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15948), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15933), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -1914,32 +1350,7 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15937), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15942), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15947), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15953), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 26 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15932), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -1967,29 +1378,7 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26354), { 0, 0, height + 24 },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26359), { 0, 0, height + 24 },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26364), { 0, 0, height + 24 },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26349), { 0, 0, height + 24 },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -2012,27 +1401,7 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26353), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26358), { 0, 0, height + 24 }, { 32, 16, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26363), { 0, 0, height + 24 },
-                            { { 0, 16, height + 24 }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26348), { 0, 0, height + 24 },
-                            { { 0, 16, height + 24 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -2044,28 +1413,7 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26352), { 0, 0, height + 24 },
-                            { { 0, 16, height + 24 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26357), { 0, 0, height + 24 },
-                            { { 16, 16, height + 24 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26362), { 0, 0, height + 24 },
-                            { { 16, 0, height + 24 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26347), { 0, 0, height + 24 }, { 16, 16, 3 });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -2080,27 +1428,7 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 5:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26351), { 0, 0, height + 24 },
-                            { { 16, 0, height + 24 }, { 16, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26356), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26361), { 0, 0, height + 24 }, { 16, 32, 3 });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26346), { 0, 0, height + 24 },
-                            { { 16, 0, height + 24 }, { 16, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence5InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -2112,41 +1440,19 @@ static void MultiDimensionRCTrackBankedLeftQuarterTurn5(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 6:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26350), { 0, 0, height + 24 },
-                            { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26355), { 0, 0, height + 24 },
-                            { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26360), { 0, 0, height + 24 },
-                            { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26345), { 0, 0, height + 24 },
-                            { { 6, 0, height + 24 }, { 20, 32, 3 } });
-                        break;
-                }
-
-                PaintUtilSetSegmentSupportHeight(
-                    session,
-                    PaintUtilRotateSegments(
-                        EnumsToFlags(
-                            PaintSegment::bottomCorner, PaintSegment::centre, PaintSegment::topLeftSide,
-                            PaintSegment::topRightSide, PaintSegment::bottomRightSide),
-                        direction),
-                    0xFFFF, 0);
-                MetalASupportsPaintSetup(
-                    session, kSupportType, MetalSupportPlace::Centre, 0, height + 36, session.SupportColours);
-
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence6InvertedSprites);
+
+                PaintUtilSetSegmentSupportHeight(
+                    session,
+                    PaintUtilRotateSegments(
+                        EnumsToFlags(
+                            PaintSegment::bottomCorner, PaintSegment::centre, PaintSegment::topLeftSide,
+                            PaintSegment::topRightSide, PaintSegment::bottomRightSide),
+                        direction),
+                    0xFFFF, 0);
+                MetalASupportsPaintSetup(
+                    session, kSupportType, MetalSupportPlace::Centre, 0, height + 36, session.SupportColours);
+
                 switch (direction)
                 {
                     case 2:
@@ -2176,37 +1482,28 @@ static void MultiDimensionRCTrackLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 15844, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15848, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 15845, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15849, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 15846, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15847, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26281, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26282, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26283, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26284, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15844), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15848), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15845), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15849), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15846), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15847), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -2224,29 +1521,7 @@ static void MultiDimensionRCTrackLeftBankTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26281), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26282), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26283), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26284), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2296,37 +1571,28 @@ static void MultiDimensionRCTrackRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15850, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15851, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 15852, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15854, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 15853, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15855, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26285, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26286, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26287, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26288, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15850), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15851), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15852), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15854), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15853), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15855), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 3, height, session.SupportColours);
@@ -2344,29 +1610,7 @@ static void MultiDimensionRCTrackRightBankTo25DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26285), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26286), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26287), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26288), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2416,37 +1660,28 @@ static void MultiDimensionRCTrack25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        {
+            { 15856, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15860, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 15857, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15861, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        { { 15858, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15859, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26289, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26290, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26291, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26292, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15856), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15860), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15857), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15861), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15858), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15859), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -2464,29 +1699,7 @@ static void MultiDimensionRCTrack25DegUpToLeftBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26289), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26290), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26291), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26292), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2536,37 +1749,28 @@ static void MultiDimensionRCTrack25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15862, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15863, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        {
+            { 15864, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15866, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+        {
+            { 15865, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15867, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 34 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26293, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26294, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26295, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 26296, { 0, 0, 24 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15862), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15863), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15864), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15866), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15865), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15867), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 34 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
@@ -2584,29 +1788,7 @@ static void MultiDimensionRCTrack25DegUpToRightBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26293), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26294), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26295), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26296), { 0, 0, height + 24 },
-                    { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2688,31 +1870,22 @@ static void MultiDimensionRCTrackLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15868, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 15869, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 15870, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15871, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26297, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26298, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26299, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26300, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15868), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15869), { 0, 0, height },
-                    { { 0, 27, height }, { 32, 1, 26 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15870), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15871), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -2723,29 +1896,7 @@ static void MultiDimensionRCTrackLeftBank(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26297), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26298), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26299), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26300), { 0, 0, height + 24 },
-                    { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session,
@@ -2778,34 +1929,49 @@ static void MultiDimensionRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15816, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15820, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15819, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15823, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 15819, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15823, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15816, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15820, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26229, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26233, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26232, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26236, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26230, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26234, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26231, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26235, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26231, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26235, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26230, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26234, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 26232, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26236, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26229, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26233, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15816), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15820), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15819), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15823), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -2873,29 +2039,7 @@ static void MultiDimensionRCTrackSBendLeft(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15819), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15823), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15816), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15820), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -2916,29 +2060,7 @@ static void MultiDimensionRCTrackSBendLeft(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26229), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26233), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26232), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26236), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -2958,29 +2080,7 @@ static void MultiDimensionRCTrackSBendLeft(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26230), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26234), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26231), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26235), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3005,29 +2105,7 @@ static void MultiDimensionRCTrackSBendLeft(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26231), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26235), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26230), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26234), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3052,29 +2130,7 @@ static void MultiDimensionRCTrackSBendLeft(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26232), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26236), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26229), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26233), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3107,34 +2163,49 @@ static void MultiDimensionRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15824, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15828, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15827, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15831, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 15827, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15831, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15824, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15828, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26237, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26241, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26240, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26244, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26238, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26242, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26239, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26243, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26239, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26243, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 26, 3 } } } },
+        { { 26238, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+        { { 26242, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 26240, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26244, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26237, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26241, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15824), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15828), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15827), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15831), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -3202,29 +2273,7 @@ static void MultiDimensionRCTrackSBendRight(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15827), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15831), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15824), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15828), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -3245,29 +2294,7 @@ static void MultiDimensionRCTrackSBendRight(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26237), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26241), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26240), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26244), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3287,29 +2314,7 @@ static void MultiDimensionRCTrackSBendRight(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26238), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26242), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26239), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26243), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3334,29 +2339,7 @@ static void MultiDimensionRCTrackSBendRight(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26239), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26243), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26238), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26242), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 26, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3381,29 +2364,7 @@ static void MultiDimensionRCTrackSBendRight(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26240), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26244), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26237), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26241), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3436,34 +2397,49 @@ static void MultiDimensionRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15959, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15962, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15965, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15956, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15958, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 15961, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 15964, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 15955, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 15957, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 15960, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 15963, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 15954, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26326, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26329, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26332, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26323, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26325, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26328, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26331, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26322, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 26324, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26327, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26330, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26321, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15959), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15962), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15965), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15956), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -3476,29 +2452,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15958), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15961), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15964), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15955), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3510,29 +2464,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15957), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15960), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15963), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15954), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -3560,29 +2492,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26326), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26329), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26332), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26323), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3605,29 +2515,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26325), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26328), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26331), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26322), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3639,29 +2527,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26324), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26327), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26330), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26321), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3703,37 +2569,55 @@ static void MultiDimensionRCTrackLeftQuarterTurn3Bank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    if (!trackElement.IsInverted())
-    {
-        switch (trackSequence)
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 15971, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 15978, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 15974, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 15977, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15968, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15970, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 15973, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 15976, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 15967, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 15969, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 15972, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 15975, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 15979, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 15966, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26338, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26341, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26344, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26335, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26337, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26340, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26343, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26334, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        { { 26336, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26339, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26342, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+        { { 26333, { 0, 0, 24 }, { { 6, 0, 22 }, { 20, 32, 3 } } } },
+    };
+
+    if (!trackElement.IsInverted())
+    {
+        switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15971), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15978), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15974), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15977), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15968), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -3746,29 +2630,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3Bank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15970), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15973), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15976), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15967), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3780,32 +2642,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3Bank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15969), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15972), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15975), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15979), { 0, 0, height },
-                            { { 27, 0, height }, { 1, 32, 26 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15966), { 0, 0, height },
-                            { { 6, 0, height }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 switch (direction)
                 {
@@ -3833,29 +2670,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3Bank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26338), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26341), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26344), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26335), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3878,29 +2693,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3Bank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26337), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26340), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26343), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26334), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -3912,29 +2705,7 @@ static void MultiDimensionRCTrackLeftQuarterTurn3Bank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26336), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26339), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26342), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26333), { 0, 0, height + 24 },
-                            { { 6, 0, height + 22 }, { 20, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -3976,35 +2747,59 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 16197, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16204, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16200, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16203, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16194, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16196, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16199, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16202, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16193, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16195, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16198, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16201, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16205, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16192, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 16194, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 16197, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16204, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16200, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 16203, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16193, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16196, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16199, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16202, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 16192, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 16195, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16198, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 16201, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16205, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16197), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16204), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16200), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16203), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16194), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4017,29 +2812,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16196), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16199), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16202), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16193), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4051,32 +2824,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16195), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16198), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16201), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16205), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16192), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -4098,32 +2846,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16194), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16197), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16204), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16200), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16203), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -4141,29 +2864,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16193), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16196), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16199), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16202), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4175,32 +2876,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16192), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16195), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16198), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16201), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16205), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4217,35 +2893,59 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpSmall(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16178, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16181, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16184, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 16187, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16191, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16179, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16182, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16185, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16188, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16180, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+        {
+            { 16183, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16190, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16186, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 16189, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 16181, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16184, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16187, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16191, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16178, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16182, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16185, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 1 } } } },
+        { { 16188, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16179, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        {
+            { 16183, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16190, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16186, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16189, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16180, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16178), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16181), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16184), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16187), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16191), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4258,29 +2958,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16179), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16182), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16185), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16188), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4292,32 +2970,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16180), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16183), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16190), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16186), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16189), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             switch (direction)
             {
@@ -4332,32 +2985,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16181), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16184), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16187), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16191), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16178), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 2, height, session.SupportColours);
             switch (direction)
             {
@@ -4382,29 +3010,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16182), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16185), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16188), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16179), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4416,32 +3022,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpSmall(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16183), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16190), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16186), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16189), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16180), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 6, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4486,35 +3067,83 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {
+            { 16165, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16176, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16170, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16175, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16160, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16164, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16169, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16174, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16159, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16163, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16168, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16173, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16158, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 16162, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16167, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16172, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16157, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16161, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16166, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16171, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16177, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16156, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 16160, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        {
+            { 16165, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16176, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16170, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 16175, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 16159, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16164, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16169, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16174, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        { { 16158, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16163, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16168, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16173, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        { { 16157, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16162, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16167, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16172, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        { { 16156, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+        { { 16161, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16166, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 16171, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16177, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16165), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16176), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16170), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16175), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16160), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4527,29 +3156,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16164), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16169), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16174), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16159), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4561,29 +3168,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16163), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16168), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16173), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16158), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4598,29 +3183,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16162), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16167), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16172), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16157), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4632,32 +3195,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16161), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16166), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16171), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16177), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16156), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -4679,32 +3217,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16160), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16165), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16176), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16170), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16175), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -4722,29 +3235,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16159), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16164), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16169), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16174), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4756,29 +3247,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16158), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16163), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16168), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16173), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4792,29 +3261,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16157), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16162), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16167), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16172), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4826,32 +3273,7 @@ static void MultiDimensionRCTrackLeftHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16156), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16161), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16166), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16171), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16177), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4868,35 +3290,83 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16134, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16139, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16144, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        {
+            { 16149, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16155, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16135, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16140, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16145, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16150, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 16136, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16141, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16146, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16151, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 16137, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16142, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16147, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16152, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 16138, { 0, 0, 0 }, { { 6, 0, 8 }, { 20, 32, 3 } } } },
+        {
+            { 16143, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16154, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16148, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        { { 16153, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence7Sprites = {
+        { { 16139, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+        { { 16144, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } } },
+        {
+            { 16149, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } },
+            { 16155, { 0, 0, 0 }, { { 27, 0, 0 }, { 1, 32, 26 } } },
+        },
+        { { 16134, { 0, 0, 0 }, { { 6, 0, 0 }, { 20, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence9Sprites = {
+        { { 16140, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16145, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 32, 1 } } } },
+        { { 16150, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 32, 3 } } } },
+        { { 16135, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence10Sprites = {
+        { { 16141, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16146, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 1 } } } },
+        { { 16151, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16136, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence12Sprites = {
+        { { 16142, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16147, { 0, 0, 0 }, { { 0, 0, 27 }, { 32, 16, 1 } } } },
+        { { 16152, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16137, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence13Sprites = {
+        {
+            { 16143, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } },
+            { 16154, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } },
+        },
+        { { 16148, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16153, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16138, { 0, 0, 0 }, { { 0, 6, 8 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16134), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16139), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16144), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16149), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16155), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -4909,29 +3379,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16135), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16140), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16145), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16150), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4943,29 +3391,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16136), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16141), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16146), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16151), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4979,29 +3405,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16137), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16142), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16147), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16152), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5013,32 +3417,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16138), { 0, 0, height },
-                        { { 6, 0, height + 8 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16143), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16154), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16148), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16153), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             switch (direction)
             {
@@ -5053,32 +3432,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 7:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16139), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16144), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16149), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16155), { 0, 0, height },
-                        { { 27, 0, height }, { 1, 32, 26 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16134), { 0, 0, height },
-                        { { 6, 0, height }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence7Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 1, height, session.SupportColours);
             switch (direction)
             {
@@ -5103,29 +3457,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 9:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16140), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16145), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 32, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16150), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16135), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence9Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5137,29 +3469,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 10:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16141), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16146), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16151), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16136), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence10Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5174,29 +3484,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 12:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16142), { 0, 0, height },
-                        { { 0, 0, height }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16147), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 32, 16, 1 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16152), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16137), { 0, 0, height },
-                        { { 0, 16, height }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence12Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -5208,32 +3496,7 @@ static void MultiDimensionRCTrackRightHalfBankedHelixUpLarge(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 13:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16143), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16154), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16148), { 0, 0, height },
-                        { { 0, 27, height }, { 32, 1, 26 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16153), { 0, 0, height },
-                        { { 0, 6, height }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(16138), { 0, 0, height },
-                        { { 0, 6, height + 8 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence13Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 7, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -5278,23 +3541,22 @@ static void MultiDimensionRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16218, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16219, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16218, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16219, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26549, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26550, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26549, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26550, { 0, 0, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16218), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16219), { 0, 0, height },
-                    { { 0, 6, height }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
         {
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
@@ -5305,21 +3567,7 @@ static void MultiDimensionRCTrackBrakes(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26549), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26550), { 0, 0, height + 24 },
-                    { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
 
         PaintUtilSetSegmentSupportHeight(
             session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -5338,33 +3586,18 @@ static void MultiDimensionRCTrackOnRidePhoto(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 15806, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 15807, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 15806, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+        { { 15807, { 0, 0, 0 }, { { 0, 6, 3 }, { 32, 20, 0 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         TrackPaintUtilOnridePhotoPlatformPaint(session, direction, height, kSupportType);
 
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15806), { 0, 0, height },
-                    { { 0, 6, height + 3 }, { 32, 20, 0 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15807), { 0, 0, height },
-                    { { 0, 6, height + 3 }, { 32, 20, 0 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15806), { 0, 0, height },
-                    { { 0, 6, height + 3 }, { 32, 20, 0 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(15807), { 0, 0, height },
-                    { { 0, 6, height + 3 }, { 32, 20, 0 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         TrackPaintUtilOnridePhotoPaint(session, direction, height + 3, trackElement);
         PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
         PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
@@ -5431,34 +3664,25 @@ static void MultiDimensionRCTrack90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16130, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16131, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16132, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16133, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26533, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+        { { 26534, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 31 } } } },
+        { { 26535, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 31 } } } },
+        { { 26536, { 0, 0, 24 }, { { 0, 6, 56 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16130), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16131), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16132), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16133), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetVerticalTunnel(session, height + 32);
                 PaintUtilSetSegmentSupportHeight(
                     session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -5473,29 +3697,7 @@ static void MultiDimensionRCTrack90DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26533), { 0, 0, height + 24 },
-                            { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26534), { 0, 0, height + 24 },
-                            { { 0, 4, height + 6 }, { 32, 2, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26535), { 0, 0, height + 24 },
-                            { { 0, 4, height + 6 }, { 32, 2, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26536), { 0, 0, height + 24 },
-                            { { 0, 6, height + 56 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetVerticalTunnel(session, height + 32);
                 PaintUtilSetSegmentSupportHeight(
                     session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -5520,34 +3722,25 @@ static void MultiDimensionRCTrack60DegUpTo90DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16122, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16123, { 0, 0, 0 }, { { 24, 6, 0 }, { 2, 20, 55 } } } },
+        { { 16124, { 0, 0, 0 }, { { 24, 6, 0 }, { 2, 20, 55 } } } },
+        { { 16125, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26525, { 0, 0, 24 }, { { 0, 6, 80 }, { 32, 20, 3 } } } },
+        { { 26526, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 55 } } } },
+        { { 26527, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 55 } } } },
+        { { 26528, { 0, 0, 24 }, { { 0, 6, 80 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16122), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16123), { 0, 0, height },
-                            { { 24, 6, height }, { 2, 20, 55 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16124), { 0, 0, height },
-                            { { 24, 6, height }, { 2, 20, 55 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16125), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::SquareSlopeStart);
@@ -5566,29 +3759,7 @@ static void MultiDimensionRCTrack60DegUpTo90DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26525), { 0, 0, height + 24 },
-                            { { 0, 6, height + 80 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26526), { 0, 0, height + 24 },
-                            { { 0, 4, height + 6 }, { 32, 2, 55 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26527), { 0, 0, height + 24 },
-                            { { 0, 4, height + 6 }, { 32, 2, 55 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26528), { 0, 0, height + 24 },
-                            { { 0, 6, height + 80 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -5617,31 +3788,22 @@ static void MultiDimensionRCTrack90DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 16126, { 0, 0, 0 }, { { 0, 6, 2 }, { 6, 20, 3 } } } },
+        { { 16127, { 0, 0, 0 }, { { 39, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16128, { 0, 0, 0 }, { { 39, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16129, { 0, 0, 0 }, { { 0, 6, 2 }, { 6, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kInvertedSprites = {
+        { { 26529, { 0, 0, 24 }, { { 0, 6, 80 }, { 32, 20, 3 } } } },
+        { { 26530, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 55 } } } },
+        { { 26531, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 55 } } } },
+        { { 26532, { 0, 0, 24 }, { { 0, 6, 80 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16126), { 0, 0, height },
-                    { { 0, 6, height + 2 }, { 6, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16127), { 0, 0, height },
-                    { { 39, 6, height + 8 }, { 2, 20, 31 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16128), { 0, 0, height },
-                    { { 39, 6, height + 8 }, { 2, 20, 31 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(16129), { 0, 0, height },
-                    { { 0, 6, height + 2 }, { 6, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
         switch (direction)
         {
             case 1:
@@ -5657,29 +3819,7 @@ static void MultiDimensionRCTrack90DegUpTo60DegUp(
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26529), { 0, 0, height + 24 },
-                    { { 0, 6, height + 80 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26530), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 55 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26531), { 0, 0, height + 24 },
-                    { { 0, 4, height + 6 }, { 32, 2, 55 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26532), { 0, 0, height + 24 },
-                    { { 0, 6, height + 80 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kInvertedSprites);
         switch (direction)
         {
             case 1:
@@ -5700,34 +3840,25 @@ static void MultiDimensionRCTrack60DegDownTo90DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16128, { 0, 0, 0 }, { { 39, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16129, { 0, 0, 0 }, { { 0, 6, 2 }, { 6, 20, 3 } } } },
+        { { 16126, { 0, 0, 0 }, { { 0, 6, 2 }, { 6, 20, 3 } } } },
+        { { 16127, { 0, 0, 0 }, { { 39, 6, 8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26531, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 55 } } } },
+        { { 26532, { 0, 0, 24 }, { { 0, 6, 80 }, { 32, 20, 3 } } } },
+        { { 26529, { 0, 0, 24 }, { { 0, 6, 80 }, { 32, 20, 3 } } } },
+        { { 26530, { 0, 0, 24 }, { { 0, 4, 6 }, { 32, 2, 55 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16128), { 0, 0, height },
-                            { { 39, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16129), { 0, 0, height },
-                            { { 0, 6, height + 2 }, { 6, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16126), { 0, 0, height },
-                            { { 0, 6, height + 2 }, { 6, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16127), { 0, 0, height },
-                            { { 39, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height + 48, TunnelType::SquareSlopeEnd);
@@ -5745,29 +3876,7 @@ static void MultiDimensionRCTrack60DegDownTo90DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26531), { 0, 0, height + 24 },
-                            { { 0, 4, height + 6 }, { 32, 2, 55 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26532), { 0, 0, height + 24 },
-                            { { 0, 6, height + 80 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26529), { 0, 0, height + 24 },
-                            { { 0, 6, height + 80 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26530), { 0, 0, height + 24 },
-                            { { 0, 4, height + 6 }, { 32, 2, 55 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height + 48, TunnelType::InvertedSlopeEnd);
@@ -5787,34 +3896,55 @@ static void MultiDimensionRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15996, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16000, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16004, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16008, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 15997, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16001, { 0, 0, 0 }, { { 0, 0, 0 }, { 34, 16, 3 } } } },
+        { { 16005, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16009, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15998, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16002, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16006, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16010, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26405, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26409, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26413, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26417, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26406, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 26410, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 26414, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26418, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26407, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26411, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26415, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26419, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4InvertedSprites = {
+        { { 26408, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26412, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 26416, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26420, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15996), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16000), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16004), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16008), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -5824,56 +3954,12 @@ static void MultiDimensionRCTrackLeftEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15997), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16001), { 0, 0, height },
-                            { { 0, 0, height }, { 34, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16005), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16009), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15998), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16002), { 0, 0, height },
-                            { { 16, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16006), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16010), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -5937,65 +4023,21 @@ static void MultiDimensionRCTrackLeftEighthToDiag(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26405), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26409), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26413), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26417), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
-
-                PaintUtilSetSegmentSupportHeight(
-                    session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
-                MetalASupportsPaintSetup(
-                    session, kSupportType, MetalSupportPlace::Centre, 0, height + 36, session.SupportColours);
-
-                if (direction == 0 || direction == 3)
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
+
+                PaintUtilSetSegmentSupportHeight(
+                    session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
+                MetalASupportsPaintSetup(
+                    session, kSupportType, MetalSupportPlace::Centre, 0, height + 36, session.SupportColours);
+
+                if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
                 }
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26406), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26410), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26414), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26418), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6007,29 +4049,7 @@ static void MultiDimensionRCTrackLeftEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26407), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26411), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26415), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26419), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6052,29 +4072,7 @@ static void MultiDimensionRCTrackLeftEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 4:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26408), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26412), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26416), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26420), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence4InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -6115,34 +4113,55 @@ static void MultiDimensionRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 15980, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15984, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15988, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 15992, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 15981, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 15985, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 15989, { 0, 0, 0 }, { { 0, 0, 0 }, { 34, 16, 3 } } } },
+        { { 15993, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 15982, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 15986, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 15990, { 0, 0, 0 }, { { 4, 4, 0 }, { 28, 28, 3 } } } },
+        { { 15994, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26389, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26393, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26397, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26401, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26390, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26394, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26398, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 26402, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26391, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26395, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26399, { 0, 0, 24 }, { { 4, 4, 22 }, { 28, 28, 3 } } } },
+        { { 26403, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4InvertedSprites = {
+        { { 26392, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26396, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26400, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 26404, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15980), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15984), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15988), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15992), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -6152,56 +4171,12 @@ static void MultiDimensionRCTrackRightEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15981), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15985), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15989), { 0, 0, height },
-                            { { 0, 0, height }, { 34, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15993), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15982), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15986), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15990), { 0, 0, height },
-                            { { 4, 4, height }, { 28, 28, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(15994), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6265,29 +4240,7 @@ static void MultiDimensionRCTrackRightEighthToDiag(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26389), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26393), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26397), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26401), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -6301,29 +4254,7 @@ static void MultiDimensionRCTrackRightEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26390), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26394), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26398), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26402), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6335,29 +4266,7 @@ static void MultiDimensionRCTrackRightEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26391), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26395), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26399), { 0, 0, height + 24 },
-                            { { 4, 4, height + 22 }, { 28, 28, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26403), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6380,29 +4289,7 @@ static void MultiDimensionRCTrackRightEighthToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 4:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26392), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26396), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26400), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26404), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence4InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -6461,34 +4348,55 @@ static void MultiDimensionRCTrackLeftEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16028, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16032, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16036, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16040, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16029, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+        { { 16033, { 0, 0, 0 }, { { 0, 0, 27 }, { 34, 16, 0 } } } },
+        { { 16037, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16041, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16030, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+        { { 16034, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } } },
+        { { 16038, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16042, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26437, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26441, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26445, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26449, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26438, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+        { { 26442, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 26446, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26450, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26439, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26443, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26447, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26451, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4InvertedSprites = {
+        { { 26440, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+        { { 26444, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 26448, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26452, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16028), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16032), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16036), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16040), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -6498,56 +4406,12 @@ static void MultiDimensionRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16029), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16033), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 34, 16, 0 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16037), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16041), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16030), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16034), { 0, 0, height },
-                            { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16038), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16042), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6611,29 +4475,7 @@ static void MultiDimensionRCTrackLeftEighthBankToDiag(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26437), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26441), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26445), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26449), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -6653,29 +4495,7 @@ static void MultiDimensionRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26438), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26442), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26446), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26450), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6687,29 +4507,7 @@ static void MultiDimensionRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26439), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26443), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26447), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26451), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6732,29 +4530,7 @@ static void MultiDimensionRCTrackLeftEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 4:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26440), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26444), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26448), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26452), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence4InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -6796,34 +4572,55 @@ static void MultiDimensionRCTrackRightEighthBankToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16012, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16016, { 0, 0, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 16020, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+        { { 16024, { 0, 0, 0 }, { { 0, 27, 0 }, { 32, 1, 26 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16013, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16017, { 0, 0, 0 }, { { 0, 16, 0 }, { 32, 16, 3 } } } },
+        { { 16021, { 0, 0, 0 }, { { 0, 0, 27 }, { 34, 16, 0 } } } },
+        { { 16025, { 0, 0, 0 }, { { 0, 0, 0 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16014, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16018, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 3 } } } },
+        { { 16022, { 0, 0, 0 }, { { 4, 4, 27 }, { 28, 28, 0 } } } },
+        { { 16026, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26421, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26425, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26429, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+        { { 26433, { 0, 0, 24 }, { { 0, 6, 22 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26422, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26426, { 0, 0, 24 }, { { 0, 16, 22 }, { 32, 16, 3 } } } },
+        { { 26430, { 0, 0, 24 }, { { 0, 0, 22 }, { 34, 16, 3 } } } },
+        { { 26434, { 0, 0, 24 }, { { 0, 0, 22 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26423, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26427, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26431, { 0, 0, 24 }, { { 4, 4, 22 }, { 28, 28, 3 } } } },
+        { { 26435, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4InvertedSprites = {
+        { { 26424, { 0, 0, 24 }, { { 16, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26428, { 0, 0, 24 }, { { 0, 0, 22 }, { 16, 16, 3 } } } },
+        { { 26432, { 0, 0, 24 }, { { 0, 16, 22 }, { 16, 18, 3 } } } },
+        { { 26436, { 0, 0, 24 }, { { 16, 16, 22 }, { 16, 16, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16012), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16016), { 0, 0, height },
-                            { { 0, 6, height }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16020), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16024), { 0, 0, height },
-                            { { 0, 27, height }, { 32, 1, 26 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
                 if (direction == 0 || direction == 3)
                 {
@@ -6833,56 +4630,12 @@ static void MultiDimensionRCTrackRightEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16013), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16017), { 0, 0, height },
-                            { { 0, 16, height }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16021), { 0, 0, height },
-                            { { 0, 0, height + 27 }, { 34, 16, 0 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16025), { 0, 0, height },
-                            { { 0, 0, height }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16014), { 0, 0, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16018), { 0, 0, height },
-                            { { 16, 0, height }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16022), { 0, 0, height },
-                            { { 4, 4, height + 27 }, { 28, 28, 0 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16026), { 0, 0, height },
-                            { { 0, 16, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -6946,29 +4699,7 @@ static void MultiDimensionRCTrackRightEighthBankToDiag(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26421), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26425), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26429), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26433), { 0, 0, height + 24 },
-                            { { 0, 6, height + 22 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -6988,29 +4719,7 @@ static void MultiDimensionRCTrackRightEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26422), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26426), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 32, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26430), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 34, 16, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26434), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 32, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -7022,29 +4731,7 @@ static void MultiDimensionRCTrackRightEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26423), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26427), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26431), { 0, 0, height + 24 },
-                            { { 4, 4, height + 22 }, { 28, 28, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26435), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -7067,29 +4754,7 @@ static void MultiDimensionRCTrackRightEighthBankToDiag(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 4:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26424), { 0, 0, height + 24 },
-                            { { 16, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26428), { 0, 0, height + 24 },
-                            { { 0, 0, height + 22 }, { 16, 16, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26432), { 0, 0, height + 24 },
-                            { { 0, 16, height + 22 }, { 16, 18, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26436), { 0, 0, height + 24 },
-                            { { 16, 16, height + 22 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence4InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7148,6 +4813,91 @@ static void MultiDimensionRCTrackDiagFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16109, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16047, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16106, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16044, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16108, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16046, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedChainSprites = {
+        {},
+        {},
+        {},
+        { { 26484, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26456, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedChainSprites = {
+        { { 26481, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26453, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedChainSprites = {
+        {},
+        {},
+        { { 26483, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26455, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedChainSprites = {
+        {},
+        { { 26482, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26454, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -7155,25 +4905,11 @@ static void MultiDimensionRCTrackDiagFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16109), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16047), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7188,25 +4924,11 @@ static void MultiDimensionRCTrackDiagFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16106), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16044), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7221,25 +4943,11 @@ static void MultiDimensionRCTrackDiagFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16108), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16046), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7321,25 +5029,11 @@ static void MultiDimensionRCTrackDiagFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26484), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26456), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7354,25 +5048,11 @@ static void MultiDimensionRCTrackDiagFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26481), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26453), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7387,25 +5067,11 @@ static void MultiDimensionRCTrackDiagFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26483), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26455), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7420,25 +5086,11 @@ static void MultiDimensionRCTrackDiagFlat(
             case 3:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26482), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26454), { -16, -16, height + 24 },
-                                { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 }
 
                 PaintUtilSetSegmentSupportHeight(
@@ -7554,6 +5206,91 @@ static void MultiDimensionRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16121, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16059, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16118, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16056, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16120, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16058, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedChainSprites = {
+        {},
+        {},
+        {},
+        { { 26496, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26468, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedChainSprites = {
+        { { 26493, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26465, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedChainSprites = {
+        {},
+        {},
+        { { 26495, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26467, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedChainSprites = {
+        {},
+        { { 26494, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26466, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -7561,25 +5298,11 @@ static void MultiDimensionRCTrackDiag25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16121), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16059), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7594,25 +5317,11 @@ static void MultiDimensionRCTrackDiag25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16118), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16056), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7627,25 +5336,11 @@ static void MultiDimensionRCTrackDiag25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16120), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16058), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7727,25 +5422,11 @@ static void MultiDimensionRCTrackDiag25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26496), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26468), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7760,25 +5441,11 @@ static void MultiDimensionRCTrackDiag25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26493), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26465), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7793,25 +5460,11 @@ static void MultiDimensionRCTrackDiag25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26495), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26467), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -7826,25 +5479,11 @@ static void MultiDimensionRCTrackDiag25DegUp(
             case 3:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26494), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26466), { -16, -16, height + 24 },
-                                { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 }
 
                 PaintUtilSetSegmentSupportHeight(
@@ -7886,19 +5525,55 @@ static void MultiDimensionRCTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16071, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16068, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16070, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26480, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26477, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26479, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26478, { -16, -16, 24 }, { { -16, -16, 24 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16071), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -7910,14 +5585,7 @@ static void MultiDimensionRCTrackDiag60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16068), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -7929,14 +5597,7 @@ static void MultiDimensionRCTrackDiag60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16070), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -7987,14 +5648,7 @@ static void MultiDimensionRCTrackDiag60DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26480), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8006,14 +5660,7 @@ static void MultiDimensionRCTrackDiag60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26477), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8025,14 +5672,7 @@ static void MultiDimensionRCTrackDiag60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26479), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8044,14 +5684,7 @@ static void MultiDimensionRCTrackDiag60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26478), { -16, -16, height + 24 },
-                            { { -16, -16, height + 24 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8092,6 +5725,91 @@ static void MultiDimensionRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16113, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16051, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16110, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16048, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16112, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16050, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedChainSprites = {
+        {},
+        {},
+        {},
+        { { 26488, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26460, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedChainSprites = {
+        { { 26485, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26457, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedChainSprites = {
+        {},
+        {},
+        { { 26487, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26459, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedChainSprites = {
+        {},
+        { { 26486, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26458, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -8099,25 +5817,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16113), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16051), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8132,25 +5836,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16110), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16048), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8165,25 +5855,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16112), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16050), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8265,25 +5941,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegUp(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26488), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26460), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8298,25 +5960,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegUp(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26485), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26457), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8331,25 +5979,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegUp(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26487), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26459), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8364,25 +5998,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegUp(
             case 3:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26486), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26458), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 }
 
                 PaintUtilSetSegmentSupportHeight(
@@ -8424,19 +6044,55 @@ static void MultiDimensionRCTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16063, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16060, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16062, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26472, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26469, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26471, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26470, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16063), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8448,14 +6104,7 @@ static void MultiDimensionRCTrackDiag25DegUpTo60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16060), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8467,14 +6116,7 @@ static void MultiDimensionRCTrackDiag25DegUpTo60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16062), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8525,14 +6167,7 @@ static void MultiDimensionRCTrackDiag25DegUpTo60DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26472), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8544,14 +6179,7 @@ static void MultiDimensionRCTrackDiag25DegUpTo60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26469), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8563,14 +6191,7 @@ static void MultiDimensionRCTrackDiag25DegUpTo60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26471), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8582,14 +6203,7 @@ static void MultiDimensionRCTrackDiag25DegUpTo60DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26470), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8630,19 +6244,55 @@ static void MultiDimensionRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16067, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16064, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16066, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26476, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26473, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26475, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26474, { -16, -16, 24 }, { { 0, 0, 56 }, { 16, 16, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16067), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8654,14 +6304,7 @@ static void MultiDimensionRCTrackDiag60DegUpTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16064), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8673,14 +6316,7 @@ static void MultiDimensionRCTrackDiag60DegUpTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16066), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8731,14 +6367,7 @@ static void MultiDimensionRCTrackDiag60DegUpTo25DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26476), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8750,14 +6379,7 @@ static void MultiDimensionRCTrackDiag60DegUpTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26473), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8769,14 +6391,7 @@ static void MultiDimensionRCTrackDiag60DegUpTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26475), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -8788,14 +6403,7 @@ static void MultiDimensionRCTrackDiag60DegUpTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26474), { -16, -16, height + 24 },
-                            { { 0, 0, height + 56 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8836,6 +6444,91 @@ static void MultiDimensionRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16117, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16055, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16114, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16052, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16116, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16054, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedChainSprites = {
+        {},
+        {},
+        {},
+        { { 26492, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26464, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedChainSprites = {
+        { { 26489, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26461, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedChainSprites = {
+        {},
+        {},
+        { { 26491, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26463, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedChainSprites = {
+        {},
+        { { 26490, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26462, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -8843,25 +6536,11 @@ static void MultiDimensionRCTrackDiag25DegUpToFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16117), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16055), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8876,25 +6555,11 @@ static void MultiDimensionRCTrackDiag25DegUpToFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16114), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16052), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -8909,25 +6574,11 @@ static void MultiDimensionRCTrackDiag25DegUpToFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16116), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16054), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9009,25 +6660,11 @@ static void MultiDimensionRCTrackDiag25DegUpToFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26492), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26464), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9042,25 +6679,11 @@ static void MultiDimensionRCTrackDiag25DegUpToFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26489), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26461), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9075,25 +6698,11 @@ static void MultiDimensionRCTrackDiag25DegUpToFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26491), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26463), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9108,25 +6717,11 @@ static void MultiDimensionRCTrackDiag25DegUpToFlat(
             case 3:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26490), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 1:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(26462), { -16, -16, height + 24 },
-                                { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
                 }
 
                 PaintUtilSetSegmentSupportHeight(
@@ -9168,6 +6763,67 @@ static void MultiDimensionRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16119, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16057, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16120, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16058, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16118, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16056, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26466, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26467, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26465, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26468, { -16, -16, 24 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -9175,25 +6831,11 @@ static void MultiDimensionRCTrackDiag25DegDown(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16119), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16057), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9208,25 +6850,11 @@ static void MultiDimensionRCTrackDiag25DegDown(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16120), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16058), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9241,25 +6869,11 @@ static void MultiDimensionRCTrackDiag25DegDown(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16118), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16056), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9339,14 +6953,7 @@ static void MultiDimensionRCTrackDiag25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26466), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9358,14 +6965,7 @@ static void MultiDimensionRCTrackDiag25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26467), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9377,14 +6977,7 @@ static void MultiDimensionRCTrackDiag25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26465), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9396,14 +6989,7 @@ static void MultiDimensionRCTrackDiag25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26468), { -16, -16, height + 24 },
-                            { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9444,19 +7030,55 @@ static void MultiDimensionRCTrackDiag60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16069, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16070, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16068, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26478, { -16, -16, 24 }, { { -16, -16, 24 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26479, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26477, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26480, { -16, -16, 24 }, { { -16, -16, 88 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16069), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9468,14 +7090,7 @@ static void MultiDimensionRCTrackDiag60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16070), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9487,14 +7102,7 @@ static void MultiDimensionRCTrackDiag60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16068), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9545,14 +7153,7 @@ static void MultiDimensionRCTrackDiag60DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26478), { -16, -16, height + 24 },
-                            { { -16, -16, height + 24 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9564,14 +7165,7 @@ static void MultiDimensionRCTrackDiag60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26479), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9583,14 +7177,7 @@ static void MultiDimensionRCTrackDiag60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26477), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9602,14 +7189,7 @@ static void MultiDimensionRCTrackDiag60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 104);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26480), { -16, -16, height + 24 },
-                            { { -16, -16, height + 88 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9650,6 +7230,67 @@ static void MultiDimensionRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16115, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16053, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16116, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16054, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16114, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16052, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26462, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26463, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26461, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26464, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -9657,25 +7298,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegDown(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16115), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16053), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9689,25 +7316,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegDown(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16116), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16054), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9721,25 +7334,11 @@ static void MultiDimensionRCTrackDiagFlatTo25DegDown(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16114), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16052), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9817,14 +7416,7 @@ static void MultiDimensionRCTrackDiagFlatTo25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26462), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9836,14 +7428,7 @@ static void MultiDimensionRCTrackDiagFlatTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26463), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9855,14 +7440,7 @@ static void MultiDimensionRCTrackDiagFlatTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26461), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9874,14 +7452,7 @@ static void MultiDimensionRCTrackDiagFlatTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26464), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -9922,19 +7493,55 @@ static void MultiDimensionRCTrackDiag25DegDownTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16065, { -16, -16, 0 }, { { 0, 0, 0 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16066, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16064, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26474, { -16, -16, 24 }, { { 0, 0, 56 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26475, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26473, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26476, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16065), { -16, -16, height },
-                            { { 0, 0, height }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9946,14 +7553,7 @@ static void MultiDimensionRCTrackDiag25DegDownTo60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16066), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -9965,14 +7565,7 @@ static void MultiDimensionRCTrackDiag25DegDownTo60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16064), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10023,14 +7616,7 @@ static void MultiDimensionRCTrackDiag25DegDownTo60DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26474), { -16, -16, height + 24 },
-                            { { 0, 0, height + 56 }, { 16, 16, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10042,14 +7628,7 @@ static void MultiDimensionRCTrackDiag25DegDownTo60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26475), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10061,14 +7640,7 @@ static void MultiDimensionRCTrackDiag25DegDownTo60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26473), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10080,14 +7652,7 @@ static void MultiDimensionRCTrackDiag25DegDownTo60DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26476), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10128,19 +7693,55 @@ static void MultiDimensionRCTrackDiag60DegDownTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16061, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16062, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16060, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26470, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26471, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26469, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26472, { -16, -16, 24 }, { { -16, -16, 56 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16061), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10152,14 +7753,7 @@ static void MultiDimensionRCTrackDiag60DegDownTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16062), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10171,14 +7765,7 @@ static void MultiDimensionRCTrackDiag60DegDownTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16060), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10229,14 +7816,7 @@ static void MultiDimensionRCTrackDiag60DegDownTo25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26470), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10248,14 +7828,7 @@ static void MultiDimensionRCTrackDiag60DegDownTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26471), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10267,14 +7840,7 @@ static void MultiDimensionRCTrackDiag60DegDownTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26469), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10286,14 +7852,7 @@ static void MultiDimensionRCTrackDiag60DegDownTo25DegDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26472), { -16, -16, height + 24 },
-                            { { -16, -16, height + 56 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10334,6 +7893,67 @@ static void MultiDimensionRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 16111, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16049, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 16112, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16050, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 16110, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16048, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26458, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26459, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26457, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26460, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
@@ -10341,25 +7961,11 @@ static void MultiDimensionRCTrackDiag25DegDownToFlat(
             case 0:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16111), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 3:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16049), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10374,25 +7980,11 @@ static void MultiDimensionRCTrackDiag25DegDownToFlat(
             case 1:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16112), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 0:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16050), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10407,25 +7999,11 @@ static void MultiDimensionRCTrackDiag25DegDownToFlat(
             case 2:
                 if (trackElement.HasChain())
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16110), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
                 }
                 else
                 {
-                    switch (direction)
-                    {
-                        case 2:
-                            PaintAddImageAsParentRotated(
-                                session, direction, session.TrackColours.WithIndex(16048), { -16, -16, height },
-                                { { -16, -16, height }, { 32, 32, 3 } });
-                            break;
-                    }
+                    TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 }
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10505,14 +8083,7 @@ static void MultiDimensionRCTrackDiag25DegDownToFlat(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26458), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10524,14 +8095,7 @@ static void MultiDimensionRCTrackDiag25DegDownToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26459), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10543,14 +8107,7 @@ static void MultiDimensionRCTrackDiag25DegDownToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26457), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10562,14 +8119,7 @@ static void MultiDimensionRCTrackDiag25DegDownToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26460), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10610,19 +8160,58 @@ static void MultiDimensionRCTrackDiagFlatToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16079, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16076, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16080, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16078, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26504, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26501, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26503, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26502, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16079), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10634,17 +8223,7 @@ static void MultiDimensionRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16076), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16080), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10656,14 +8235,7 @@ static void MultiDimensionRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16078), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10714,14 +8286,7 @@ static void MultiDimensionRCTrackDiagFlatToLeftBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26504), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10733,14 +8298,7 @@ static void MultiDimensionRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26501), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10752,14 +8310,7 @@ static void MultiDimensionRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26503), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10771,14 +8322,7 @@ static void MultiDimensionRCTrackDiagFlatToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26502), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -10819,19 +8363,58 @@ static void MultiDimensionRCTrackDiagFlatToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16084, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16081, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16083, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16085, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26508, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26505, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26507, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26506, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16084), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10843,14 +8426,7 @@ static void MultiDimensionRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16081), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10862,17 +8438,7 @@ static void MultiDimensionRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16083), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16085), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10923,14 +8489,7 @@ static void MultiDimensionRCTrackDiagFlatToRightBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26508), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10942,14 +8501,7 @@ static void MultiDimensionRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26505), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10961,14 +8513,7 @@ static void MultiDimensionRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26507), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -10980,14 +8525,7 @@ static void MultiDimensionRCTrackDiagFlatToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26506), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11028,19 +8566,58 @@ static void MultiDimensionRCTrackDiagLeftBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16082, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16083, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16085, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16081, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26506, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26507, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26505, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26508, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16082), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11052,17 +8629,7 @@ static void MultiDimensionRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16083), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16085), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11074,14 +8641,7 @@ static void MultiDimensionRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16081), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11132,14 +8692,7 @@ static void MultiDimensionRCTrackDiagLeftBankToFlat(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26506), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11151,14 +8704,7 @@ static void MultiDimensionRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26507), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11170,14 +8716,7 @@ static void MultiDimensionRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26505), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11189,14 +8728,7 @@ static void MultiDimensionRCTrackDiagLeftBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26508), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11237,19 +8769,58 @@ static void MultiDimensionRCTrackDiagRightBankToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16077, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16078, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16076, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16080, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26502, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26503, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26501, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26504, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16077), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11261,14 +8832,7 @@ static void MultiDimensionRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16078), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11280,17 +8844,7 @@ static void MultiDimensionRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16076), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16080), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11341,14 +8895,7 @@ static void MultiDimensionRCTrackDiagRightBankToFlat(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26502), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11360,14 +8907,7 @@ static void MultiDimensionRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26503), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11379,14 +8919,7 @@ static void MultiDimensionRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26501), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11398,14 +8931,7 @@ static void MultiDimensionRCTrackDiagRightBankToFlat(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26504), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11446,19 +8972,58 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16099, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16096, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16100, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16098, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26520, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26517, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26519, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26518, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16099), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11470,17 +9035,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16096), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16100), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11492,14 +9047,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16098), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11550,14 +9098,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26520), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11569,14 +9110,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26517), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11588,14 +9122,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26519), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11607,14 +9134,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26518), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11655,19 +9175,58 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16104, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16101, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16103, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16105, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26524, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26521, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26523, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26522, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16104), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11679,14 +9238,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16101), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11698,17 +9250,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16103), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16105), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11759,14 +9301,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegUp(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26524), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11778,14 +9313,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26521), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11797,14 +9325,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26523), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11816,14 +9337,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegUp(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26522), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -11864,19 +9378,58 @@ static void MultiDimensionRCTrackDiag25DegUpToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16089, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16086, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16090, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16088, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26512, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26509, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26511, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26510, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16089), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11888,17 +9441,7 @@ static void MultiDimensionRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16086), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16090), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11910,14 +9453,7 @@ static void MultiDimensionRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16088), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11968,14 +9504,7 @@ static void MultiDimensionRCTrackDiag25DegUpToLeftBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26512), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -11987,14 +9516,7 @@ static void MultiDimensionRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26509), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12006,14 +9528,7 @@ static void MultiDimensionRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26511), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12025,14 +9540,7 @@ static void MultiDimensionRCTrackDiag25DegUpToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26510), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12073,19 +9581,58 @@ static void MultiDimensionRCTrackDiag25DegUpToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16094, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16091, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16093, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16095, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26516, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26513, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26515, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26514, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16094), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12097,14 +9644,7 @@ static void MultiDimensionRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16091), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12116,17 +9656,7 @@ static void MultiDimensionRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16093), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16095), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12177,14 +9707,7 @@ static void MultiDimensionRCTrackDiag25DegUpToRightBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26516), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12196,14 +9719,7 @@ static void MultiDimensionRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26513), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12215,14 +9731,7 @@ static void MultiDimensionRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26515), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12234,14 +9743,7 @@ static void MultiDimensionRCTrackDiag25DegUpToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 56);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26514), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12282,19 +9784,58 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16092, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16093, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16095, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16091, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26514, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26515, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26513, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26516, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16092), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12305,17 +9846,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16093), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16095), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12326,14 +9857,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16091), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12382,14 +9906,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26514), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12400,14 +9917,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26515), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12418,14 +9928,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26513), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12436,14 +9939,7 @@ static void MultiDimensionRCTrackDiagLeftBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26516), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12484,19 +9980,58 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16087, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16088, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16086, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16090, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26510, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26511, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26509, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26512, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16087), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12507,14 +10042,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16088), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12525,17 +10053,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16086), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16090), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12584,14 +10102,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26510), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12602,14 +10113,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26511), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12620,14 +10124,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26509), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12638,14 +10135,7 @@ static void MultiDimensionRCTrackDiagRightBankTo25DegDown(
                     0xFFFF, 0);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26512), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12686,19 +10176,58 @@ static void MultiDimensionRCTrackDiag25DegDownToLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16102, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 16103, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16105, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16101, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26522, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26523, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26521, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26524, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16102), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12710,17 +10239,7 @@ static void MultiDimensionRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16103), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16105), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12732,14 +10251,7 @@ static void MultiDimensionRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16101), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12790,14 +10302,7 @@ static void MultiDimensionRCTrackDiag25DegDownToLeftBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26522), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12809,14 +10314,7 @@ static void MultiDimensionRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26523), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12828,14 +10326,7 @@ static void MultiDimensionRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26521), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12847,14 +10338,7 @@ static void MultiDimensionRCTrackDiag25DegDownToLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26524), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -12895,19 +10379,58 @@ static void MultiDimensionRCTrackDiag25DegDownToRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16097, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16098, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 16096, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } },
+            { 16100, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26518, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26519, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26517, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26520, { -16, -16, 24 }, { { -16, -16, 32 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16097), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12919,14 +10442,7 @@ static void MultiDimensionRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16098), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12938,17 +10454,7 @@ static void MultiDimensionRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16096), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16100), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -12999,14 +10505,7 @@ static void MultiDimensionRCTrackDiag25DegDownToRightBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26518), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13018,14 +10517,7 @@ static void MultiDimensionRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26519), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13037,14 +10529,7 @@ static void MultiDimensionRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26517), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13056,14 +10541,7 @@ static void MultiDimensionRCTrackDiag25DegDownToRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26520), { -16, -16, height + 24 },
-                            { { -16, -16, height + 32 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13104,19 +10582,55 @@ static void MultiDimensionRCTrackDiagLeftBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16075, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16072, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16074, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26500, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26497, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26499, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26498, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16075), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13128,14 +10642,7 @@ static void MultiDimensionRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16072), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13147,14 +10654,7 @@ static void MultiDimensionRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16074), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13205,14 +10705,7 @@ static void MultiDimensionRCTrackDiagLeftBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26500), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13224,14 +10717,7 @@ static void MultiDimensionRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26497), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13243,14 +10729,7 @@ static void MultiDimensionRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26499), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13262,14 +10741,7 @@ static void MultiDimensionRCTrackDiagLeftBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26498), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13310,19 +10782,55 @@ static void MultiDimensionRCTrackDiagRightBank(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 16073, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16074, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 16072, { -16, -16, 0 }, { { -16, -16, 27 }, { 32, 32, 0 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        {},
+        {},
+        {},
+        { { 26498, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26499, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        {},
+        {},
+        { { 26497, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3InvertedSprites = {
+        {},
+        { { 26500, { -16, -16, 24 }, { { -16, -16, 22 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16073), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13334,14 +10842,7 @@ static void MultiDimensionRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16074), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13353,14 +10854,7 @@ static void MultiDimensionRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16072), { -16, -16, height },
-                            { { -16, -16, height + 27 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13411,14 +10905,7 @@ static void MultiDimensionRCTrackDiagRightBank(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26498), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13430,14 +10917,7 @@ static void MultiDimensionRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26499), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13449,14 +10929,7 @@ static void MultiDimensionRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26497), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -13468,14 +10941,7 @@ static void MultiDimensionRCTrackDiagRightBank(
                 PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
                 break;
             case 3:
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26500), { -16, -16, height + 24 },
-                            { { -16, -16, height + 22 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3InvertedSprites);
 
                 PaintUtilSetSegmentSupportHeight(
                     session,
@@ -13516,28 +10982,29 @@ static void MultiDimensionRCTrackLeftFlyerTwistUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26368, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26374, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26367, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26373, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26369, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26375, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26366, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26372, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26370, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26376, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26365, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26371, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26368), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26374), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26367), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26373), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -13554,26 +11021,7 @@ static void MultiDimensionRCTrackLeftFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26369), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26375), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26366), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26372), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13585,26 +11033,7 @@ static void MultiDimensionRCTrackLeftFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26370), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26376), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26365), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26371), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -13635,28 +11064,29 @@ static void MultiDimensionRCTrackRightFlyerTwistUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26380, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26386, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26379, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26385, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26381, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26387, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26378, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26384, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26382, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26388, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26377, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26383, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26380), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26386), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26379), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26385), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             if (direction == 0 || direction == 3)
             {
@@ -13673,25 +11103,7 @@ static void MultiDimensionRCTrackRightFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26381), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26387), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26378), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26384), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13703,25 +11115,7 @@ static void MultiDimensionRCTrackRightFlyerTwistUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26382), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26388), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26377), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26383), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -13752,29 +11146,29 @@ static void MultiDimensionRCTrackLeftFlyerTwistDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26365, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26371, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26370, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26376, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26366, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26372, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26369, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26375, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26367, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26373, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26368, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26374, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26365), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26371), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26370), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26376), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -13793,26 +11187,7 @@ static void MultiDimensionRCTrackLeftFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26366), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26372), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26369), { 0, 6, height + 24 },
-                        { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26375), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13824,25 +11199,7 @@ static void MultiDimensionRCTrackLeftFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26367), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26373), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26368), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26374), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -13871,28 +11228,29 @@ static void MultiDimensionRCTrackRightFlyerTwistDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26377, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26383, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26382, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26388, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26378, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26384, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26381, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 26387, { 0, 6, 24 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26379, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26385, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26380, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+        { { 26386, { 0, 6, 0 }, { { 0, 6, 0 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26377), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26383), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26382), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26388), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -13911,25 +11269,7 @@ static void MultiDimensionRCTrackRightFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26378), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26384), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26381), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26387), { 0, 6, height + 24 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -13941,25 +11281,7 @@ static void MultiDimensionRCTrackRightFlyerTwistDown(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26379), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26385), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26380), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26386), { 0, 6, height }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             MetalASupportsPaintSetup(session, kSupportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
             switch (direction)
             {
@@ -13988,34 +11310,49 @@ static void MultiDimensionRCTrackMultidimInvertedFlatTo90DegQuarterLoopDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26539, { 0, 0, 16 }, { { 0, 6, 16 }, { 32, 20, 3 } } } },
+        { { 26542, { 0, 0, 16 }, { { 0, 6, 18 }, { 2, 20, 3 } } } },
+        { { 26545, { 0, 0, 16 }, { { 0, 6, 18 }, { 2, 20, 3 } } } },
+        { { 26548, { 0, 0, 16 }, { { 0, 6, 16 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26538, { 0, 0, 16 }, { { 24, 6, 16 }, { 2, 20, 31 } } } },
+        { { 26541, { 0, 0, 16 }, { { 0, 6, 18 }, { 2, 20, 3 } } } },
+        { { 26544, { 0, 0, 16 }, { { 0, 6, 18 }, { 2, 20, 3 } } } },
+        { { 26547, { 0, 0, 16 }, { { 24, 6, 16 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26537, { 0, 0, 16 }, { { 28, 6, 24 }, { 2, 20, 31 } } } },
+        { { 26540, { 0, 0, 16 }, { { 0, 6, 24 }, { 2, 20, 31 } } } },
+        { { 26543, { 0, 0, 16 }, { { 0, 6, 24 }, { 2, 20, 31 } } } },
+        { { 26546, { 0, 0, 16 }, { { 29, 6, 24 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 16208, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 16211, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16214, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16217, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 16207, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+        { { 16210, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 16213, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 16216, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 16206, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16209, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16212, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16215, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26539), { 0, 0, height + 16 },
-                            { { 0, 6, height + 16 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26542), { 0, 0, height + 16 },
-                            { { 0, 6, height + 18 }, { 2, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26545), { 0, 0, height + 16 },
-                            { { 0, 6, height + 18 }, { 2, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26548), { 0, 0, height + 16 },
-                            { { 0, 6, height + 16 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height + 32, TunnelType::SquareFlat);
@@ -14029,29 +11366,7 @@ static void MultiDimensionRCTrackMultidimInvertedFlatTo90DegQuarterLoopDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 64);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26538), { 0, 0, height + 16 },
-                            { { 24, 6, height + 16 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26541), { 0, 0, height + 16 },
-                            { { 0, 6, height + 18 }, { 2, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26544), { 0, 0, height + 16 },
-                            { { 0, 6, height + 18 }, { 2, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26547), { 0, 0, height + 16 },
-                            { { 24, 6, height + 16 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14061,29 +11376,7 @@ static void MultiDimensionRCTrackMultidimInvertedFlatTo90DegQuarterLoopDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 80);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26537), { 0, 0, height + 16 },
-                            { { 28, 6, height + 24 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26540), { 0, 0, height + 16 },
-                            { { 0, 6, height + 24 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26543), { 0, 0, height + 16 },
-                            { { 0, 6, height + 24 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26546), { 0, 0, height + 16 },
-                            { { 29, 6, height + 24 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14101,29 +11394,7 @@ static void MultiDimensionRCTrackMultidimInvertedFlatTo90DegQuarterLoopDown(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16208), { 0, 0, height },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16211), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16214), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16217), { 0, 0, height },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height + 16, TunnelType::SquareFlat);
@@ -14137,29 +11408,7 @@ static void MultiDimensionRCTrackMultidimInvertedFlatTo90DegQuarterLoopDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16207), { 0, 0, height },
-                            { { -8, 6, height }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16210), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16213), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16216), { 0, 0, height },
-                            { { -8, 6, height }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14169,29 +11418,7 @@ static void MultiDimensionRCTrackMultidimInvertedFlatTo90DegQuarterLoopDown(
                 PaintUtilSetGeneralSupportHeight(session, height + 64);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16206), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16209), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16212), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16215), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14260,34 +11487,49 @@ static void MultiDimensionRCTrackMultidim90DegUpToInvertedFlatQuarterLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16206, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16209, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16212, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16215, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16207, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+        { { 16210, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 16213, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 16216, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16208, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 16211, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16214, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16217, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26537, { 0, 0, -16 }, { { 28, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26540, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26543, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26546, { 0, 0, -16 }, { { 28, 6, -8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26538, { 0, 0, -16 }, { { 24, 6, -16 }, { 2, 20, 31 } } } },
+        { { 26541, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 63 } } } },
+        { { 26544, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 63 } } } },
+        { { 26547, { 0, 0, -16 }, { { 24, 6, -16 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26539, { 0, 0, -16 }, { { 0, 6, -16 }, { 32, 20, 3 } } } },
+        { { 26542, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26545, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26548, { 0, 0, -16 }, { { 0, 6, -16 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16206), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16209), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16212), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16215), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14297,29 +11539,7 @@ static void MultiDimensionRCTrackMultidim90DegUpToInvertedFlatQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16207), { 0, 0, height },
-                            { { -8, 6, height }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16210), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16213), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16216), { 0, 0, height },
-                            { { -8, 6, height }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14329,29 +11549,7 @@ static void MultiDimensionRCTrackMultidim90DegUpToInvertedFlatQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 64);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16208), { 0, 0, height },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16211), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16214), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16217), { 0, 0, height },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height + 16, TunnelType::SquareFlat);
@@ -14371,29 +11569,7 @@ static void MultiDimensionRCTrackMultidim90DegUpToInvertedFlatQuarterLoop(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26537), { 0, 0, height - 16 },
-                            { { 28, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26540), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26543), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26546), { 0, 0, height - 16 },
-                            { { 28, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14403,29 +11579,7 @@ static void MultiDimensionRCTrackMultidim90DegUpToInvertedFlatQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26538), { 0, 0, height - 16 },
-                            { { 24, 6, height - 16 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26541), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 63 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26544), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 63 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26547), { 0, 0, height - 16 },
-                            { { 24, 6, height - 16 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14435,29 +11589,7 @@ static void MultiDimensionRCTrackMultidim90DegUpToInvertedFlatQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26539), { 0, 0, height - 16 },
-                            { { 0, 6, height - 16 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26542), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26545), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26548), { 0, 0, height - 16 },
-                            { { 0, 6, height - 16 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
@@ -14479,34 +11611,49 @@ static void MultiDimensionRCTrackMultidimFlatTo90DegDownQuarterLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26539, { 0, 0, 16 }, { { 0, 6, 16 }, { 32, 20, 3 } } } },
+        { { 26542, { 0, 0, 16 }, { { 0, 6, 18 }, { 2, 20, 3 } } } },
+        { { 26545, { 0, 0, 16 }, { { 0, 6, 18 }, { 2, 20, 3 } } } },
+        { { 26548, { 0, 0, 16 }, { { 0, 6, 16 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26538, { 0, 0, 16 }, { { 24, 6, 16 }, { 2, 20, 31 } } } },
+        { { 26541, { 0, 0, 16 }, { { 0, 6, 18 }, { 2, 20, 3 } } } },
+        { { 26544, { 0, 0, 16 }, { { 0, 6, 18 }, { 2, 20, 3 } } } },
+        { { 26547, { 0, 0, 16 }, { { 24, 6, 16 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26537, { 0, 0, 16 }, { { 28, 6, 24 }, { 2, 20, 31 } } } },
+        { { 26540, { 0, 0, 16 }, { { 0, 6, 24 }, { 2, 20, 31 } } } },
+        { { 26543, { 0, 0, 16 }, { { 0, 6, 24 }, { 2, 20, 31 } } } },
+        { { 26546, { 0, 0, 16 }, { { 29, 6, 24 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 16208, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 16211, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16214, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16217, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 16207, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+        { { 16210, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 16213, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 16216, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 16206, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16209, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16212, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16215, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26539), { 0, 0, height + 16 },
-                            { { 0, 6, height + 16 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26542), { 0, 0, height + 16 },
-                            { { 0, 6, height + 18 }, { 2, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26545), { 0, 0, height + 16 },
-                            { { 0, 6, height + 18 }, { 2, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26548), { 0, 0, height + 16 },
-                            { { 0, 6, height + 16 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height + 32, TunnelType::SquareFlat);
@@ -14520,29 +11667,7 @@ static void MultiDimensionRCTrackMultidimFlatTo90DegDownQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 64);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26538), { 0, 0, height + 16 },
-                            { { 24, 6, height + 16 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26541), { 0, 0, height + 16 },
-                            { { 0, 6, height + 18 }, { 2, 20, 3 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26544), { 0, 0, height + 16 },
-                            { { 0, 6, height + 18 }, { 2, 20, 3 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26547), { 0, 0, height + 16 },
-                            { { 24, 6, height + 16 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14552,29 +11677,7 @@ static void MultiDimensionRCTrackMultidimFlatTo90DegDownQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 80);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26537), { 0, 0, height + 16 },
-                            { { 28, 6, height + 24 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26540), { 0, 0, height + 16 },
-                            { { 0, 6, height + 24 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26543), { 0, 0, height + 16 },
-                            { { 0, 6, height + 24 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26546), { 0, 0, height + 16 },
-                            { { 29, 6, height + 24 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14592,29 +11695,7 @@ static void MultiDimensionRCTrackMultidimFlatTo90DegDownQuarterLoop(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16208), { 0, 0, height },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16211), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16214), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16217), { 0, 0, height },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height + 16, TunnelType::SquareFlat);
@@ -14628,29 +11709,7 @@ static void MultiDimensionRCTrackMultidimFlatTo90DegDownQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16207), { 0, 0, height },
-                            { { -8, 6, height }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16210), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16213), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16216), { 0, 0, height },
-                            { { -8, 6, height }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14660,29 +11719,7 @@ static void MultiDimensionRCTrackMultidimFlatTo90DegDownQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 64);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16206), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16209), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16212), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16215), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14702,34 +11739,49 @@ static void MultiDimensionRCTrackMultidimInverted90DegUpToFlatQuarterLoop(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 16206, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16209, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16212, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16215, { 0, 0, 0 }, { { 4, 6, 8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 16207, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+        { { 16210, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 16213, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 63 } } } },
+        { { 16216, { 0, 0, 0 }, { { -8, 6, 0 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 16208, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+        { { 16211, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16214, { 0, 0, 0 }, { { 24, 6, 8 }, { 2, 20, 31 } } } },
+        { { 16217, { 0, 0, 0 }, { { 0, 6, 24 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0InvertedSprites = {
+        { { 26537, { 0, 0, -16 }, { { 28, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26540, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26543, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26546, { 0, 0, -16 }, { { 28, 6, -8 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1InvertedSprites = {
+        { { 26538, { 0, 0, -16 }, { { 24, 6, -16 }, { 2, 20, 31 } } } },
+        { { 26541, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 63 } } } },
+        { { 26544, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 63 } } } },
+        { { 26547, { 0, 0, -16 }, { { 24, 6, -16 }, { 2, 20, 31 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2InvertedSprites = {
+        { { 26539, { 0, 0, -16 }, { { 0, 6, -16 }, { 32, 20, 3 } } } },
+        { { 26542, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26545, { 0, 0, -16 }, { { 0, 6, -8 }, { 2, 20, 31 } } } },
+        { { 26548, { 0, 0, -16 }, { { 0, 6, -16 }, { 32, 20, 3 } } } },
+    };
+
     if (!trackElement.IsInverted())
     {
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16206), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16209), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16212), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16215), { 0, 0, height },
-                            { { 4, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14739,29 +11791,7 @@ static void MultiDimensionRCTrackMultidimInverted90DegUpToFlatQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 88);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16207), { 0, 0, height },
-                            { { -8, 6, height }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16210), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16213), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 63 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16216), { 0, 0, height },
-                            { { -8, 6, height }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14771,29 +11801,7 @@ static void MultiDimensionRCTrackMultidimInverted90DegUpToFlatQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 64);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16208), { 0, 0, height },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16211), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16214), { 0, 0, height },
-                            { { 24, 6, height + 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(16217), { 0, 0, height },
-                            { { 0, 6, height + 24 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height + 16, TunnelType::SquareFlat);
@@ -14813,29 +11821,7 @@ static void MultiDimensionRCTrackMultidimInverted90DegUpToFlatQuarterLoop(
         switch (trackSequence)
         {
             case 0:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26537), { 0, 0, height - 16 },
-                            { { 28, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26540), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26543), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26546), { 0, 0, height - 16 },
-                            { { 28, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14845,29 +11831,7 @@ static void MultiDimensionRCTrackMultidimInverted90DegUpToFlatQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 72);
                 break;
             case 1:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26538), { 0, 0, height - 16 },
-                            { { 24, 6, height - 16 }, { 2, 20, 31 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26541), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 63 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26544), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 63 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26547), { 0, 0, height - 16 },
-                            { { 24, 6, height - 16 }, { 2, 20, 31 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1InvertedSprites);
                 PaintUtilSetSegmentSupportHeight(
                     session,
                     PaintUtilRotateSegments(
@@ -14877,29 +11841,7 @@ static void MultiDimensionRCTrackMultidimInverted90DegUpToFlatQuarterLoop(
                 PaintUtilSetGeneralSupportHeight(session, height + 48);
                 break;
             case 2:
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26539), { 0, 0, height - 16 },
-                            { { 0, 6, height - 16 }, { 32, 20, 3 } });
-                        break;
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26542), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26545), { 0, 0, height - 16 },
-                            { { 0, 6, height - 8 }, { 2, 20, 31 } });
-                        break;
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26548), { 0, 0, height - 16 },
-                            { { 0, 6, height - 16 }, { 32, 20, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2InvertedSprites);
                 if (direction == 0 || direction == 3)
                 {
                     PaintUtilPushTunnelRotated(session, direction, height, TunnelType::SquareFlat);
@@ -990,6 +990,13 @@ static void ReverserRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 21558, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } } },
+        { { 21561, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } } },
+        { { 21564, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } } },
+        { { 21555, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -1035,29 +1042,7 @@ static void ReverserRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21558), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21561), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21564), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21555), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
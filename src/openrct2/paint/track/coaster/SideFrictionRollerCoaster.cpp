@@ -1290,6 +1290,25 @@ static void SideFrictionRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {
+            { 21698, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 21710, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21701, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 21713, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21704, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 16, 2 } } },
+            { 21716, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21695, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 21707, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -1347,41 +1366,7 @@ static void SideFrictionRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21698), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21710), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21701), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21713), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21704), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21716), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21695), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21707), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1498,6 +1483,25 @@ static void SideFrictionRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        {
+            { 21793, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 21809, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21797, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 18, 2 } } },
+            { 21813, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21801, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 21817, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21805, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 21821, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -1669,41 +1673,7 @@ static void SideFrictionRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21793), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21809), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21797), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 18, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21813), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21801), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21817), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21805), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21821), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
@@ -1715,6 +1685,25 @@ static void SideFrictionRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        {
+            { 21761, { 0, 0, 0 }, { { 16, 0, 0 }, { 16, 16, 2 } } },
+            { 21777, { 0, 0, 0 }, { { 16, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21765, { 0, 0, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } },
+            { 21781, { 0, 0, 0 }, { { 0, 0, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21769, { 0, 0, 0 }, { { 0, 16, 0 }, { 16, 18, 2 } } },
+            { 21785, { 0, 0, 0 }, { { 0, 16, 27 }, { 16, 16, 0 } } },
+        },
+        {
+            { 21773, { 0, 0, 0 }, { { 16, 16, 0 }, { 16, 16, 2 } } },
+            { 21789, { 0, 0, 0 }, { { 16, 16, 27 }, { 16, 16, 0 } } },
+        },
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -1886,41 +1875,7 @@ static void SideFrictionRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21761), { 0, 0, height },
-                        { { 16, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21777), { 0, 0, height },
-                        { { 16, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21765), { 0, 0, height },
-                        { { 0, 0, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21781), { 0, 0, height },
-                        { { 0, 0, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21769), { 0, 0, height },
-                        { { 0, 16, height }, { 16, 18, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21785), { 0, 0, height },
-                        { { 0, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21773), { 0, 0, height },
-                        { { 16, 16, height }, { 16, 16, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(21789), { 0, 0, height },
-                        { { 16, 16, height + 27 }, { 16, 16, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
@@ -1998,30 +1953,77 @@ static void SideFrictionRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 21867, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 21843, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        {
+            { 21864, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21868, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 21840, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21844, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        {
+            { 21866, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21869, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 21842, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21845, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 21865, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 21841, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21867), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21843), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 56);
@@ -2029,31 +2031,11 @@ static void SideFrictionRCTrackDiag25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21864), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21868), { -16, -16, height },
-                            { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21840), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21844), { -16, -16, height },
-                            { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
 
             WoodenBSupportsPaintSetupRotated(
@@ -2065,31 +2047,11 @@ static void SideFrictionRCTrackDiag25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21866), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21869), { -16, -16, height },
-                            { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21842), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21845), { -16, -16, height },
-                            { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
 
             WoodenBSupportsPaintSetupRotated(
@@ -2101,25 +2063,11 @@ static void SideFrictionRCTrackDiag25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21865), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21841), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 56);
@@ -2132,30 +2080,41 @@ static void SideFrictionRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 21855, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 21831, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 21853, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 21829, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21855), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21831), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
@@ -2283,25 +2242,11 @@ static void SideFrictionRCTrackDiagFlatTo25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21853), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21829), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
@@ -2314,30 +2259,77 @@ static void SideFrictionRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 21861, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 21837, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        {
+            { 21858, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21862, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 21834, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21838, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        {
+            { 21860, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21863, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 21836, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21839, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 21859, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 21835, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21861), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21837), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 56);
@@ -2345,31 +2337,11 @@ static void SideFrictionRCTrackDiag25DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21858), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21862), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21834), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21838), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
 
             WoodenBSupportsPaintSetupRotated(
@@ -2381,31 +2353,11 @@ static void SideFrictionRCTrackDiag25DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21860), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21863), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21836), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21839), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
 
             WoodenBSupportsPaintSetupRotated(
@@ -2417,25 +2369,11 @@ static void SideFrictionRCTrackDiag25DegUpToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21859), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21835), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 56);
@@ -2448,30 +2386,77 @@ static void SideFrictionRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 21865, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 21841, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        {
+            { 21866, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21869, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 21842, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21845, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        {
+            { 21864, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21868, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 21840, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21844, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 21867, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 21843, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21865), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21841), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 56);
@@ -2479,31 +2464,11 @@ static void SideFrictionRCTrackDiag25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21866), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21869), { -16, -16, height },
-                            { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21842), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21845), { -16, -16, height },
-                            { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
 
             WoodenBSupportsPaintSetupRotated(
@@ -2515,31 +2480,11 @@ static void SideFrictionRCTrackDiag25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21864), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21868), { -16, -16, height },
-                            { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21840), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21844), { -16, -16, height },
-                            { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
 
             WoodenBSupportsPaintSetupRotated(
@@ -2551,25 +2496,11 @@ static void SideFrictionRCTrackDiag25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21867), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21843), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 56);
@@ -2582,60 +2513,87 @@ static void SideFrictionRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 21859, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 21835, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        {
+            { 21860, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21863, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { 21836, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21839, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        {
+            { 21858, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21862, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { 21834, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 21838, { -16, -16, 0 }, { { -16, -16, 35 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 21861, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 21837, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21859), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21835), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             break;
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21860), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21863), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21836), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21839), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
 
             WoodenBSupportsPaintSetupRotated(
@@ -2645,31 +2603,11 @@ static void SideFrictionRCTrackDiagFlatTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21858), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21862), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21834), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21838), { -16, -16, height },
-                            { { -16, -16, height + 35 }, { 32, 32, 0 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
 
             WoodenBSupportsPaintSetupRotated(
@@ -2679,25 +2617,11 @@ static void SideFrictionRCTrackDiagFlatTo25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21861), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21837), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
             break;
     }
@@ -2711,30 +2635,41 @@ static void SideFrictionRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 21853, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 21829, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 21855, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 21831, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21853), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21829), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
@@ -2862,25 +2797,11 @@ static void SideFrictionRCTrackDiag25DegDownToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21855), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(21831), { -16, -16, height },
-                            { { -16, -16, height }, { 32, 32, 2 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 48);
@@ -3108,32 +3029,46 @@ static void SideFrictionRCTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_3_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_0_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_0_B, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_2_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_2_B, { -16, -16, 0 }, { { -16, -16, 43 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_1_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_3_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_0_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_0_B),
-                        { -16, -16, height }, { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             WoodenBSupportsPaintSetupRotated(
                 session, kSupportType, WoodenSupportSubType::Corner0, direction, height + 16, session.SupportColours);
@@ -3142,17 +3077,7 @@ static void SideFrictionRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_2_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_2_B),
-                        { -16, -16, height }, { { -16, -16, height + 43 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             WoodenBSupportsPaintSetupRotated(
                 session, kSupportType, WoodenSupportSubType::Corner2, direction, height + 16, session.SupportColours);
@@ -3161,14 +3086,7 @@ static void SideFrictionRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 104);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_DIR_1_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + 104);
@@ -3187,35 +3105,46 @@ static void SideFrictionRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_3_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_0_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_0_B, { -16, -16, 0 }, { { -16, -16, 59 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_2_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_2_B, { -16, -16, 0 }, { { -16, -16, 59 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_1_A, { -16, -16, 0 }, { { 0, 0, 0 }, { 16, 16, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_3_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_0_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_0_B),
-                        { -16, -16, height }, { { -16, -16, height + 59 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             WoodenBSupportsPaintSetupRotated(
                 session, kSupportType, WoodenSupportSubType::Corner0, direction, height + 16, session.SupportColours);
@@ -3224,19 +3153,7 @@ static void SideFrictionRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_2_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_2_B),
-                        { -16, -16, height }, { { -16, -16, height + 59 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             WoodenBSupportsPaintSetupRotated(
                 session, kSupportType, WoodenSupportSubType::Corner2, direction, height + 16, session.SupportColours);
@@ -3245,15 +3162,7 @@ static void SideFrictionRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_60_DEG_UP_TO_25_DEG_UP_DIR_1_A),
-                        { -16, -16, height }, { { 0, 0, height }, { 16, 16, 2 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
@@ -3271,6 +3180,31 @@ static void SideFrictionRCTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        {
+            { SPR_SIDE_FRICTION_DIAG_25_DEG_UP_TO_60_DEG_UP_DIR_0_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 24033, { -16, -16, 0 }, { { -16, -16, 59 }, { 32, 32, 0 } } },
+        },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        {
+            { SPR_SIDE_FRICTION_DIAG_25_DEG_UP_TO_60_DEG_UP_DIR_2_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } },
+            { 24034, { -16, -16, 0 }, { { -16, -16, 59 }, { 32, 32, 0 } } },
+        },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { SPR_SIDE_FRICTION_DIAG_25_DEG_UP_TO_60_DEG_UP_DIR_1_A, { -16, -16, 0 }, { { -16, -16, 0 }, { 32, 32, 2 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
@@ -3287,18 +3221,7 @@ static void SideFrictionRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_25_DEG_UP_TO_60_DEG_UP_DIR_0_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(24033), { -16, -16, height },
-                        { { -16, -16, height + 59 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             WoodenBSupportsPaintSetupRotated(
                 session, kSupportType, WoodenSupportSubType::Corner0, direction, height + 16, session.SupportColours);
@@ -3307,18 +3230,7 @@ static void SideFrictionRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_25_DEG_UP_TO_60_DEG_UP_DIR_2_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(24034), { -16, -16, height },
-                        { { -16, -16, height + 59 }, { 32, 32, 0 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             WoodenBSupportsPaintSetupRotated(
                 session, kSupportType, WoodenSupportSubType::Corner2, direction, height + 16, session.SupportColours);
@@ -3327,15 +3239,7 @@ static void SideFrictionRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction,
-                        session.TrackColours.WithIndex(SPR_SIDE_FRICTION_DIAG_25_DEG_UP_TO_60_DEG_UP_DIR_1_A),
-                        { -16, -16, height }, { { -16, -16, height }, { 32, 32, 2 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(session, kSegmentsAll, 0xFFFF, 0);
             PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
             break;
@@ -34,41 +34,26 @@ static void SuspendedSwingingRCTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 25963, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 25964, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 25963, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 25964, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25961, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 25962, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 25961, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 25962, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25963), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25964), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25961), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-            case 1:
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25962), { 0, 0, height + 29 },
-                    { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -114,57 +99,26 @@ static void SuspendedSwingingRCTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 26001, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26002, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26003, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 26004, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25973, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 25974, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 25975, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+        { { 25976, { 0, 0, 29 }, { { 0, 6, 45 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26001), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26002), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26003), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26004), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25973), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25974), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25975), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25976), { 0, 0, height + 29 },
-                    { { 0, 6, height + 45 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -207,29 +161,14 @@ static void SuspendedSwingingRCTrack60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25989), { 0, 0, height + 29 },
-                { { 0, 6, height + 93 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25990), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 81 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25991), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 81 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25992), { 0, 0, height + 29 },
-                { { 0, 6, height + 93 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25989, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+        { { 25990, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 25991, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 81 } } } },
+        { { 25992, { 0, 0, 29 }, { { 0, 6, 93 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -247,57 +186,26 @@ static void SuspendedSwingingRCTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 25993, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25994, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25995, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25996, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25965, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25966, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25967, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25968, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25993), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25994), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25995), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25996), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25965), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25966), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25967), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25968), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -340,35 +248,20 @@ static void SuspendedSwingingRCTrack25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25977), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25981), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25978), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25982), { 0, 0, height + 29 },
-                { { 0, 10, height + 11 }, { 32, 10, 49 } });
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25979), { 0, 0, height + 29 },
-                { { 0, 4, height + 11 }, { 32, 2, 49 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25980), { 0, 0, height + 29 },
-                { { 0, 6, height + 61 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25977, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 25981, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 25978, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 25982, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 25979, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 25980, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     if (direction == 0 || direction == 3)
     {
         PaintUtilPushTunnelRotated(session, direction, height - 8, TunnelType::InvertedSlopeStart);
@@ -386,69 +279,38 @@ static void SuspendedSwingingRCTrack60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 25983, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 25987, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 26090, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 25988, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 25985, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 25986, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25983, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+        {
+            { 25987, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 25984, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        {
+            { 25988, { 0, 0, 29 }, { { 0, 10, 11 }, { 32, 10, 49 } } },
+            { 25985, { 0, 0, 29 }, { { 0, 4, 11 }, { 32, 2, 49 } } },
+        },
+        { { 25986, { 0, 0, 29 }, { { 0, 6, 61 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25983), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25987), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26090), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25988), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25985), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25986), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25983), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25987), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25984), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25988), { 0, 0, height + 29 },
-                    { { 0, 10, height + 11 }, { 32, 10, 49 } });
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25985), { 0, 0, height + 29 },
-                    { { 0, 4, height + 11 }, { 32, 2, 49 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25986), { 0, 0, height + 29 },
-                    { { 0, 6, height + 61 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -491,57 +353,26 @@ static void SuspendedSwingingRCTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kChainSprites = {
+        { { 25997, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25998, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25999, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 26000, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25969, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25970, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25971, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+        { { 25972, { 0, 0, 29 }, { { 0, 6, 37 }, { 32, 20, 3 } } } },
+    };
+
     if (trackElement.HasChain())
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25997), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25998), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25999), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(26000), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kChainSprites);
     }
     else
     {
-        switch (direction)
-        {
-            case 0:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25969), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 1:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25970), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 2:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25971), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-            case 3:
-                PaintAddImageAsParentRotated(
-                    session, direction, session.TrackColours.WithIndex(25972), { 0, 0, height + 29 },
-                    { { 0, 6, height + 37 }, { 32, 20, 3 } });
-                break;
-        }
+        TrackPaintUtilPaintSprites(session, direction, height, kSprites);
     }
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -632,32 +463,41 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26014, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26019, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26024, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26009, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26013, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26018, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26023, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26008, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26012, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26017, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26022, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26007, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26011, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26016, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26021, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26006, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26010, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26015, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26020, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26005, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26014), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26019), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26024), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26009), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -679,27 +519,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26013), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26018), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26023), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26008), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -711,28 +531,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26012), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26017), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26022), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26007), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -747,27 +546,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26011), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26016), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26021), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26006), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -779,29 +558,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26010), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26015), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26020), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26005), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -841,28 +598,41 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26097, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26102, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 11 } } } },
+        { { 26107, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26112, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26098, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26103, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26108, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26113, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26099, { 0, 16, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26104, { 16, 16, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26109, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26114, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26100, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26105, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26110, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26115, { 16, 0, 29 }, { { 16, 0, 37 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26101, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26106, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26111, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26116, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26097), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26102), { 0, 6, height + 29 }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26107), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26112), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -884,25 +654,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26098), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26103), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26108), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26113), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -914,25 +666,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26099), { 0, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26104), { 16, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26109), { 16, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26114), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -947,26 +681,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26100), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26105), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26110), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26115), { 16, 0, height + 29 },
-                        { { 16, 0, height + 37 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -978,25 +693,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26101), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26106), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26111), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26116), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1027,28 +724,41 @@ static void SuspendedSwingingRCTrackRightQuarterTurn525DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26077, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26082, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26087, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 11 } } } },
+        { { 26092, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26078, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26083, { 0, 16, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26088, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26093, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26079, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26084, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26089, { 16, 16, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26094, { 0, 16, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26080, { 16, 0, 29 }, { { 16, 0, 37 }, { 16, 32, 3 } } } },
+        { { 26085, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26090, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 32, 3 } } } },
+        { { 26095, { 16, 0, 29 }, { { 16, 0, 29 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26081, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26086, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26091, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26096, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26077), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26082), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26087), { 0, 6, height + 29 }, { 32, 20, 11 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26092), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1070,25 +780,7 @@ static void SuspendedSwingingRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26078), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26083), { 0, 16, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26088), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26093), { 0, 0, height + 29 }, { 32, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1100,25 +792,7 @@ static void SuspendedSwingingRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26079), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26084), { 16, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26089), { 16, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26094), { 0, 16, height + 29 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1132,26 +806,7 @@ static void SuspendedSwingingRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26080), { 16, 0, height + 29 },
-                        { { 16, 0, height + 37 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26085), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26090), { 0, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26095), { 16, 0, height + 29 }, { 16, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1163,25 +818,7 @@ static void SuspendedSwingingRCTrackRightQuarterTurn525DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26081), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26086), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26091), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26096), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1230,28 +867,35 @@ static void SuspendedSwingingRCTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26139, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26146, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26142, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26143, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26140, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26145, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26141, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26144, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26141, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26144, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26140, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26145, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26142, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26143, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26139, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26146, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26139), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26146), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26142), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26143), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1270,25 +914,7 @@ static void SuspendedSwingingRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26140), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26145), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26141), { 0, 6, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26144), { 0, 6, height + 29 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1313,25 +939,7 @@ static void SuspendedSwingingRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26141), { 0, 6, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26144), { 0, 6, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26140), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26145), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1356,25 +964,7 @@ static void SuspendedSwingingRCTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26142), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26143), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26139), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26146), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1405,28 +995,35 @@ static void SuspendedSwingingRCTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26135, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26150, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26138, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26147, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26136, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26149, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26137, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26148, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26137, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26148, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 26, 3 } } } },
+        { { 26136, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+        { { 26149, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26138, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26147, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26135, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26150, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26135), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26150), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26138), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26147), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1445,25 +1042,7 @@ static void SuspendedSwingingRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26136), { 0, 6, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26149), { 0, 6, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26137), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26148), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1488,25 +1067,7 @@ static void SuspendedSwingingRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26137), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26148), { 0, 0, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26136), { 0, 6, height + 29 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26149), { 0, 6, height + 29 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1531,25 +1092,7 @@ static void SuspendedSwingingRCTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26138), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26147), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26135), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26150), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1580,32 +1123,29 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26070, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26073, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26076, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26067, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26069, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26072, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26075, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26066, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26068, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26071, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26074, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26065, { 0, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26070), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26073), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26076), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26067), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1627,28 +1167,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26069), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26072), { 0, 0, height + 29 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26075), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26066), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1660,29 +1179,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26068), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26071), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26074), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26065), { 0, 0, height + 29 },
-                        { { 6, 0, height + 29 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1722,28 +1219,23 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26130, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26132, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 11 } } } },
+        { { 26134, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26128, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26129, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26131, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26133, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26127, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26130), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26132), { 0, 6, height + 29 }, { 32, 20, 11 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26134), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26128), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1768,25 +1260,7 @@ static void SuspendedSwingingRCTrackLeftQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26129), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26131), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26133), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26127), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1817,28 +1291,23 @@ static void SuspendedSwingingRCTrackRightQuarterTurn325DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26119, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26121, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26123, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 11 } } } },
+        { { 26125, { 0, 6, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26120, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26122, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26124, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+        { { 26126, { 6, 0, 29 }, { { 6, 0, 29 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26119), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26121), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26123), { 0, 6, height + 29 }, { 32, 20, 11 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26125), { 0, 6, height + 29 }, { 32, 20, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1863,25 +1332,7 @@ static void SuspendedSwingingRCTrackRightQuarterTurn325DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26120), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26122), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26124), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26126), { 6, 0, height + 29 }, { 20, 32, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1930,21 +1381,14 @@ static void SuspendedSwingingRCTrackBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26117), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26118), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26117, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26118, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26117, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26118, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -1961,32 +1405,41 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26054, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 26059, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 26064, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 26049, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26053, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 26058, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 26063, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 26048, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26052, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+        { { 26057, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 26062, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 26047, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26051, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26056, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26061, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26046, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26050, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 26055, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 26060, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 26045, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26054), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26059), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26064), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26049), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2008,29 +1461,7 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26053), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26058), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26063), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26048), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2042,29 +1473,7 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26052), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26057), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26062), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26047), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2079,29 +1488,7 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26051), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26056), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26061), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26046), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2113,29 +1500,7 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26050), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26055), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26060), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26045), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2166,32 +1531,41 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26025, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 26030, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 26035, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+        { { 26040, { 0, 0, 29 }, { { 0, 6, 35 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26026, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 26031, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 26036, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 26041, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26027, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+        { { 26032, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 26037, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 26042, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26028, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26033, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26038, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26043, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26029, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 26034, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 26039, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+        { { 26044, { 0, 0, 29 }, { { 6, 0, 43 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26025), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26030), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26035), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26040), { 0, 0, height + 29 },
-                        { { 0, 6, height + 35 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2213,29 +1587,7 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26026), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26031), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26036), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26041), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2247,29 +1599,7 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26027), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26032), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26037), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26042), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2283,29 +1613,7 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26028), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26033), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26038), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26043), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2317,29 +1625,7 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeUp(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26029), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26034), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26039), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26044), { 0, 0, height + 29 },
-                        { { 6, 0, height + 43 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2370,32 +1656,41 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26034, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 26039, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 26044, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 26029, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26033, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 26038, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 26043, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 26028, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26032, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+        { { 26037, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 26042, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 26027, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26031, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26036, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26041, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26026, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26030, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 26035, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 26040, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 26025, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26034), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26039), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26044), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26029), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2417,29 +1712,7 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26033), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26038), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26043), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26028), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2451,29 +1724,7 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26032), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26037), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26042), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26027), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2488,29 +1739,7 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26031), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26036), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26041), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26026), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2522,29 +1751,7 @@ static void SuspendedSwingingRCTrackLeftQuarterHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26030), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26035), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26040), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26025), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2575,32 +1782,41 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26045, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 26050, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 26055, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+        { { 26060, { 0, 0, 29 }, { { 0, 6, 43 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26046, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 26051, { 0, 0, 29 }, { { 0, 16, 43 }, { 32, 16, 3 } } } },
+        { { 26056, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+        { { 26061, { 0, 0, 29 }, { { 0, 0, 43 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 26047, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 16, 3 } } } },
+        { { 26052, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 16, 3 } } } },
+        { { 26057, { 0, 0, 29 }, { { 16, 16, 43 }, { 16, 16, 3 } } } },
+        { { 26062, { 0, 0, 29 }, { { 0, 16, 43 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 26048, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26053, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26058, { 0, 0, 29 }, { { 0, 0, 43 }, { 16, 32, 3 } } } },
+        { { 26063, { 0, 0, 29 }, { { 16, 0, 43 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 26049, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 26054, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 26059, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+        { { 26064, { 0, 0, 29 }, { { 6, 0, 35 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26045), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26050), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26055), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26060), { 0, 0, height + 29 },
-                        { { 0, 6, height + 43 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2622,29 +1838,7 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26046), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26051), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26056), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26061), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2656,29 +1850,7 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26047), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26052), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26057), { 0, 0, height + 29 },
-                        { { 16, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26062), { 0, 0, height + 29 },
-                        { { 0, 16, height + 43 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2692,29 +1864,7 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26048), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26053), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26058), { 0, 0, height + 29 },
-                        { { 0, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26063), { 0, 0, height + 29 },
-                        { { 16, 0, height + 43 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2726,29 +1876,7 @@ static void SuspendedSwingingRCTrackRightQuarterHelixLargeDown(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26049), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26054), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26059), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26064), { 0, 0, height + 29 },
-                        { { 6, 0, height + 35 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2779,32 +1907,35 @@ static void SuspendedSwingingRCTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26167, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26171, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26175, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26179, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26168, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+        { { 26172, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 26176, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26180, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26169, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26173, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26177, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26181, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26170, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+        { { 26174, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 26178, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26182, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26167), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26171), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26175), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26179), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2823,29 +1954,7 @@ static void SuspendedSwingingRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26168), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26172), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26176), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26180), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2857,29 +1966,7 @@ static void SuspendedSwingingRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26169), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26173), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26177), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26181), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2902,29 +1989,7 @@ static void SuspendedSwingingRCTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26170), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26174), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26178), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26182), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -2963,33 +2028,36 @@ static void SuspendedSwingingRCTrackLeftEighthToDiag(
 static void SuspendedSwingingRCTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
-{
-    switch (trackSequence)
-    {
-        case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26151), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26155), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26159), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26163), { 0, 0, height + 29 },
-                        { { 0, 6, height + 29 }, { 32, 20, 3 } });
-                    break;
-            }
+{
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 26151, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26155, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26159, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26163, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26152, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26156, { 0, 0, 29 }, { { 0, 16, 29 }, { 32, 16, 3 } } } },
+        { { 26160, { 0, 0, 29 }, { { 0, 0, 29 }, { 34, 16, 3 } } } },
+        { { 26164, { 0, 0, 29 }, { { 0, 0, 29 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 26153, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26157, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26161, { 0, 0, 29 }, { { 4, 4, 29 }, { 28, 28, 3 } } } },
+        { { 26165, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 26154, { 0, 0, 29 }, { { 16, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26158, { 0, 0, 29 }, { { 0, 0, 29 }, { 16, 16, 3 } } } },
+        { { 26162, { 0, 0, 29 }, { { 0, 16, 29 }, { 16, 18, 3 } } } },
+        { { 26166, { 0, 0, 29 }, { { 16, 16, 29 }, { 16, 16, 3 } } } },
+    };
+
+    switch (trackSequence)
+    {
+        case 0:
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3008,29 +2076,7 @@ static void SuspendedSwingingRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26152), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26156), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26160), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26164), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3042,29 +2088,7 @@ static void SuspendedSwingingRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26153), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26157), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26161), { 0, 0, height + 29 },
-                        { { 4, 4, height + 29 }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26165), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3087,29 +2111,7 @@ static void SuspendedSwingingRCTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26154), { 0, 0, height + 29 },
-                        { { 16, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26158), { 0, 0, height + 29 },
-                        { { 0, 0, height + 29 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26162), { 0, 0, height + 29 },
-                        { { 0, 16, height + 29 }, { 16, 18, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26166), { 0, 0, height + 29 },
-                        { { 16, 16, height + 29 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3186,30 +2188,65 @@ static void SuspendedSwingingRCTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26226, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26198, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26223, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26195, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26225, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26197, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26224, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26196, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26226), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26198), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3224,25 +2261,11 @@ static void SuspendedSwingingRCTrackDiag25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26223), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26195), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3256,25 +2279,11 @@ static void SuspendedSwingingRCTrackDiag25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26225), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26197), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3289,25 +2298,11 @@ static void SuspendedSwingingRCTrackDiag25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26224), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26196), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -3348,17 +2343,35 @@ static void SuspendedSwingingRCTrackDiag60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26210, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26207, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26209, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26208, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26210), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3370,14 +2383,7 @@ static void SuspendedSwingingRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26207), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3388,14 +2394,7 @@ static void SuspendedSwingingRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26209), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3407,14 +2406,7 @@ static void SuspendedSwingingRCTrackDiag60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26208), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3454,30 +2446,65 @@ static void SuspendedSwingingRCTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26218, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26190, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26215, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26187, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26217, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26189, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26216, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26188, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26218), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26190), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3492,25 +2519,11 @@ static void SuspendedSwingingRCTrackDiagFlatTo25DegUp(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26215), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26187), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3524,25 +2537,11 @@ static void SuspendedSwingingRCTrackDiagFlatTo25DegUp(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26217), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26189), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3557,25 +2556,11 @@ static void SuspendedSwingingRCTrackDiagFlatTo25DegUp(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26216), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26188), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -3616,17 +2601,35 @@ static void SuspendedSwingingRCTrackDiag25DegUpTo60DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26202, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26199, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26201, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26200, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26202), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3638,14 +2641,7 @@ static void SuspendedSwingingRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26199), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3656,14 +2652,7 @@ static void SuspendedSwingingRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26201), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3675,14 +2664,7 @@ static void SuspendedSwingingRCTrackDiag25DegUpTo60DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26200), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3722,17 +2704,35 @@ static void SuspendedSwingingRCTrackDiag60DegUpTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26206, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26203, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26205, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26204, { -16, -16, 29 }, { { 0, 0, 61 }, { 16, 16, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26206), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3744,14 +2744,7 @@ static void SuspendedSwingingRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26203), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3762,14 +2755,7 @@ static void SuspendedSwingingRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26205), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -3781,14 +2767,7 @@ static void SuspendedSwingingRCTrackDiag60DegUpTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26204), { -16, -16, height + 29 },
-                        { { 0, 0, height + 61 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3828,30 +2807,65 @@ static void SuspendedSwingingRCTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26222, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26194, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26219, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26191, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26221, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26193, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26220, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26192, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26222), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26194), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3866,25 +2880,11 @@ static void SuspendedSwingingRCTrackDiag25DegUpToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26219), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26191), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3898,25 +2898,11 @@ static void SuspendedSwingingRCTrackDiag25DegUpToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26221), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26193), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -3931,25 +2917,11 @@ static void SuspendedSwingingRCTrackDiag25DegUpToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26220), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26192), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -3990,30 +2962,65 @@ static void SuspendedSwingingRCTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26224, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26196, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26225, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26197, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26223, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26195, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26226, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26198, { -16, -16, 29 }, { { -16, -16, 45 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26224), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26196), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4028,25 +3035,11 @@ static void SuspendedSwingingRCTrackDiag25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26225), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26197), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4060,25 +3053,11 @@ static void SuspendedSwingingRCTrackDiag25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26223), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26195), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4093,25 +3072,11 @@ static void SuspendedSwingingRCTrackDiag25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26226), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26198), { -16, -16, height + 29 },
-                            { { -16, -16, height + 45 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -4152,17 +3117,35 @@ static void SuspendedSwingingRCTrackDiag60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26208, { -16, -16, 29 }, { { -16, -16, 29 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26209, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26207, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26210, { -16, -16, 29 }, { { -16, -16, 93 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26208), { -16, -16, height + 29 },
-                        { { -16, -16, height + 29 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4174,14 +3157,7 @@ static void SuspendedSwingingRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26209), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4192,14 +3168,7 @@ static void SuspendedSwingingRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26207), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4211,14 +3180,7 @@ static void SuspendedSwingingRCTrackDiag60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 120);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26210), { -16, -16, height + 29 },
-                        { { -16, -16, height + 93 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4237,30 +3199,65 @@ static void SuspendedSwingingRCTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26220, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26192, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26221, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26193, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26219, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26191, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26222, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26194, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26220), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26192), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4274,25 +3271,11 @@ static void SuspendedSwingingRCTrackDiagFlatTo25DegDown(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26221), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26193), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4305,25 +3288,11 @@ static void SuspendedSwingingRCTrackDiagFlatTo25DegDown(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26219), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26191), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4337,25 +3306,11 @@ static void SuspendedSwingingRCTrackDiagFlatTo25DegDown(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26222), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26194), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -4396,17 +3351,35 @@ static void SuspendedSwingingRCTrackDiag25DegDownTo60DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26204, { -16, -16, 29 }, { { 0, 0, 61 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26205, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26203, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26206, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26204), { -16, -16, height + 29 },
-                        { { 0, 0, height + 61 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4418,14 +3391,7 @@ static void SuspendedSwingingRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26205), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4436,14 +3402,7 @@ static void SuspendedSwingingRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26203), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4455,14 +3414,7 @@ static void SuspendedSwingingRCTrackDiag25DegDownTo60DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26206), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4502,17 +3454,35 @@ static void SuspendedSwingingRCTrackDiag60DegDownTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26200, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26201, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26199, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26202, { -16, -16, 29 }, { { -16, -16, 61 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26200), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4524,14 +3494,7 @@ static void SuspendedSwingingRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26201), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4542,14 +3505,7 @@ static void SuspendedSwingingRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26199), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -4561,14 +3517,7 @@ static void SuspendedSwingingRCTrackDiag60DegDownTo25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 88);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(26202), { -16, -16, height + 29 },
-                        { { -16, -16, height + 61 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4608,30 +3557,65 @@ static void SuspendedSwingingRCTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0ChainSprites = {
+        {},
+        {},
+        {},
+        { { 26216, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 26188, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1ChainSprites = {
+        { { 26217, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 26189, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2ChainSprites = {
+        {},
+        {},
+        { { 26215, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 26187, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3ChainSprites = {
+        {},
+        { { 26218, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 26190, { -16, -16, 29 }, { { -16, -16, 37 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26216), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 3:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26188), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4646,25 +3630,11 @@ static void SuspendedSwingingRCTrackDiag25DegDownToFlat(
         case 1:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26217), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 0:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26189), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4678,25 +3648,11 @@ static void SuspendedSwingingRCTrackDiag25DegDownToFlat(
         case 2:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26215), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 2:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26187), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             }
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -4711,25 +3667,11 @@ static void SuspendedSwingingRCTrackDiag25DegDownToFlat(
         case 3:
             if (trackElement.HasChain())
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26218), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3ChainSprites);
             }
             else
             {
-                switch (direction)
-                {
-                    case 1:
-                        PaintAddImageAsParentRotated(
-                            session, direction, session.TrackColours.WithIndex(26190), { -16, -16, height + 29 },
-                            { { -16, -16, height + 37 }, { 32, 32, 3 } });
-                        break;
-                }
+                TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             }
 
             PaintUtilSetSegmentSupportHeight(
@@ -4770,21 +3712,14 @@ static void SuspendedSwingingRCTrackBlockBrakes(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26117), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(26118), { 0, 0, height + 29 },
-                { { 0, 6, height + 29 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 26117, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26118, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26117, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+        { { 26118, { 0, 0, 29 }, { { 0, 6, 29 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -32,21 +32,14 @@ static void SuspendedMonorailTrackFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25853), { 0, 0, height + 32 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-        case 1:
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25854), { 0, 0, height + 32 },
-                { { 0, 6, height + 32 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25853, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25854, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25853, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25854, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -91,29 +84,14 @@ static void SuspendedMonorailTrack25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25945), { 0, 0, height + 32 },
-                { { 0, 6, height + 48 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25946), { 0, 0, height + 32 },
-                { { 0, 6, height + 48 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25947), { 0, 0, height + 32 },
-                { { 0, 6, height + 48 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25948), { 0, 0, height + 32 },
-                { { 0, 6, height + 48 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25945, { 0, 0, 32 }, { { 0, 6, 48 }, { 32, 20, 3 } } } },
+        { { 25946, { 0, 0, 32 }, { { 0, 6, 48 }, { 32, 20, 3 } } } },
+        { { 25947, { 0, 0, 32 }, { { 0, 6, 48 }, { 32, 20, 3 } } } },
+        { { 25948, { 0, 0, 32 }, { { 0, 6, 48 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -155,29 +133,14 @@ static void SuspendedMonorailTrackFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25937), { 0, 0, height + 32 },
-                { { 0, 6, height + 40 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25938), { 0, 0, height + 32 },
-                { { 0, 6, height + 40 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25939), { 0, 0, height + 32 },
-                { { 0, 6, height + 40 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25940), { 0, 0, height + 32 },
-                { { 0, 6, height + 40 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25937, { 0, 0, 32 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 25938, { 0, 0, 32 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 25939, { 0, 0, 32 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 25940, { 0, 0, 32 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -219,29 +182,14 @@ static void SuspendedMonorailTrack25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
-    switch (direction)
-    {
-        case 0:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25941), { 0, 0, height + 32 },
-                { { 0, 6, height + 40 }, { 32, 20, 3 } });
-            break;
-        case 1:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25942), { 0, 0, height + 32 },
-                { { 0, 6, height + 40 }, { 32, 20, 3 } });
-            break;
-        case 2:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25943), { 0, 0, height + 32 },
-                { { 0, 6, height + 40 }, { 32, 20, 3 } });
-            break;
-        case 3:
-            PaintAddImageAsParentRotated(
-                session, direction, session.TrackColours.WithIndex(25944), { 0, 0, height + 32 },
-                { { 0, 6, height + 40 }, { 32, 20, 3 } });
-            break;
-    }
+    static constexpr TrackPaintSpriteTable kSprites = {
+        { { 25941, { 0, 0, 32 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 25942, { 0, 0, 32 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 25943, { 0, 0, 32 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+        { { 25944, { 0, 0, 32 }, { { 0, 6, 40 }, { 32, 20, 3 } } } },
+    };
+
+    TrackPaintUtilPaintSprites(session, direction, height, kSprites);
 
     PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
     if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
@@ -307,32 +255,41 @@ static void SuspendedMonorailTrackLeftQuarterTurn5(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 25876, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25881, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25886, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25871, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 25875, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 25880, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 25885, { 0, 0, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 25870, { 0, 0, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 25874, { 0, 0, 32 }, { { 0, 16, 32 }, { 16, 16, 3 } } } },
+        { { 25879, { 0, 0, 32 }, { { 16, 16, 32 }, { 16, 16, 3 } } } },
+        { { 25884, { 0, 0, 32 }, { { 16, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25869, { 0, 0, 32 }, { { 0, 0, 32 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence5Sprites = {
+        { { 25873, { 0, 0, 32 }, { { 16, 0, 32 }, { 16, 32, 3 } } } },
+        { { 25878, { 0, 0, 32 }, { { 0, 0, 32 }, { 16, 32, 3 } } } },
+        { { 25883, { 0, 0, 32 }, { { 0, 0, 32 }, { 16, 32, 3 } } } },
+        { { 25868, { 0, 0, 32 }, { { 16, 0, 32 }, { 16, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence6Sprites = {
+        { { 25872, { 0, 0, 32 }, { { 6, 0, 32 }, { 20, 32, 3 } } } },
+        { { 25877, { 0, 0, 32 }, { { 6, 0, 32 }, { 20, 32, 3 } } } },
+        { { 25882, { 0, 0, 32 }, { { 6, 0, 32 }, { 20, 32, 3 } } } },
+        { { 25867, { 0, 0, 32 }, { { 6, 0, 32 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25876), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25881), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25886), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25871), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -354,27 +311,7 @@ static void SuspendedMonorailTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25875), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25880), { 0, 0, height + 32 }, { 32, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25885), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25870), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -386,28 +323,7 @@ static void SuspendedMonorailTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25874), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25879), { 0, 0, height + 32 },
-                        { { 16, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25884), { 0, 0, height + 32 },
-                        { { 16, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25869), { 0, 0, height + 32 }, { 16, 16, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -422,27 +338,7 @@ static void SuspendedMonorailTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 5:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25873), { 0, 0, height + 32 },
-                        { { 16, 0, height + 32 }, { 16, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25878), { 0, 0, height + 32 }, { 16, 32, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25883), { 0, 0, height + 32 }, { 16, 32, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25868), { 0, 0, height + 32 },
-                        { { 16, 0, height + 32 }, { 16, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence5Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -454,29 +350,7 @@ static void SuspendedMonorailTrackLeftQuarterTurn5(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 6:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25872), { 0, 0, height + 32 },
-                        { { 6, 0, height + 32 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25877), { 0, 0, height + 32 },
-                        { { 6, 0, height + 32 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25882), { 0, 0, height + 32 },
-                        { { 6, 0, height + 32 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25867), { 0, 0, height + 32 },
-                        { { 6, 0, height + 32 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence6Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -516,32 +390,35 @@ static void SuspendedMonorailTrackSBendLeft(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 25919, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25923, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25922, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25926, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25920, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 26, 3 } } } },
+        { { 25924, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 26, 3 } } } },
+        { { 25921, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 26, 3 } } } },
+        { { 25925, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 25921, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 26, 3 } } } },
+        { { 25925, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 26, 3 } } } },
+        { { 25920, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 26, 3 } } } },
+        { { 25924, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 25922, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25926, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25919, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25923, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25919), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25923), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25922), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25926), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -560,27 +437,7 @@ static void SuspendedMonorailTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25920), { 0, 0, height + 32 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25924), { 0, 0, height + 32 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25921), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25925), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -605,27 +462,7 @@ static void SuspendedMonorailTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25921), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25925), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25920), { 0, 0, height + 32 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25924), { 0, 0, height + 32 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -650,29 +487,7 @@ static void SuspendedMonorailTrackSBendLeft(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25922), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25926), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25919), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25923), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -703,32 +518,35 @@ static void SuspendedMonorailTrackSBendRight(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 25927, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25931, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25930, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25934, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25928, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 26, 3 } } } },
+        { { 25932, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 26, 3 } } } },
+        { { 25929, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 26, 3 } } } },
+        { { 25933, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 25929, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 26, 3 } } } },
+        { { 25933, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 26, 3 } } } },
+        { { 25928, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 26, 3 } } } },
+        { { 25932, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 26, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 25930, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25934, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25927, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25931, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25927), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25931), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25930), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25934), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -747,27 +565,7 @@ static void SuspendedMonorailTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25928), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 26, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25932), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 26, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25929), { 0, 0, height + 32 }, { 32, 26, 3 });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25933), { 0, 0, height + 32 }, { 32, 26, 3 });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -792,27 +590,7 @@ static void SuspendedMonorailTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25929), { 0, 0, height + 32 }, { 32, 26, 3 });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25933), { 0, 0, height + 32 }, { 32, 26, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25928), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 26, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25932), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 26, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -837,29 +615,7 @@ static void SuspendedMonorailTrackSBendRight(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25930), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25934), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25927), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25931), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -890,32 +646,29 @@ static void SuspendedMonorailTrackLeftQuarterTurn3(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 25860, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25863, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25866, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25857, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 25859, { 0, 0, 32 }, { { 16, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25862, { 0, 0, 32 }, { { 0, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25865, { 0, 0, 32 }, { { 0, 16, 32 }, { 16, 16, 3 } } } },
+        { { 25856, { 0, 0, 32 }, { { 16, 16, 32 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        { { 25858, { 0, 0, 32 }, { { 6, 0, 32 }, { 20, 32, 3 } } } },
+        { { 25861, { 0, 0, 32 }, { { 6, 0, 32 }, { 20, 32, 3 } } } },
+        { { 25864, { 0, 0, 32 }, { { 6, 0, 32 }, { 20, 32, 3 } } } },
+        { { 25855, { 0, 0, 32 }, { { 6, 0, 32 }, { 20, 32, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25860), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25863), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25866), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25857), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -937,28 +690,7 @@ static void SuspendedMonorailTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25859), { 0, 0, height + 32 },
-                        { { 16, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25862), { 0, 0, height + 32 }, { 16, 16, 3 });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25865), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25856), { 0, 0, height + 32 },
-                        { { 16, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -970,29 +702,7 @@ static void SuspendedMonorailTrackLeftQuarterTurn3(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 3:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25858), { 0, 0, height + 32 },
-                        { { 6, 0, height + 32 }, { 20, 32, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25861), { 0, 0, height + 32 },
-                        { { 6, 0, height + 32 }, { 20, 32, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25864), { 0, 0, height + 32 },
-                        { { 6, 0, height + 32 }, { 20, 32, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25855), { 0, 0, height + 32 },
-                        { { 6, 0, height + 32 }, { 20, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1032,32 +742,35 @@ static void SuspendedMonorailTrackLeftEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 25903, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25907, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25911, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25915, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25904, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+        { { 25908, { 0, 0, 32 }, { { 0, 0, 32 }, { 34, 16, 3 } } } },
+        { { 25912, { 0, 0, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 25916, { 0, 0, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 25905, { 0, 0, 32 }, { { 0, 16, 32 }, { 16, 16, 3 } } } },
+        { { 25909, { 0, 0, 32 }, { { 16, 16, 32 }, { 16, 16, 3 } } } },
+        { { 25913, { 0, 0, 32 }, { { 16, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25917, { 0, 0, 32 }, { { 0, 0, 32 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 25906, { 0, 0, 32 }, { { 16, 16, 32 }, { 16, 16, 3 } } } },
+        { { 25910, { 0, 0, 32 }, { { 0, 16, 32 }, { 16, 18, 3 } } } },
+        { { 25914, { 0, 0, 32 }, { { 0, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25918, { 0, 0, 32 }, { { 16, 0, 32 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25903), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25907), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25911), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25915), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -1070,29 +783,7 @@ static void SuspendedMonorailTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25904), { 0, 0, height + 32 },
-                        { { 0, 0, height + 32 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25908), { 0, 0, height + 32 },
-                        { { 0, 0, height + 32 }, { 34, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25912), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 32, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25916), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1104,29 +795,7 @@ static void SuspendedMonorailTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25905), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25909), { 0, 0, height + 32 },
-                        { { 16, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25913), { 0, 0, height + 32 },
-                        { { 16, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25917), { 0, 0, height + 32 },
-                        { { 0, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1149,29 +818,7 @@ static void SuspendedMonorailTrackLeftEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25906), { 0, 0, height + 32 },
-                        { { 16, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25910), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 16, 18, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25914), { 0, 0, height + 32 },
-                        { { 0, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25918), { 0, 0, height + 32 },
-                        { { 16, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1211,32 +858,35 @@ static void SuspendedMonorailTrackRightEighthToDiag(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        { { 25887, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25891, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25895, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+        { { 25899, { 0, 0, 32 }, { { 0, 6, 32 }, { 32, 20, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25888, { 0, 0, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 25892, { 0, 0, 32 }, { { 0, 16, 32 }, { 32, 16, 3 } } } },
+        { { 25896, { 0, 0, 32 }, { { 0, 0, 32 }, { 34, 16, 3 } } } },
+        { { 25900, { 0, 0, 32 }, { { 0, 0, 32 }, { 32, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        { { 25889, { 0, 0, 32 }, { { 0, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25893, { 0, 0, 32 }, { { 16, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25897, { 0, 0, 32 }, { { 4, 4, 32 }, { 28, 28, 3 } } } },
+        { { 25901, { 0, 0, 32 }, { { 0, 16, 32 }, { 16, 16, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence4Sprites = {
+        { { 25890, { 0, 0, 32 }, { { 16, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25894, { 0, 0, 32 }, { { 0, 0, 32 }, { 16, 16, 3 } } } },
+        { { 25898, { 0, 0, 32 }, { { 0, 16, 32 }, { 16, 18, 3 } } } },
+        { { 25902, { 0, 0, 32 }, { { 16, 16, 32 }, { 16, 16, 3 } } } },
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25887), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25891), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25895), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25899), { 0, 0, height + 32 },
-                        { { 0, 6, height + 32 }, { 32, 20, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
@@ -1249,29 +899,7 @@ static void SuspendedMonorailTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25888), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 32, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25892), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 32, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25896), { 0, 0, height + 32 },
-                        { { 0, 0, height + 32 }, { 34, 16, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25900), { 0, 0, height + 32 },
-                        { { 0, 0, height + 32 }, { 32, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1283,29 +911,7 @@ static void SuspendedMonorailTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 2:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25889), { 0, 0, height + 32 },
-                        { { 0, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25893), { 0, 0, height + 32 },
-                        { { 16, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25897), { 0, 0, height + 32 },
-                        { { 4, 4, height + 32 }, { 28, 28, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25901), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1328,29 +934,7 @@ static void SuspendedMonorailTrackRightEighthToDiag(
             PaintUtilSetGeneralSupportHeight(session, height + 48);
             break;
         case 4:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25890), { 0, 0, height + 32 },
-                        { { 16, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25894), { 0, 0, height + 32 },
-                        { { 0, 0, height + 32 }, { 16, 16, 3 } });
-                    break;
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25898), { 0, 0, height + 32 },
-                        { { 0, 16, height + 32 }, { 16, 18, 3 } });
-                    break;
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25902), { 0, 0, height + 32 },
-                        { { 16, 16, height + 32 }, { 16, 16, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence4Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1427,17 +1011,35 @@ static void SuspendedMonorailTrackDiag25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 25960, { -16, -16, 32 }, { { -16, -16, 48 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25957, { -16, -16, 32 }, { { -16, -16, 48 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 25959, { -16, -16, 32 }, { { -16, -16, 48 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 25958, { -16, -16, 32 }, { { -16, -16, 48 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25960), { -16, -16, height + 32 },
-                        { { -16, -16, height + 48 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1449,14 +1051,7 @@ static void SuspendedMonorailTrackDiag25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25957), { -16, -16, height + 32 },
-                        { { -16, -16, height + 48 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1467,14 +1062,7 @@ static void SuspendedMonorailTrackDiag25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25959), { -16, -16, height + 32 },
-                        { { -16, -16, height + 48 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1486,14 +1074,7 @@ static void SuspendedMonorailTrackDiag25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25958), { -16, -16, height + 32 },
-                        { { -16, -16, height + 48 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1533,17 +1114,35 @@ static void SuspendedMonorailTrackDiagFlatTo25DegUp(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 25952, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25949, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 25951, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 25950, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25952), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1555,14 +1154,7 @@ static void SuspendedMonorailTrackDiagFlatTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25949), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1573,14 +1165,7 @@ static void SuspendedMonorailTrackDiagFlatTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25951), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1592,14 +1177,7 @@ static void SuspendedMonorailTrackDiagFlatTo25DegUp(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25950), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1639,17 +1217,35 @@ static void SuspendedMonorailTrackDiag25DegUpToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 25956, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25953, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 25955, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 25954, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25956), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1661,14 +1257,7 @@ static void SuspendedMonorailTrackDiag25DegUpToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25953), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1679,14 +1268,7 @@ static void SuspendedMonorailTrackDiag25DegUpToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25955), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1698,14 +1280,7 @@ static void SuspendedMonorailTrackDiag25DegUpToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25954), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1745,17 +1320,35 @@ static void SuspendedMonorailTrackDiag25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 25958, { -16, -16, 32 }, { { -16, -16, 48 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25959, { -16, -16, 32 }, { { -16, -16, 48 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 25957, { -16, -16, 32 }, { { -16, -16, 48 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 25960, { -16, -16, 32 }, { { -16, -16, 48 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25958), { -16, -16, height + 32 },
-                        { { -16, -16, height + 48 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1767,14 +1360,7 @@ static void SuspendedMonorailTrackDiag25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25959), { -16, -16, height + 32 },
-                        { { -16, -16, height + 48 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1785,14 +1371,7 @@ static void SuspendedMonorailTrackDiag25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25957), { -16, -16, height + 32 },
-                        { { -16, -16, height + 48 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1804,14 +1383,7 @@ static void SuspendedMonorailTrackDiag25DegDown(
             PaintUtilSetGeneralSupportHeight(session, height + 72);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25960), { -16, -16, height + 32 },
-                        { { -16, -16, height + 48 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1851,17 +1423,35 @@ static void SuspendedMonorailTrackDiagFlatTo25DegDown(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 25954, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25955, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 25953, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 25956, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25954), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1872,14 +1462,7 @@ static void SuspendedMonorailTrackDiagFlatTo25DegDown(
                 0xFFFF, 0);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25955), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1889,14 +1472,7 @@ static void SuspendedMonorailTrackDiagFlatTo25DegDown(
                 0xFFFF, 0);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25953), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1907,14 +1483,7 @@ static void SuspendedMonorailTrackDiagFlatTo25DegDown(
                 0xFFFF, 0);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25956), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
@@ -1954,17 +1523,35 @@ static void SuspendedMonorailTrackDiag25DegDownToFlat(
     PaintSession& session, const Ride& ride, uint8_t trackSequence, uint8_t direction, int32_t height,
     const TrackElement& trackElement)
 {
+    static constexpr TrackPaintSpriteTable kSequence0Sprites = {
+        {},
+        {},
+        {},
+        { { 25950, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+    };
+    static constexpr TrackPaintSpriteTable kSequence1Sprites = {
+        { { 25951, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence2Sprites = {
+        {},
+        {},
+        { { 25949, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+    };
+    static constexpr TrackPaintSpriteTable kSequence3Sprites = {
+        {},
+        { { 25952, { -16, -16, 32 }, { { -16, -16, 40 }, { 32, 32, 3 } } } },
+        {},
+        {},
+    };
+
     switch (trackSequence)
     {
         case 0:
-            switch (direction)
-            {
-                case 3:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25950), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence0Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1976,14 +1563,7 @@ static void SuspendedMonorailTrackDiag25DegDownToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 1:
-            switch (direction)
-            {
-                case 0:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25951), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence1Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -1994,14 +1574,7 @@ static void SuspendedMonorailTrackDiag25DegDownToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 2:
-            switch (direction)
-            {
-                case 2:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25949), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence2Sprites);
             PaintUtilSetSegmentSupportHeight(
                 session,
                 PaintUtilRotateSegments(
@@ -2013,14 +1586,7 @@ static void SuspendedMonorailTrackDiag25DegDownToFlat(
             PaintUtilSetGeneralSupportHeight(session, height + 64);
             break;
         case 3:
-            switch (direction)
-            {
-                case 1:
-                    PaintAddImageAsParentRotated(
-                        session, direction, session.TrackColours.WithIndex(25952), { -16, -16, height + 32 },
-                        { { -16, -16, height + 40 }, { 32, 32, 3 } });
-                    break;
-            }
+            TrackPaintUtilPaintSprites(session, direction, height, kSequence3Sprites);
 
             PaintUtilSetSegmentSupportHeight(
                 session,
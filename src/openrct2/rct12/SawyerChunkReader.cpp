@@ -12,6 +12,9 @@
 #include "../core/IStream.hpp"
 #include "../core/Numerics.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace OpenRCT2;
 
 // malloc is very slow for large allocations in MSVC debug builds as it allocates
@@ -33,6 +36,8 @@ constexpr const char* EXCEPTION_MSG_DESTINATION_TOO_SMALL = "Chunk data larger t
 constexpr const char* EXCEPTION_MSG_INVALID_CHUNK_ENCODING = "Invalid chunk encoding.";
 constexpr const char* EXCEPTION_MSG_ZERO_SIZED_CHUNK = "Encountered zero-sized chunk.";
 
+static size_t DecodeChunkRLERepeat(const uint8_t* src, size_t srcLength, uint8_t* dst, size_t dstLength);
+
 SawyerChunkReader::SawyerChunkReader(OpenRCT2::IStream* stream)
     : _stream(stream)
 {
@@ -60,32 +65,13 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunk()
     try
     {
         auto header = _stream->ReadValue<SawyerCodingChunkHeader>();
-        if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
-            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
-
-        switch (header.encoding)
+        auto compressedData = ReadCompressedData(header);
+        auto buffer = DecodeChunk(compressedData, header);
+        if (buffer.empty())
         {
-            case CHUNK_ENCODING_NONE:
-            case CHUNK_ENCODING_RLE:
-            case CHUNK_ENCODING_RLECOMPRESSED:
-            case CHUNK_ENCODING_ROTATE:
-            {
-                auto compressedData = std::make_unique<uint8_t[]>(header.length);
-                if (_stream->TryRead(compressedData.get(), header.length) != header.length)
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
-                }
-
-                auto buffer = DecodeChunk(compressedData.get(), header);
-                if (buffer.empty())
-                {
-                    throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
-                }
-                return std::make_shared<SawyerChunk>(static_cast<SAWYER_ENCODING>(header.encoding), std::move(buffer));
-            }
-            default:
-                throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+            throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
         }
+        return std::make_shared<SawyerChunk>(static_cast<SAWYER_ENCODING>(header.encoding), std::move(buffer));
     }
     catch (const std::exception&)
     {
@@ -107,15 +93,15 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
             throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
         }
         uint32_t compressedDataLength = compressedDataLength64;
-        auto compressedData = std::make_unique<uint8_t[]>(compressedDataLength);
+        auto compressedData = GetBuffer(_compressedBuffer, compressedDataLength);
 
-        if (_stream->TryRead(compressedData.get(), compressedDataLength) != compressedDataLength)
+        if (_stream->TryRead(compressedData, compressedDataLength) != compressedDataLength)
         {
             throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
         }
 
         SawyerCodingChunkHeader header{ CHUNK_ENCODING_RLE, compressedDataLength };
-        auto buffer = DecodeChunk(compressedData.get(), header);
+        auto buffer = DecodeChunk(compressedData, header);
         if (buffer.empty())
         {
             throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
@@ -132,158 +118,371 @@ std::shared_ptr<SawyerChunk> SawyerChunkReader::ReadChunkTrack()
 
 void SawyerChunkReader::ReadChunk(void* dst, size_t length)
 {
-    auto chunk = ReadChunk();
-    auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
-    auto chunkLength = chunk->GetLength();
-    if (chunkLength > length)
-    {
-        std::memcpy(dst, chunkData, length);
-    }
-    else
+    uint64_t originalPosition = _stream->GetPosition();
+    try
     {
-        std::memcpy(dst, chunkData, chunkLength);
-        auto remainingLength = length - chunkLength;
-        if (remainingLength > 0)
+        auto header = _stream->ReadValue<SawyerCodingChunkHeader>();
+        auto compressedData = ReadCompressedData(header);
+        auto dst8 = static_cast<uint8_t*>(dst);
+        if (header.encoding == CHUNK_ENCODING_RLECOMPRESSED)
         {
-            auto offset = static_cast<uint8_t*>(dst) + chunkLength;
-            std::fill_n(offset, remainingLength, 0x00);
+            // Working out the length first would take as long as decoding it, so it is done in one go
+            auto decodedLength = DecodeChunkRLERepeat(compressedData, header.length, dst8, length);
+            if (decodedLength == 0)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+            }
+            if (decodedLength < length)
+            {
+                std::fill_n(dst8 + decodedLength, length - decodedLength, 0x00);
+            }
+            return;
+        }
+
+        auto decodedLength = PrepareDecode(compressedData, header);
+        if (decodedLength == 0)
+        {
+            throw SawyerChunkException(EXCEPTION_MSG_ZERO_SIZED_CHUNK);
+        }
+
+        if (decodedLength <= length)
+        {
+            DecodeChunk(compressedData, header, dst8, decodedLength);
+            std::fill_n(dst8 + decodedLength, length - decodedLength, 0x00);
+        }
+        else
+        {
+            // Only the start of the chunk is wanted, but the repeat encoding may refer back to any of it
+            std::vector<uint8_t> buffer(decodedLength);
+            DecodeChunk(compressedData, header, buffer.data(), decodedLength);
+            std::memcpy(dst, buffer.data(), length);
         }
     }
+    catch (const std::exception&)
+    {
+        // Rewind stream back to original position
+        _stream->SetPosition(originalPosition);
+        throw;
+    }
 }
 
-std::vector<uint8_t> SawyerChunkReader::DecodeChunk(const void* src, const SawyerCodingChunkHeader& header)
+uint8_t* SawyerChunkReader::GetBuffer(std::vector<uint8_t>& buffer, size_t length)
 {
-    std::vector<uint8_t> buf;
+    // Only ever grow the buffer, so that reading a file's chunks allocates for the largest of them alone. It is never
+    // left empty, so that even zero-length reads get a valid pointer.
+    length = std::max<size_t>(length, 1);
+    if (buffer.size() < length)
+    {
+        buffer.resize(length);
+    }
+    return buffer.data();
+}
+
+const uint8_t* SawyerChunkReader::ReadCompressedData(const SawyerCodingChunkHeader& header)
+{
+    if (header.length >= MAX_UNCOMPRESSED_CHUNK_SIZE)
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+
     switch (header.encoding)
     {
         case CHUNK_ENCODING_NONE:
-            buf.resize(header.length);
-            std::memcpy(buf.data(), src, header.length);
-            break;
         case CHUNK_ENCODING_RLE:
-            buf = DecodeChunkRLE(src, header.length);
-            break;
         case CHUNK_ENCODING_RLECOMPRESSED:
-            buf = DecodeChunkRLERepeat(src, header.length);
-            break;
         case CHUNK_ENCODING_ROTATE:
-            buf = DecodeChunkRotate(src, header.length);
             break;
         default:
             throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
     }
-    return buf;
+
+    auto compressedData = GetBuffer(_compressedBuffer, header.length);
+    if (_stream->TryRead(compressedData, header.length) != header.length)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_CHUNK_SIZE);
+    }
+    return compressedData;
 }
 
-std::vector<uint8_t> SawyerChunkReader::DecodeChunkRLERepeat(const void* src, size_t srcLength)
+/**
+ * Works out the length of RLE encoded data without decoding it. Runs and literals are told apart arithmetically
+ * rather than by branching, as the mix of them in saved games is too random for the branch to be predicted well.
+ */
+static size_t GetDecodedLengthRLE(const uint8_t* src, size_t srcLength)
 {
-    auto tempBuf = DecodeChunkRLE(src, srcLength);
-    return DecodeChunkRepeat(tempBuf.data(), tempBuf.size());
+    size_t length = 0;
+    size_t i = 0;
+    while (i < srcLength)
+    {
+        uint8_t rleCodeByte = src[i];
+        bool isRun = (rleCodeByte & 128) != 0;
+        size_t count = isRun ? 257 - rleCodeByte : rleCodeByte + 1;
+        size_t encodedLength = isRun ? 2 : count + 1;
+        if (i + encodedLength > srcLength || length + count > MAX_UNCOMPRESSED_CHUNK_SIZE)
+        {
+            if (i + 1 >= srcLength)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+            }
+            if (length + count > MAX_UNCOMPRESSED_CHUNK_SIZE)
+            {
+                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+            }
+            throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+        }
+        length += count;
+        i += encodedLength;
+    }
+    return length;
 }
 
-std::vector<uint8_t> SawyerChunkReader::DecodeChunkRLE(const void* src, size_t srcLength)
+/**
+ * The data must have been validated by GetDecodedLengthRLE and the destination must be exactly as long as the
+ * decoded data. Runs and literals are at most 128 bytes long, so while there is enough room left in both the source
+ * and the destination they are copied in whole blocks, running past their end and being overwritten by what follows.
+ */
+static void DecodeChunkRLE(const uint8_t* src, size_t srcLength, uint8_t* dst, size_t dstLength)
 {
-    std::vector<uint8_t> buf;
-    buf.reserve(srcLength);
+    constexpr size_t kBlockSize = 16;
+    constexpr size_t kMaxOvercopy = 128 + kBlockSize;
 
-    auto src8 = static_cast<const uint8_t*>(src);
-    for (size_t i = 0; i < srcLength; i++)
+    const uint8_t* srcEnd = src + srcLength;
+    const uint8_t* dstEnd = dst + dstLength;
+    while (src < srcEnd)
     {
-        uint8_t rleCodeByte = src8[i];
+        uint8_t rleCodeByte = *src++;
+        bool hasRoom = static_cast<size_t>(srcEnd - src) >= kMaxOvercopy
+            && static_cast<size_t>(dstEnd - dst) >= kMaxOvercopy;
         if (rleCodeByte & 128)
         {
-            i++;
             size_t count = 257 - rleCodeByte;
-
-            if (i >= srcLength)
+            uint8_t value = *src++;
+            if (hasRoom)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+                uint8_t block[kBlockSize];
+                std::memset(block, value, kBlockSize);
+                for (size_t j = 0; j < count; j += kBlockSize)
+                {
+                    std::memcpy(dst + j, block, kBlockSize);
+                }
             }
-            if (buf.size() + count > MAX_UNCOMPRESSED_CHUNK_SIZE)
+            else
             {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+                std::memset(dst, value, count);
             }
-
-            buf.insert(buf.end(), count, src8[i]);
+            dst += count;
         }
         else
         {
-            const auto len = rleCodeByte + 1;
-
-            if (i + 1 >= srcLength)
+            size_t len = rleCodeByte + 1;
+            if (hasRoom)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-            if (buf.size() + len > MAX_UNCOMPRESSED_CHUNK_SIZE)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_DESTINATION_TOO_SMALL);
+                for (size_t j = 0; j < len; j += kBlockSize)
+                {
+                    std::memcpy(dst + j, src + j, kBlockSize);
+                }
             }
-            if (i + 1 + len > srcLength)
+            else
             {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+                std::memcpy(dst, src, len);
             }
-
-            const auto* pos = src8 + i + 1;
-            buf.insert(buf.end(), pos, pos + len);
-
-            i += len;
+            dst += len;
+            src += len;
         }
     }
-
-    return buf;
 }
 
-std::vector<uint8_t> SawyerChunkReader::DecodeChunkRepeat(const void* src, size_t srcLength)
+/**
+ * Calls the function with each run or literal of RLE encoded data in turn, which must have been validated by
+ * GetDecodedLengthRLE. This lets the repeat encoding of RLE compressed chunks be decoded in the same pass as the RLE
+ * encoding, without the RLE decoded data being written out in between.
+ */
+template<typename TFunc>
+static void ForEachRLEDecodedSpan(const uint8_t* src, size_t srcLength, TFunc&& func)
 {
-    std::vector<uint8_t> buf;
-    buf.reserve(srcLength);
-
-    auto src8 = static_cast<const uint8_t*>(src);
-    for (size_t i = 0; i < srcLength; i++)
+    uint8_t run[128];
+    const uint8_t* srcEnd = src + srcLength;
+    while (src < srcEnd)
     {
-        if (src8[i] == 0xFF)
+        uint8_t rleCodeByte = *src++;
+        if (rleCodeByte & 128)
         {
-            if (i + 1 >= srcLength)
-            {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
-            }
-            buf.push_back(src8[++i]);
+            size_t count = 257 - rleCodeByte;
+            std::memset(run, *src++, count);
+            func(run, count);
         }
         else
         {
-            size_t count = (src8[i] & 7) + 1;
-            int32_t offset = static_cast<int32_t>(src8[i] >> 3) - 32;
-            const uint8_t* copySrc = buf.data() + (buf.size() + offset);
+            size_t len = rleCodeByte + 1;
+            func(src, len);
+            src += len;
+        }
+    }
+}
 
-            if (copySrc < buf.data() || copySrc + count > buf.data() + buf.size())
+/**
+ * Validates and decodes RLE compressed data in a single pass, returning the length of the decoded data. Only as much
+ * of it as fits is written to the destination, which can be empty to just work out the length. Repeats are at most 8
+ * bytes long, so while there is room they are copied as a whole 8 bytes. The repeated bytes can overlap the copy, but
+ * only the ones before the destination are kept.
+ */
+static size_t DecodeChunkRLERepeat(const uint8_t* src, size_t srcLength, uint8_t* dst, size_t dstLength)
+{
+    constexpr size_t kMaxRepeat = 8;
+
+    GetDecodedLengthRLE(src, srcLength);
+
+    const uint8_t* dstStart = dst;
+    const uint8_t* dstEnd = dst + dstLength;
+    size_t lengthPastEnd = 0;
+    bool isLiteralPending = false;
+    ForEachRLEDecodedSpan(src, srcLength, [&](const uint8_t* span, size_t spanLength) {
+        // Copied to a local, as the writes to the destination could otherwise alias it
+        auto* out = dst;
+        size_t i = 0;
+        if (isLiteralPending)
+        {
+            // The literal's marker ended the previous span
+            isLiteralPending = false;
+            i++;
+            if (out < dstEnd)
+                *out++ = span[0];
+            else
+                lengthPastEnd++;
+        }
+        for (; i < spanLength; i++)
+        {
+            uint8_t code = span[i];
+            if (code == 0xFF)
             {
-                throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+                if (i + 1 >= spanLength)
+                {
+                    isLiteralPending = true;
+                    break;
+                }
+                i++;
+                if (out < dstEnd)
+                    *out++ = span[i];
+                else
+                    lengthPastEnd++;
             }
+            else
+            {
+                size_t count = (code & 7) + 1;
+                size_t distance = 32 - (code >> 3);
+                if (distance > static_cast<size_t>(out - dstStart) + lengthPastEnd || count > distance)
+                {
+                    throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
+                }
 
-            // We need a temporary buffer as the vector might invalidate the pointer.
-            uint8_t temp[16];
-            std::memcpy(temp, copySrc, count);
-
-            buf.insert(buf.end(), std::begin(temp), std::begin(temp) + count);
+                size_t room = dstEnd - out;
+                if (room >= kMaxRepeat)
+                {
+                    std::memmove(out, out - distance, kMaxRepeat);
+                    out += count;
+                }
+                else if (room > 0)
+                {
+                    size_t copyLength = std::min(count, room);
+                    std::memmove(out, out - distance, copyLength);
+                    out += copyLength;
+                    lengthPastEnd += count - copyLength;
+                }
+                else
+                {
+                    lengthPastEnd += count;
+                }
+            }
         }
+        dst = out;
+    });
+    if (isLiteralPending)
+    {
+        throw SawyerChunkException(EXCEPTION_MSG_CORRUPT_RLE);
     }
-
-    return buf;
+    return static_cast<size_t>(dst - dstStart) + lengthPastEnd;
 }
 
-std::vector<uint8_t> SawyerChunkReader::DecodeChunkRotate(const void* src, size_t srcLength)
+/**
+ * The rotation cycles through 1, 3, 5 and 7 bits, so decoding four bytes at a time gives each byte a constant
+ * rotation, which lets the compiler vectorise the loop.
+ */
+static void DecodeChunkRotate(const uint8_t* src, size_t srcLength, uint8_t* dst)
 {
-    std::vector<uint8_t> buf;
-    buf.reserve(srcLength);
-
-    auto src8 = static_cast<const uint8_t*>(src);
+    size_t i = 0;
+    for (; i + 4 <= srcLength; i += 4)
+    {
+        dst[i + 0] = Numerics::ror8(src[i + 0], 1);
+        dst[i + 1] = Numerics::ror8(src[i + 1], 3);
+        dst[i + 2] = Numerics::ror8(src[i + 2], 5);
+        dst[i + 3] = Numerics::ror8(src[i + 3], 7);
+    }
 
     uint8_t code = 1;
-    for (size_t i = 0; i < srcLength; i++)
+    for (; i < srcLength; i++)
     {
-        buf.push_back(Numerics::ror8(src8[i], code));
+        dst[i] = Numerics::ror8(src[i], code);
         code = (code + 2) % 8;
     }
+}
+
+size_t SawyerChunkReader::PrepareDecode(const uint8_t* src, const SawyerCodingChunkHeader& header)
+{
+    switch (header.encoding)
+    {
+        case CHUNK_ENCODING_NONE:
+        case CHUNK_ENCODING_ROTATE:
+            return header.length;
+        case CHUNK_ENCODING_RLE:
+            return GetDecodedLengthRLE(src, header.length);
+        case CHUNK_ENCODING_RLECOMPRESSED:
+            return DecodeChunkRLERepeat(src, header.length, nullptr, 0);
+        default:
+            throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+    }
+}
+
+void SawyerChunkReader::DecodeChunk(
+    const uint8_t* src, const SawyerCodingChunkHeader& header, uint8_t* dst, size_t decodedLength)
+{
+    switch (header.encoding)
+    {
+        case CHUNK_ENCODING_NONE:
+            std::memcpy(dst, src, header.length);
+            break;
+        case CHUNK_ENCODING_RLE:
+            DecodeChunkRLE(src, header.length, dst, decodedLength);
+            break;
+        case CHUNK_ENCODING_RLECOMPRESSED:
+            DecodeChunkRLERepeat(src, header.length, dst, decodedLength);
+            break;
+        case CHUNK_ENCODING_ROTATE:
+            DecodeChunkRotate(src, header.length, dst);
+            break;
+        default:
+            throw SawyerChunkException(EXCEPTION_MSG_INVALID_CHUNK_ENCODING);
+    }
+}
 
+std::vector<uint8_t> SawyerChunkReader::DecodeChunk(const uint8_t* src, const SawyerCodingChunkHeader& header)
+{
+    if (header.encoding == CHUNK_ENCODING_RLECOMPRESSED)
+    {
+        // The length is only known once it has been decoded, so decode into room for a typical compression ratio and
+        // only decode it again when that was not enough
+        std::vector<uint8_t> buf(std::min<size_t>(header.length * 4, MAX_UNCOMPRESSED_CHUNK_SIZE));
+        auto decodedLength = DecodeChunkRLERepeat(src, header.length, buf.data(), buf.size());
+        bool isTruncated = decodedLength > buf.size();
+        buf.resize(decodedLength);
+        if (isTruncated)
+        {
+            DecodeChunkRLERepeat(src, header.length, buf.data(), buf.size());
+        }
+        return buf;
+    }
+
+    std::vector<uint8_t> buf(PrepareDecode(src, header));
+    if (!buf.empty())
+    {
+        DecodeChunk(src, header, buf.data(), buf.size());
+    }
     return buf;
 }
@@ -45,6 +45,9 @@ class SawyerChunkReader final
 private:
     OpenRCT2::IStream* const _stream = nullptr;
 
+    // Reused between chunks, so that reading a file doesn't allocate for every chunk
+    std::vector<uint8_t> _compressedBuffer;
+
 public:
     explicit SawyerChunkReader(OpenRCT2::IStream* stream);
 
@@ -87,9 +90,17 @@ public:
     }
 
 private:
-    static std::vector<uint8_t> DecodeChunk(const void* src, const SawyerCodingChunkHeader& header);
-    static std::vector<uint8_t> DecodeChunkRLERepeat(const void* src, size_t srcLength);
-    static std::vector<uint8_t> DecodeChunkRLE(const void* src, size_t srcLength);
-    static std::vector<uint8_t> DecodeChunkRepeat(const void* src, size_t srcLength);
-    static std::vector<uint8_t> DecodeChunkRotate(const void* src, size_t srcLength);
+    static uint8_t* GetBuffer(std::vector<uint8_t>& buffer, size_t length);
+    const uint8_t* ReadCompressedData(const SawyerCodingChunkHeader& header);
+
+    /**
+     * Validates the encoded data and works out the length of the decoded chunk, ready for DecodeChunk.
+     */
+    size_t PrepareDecode(const uint8_t* src, const SawyerCodingChunkHeader& header);
+
+    /**
+     * Decodes a prepared chunk straight into the destination, which must be exactly as long as the decoded chunk.
+     */
+    void DecodeChunk(const uint8_t* src, const SawyerCodingChunkHeader& header, uint8_t* dst, size_t decodedLength);
+    std::vector<uint8_t> DecodeChunk(const uint8_t* src, const SawyerCodingChunkHeader& header);
 };
@@ -234,12 +234,12 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
     if (curRide == nullptr)
         return false;
 
-    for (; remaining_distance >= 13962; _vehicleUnkF64E10++)
+    for (; remaining_distance >= 13962; gVehicleMotion.UnkF64E10++)
     {
         auto trackType = GetTrackType();
         if (trackType == TrackElemType::CableLiftHill && track_progress == 160)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
         }
 
         uint16_t trackProgress = track_progress + 1;
@@ -273,17 +273,17 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
 
         uint8_t remainingDistanceFlags = 0;
         nextVehiclePosition.z += GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset;
-        if (nextVehiclePosition.x != _vehicleCurPosition.x)
+        if (nextVehiclePosition.x != gVehicleMotion.CurPosition.x)
             remainingDistanceFlags |= (1 << 0);
-        if (nextVehiclePosition.y != _vehicleCurPosition.y)
+        if (nextVehiclePosition.y != gVehicleMotion.CurPosition.y)
             remainingDistanceFlags |= (1 << 1);
-        if (nextVehiclePosition.z != _vehicleCurPosition.z)
+        if (nextVehiclePosition.z != gVehicleMotion.CurPosition.z)
             remainingDistanceFlags |= (1 << 2);
 
         remaining_distance -= SubpositionTranslationDistances[remainingDistanceFlags];
-        _vehicleCurPosition.x = nextVehiclePosition.x;
-        _vehicleCurPosition.y = nextVehiclePosition.y;
-        _vehicleCurPosition.z = nextVehiclePosition.z;
+        gVehicleMotion.CurPosition.x = nextVehiclePosition.x;
+        gVehicleMotion.CurPosition.y = nextVehiclePosition.y;
+        gVehicleMotion.CurPosition.z = nextVehiclePosition.z;
 
         Orientation = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
@@ -303,7 +303,7 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
     if (curRide == nullptr)
         return false;
 
-    for (; remaining_distance < 0; _vehicleUnkF64E10++)
+    for (; remaining_distance < 0; gVehicleMotion.UnkF64E10++)
     {
         uint16_t trackProgress = track_progress - 1;
 
@@ -327,7 +327,7 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
 
             if (output.begin_element->AsTrack()->GetTrackType() == TrackElemType::EndStation)
             {
-                _vehicleMotionTrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+                gVehicleMotion.TrackFlags = VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
             }
 
             uint16_t trackTotalProgress = GetTrackProgress();
@@ -339,17 +339,17 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
 
         uint8_t remainingDistanceFlags = 0;
         unk.z += GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset;
-        if (unk.x != _vehicleCurPosition.x)
+        if (unk.x != gVehicleMotion.CurPosition.x)
             remainingDistanceFlags |= (1 << 0);
-        if (unk.y != _vehicleCurPosition.y)
+        if (unk.y != gVehicleMotion.CurPosition.y)
             remainingDistanceFlags |= (1 << 1);
-        if (unk.z != _vehicleCurPosition.z)
+        if (unk.z != gVehicleMotion.CurPosition.z)
             remainingDistanceFlags |= (1 << 2);
 
         remaining_distance += SubpositionTranslationDistances[remainingDistanceFlags];
-        _vehicleCurPosition.x = unk.x;
-        _vehicleCurPosition.y = unk.y;
-        _vehicleCurPosition.z = unk.z;
+        gVehicleMotion.CurPosition.x = unk.x;
+        gVehicleMotion.CurPosition.y = unk.y;
+        gVehicleMotion.CurPosition.z = unk.z;
 
         Orientation = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
@@ -369,14 +369,14 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
  */
 int32_t Vehicle::CableLiftUpdateTrackMotion()
 {
-    _vehicleF64E2C = 0;
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
-    _vehicleStationIndex = StationIndex::GetNull();
+    gVehicleMotion.F64E2C = 0;
+    gVehicleMotion.CurrentVehicle = this;
+    gVehicleMotion.TrackFlags = 0;
+    gVehicleMotion.Station = StationIndex::GetNull();
 
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity / 1024) * 42;
+    gVehicleMotion.VelocityF64E08 = velocity;
+    gVehicleMotion.VelocityF64E0C = (velocity / 1024) * 42;
 
     Vehicle* frontVehicle = this;
     if (velocity < 0)
@@ -384,17 +384,17 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
         frontVehicle = TrainTail();
     }
 
-    _vehicleFrontVehicle = frontVehicle;
+    gVehicleMotion.FrontVehicle = frontVehicle;
 
     for (Vehicle* vehicle = frontVehicle; vehicle != nullptr;)
     {
         vehicle->acceleration = AccelerationFromPitch[vehicle->Pitch];
-        _vehicleUnkF64E10 = 1;
-        vehicle->remaining_distance += _vehicleVelocityF64E0C;
+        gVehicleMotion.UnkF64E10 = 1;
+        vehicle->remaining_distance += gVehicleMotion.VelocityF64E0C;
 
         if (vehicle->remaining_distance < 0 || vehicle->remaining_distance >= 13962)
         {
-            _vehicleCurPosition = vehicle->GetLocation();
+            gVehicleMotion.CurPosition = vehicle->GetLocation();
             vehicle->Invalidate();
 
             while (true)
@@ -406,11 +406,11 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
                         break;
                     }
 
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                    _vehicleVelocityF64E0C -= vehicle->remaining_distance - 13962;
+                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                    gVehicleMotion.VelocityF64E0C -= vehicle->remaining_distance - 13962;
                     vehicle->remaining_distance = 13962;
                     vehicle->acceleration += AccelerationFromPitch[vehicle->Pitch];
-                    _vehicleUnkF64E10++;
+                    gVehicleMotion.UnkF64E10++;
                     continue;
                 }
 
@@ -419,16 +419,16 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
                     break;
                 }
 
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                _vehicleVelocityF64E0C -= vehicle->remaining_distance + 1;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                gVehicleMotion.VelocityF64E0C -= vehicle->remaining_distance + 1;
                 vehicle->remaining_distance = -1;
                 vehicle->acceleration += AccelerationFromPitch[vehicle->Pitch];
-                _vehicleUnkF64E10++;
+                gVehicleMotion.UnkF64E10++;
             }
-            vehicle->MoveTo(_vehicleCurPosition);
+            vehicle->MoveTo(gVehicleMotion.CurPosition);
         }
-        vehicle->acceleration /= _vehicleUnkF64E10;
-        if (_vehicleVelocityF64E08 >= 0)
+        vehicle->acceleration /= gVehicleMotion.UnkF64E10;
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             vehicle = GetEntity<Vehicle>(vehicle->next_vehicle_on_train);
         }
@@ -466,5 +466,5 @@ int32_t Vehicle::CableLiftUpdateTrackMotion()
     newAcceleration -= edx / massTotal;
 
     acceleration = newAcceleration;
-    return _vehicleMotionTrackFlags;
+    return gVehicleMotion.TrackFlags;
 }
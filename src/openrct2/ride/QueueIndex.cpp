@@ -0,0 +1,314 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "QueueIndex.h"
+
+#include "../core/Guard.hpp"
+#include "../entity/EntityRegistry.h"
+#include "../entity/Guest.h"
+#include "Ride.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace OpenRCT2::QueueIndex
+{
+    using StationKey = uint32_t;
+
+    static constexpr StationKey kNoStation = UINT32_MAX;
+
+    struct StationQueue
+    {
+        // Incremented whenever the index is dropped, so that entries of guests that have left are not read again
+        uint32_t Generation{};
+        bool Valid{};
+        EntityId Back = EntityId::GetNull();
+        EntityId Front = EntityId::GetNull();
+        uint16_t Length{};
+    };
+
+    struct GuestEntry
+    {
+        StationKey Station = kNoStation;
+        uint32_t Generation{};
+        EntityId Behind = EntityId::GetNull();
+    };
+
+    static std::unordered_map<StationKey, StationQueue> _stations;
+    static std::vector<GuestEntry> _guests;
+
+    static StationKey GetStationKey(const Ride& ride, StationIndex stationIndex)
+    {
+        return (static_cast<StationKey>(ride.id.ToUnderlying()) << 8) | stationIndex.ToUnderlying();
+    }
+
+    static GuestEntry& GetGuestEntry(EntityId guestId)
+    {
+        if (_guests.empty())
+        {
+            _guests.resize(MAX_ENTITIES);
+        }
+        return _guests[guestId.ToUnderlying()];
+    }
+
+    static StationQueue* GetValidStation(const GuestEntry& entry)
+    {
+        if (entry.Station == kNoStation)
+            return nullptr;
+
+        auto it = _stations.find(entry.Station);
+        if (it == _stations.end() || !it->second.Valid || it->second.Generation != entry.Generation)
+            return nullptr;
+        return &it->second;
+    }
+
+    static void Invalidate(StationQueue& queue)
+    {
+        queue.Valid = false;
+        queue.Generation++;
+    }
+
+    static bool Rebuild(const Ride& ride, StationIndex stationIndex, StationKey key, StationQueue& queue)
+    {
+        Invalidate(queue);
+
+        const auto back = ride.GetStation(stationIndex).LastPeepInQueue;
+        auto behind = EntityId::GetNull();
+        uint16_t length = 0;
+        auto guestId = back;
+        Guest* guest;
+        while ((guest = TryGetEntity<Guest>(guestId)) != nullptr)
+        {
+            auto& entry = GetGuestEntry(guestId);
+            if (entry.Station == key && entry.Generation == queue.Generation)
+            {
+                // The list loops back on itself
+                return false;
+            }
+
+            // A guest can only be indexed in one queue, lists that share guests are walked every time
+            auto* otherQueue = GetValidStation(entry);
+            if (otherQueue != nullptr)
+            {
+                Invalidate(*otherQueue);
+            }
+
+            entry.Station = key;
+            entry.Generation = queue.Generation;
+            entry.Behind = behind;
+            behind = guestId;
+            length++;
+            guestId = guest->GuestNextInQueue;
+        }
+        if (!guestId.IsNull())
+        {
+            // The list ends at an entity that is not a guest, it would change if a guest was created there
+            return false;
+        }
+
+        queue.Valid = true;
+        queue.Back = back;
+        queue.Front = behind;
+        queue.Length = length;
+        return true;
+    }
+
+#if defined(DEBUG) && DEBUG > 0
+    // Walks the station's list, as the index is meant to save doing, and checks that the index still matches it.
+    static void VerifyStation(const Ride& ride, StationIndex stationIndex, StationKey key, const StationQueue& queue)
+    {
+        auto behind = EntityId::GetNull();
+        uint16_t length = 0;
+        auto guestId = ride.GetStation(stationIndex).LastPeepInQueue;
+        Guest* guest;
+        while ((guest = TryGetEntity<Guest>(guestId)) != nullptr && length <= queue.Length)
+        {
+            const auto& entry = GetGuestEntry(guestId);
+            Guard::Assert(
+                entry.Station == key && entry.Generation == queue.Generation && entry.Behind == behind,
+                "Queue index of ride %u station %u does not match guest %u.", ride.id.ToUnderlying(),
+                stationIndex.ToUnderlying(), guestId.ToUnderlying());
+            behind = guestId;
+            length++;
+            guestId = guest->GuestNextInQueue;
+        }
+        Guard::Assert(
+            queue.Front == behind && queue.Length == length,
+            "Queue index of ride %u station %u has front %u and length %u, the queue has front %u and length %u.",
+            ride.id.ToUnderlying(), stationIndex.ToUnderlying(), queue.Front.ToUnderlying(), queue.Length,
+            behind.ToUnderlying(), length);
+    }
+#endif
+
+    static StationQueue* GetIndexedStation(const Ride& ride, StationIndex stationIndex)
+    {
+        auto key = GetStationKey(ride, stationIndex);
+        auto& queue = _stations[key];
+        if (queue.Valid && queue.Back == ride.GetStation(stationIndex).LastPeepInQueue)
+        {
+#if defined(DEBUG) && DEBUG > 0
+            VerifyStation(ride, stationIndex, key, queue);
+#endif
+            return &queue;
+        }
+        return Rebuild(ride, stationIndex, key, queue) ? &queue : nullptr;
+    }
+
+    // Gets the station's index without building it, for updates that can be skipped when there is nothing to update.
+    static StationQueue* FindIndexedStation(const Ride& ride, StationIndex stationIndex)
+    {
+        auto it = _stations.find(GetStationKey(ride, stationIndex));
+        if (it == _stations.end() || !it->second.Valid)
+            return nullptr;
+        return &it->second;
+    }
+
+    void Reset()
+    {
+        _stations.clear();
+        _guests.clear();
+    }
+
+    void InvalidateGuest(EntityId guestId)
+    {
+        if (_guests.empty() || guestId.ToUnderlying() >= MAX_ENTITIES)
+            return;
+
+        auto* queue = GetValidStation(GetGuestEntry(guestId));
+        if (queue != nullptr)
+        {
+            Invalidate(*queue);
+        }
+    }
+
+    bool GetFront(const Ride& ride, StationIndex stationIndex, EntityId& front)
+    {
+        auto* queue = GetIndexedStation(ride, stationIndex);
+        if (queue == nullptr)
+            return false;
+
+        front = queue->Front;
+        return true;
+    }
+
+    bool GetLength(const Ride& ride, StationIndex stationIndex, uint16_t& length)
+    {
+        auto* queue = GetIndexedStation(ride, stationIndex);
+        if (queue == nullptr)
+            return false;
+
+        length = queue->Length;
+        return true;
+    }
+
+    bool GetGuestBehind(const Ride& ride, StationIndex stationIndex, const Guest& guest, EntityId& behind)
+    {
+        auto* queue = GetIndexedStation(ride, stationIndex);
+        if (queue == nullptr)
+            return false;
+
+        const auto& entry = GetGuestEntry(guest.Id);
+        behind = GetValidStation(entry) == queue ? entry.Behind : EntityId::GetNull();
+        return true;
+    }
+
+    void OnGuestJoinedBack(const Ride& ride, StationIndex stationIndex, const Guest& guest, EntityId previousBack)
+    {
+        // The guest's link was overwritten, which changed the list it was in before
+        auto& entry = GetGuestEntry(guest.Id);
+        auto* previousQueue = GetValidStation(entry);
+        if (previousQueue != nullptr)
+        {
+            Invalidate(*previousQueue);
+        }
+
+        auto* queue = FindIndexedStation(ride, stationIndex);
+        if (queue == nullptr)
+            return;
+        if (queue->Back != previousBack || guest.GuestNextInQueue != previousBack)
+        {
+            Invalidate(*queue);
+            return;
+        }
+
+        if (previousBack.IsNull())
+        {
+            queue->Front = guest.Id;
+        }
+        else
+        {
+            GetGuestEntry(previousBack).Behind = guest.Id;
+        }
+        entry.Station = GetStationKey(ride, stationIndex);
+        entry.Generation = queue->Generation;
+        entry.Behind = EntityId::GetNull();
+        queue->Back = guest.Id;
+        queue->Length++;
+    }
+
+    void OnGuestJoinedFront(const Ride& ride, StationIndex stationIndex, const Guest& guest, EntityId previousFront)
+    {
+        auto* queue = FindIndexedStation(ride, stationIndex);
+        if (queue == nullptr)
+            return;
+
+        auto& entry = GetGuestEntry(guest.Id);
+        if (GetValidStation(entry) != nullptr || queue->Front != previousFront || !guest.GuestNextInQueue.IsNull())
+        {
+            // The guest was still linked in a queue, possibly this one
+            InvalidateGuest(guest.Id);
+            Invalidate(*queue);
+            return;
+        }
+
+        if (previousFront.IsNull())
+        {
+            queue->Back = guest.Id;
+        }
+        entry.Station = GetStationKey(ride, stationIndex);
+        entry.Generation = queue->Generation;
+        entry.Behind = previousFront;
+        queue->Front = guest.Id;
+        queue->Length++;
+    }
+
+    void OnGuestLeft(const Ride& ride, StationIndex stationIndex, const Guest& guest)
+    {
+        auto* queue = FindIndexedStation(ride, stationIndex);
+        if (queue == nullptr)
+            return;
+
+        auto& entry = GetGuestEntry(guest.Id);
+        if (GetValidStation(entry) != queue)
+        {
+            Invalidate(*queue);
+            return;
+        }
+
+        if (entry.Behind.IsNull())
+        {
+            queue->Back = guest.GuestNextInQueue;
+        }
+        if (guest.GuestNextInQueue.IsNull())
+        {
+            queue->Front = entry.Behind;
+        }
+        else
+        {
+            GetGuestEntry(guest.GuestNextInQueue).Behind = entry.Behind;
+        }
+        entry.Station = kNoStation;
+        queue->Length--;
+
+        if (queue->Back != ride.GetStation(stationIndex).LastPeepInQueue)
+        {
+            Invalidate(*queue);
+        }
+    }
+} // namespace OpenRCT2::QueueIndex
@@ -0,0 +1,58 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+
+#include <cstdint>
+
+struct Guest;
+struct Ride;
+
+/**
+ * Runtime index of the guest queue of each station, which is a list linked from the station's last guest through
+ * Guest::GuestNextInQueue to the guest at the front. The index knows the front guest, the length of the list and the
+ * guest behind each queuing guest, so joining and leaving the front of a queue no longer walks the list.
+ *
+ * The index is never saved. A station's index is built from its list when it is first needed and only used while it
+ * matches the list, anything that changes a list without telling the index drops the index of that station. A list
+ * that can't be walked to its end, e.g. one with a loop, is never indexed so the callers fall back to walking it.
+ */
+namespace OpenRCT2::QueueIndex
+{
+    void Reset();
+
+    /**
+     * Drops the index of the queue the guest is in, for when its next in queue link is changed outside of the index or
+     * the guest is removed.
+     */
+    void InvalidateGuest(EntityId guestId);
+
+    /**
+     * Gets the guest at the front of the queue, returns false if the queue can't be indexed.
+     */
+    bool GetFront(const Ride& ride, StationIndex stationIndex, EntityId& front);
+
+    /**
+     * Gets the number of guests linked in the queue, returns false if the queue can't be indexed.
+     */
+    bool GetLength(const Ride& ride, StationIndex stationIndex, uint16_t& length);
+
+    /**
+     * Gets the guest whose next in queue is the given guest, null if the guest is not in the queue or is its last
+     * guest. Returns false if the queue can't be indexed.
+     */
+    bool GetGuestBehind(const Ride& ride, StationIndex stationIndex, const Guest& guest, EntityId& behind);
+
+    // Called after the lists have been changed
+    void OnGuestJoinedBack(const Ride& ride, StationIndex stationIndex, const Guest& guest, EntityId previousBack);
+    void OnGuestJoinedFront(const Ride& ride, StationIndex stationIndex, const Guest& guest, EntityId previousFront);
+    void OnGuestLeft(const Ride& ride, StationIndex stationIndex, const Guest& guest);
+} // namespace OpenRCT2::QueueIndex
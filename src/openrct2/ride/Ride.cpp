@@ -63,6 +63,7 @@
 #include "../world/Scenery.h"
 #include "../world/TileElementsView.h"
 #include "CableLift.h"
+#include "QueueIndex.h"
 #include "RideAudio.h"
 #include "RideConstruction.h"
 #include "RideData.h"
@@ -112,6 +113,17 @@ static size_t _endOfUsedRange = 0;
 // A special instance of Ride that is used to draw previews such as the track designs.
 static Ride _previewRide{};
 
+static BreakdownResponseStats _breakdownResponseStats;
+
+// Tick at which each ride broke down and whether a mechanic has been sent to fix it since, indexed by ride. They are
+// only used for the breakdown response statistics, so they are kept here rather than in the ride and are not saved.
+struct BreakdownCall
+{
+    std::optional<uint32_t> Tick;
+    bool Answered{};
+};
+static std::array<BreakdownCall, OpenRCT2::Limits::kMaxRidesInPark> _breakdownCalls;
+
 struct StationIndexWithMessage
 {
     ::StationIndex StationIndex;
@@ -188,6 +200,7 @@ Ride* RideAllocateAtIndex(RideId index)
 
     // Initialize the ride to all the defaults.
     *result = Ride{};
+    _breakdownCalls[idx] = {};
 
     // Because it is default initialized to zero rather than the magic constant for Null, fill the array.
     std::fill(std::begin(result->vehicles), std::end(result->vehicles), EntityId::GetNull());
@@ -348,6 +361,12 @@ int32_t Ride::GetMaxQueueTime() const
 
 Guest* Ride::GetQueueHeadGuest(StationIndex stationIndex) const
 {
+    EntityId front;
+    if (QueueIndex::GetFront(*this, stationIndex, front))
+    {
+        return TryGetEntity<Guest>(front);
+    }
+
     Guest* peep;
     Guest* result = nullptr;
     auto spriteIndex = GetStation(stationIndex).LastPeepInQueue;
@@ -361,9 +380,12 @@ Guest* Ride::GetQueueHeadGuest(StationIndex stationIndex) const
 
 void Ride::UpdateQueueLength(StationIndex stationIndex)
 {
+    auto& station = GetStation(stationIndex);
+    if (QueueIndex::GetLength(*this, stationIndex, station.QueueLength))
+        return;
+
     uint16_t count = 0;
     Guest* peep;
-    auto& station = GetStation(stationIndex);
     auto spriteIndex = station.LastPeepInQueue;
     while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr)
     {
@@ -378,6 +400,7 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
     assert(stationIndex.ToUnderlying() < OpenRCT2::Limits::kMaxStationsPerRide);
     assert(peep != nullptr);
 
+    QueueIndex::InvalidateGuest(peep->Id);
     peep->GuestNextInQueue = EntityId::GetNull();
     auto* queueHeadGuest = GetQueueHeadGuest(peep->CurrentRideStation);
     if (queueHeadGuest == nullptr)
@@ -388,6 +411,8 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
     {
         queueHeadGuest->GuestNextInQueue = peep->Id;
     }
+    QueueIndex::OnGuestJoinedFront(
+        *this, peep->CurrentRideStation, *peep, queueHeadGuest != nullptr ? queueHeadGuest->Id : EntityId::GetNull());
     UpdateQueueLength(peep->CurrentRideStation);
 }
 
@@ -962,6 +987,8 @@ void RideInitAll()
     auto& gameState = GetGameState();
     std::for_each(std::begin(gameState.Rides), std::end(gameState.Rides), RideReset);
     _endOfUsedRange = 0;
+    std::fill(std::begin(_breakdownCalls), std::end(_breakdownCalls), BreakdownCall{});
+    RideResetBreakdownResponseStats();
 }
 
 /**
@@ -1689,6 +1716,16 @@ static void RideMechanicStatusUpdate(Ride& ride, int32_t mechanicStatus)
             RideBreakdownAddNewsItem(ride);
         }
     }
+
+    // Start the response clock as soon as the ride is broken down, whatever the mechanic is doing. Vehicle breakdowns
+    // set the flag from the vehicle update, so this also catches those on the next status update.
+    auto& breakdownCall = _breakdownCalls[ride.id.ToUnderlying()];
+    if ((ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN) && !breakdownCall.Tick.has_value())
+    {
+        breakdownCall.Tick = GetGameState().CurrentTicks;
+        breakdownCall.Answered = false;
+    }
+
     switch (mechanicStatus)
     {
         case RIDE_MECHANIC_STATUS_UNDEFINED:
@@ -1702,6 +1739,7 @@ static void RideMechanicStatusUpdate(Ride& ride, int32_t mechanicStatus)
             {
                 ride.lifecycle_flags &= ~(
                     RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_DUE_INSPECTION);
+                breakdownCall.Tick.reset();
                 break;
             }
 
@@ -1757,6 +1795,16 @@ static void RideCallMechanic(Ride& ride, Peep* mechanic, int32_t forInspection)
     ride.mechanic = mechanic->Id;
     mechanic->CurrentRide = ride.id;
     mechanic->CurrentRideStation = ride.inspection_station;
+
+    auto& breakdownCall = _breakdownCalls[ride.id.ToUnderlying()];
+    if (!forInspection && breakdownCall.Tick.has_value() && !breakdownCall.Answered)
+    {
+        const auto ticks = GetGameState().CurrentTicks - *breakdownCall.Tick;
+        _breakdownResponseStats.NumAnswered++;
+        _breakdownResponseStats.TotalTicksToAnswer += ticks;
+        _breakdownResponseStats.MaxTicksToAnswer = std::max(_breakdownResponseStats.MaxTicksToAnswer, ticks);
+        breakdownCall.Answered = true;
+    }
 }
 
 /**
@@ -1805,6 +1853,10 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
     Staff* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
+    // Mechanics only need to patrol the ride if it is in the park
+    const auto location = entrancePosition.ToTileStart();
+    const bool checkPatrolArea = MapIsLocationInPark(location);
+
     for (auto peep : EntityList<Staff>())
     {
         if (!peep->IsMechanic())
@@ -1829,10 +1881,8 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
                 continue;
         }
 
-        auto location = entrancePosition.ToTileStart();
-        if (MapIsLocationInPark(location))
-            if (!peep->IsLocationInPatrol(location))
-                continue;
+        if (checkPatrolArea && !peep->IsLocationInPatrol(location))
+            continue;
 
         if (peep->x == kLocationNull)
             continue;
@@ -1849,6 +1899,21 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
     return closestMechanic;
 }
 
+const BreakdownResponseStats& RideGetBreakdownResponseStats()
+{
+    return _breakdownResponseStats;
+}
+
+void RideResetBreakdownResponseStats()
+{
+    _breakdownResponseStats = {};
+}
+
+void RideClearBreakdownCall(const Ride& ride)
+{
+    _breakdownCalls[ride.id.ToUnderlying()] = {};
+}
+
 Staff* RideGetMechanic(const Ride& ride)
 {
     auto staff = GetEntity<Staff>(ride.mechanic);
@@ -4673,6 +4738,17 @@ void InvalidateTestResults(Ride& ride)
  */
 void RideFixBreakdown(Ride& ride, int32_t reliabilityIncreaseFactor)
 {
+    // Breakdowns fixed without a mechanic, e.g. with cheats, are not counted
+    auto& breakdownCall = _breakdownCalls[ride.id.ToUnderlying()];
+    if (breakdownCall.Tick.has_value() && breakdownCall.Answered)
+    {
+        const auto ticks = GetGameState().CurrentTicks - *breakdownCall.Tick;
+        _breakdownResponseStats.NumFixed++;
+        _breakdownResponseStats.TotalTicksToFix += ticks;
+        _breakdownResponseStats.MaxTicksToFix = std::max(_breakdownResponseStats.MaxTicksToFix, ticks);
+    }
+    breakdownCall.Tick.reset();
+
     ride.lifecycle_flags &= ~RIDE_LIFECYCLE_BREAKDOWN_PENDING;
     ride.lifecycle_flags &= ~RIDE_LIFECYCLE_BROKEN_DOWN;
     ride.lifecycle_flags &= ~RIDE_LIFECYCLE_DUE_INSPECTION;
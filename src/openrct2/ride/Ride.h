@@ -444,6 +444,20 @@ static_assert(sizeof(TrackBeginEnd) == 36);
 
 #pragma pack(pop)
 
+/**
+ * How long broken down rides have waited for mechanics since the park was loaded, counted from the tick the ride
+ * broke down.
+ */
+struct BreakdownResponseStats
+{
+    uint32_t NumAnswered{};
+    uint64_t TotalTicksToAnswer{};
+    uint32_t MaxTicksToAnswer{};
+    uint32_t NumFixed{};
+    uint64_t TotalTicksToFix{};
+    uint32_t MaxTicksToFix{};
+};
+
 // Constants used by the lifecycle_flags property at 0x1D0
 enum
 {
@@ -1011,6 +1025,9 @@ void RideSetVehicleColoursToRandomPreset(Ride& ride, uint8_t preset_index);
 void RideMeasurementsUpdate();
 void RideBreakdownAddNewsItem(const Ride& ride);
 Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection);
+const BreakdownResponseStats& RideGetBreakdownResponseStats();
+void RideResetBreakdownResponseStats();
+void RideClearBreakdownCall(const Ride& ride);
 int32_t RideInitialiseConstructionWindow(Ride& ride);
 void RideSetMapTooltip(const TileElement& tileElement);
 void RidePrepareBreakdown(Ride& ride, int32_t breakdownReason);
@@ -612,7 +612,7 @@ std::unique_ptr<TrackDesign> TrackDesignImport(const utf8* path)
  *
  *  rct2: 0x006ABDB0
  */
-static void TrackDesignLoadSceneryObjects(const TrackDesign& td)
+void TrackDesignLoadSceneryObjects(const TrackDesign& td)
 {
     auto& objectManager = OpenRCT2::GetContext()->GetObjectManager();
     objectManager.UnloadAllTransient();
@@ -1867,6 +1867,16 @@ static money64 TrackDesignCreateRide(int32_t type, int32_t subType, int32_t flag
  * ebx = ride_id
  * cost = edi
  */
+bool TrackDesignIsVehicleUnavailable(const TrackDesign& td)
+{
+    auto& objManager = GetContext()->GetObjectManager();
+    auto entryIndex = objManager.GetLoadedObjectEntryIndex(td.trackAndVehicle.vehicleObject);
+    if (entryIndex == OBJECT_ENTRY_INDEX_NULL)
+        return true;
+
+    return !RideEntryIsInvented(entryIndex) && !GetGameState().Cheats.IgnoreResearchStatus;
+}
+
 static bool TrackDesignPlacePreview(
     TrackDesignState& tds, const TrackDesign& td, Ride** outRide, TrackDesignGameStateData& gameStateData)
 {
@@ -1942,11 +1952,7 @@ static bool TrackDesignPlacePreview(
 
     if (res.Error == GameActions::Status::Ok)
     {
-        if (entry_index == OBJECT_ENTRY_INDEX_NULL)
-        {
-            gameStateData.setFlag(TrackDesignGameStateFlag::VehicleUnavailable, true);
-        }
-        else if (!RideEntryIsInvented(entry_index) && !GetGameState().Cheats.IgnoreResearchStatus)
+        if (TrackDesignIsVehicleUnavailable(td))
         {
             gameStateData.setFlag(TrackDesignGameStateFlag::VehicleUnavailable, true);
         }
@@ -2055,13 +2061,17 @@ bool TrackDesignSceneryElement::operator!=(const TrackDesignSceneryElement& rhs)
  */
 void TrackDesignDrawPreview(TrackDesign& td, uint8_t* pixels)
 {
-    StashMap();
-    TrackDesignPreviewClearMap();
-
     if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
     {
         TrackDesignLoadSceneryObjects(td);
     }
+    TrackDesignDrawLoadedPreview(td, pixels);
+}
+
+bool TrackDesignDrawLoadedPreview(TrackDesign& td, uint8_t* pixels)
+{
+    StashMap();
+    TrackDesignPreviewClearMap();
 
     TrackDesignState tds{};
 
@@ -2071,7 +2081,7 @@ void TrackDesignDrawPreview(TrackDesign& td, uint8_t* pixels)
     {
         std::fill_n(pixels, kTrackPreviewImageSize * 4, 0x00);
         UnstashMap();
-        return;
+        return false;
     }
     td.gameStateData = updatedGameStateData;
 
@@ -2142,6 +2152,7 @@ void TrackDesignDrawPreview(TrackDesign& td, uint8_t* pixels)
 
     ride->Delete();
     UnstashMap();
+    return true;
 }
 
 /**
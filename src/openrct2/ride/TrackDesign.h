@@ -245,8 +245,20 @@ int32_t TrackDesignGetZPlacement(const TrackDesign& td, Ride& ride, const Coords
 ///////////////////////////////////////////////////////////////////////////////
 // Track design preview
 ///////////////////////////////////////////////////////////////////////////////
+void TrackDesignLoadSceneryObjects(const TrackDesign& td);
 void TrackDesignDrawPreview(TrackDesign& td, uint8_t* pixels);
 
+/**
+ * Draws the preview the same as TrackDesignDrawPreview, with the design's objects already loaded.
+ * @returns Whether the design could be placed, which is when its game state data is updated.
+ */
+bool TrackDesignDrawLoadedPreview(TrackDesign& td, uint8_t* pixels);
+
+/**
+ * Whether the design's vehicle can not be built, as it is not loaded or not yet researched.
+ */
+bool TrackDesignIsVehicleUnavailable(const TrackDesign& td);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Track design saving
 ///////////////////////////////////////////////////////////////////////////////
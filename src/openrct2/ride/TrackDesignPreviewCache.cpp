@@ -0,0 +1,346 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TrackDesignPreviewCache.h"
+
+#include "../AssetPack.h"
+#include "../AssetPackManager.h"
+#include "../Context.h"
+#include "../Diagnostic.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../PlatformEnvironment.h"
+#include "../Version.h"
+#include "../core/Crypt.h"
+#include "../core/File.h"
+#include "../core/FileScanner.h"
+#include "../core/FileStream.h"
+#include "../core/Path.hpp"
+#include "../drawing/Drawing.h"
+#include "../object/Object.h"
+#include "../object/ObjectLimits.h"
+#include "../object/ObjectList.h"
+#include "../object/ObjectManager.h"
+#include "../object/ObjectTypes.h"
+#include "../util/Util.h"
+#include "../world/Park.h"
+#include "TrackDesign.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+using namespace OpenRCT2;
+
+static constexpr uint32_t kTrackPreviewCacheMagic = 0x50445454; // TTDP
+// Cache file format version which when incremented invalidates all cached previews
+static constexpr uint32_t kTrackPreviewCacheVersion = 2;
+static constexpr uint32_t kTrackPreviewPixelsSize = kTrackPreviewImageSize * 4;
+// The cache is pruned back to this size once per session, removing the previews written longest ago first
+static constexpr uint64_t kTrackPreviewCacheMaxSize = 64 * 1024 * 1024;
+
+struct TrackPreviewCacheHeader
+{
+    uint32_t MagicNumber = kTrackPreviewCacheMagic;
+    uint32_t Version = kTrackPreviewCacheVersion;
+    bool IsPlaced{};
+    uint8_t GameStateFlags{};
+    money64 Cost{};
+    uint32_t CompressedSize{};
+};
+
+struct ObjectImagesHash
+{
+    std::string Identifier;
+    const G1Element* Images{};
+    uint32_t NumImages{};
+    Crypt::Sha1Algorithm::Result Hash{};
+};
+
+// Hashing the images of every loaded object is slow, so the hash is kept while the same object keeps its image table.
+// Objects are removed when they are unloaded, as another object could later be loaded at the same address.
+static std::unordered_map<const Object*, ObjectImagesHash> _objectImagesHashes;
+
+static u8string GetTrackPreviewCacheDirectory()
+{
+    auto env = GetContext()->GetPlatformEnvironment();
+    return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"trackpreviews");
+}
+
+static void PruneTrackPreviewCache()
+{
+    static bool pruned = false;
+    if (pruned)
+        return;
+    pruned = true;
+
+    std::vector<std::pair<u8string, FileScanner::FileInfo>> files;
+    uint64_t totalSize = 0;
+    auto scanner = Path::ScanDirectory(Path::Combine(GetTrackPreviewCacheDirectory(), u8"*.dat"), false);
+    while (scanner->Next())
+    {
+        const auto& fileInfo = scanner->GetFileInfo();
+        files.emplace_back(scanner->GetPath(), fileInfo);
+        totalSize += fileInfo.Size;
+    }
+    if (totalSize <= kTrackPreviewCacheMaxSize)
+        return;
+
+    std::sort(files.begin(), files.end(), [](const auto& a, const auto& b) {
+        return a.second.LastModified < b.second.LastModified;
+    });
+    for (const auto& [path, fileInfo] : files)
+    {
+        if (totalSize <= kTrackPreviewCacheMaxSize)
+            break;
+
+        if (File::Delete(path))
+        {
+            totalSize -= fileInfo.Size;
+        }
+    }
+}
+
+/**
+ * Hashes the images of an object, which may differ between copies of an object with the same version.
+ */
+static const Crypt::Sha1Algorithm::Result& GetObjectImagesHash(const Object& obj)
+{
+    const auto& imageTable = obj.GetImageTable();
+    auto& cached = _objectImagesHashes[&obj];
+    if (cached.Identifier == obj.GetIdentifier() && cached.Images == imageTable.GetImages()
+        && cached.NumImages == imageTable.GetCount())
+        return cached.Hash;
+
+    auto sha1 = Crypt::CreateSHA1();
+    for (uint32_t i = 0; i < imageTable.GetCount(); i++)
+    {
+        const auto& g1 = imageTable.GetImages()[i];
+        sha1->Update(&g1.width, sizeof(g1.width));
+        sha1->Update(&g1.height, sizeof(g1.height));
+        sha1->Update(&g1.x_offset, sizeof(g1.x_offset));
+        sha1->Update(&g1.y_offset, sizeof(g1.y_offset));
+        sha1->Update(&g1.flags, sizeof(g1.flags));
+        sha1->Update(&g1.zoomed_offset, sizeof(g1.zoomed_offset));
+        if (g1.offset != nullptr)
+        {
+            sha1->Update(g1.offset, G1CalculateDataSize(&g1));
+        }
+    }
+    cached.Identifier = obj.GetIdentifier();
+    cached.Images = imageTable.GetImages();
+    cached.NumImages = imageTable.GetCount();
+    cached.Hash = sha1->Finish();
+    return cached.Hash;
+}
+
+/**
+ * Everything the rendered preview depends on: the design file, the objects it is drawn with including their images,
+ * the enabled asset packs, the entrance style the ride is built with, whether it is being placed in a park or in the
+ * track manager, whether scenery is shown and the build that draws it.
+ */
+static u8string GetTrackPreviewCacheKey(const std::vector<uint8_t>& designData)
+{
+    auto sha1 = Crypt::CreateSHA1();
+    sha1->Update(designData.data(), designData.size());
+    sha1->Update(gVersionInfoFull, std::strlen(gVersionInfoFull));
+
+    const uint32_t screenFlags = gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER;
+    sha1->Update(&screenFlags, sizeof(screenFlags));
+    const uint64_t parkFlags = GetGameState().Park.Flags & PARK_FLAGS_NO_MONEY;
+    sha1->Update(&parkFlags, sizeof(parkFlags));
+    const uint8_t sceneryToggle = gTrackDesignSceneryToggle ? 1 : 0;
+    sha1->Update(&sceneryToggle, sizeof(sceneryToggle));
+    const ObjectEntryIndex entranceStyle = GetGameState().LastEntranceStyle;
+    sha1->Update(&entranceStyle, sizeof(entranceStyle));
+
+    // Asset packs are applied in order, so the order matters as much as which packs are enabled
+    auto* assetPackManager = GetContext()->GetAssetPackManager();
+    if (assetPackManager != nullptr)
+    {
+        for (size_t i = 0; i < assetPackManager->GetCount(); i++)
+        {
+            auto* assetPack = assetPackManager->GetAssetPack(i);
+            if (assetPack == nullptr || !assetPack->IsEnabled())
+                continue;
+
+            sha1->Update(assetPack->Id.data(), assetPack->Id.size() + 1);
+            sha1->Update(assetPack->Version.data(), assetPack->Version.size() + 1);
+        }
+    }
+
+    // Audio objects are loaded depending on whether the game has a sound device, they never affect the preview.
+    auto& objectManager = GetContext()->GetObjectManager();
+    for (auto objectType : getAllObjectTypes())
+    {
+        if (objectType == ObjectType::Audio)
+            continue;
+
+        auto maxObjectsOfType = static_cast<ObjectEntryIndex>(getObjectEntryGroupCount(objectType));
+        for (ObjectEntryIndex i = 0; i < maxObjectsOfType; i++)
+        {
+            auto* obj = objectManager.GetLoadedObject(objectType, i);
+            if (obj == nullptr)
+                continue;
+
+            auto identifier = obj->GetDescriptor().ToString();
+            auto version = VersionString(obj->GetVersion());
+            sha1->Update(&objectType, sizeof(objectType));
+            sha1->Update(&i, sizeof(i));
+            sha1->Update(identifier.data(), identifier.size() + 1);
+            sha1->Update(version.data(), version.size() + 1);
+            const auto& imagesHash = GetObjectImagesHash(*obj);
+            sha1->Update(imagesHash.data(), imagesHash.size());
+        }
+    }
+
+    auto hash = sha1->Finish();
+    u8string key;
+    key.reserve(hash.size() * 2);
+    for (auto b : hash)
+    {
+        char buf[3];
+        snprintf(buf, 3, "%02x", static_cast<int32_t>(b));
+        key.append(buf);
+    }
+    return key;
+}
+
+void TrackDesignPreviewCacheOnObjectUnloaded(const Object& obj)
+{
+    _objectImagesHashes.erase(&obj);
+}
+
+static bool ReadCachedTrackPreview(const u8string& cachePath, TrackDesign& td, uint8_t* pixels)
+{
+    if (!File::Exists(cachePath))
+        return false;
+
+    try
+    {
+        auto fs = FileStream(cachePath, FILE_MODE_OPEN);
+        auto header = fs.ReadValue<TrackPreviewCacheHeader>();
+        if (header.MagicNumber != kTrackPreviewCacheMagic || header.Version != kTrackPreviewCacheVersion)
+            return false;
+
+        std::vector<uint8_t> compressed(header.CompressedSize);
+        fs.Read(compressed.data(), compressed.size());
+        auto decompressed = Ungzip(compressed.data(), compressed.size());
+        if (decompressed.size() != kTrackPreviewPixelsSize)
+            return false;
+
+        std::copy(decompressed.begin(), decompressed.end(), pixels);
+        if (header.IsPlaced)
+        {
+            td.gameStateData.flags = header.GameStateFlags;
+            td.gameStateData.cost = header.Cost;
+
+            // Research and cheats decide whether the vehicle can be built without changing how the preview looks
+            td.gameStateData.setFlag(TrackDesignGameStateFlag::VehicleUnavailable, TrackDesignIsVehicleUnavailable(td));
+        }
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read track preview cache '%s': %s", cachePath.c_str(), e.what());
+        return false;
+    }
+}
+
+static void WriteCachedTrackPreview(const u8string& cachePath, const TrackDesign& td, bool isPlaced, const uint8_t* pixels)
+{
+    try
+    {
+        auto compressed = Gzip(pixels, kTrackPreviewPixelsSize);
+
+        TrackPreviewCacheHeader header;
+        header.IsPlaced = isPlaced;
+        header.GameStateFlags = td.gameStateData.flags;
+        header.Cost = td.gameStateData.cost;
+        header.CompressedSize = static_cast<uint32_t>(compressed.size());
+
+        Path::CreateDirectory(Path::GetDirectory(cachePath));
+        auto fs = FileStream(cachePath, FILE_MODE_WRITE);
+        fs.WriteValue(header);
+        fs.Write(compressed.data(), compressed.size());
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Unable to write track preview cache '%s': %s", cachePath.c_str(), e.what());
+    }
+}
+
+static bool DrawPreviewCached(const std::vector<uint8_t>& designData, TrackDesign& td, uint8_t* pixels)
+{
+    // The track manager draws designs with only their own objects loaded, so the key has to be taken after loading them.
+    if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
+    {
+        TrackDesignLoadSceneryObjects(td);
+    }
+
+    PruneTrackPreviewCache();
+
+    auto cachePath = Path::Combine(GetTrackPreviewCacheDirectory(), GetTrackPreviewCacheKey(designData) + u8".dat");
+    if (ReadCachedTrackPreview(cachePath, td, pixels))
+        return false;
+
+    auto isPlaced = TrackDesignDrawLoadedPreview(td, pixels);
+    WriteCachedTrackPreview(cachePath, td, isPlaced, pixels);
+    return true;
+}
+
+void TrackDesignDrawPreviewCached(u8string_view path, TrackDesign& td, uint8_t* pixels)
+{
+    std::vector<uint8_t> designData;
+    try
+    {
+        designData = File::ReadAllBytes(path);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_VERBOSE("Unable to read track design '%s' for preview cache: %s", u8string(path).c_str(), e.what());
+        TrackDesignDrawPreview(td, pixels);
+        return;
+    }
+    DrawPreviewCached(designData, td, pixels);
+}
+
+size_t TrackDesignPreviewCacheWarm(u8string_view directory)
+{
+    size_t numRendered = 0;
+    std::vector<uint8_t> pixels(kTrackPreviewPixelsSize);
+
+    auto pattern = Path::Combine(directory, u8"*.td4;*.td6");
+    auto scanner = Path::ScanDirectory(pattern, true);
+    while (scanner->Next())
+    {
+        const auto& path = scanner->GetPath();
+        auto td = TrackDesignImport(path.c_str());
+        if (td == nullptr)
+        {
+            LOG_ERROR("Unable to import track design '%s'", path.c_str());
+            continue;
+        }
+
+        try
+        {
+            auto designData = File::ReadAllBytes(path);
+            if (DrawPreviewCached(designData, *td, pixels.data()))
+            {
+                numRendered++;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Unable to read track design '%s': %s", path.c_str(), e.what());
+        }
+    }
+    return numRendered;
+}
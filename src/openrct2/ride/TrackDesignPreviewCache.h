@@ -0,0 +1,37 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../core/String.hpp"
+
+#include <cstdint>
+
+class Object;
+struct TrackDesign;
+
+/**
+ * Draws the four rotations of a track design preview, reusing a previously rendered copy from the on-disk cache
+ * when the design file, the loaded objects and their images, the asset packs and the game build all match. Fills in
+ * the same game state data (cost and availability flags) as TrackDesignDrawPreview. The cache is kept below a fixed
+ * size by removing the oldest previews once per session.
+ * @param path The path of the file the track design was imported from.
+ */
+void TrackDesignDrawPreviewCached(u8string_view path, TrackDesign& td, uint8_t* pixels);
+
+/**
+ * Renders and caches the previews of every track design found in the given directory (recursively).
+ * @returns The number of designs that had to be rendered.
+ */
+size_t TrackDesignPreviewCacheWarm(u8string_view directory);
+
+/**
+ * Forgets what was kept about an object that is being unloaded.
+ */
+void TrackDesignPreviewCacheOnObjectUnloaded(const Object& obj);
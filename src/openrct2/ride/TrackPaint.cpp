@@ -193,6 +193,26 @@ bool TrackPaintUtilShouldPaintSupports(const CoordsXY& position)
     return false;
 }
 
+/**
+ * Draws the sprites of a track piece that only differ by direction in their image, offset and bound box, replacing
+ * the switch on the direction each of those pieces used to have.
+ */
+void TrackPaintUtilPaintSprites(
+    PaintSession& session, Direction direction, int32_t height, const TrackPaintSpriteTable& sprites)
+{
+    for (const auto& sprite : sprites[direction])
+    {
+        if (sprite.ImageIndex == 0)
+            break;
+
+        const auto& boundBox = sprite.BoundBox;
+        PaintAddImageAsParentRotated(
+            session, direction, session.TrackColours.WithIndex(sprite.ImageIndex),
+            { sprite.Offset.x, sprite.Offset.y, height + sprite.Offset.z },
+            { { boundBox.offset.x, boundBox.offset.y, height + boundBox.offset.z }, boundBox.length });
+    }
+}
+
 static void TrackPaintUtilDrawStationImpl(
     PaintSession& session, const Ride& ride, Direction direction, uint16_t height, uint16_t coverHeight,
     const TrackElement& trackElement, int32_t fenceOffsetA, int32_t fenceOffsetB);
@@ -399,6 +399,22 @@ constexpr bool kDiagSpriteMap[kNumOrthogonalDirections][4] = {
 
 extern const uint8_t mapLeftEighthTurnToOrthogonal[5];
 
+constexpr uint8_t kTrackPaintMaxSpritesPerDirection = 3;
+
+/**
+ * A track sprite drawn by TrackPaintUtilPaintSprites. The z coordinates of the offset and bound box are relative to the
+ * height of the track element. An image index of 0 marks an unused entry.
+ */
+struct TrackPaintSprite
+{
+    uint32_t ImageIndex{};
+    CoordsXYZ Offset{};
+    BoundBoxXYZ BoundBox{};
+};
+
+/** The sprites a track piece draws for each direction, in the order they are drawn. */
+using TrackPaintSpriteTable = TrackPaintSprite[kNumOrthogonalDirections][kTrackPaintMaxSpritesPerDirection];
+
 ImageId GetStationColourScheme(PaintSession& session, const TrackElement& trackElement);
 ImageId GetShopSupportColourScheme(PaintSession& session, const TrackElement& trackElement);
 
@@ -431,6 +447,8 @@ void TrackPaintUtilDrawStationInverted(
     PaintSession& session, const Ride& ride, Direction direction, int32_t height, const TrackElement& trackElement,
     uint8_t stationVariant);
 bool TrackPaintUtilShouldPaintSupports(const CoordsXY& position);
+void TrackPaintUtilPaintSprites(
+    PaintSession& session, Direction direction, int32_t height, const TrackPaintSpriteTable& sprites);
 void TrackPaintUtilDrawPier(
     PaintSession& session, const Ride& ride, const StationObject* stationObject, const CoordsXY& position, Direction direction,
     int32_t height, const TrackElement& trackElement, uint8_t rotation);
@@ -74,17 +74,37 @@ constexpr int16_t VEHICLE_MAX_SPIN_SPEED_WATER_RIDE = 512;
 constexpr int16_t VEHICLE_MIN_SPIN_SPEED_WATER_RIDE = -VEHICLE_MAX_SPIN_SPEED_WATER_RIDE;
 constexpr int16_t VEHICLE_STOPPING_SPIN_SPEED = 600;
 
-Vehicle* gCurrentVehicle;
-
-static uint8_t _vehicleBreakdown;
-StationIndex _vehicleStationIndex;
-uint32_t _vehicleMotionTrackFlags;
-int32_t _vehicleVelocityF64E08;
-int32_t _vehicleVelocityF64E0C;
-int32_t _vehicleUnkF64E10;
-uint8_t _vehicleF64E2C;
-Vehicle* _vehicleFrontVehicle;
-CoordsXYZ _vehicleCurPosition;
+VehicleMotionState gVehicleMotion;
+
+struct VehicleDeferredSound
+{
+    SoundId Id;
+    CoordsXYZ Location;
+};
+
+static bool _vehicleSoundsDeferred;
+static std::vector<VehicleDeferredSound> _vehicleDeferredSounds;
+
+/**
+ * Sounds made while every train is being updated are held back and played once all trains have moved, in the order the
+ * trains made them, so the update of one train never has to reach the audio system.
+ */
+static void VehiclePlaySound(SoundId soundId, const CoordsXYZ& loc)
+{
+    if (_vehicleSoundsDeferred)
+        _vehicleDeferredSounds.push_back({ soundId, loc });
+    else
+        Play3D(soundId, loc);
+}
+
+static void VehiclePlayDeferredSounds()
+{
+    for (const auto& sound : _vehicleDeferredSounds)
+    {
+        Play3D(sound.Id, sound.Location);
+    }
+    _vehicleDeferredSounds.clear();
+}
 
 static constexpr OpenRCT2::Audio::SoundId _screamSet0[] = {
     OpenRCT2::Audio::SoundId::Scream8,
@@ -591,6 +611,11 @@ void VehicleSoundsUpdate()
 /**
  *
  *  rct2: 0x006D4204
+ *
+ * Trains are updated one at a time in train list order. This order is part of the simulation: track motion keeps its
+ * scratch state in gVehicleMotion, draws from the scenario RNG, moves cars in the entity spatial index and hands guests
+ * over to the ride, so running rides on separate threads or in any other order would desynchronise network games and
+ * replays. Sounds are the one side effect already deferred until every train has moved.
  */
 void VehicleUpdateAll()
 {
@@ -602,10 +627,13 @@ void VehicleUpdateAll()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && GetGameState().EditorStep != EditorStep::RollercoasterDesigner)
         return;
 
+    _vehicleSoundsDeferred = true;
     for (auto vehicle : TrainManager::View())
     {
         vehicle->Update();
     }
+    _vehicleSoundsDeferred = false;
+    VehiclePlayDeferredSounds();
 }
 
 /**
@@ -1238,10 +1266,10 @@ void Vehicle::Update()
     if (HasFlag(VehicleFlags::Testing))
         UpdateMeasurements();
 
-    _vehicleBreakdown = 255;
+    gVehicleMotion.Breakdown = 255;
     if (curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
     {
-        _vehicleBreakdown = curRide->breakdown_reason_pending;
+        gVehicleMotion.Breakdown = curRide->breakdown_reason_pending;
         auto carEntry = &rideEntry->Cars[vehicle_type];
         if ((carEntry->flags & CAR_ENTRY_FLAG_POWERED) && curRide->breakdown_reason_pending == BREAKDOWN_SAFETY_CUT_OUT)
         {
@@ -2495,12 +2523,12 @@ void Vehicle::UpdateDeparting()
             auto soundId = (rideEntry->Cars[0].sound_range == 4) ? OpenRCT2::Audio::SoundId::Tram
                                                                  : OpenRCT2::Audio::SoundId::TrainDeparting;
 
-            OpenRCT2::Audio::Play3D(soundId, GetLocation());
+            VehiclePlaySound(soundId, GetLocation());
         }
 
         if (curRide->mode == RideMode::UpwardLaunch || (curRide->mode == RideMode::DownwardLaunch && NumLaunches > 1))
         {
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::RideLaunch2, GetLocation());
+            VehiclePlaySound(OpenRCT2::Audio::SoundId::RideLaunch2, GetLocation());
         }
 
         if (!(curRide->lifecycle_flags & RIDE_LIFECYCLE_TESTED))
@@ -2614,7 +2642,7 @@ void Vehicle::UpdateDeparting()
                 acceleration = 15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == BREAKDOWN_SAFETY_CUT_OUT)
+                    if (gVehicleMotion.Breakdown == BREAKDOWN_SAFETY_CUT_OUT)
                     {
                         SetFlag(VehicleFlags::StoppedOnLift);
                         ClearFlag(VehicleFlags::CollisionDisabled);
@@ -2632,7 +2660,7 @@ void Vehicle::UpdateDeparting()
                 acceleration = -15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == BREAKDOWN_SAFETY_CUT_OUT)
+                    if (gVehicleMotion.Breakdown == BREAKDOWN_SAFETY_CUT_OUT)
                     {
                         SetFlag(VehicleFlags::StoppedOnLift);
                         ClearFlag(VehicleFlags::CollisionDisabled);
@@ -2659,7 +2687,7 @@ void Vehicle::UpdateDeparting()
 
         if (shouldLaunch)
         {
-            if (!(curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3) || _vehicleStationIndex != current_station)
+            if (!(curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3) || gVehicleMotion.Station != current_station)
             {
                 FinishDeparting();
                 return;
@@ -2706,7 +2734,7 @@ void Vehicle::FinishDeparting()
         if (NumLaunches >= 1 && (14 << 16) > velocity)
             return;
 
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::RideLaunch1, GetLocation());
+        VehiclePlaySound(OpenRCT2::Audio::SoundId::RideLaunch1, GetLocation());
     }
 
     if (curRide->mode == RideMode::UpwardLaunch)
@@ -2714,7 +2742,7 @@ void Vehicle::FinishDeparting()
         if ((curRide->launch_speed << 16) > velocity)
             return;
 
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::RideLaunch1, GetLocation());
+        VehiclePlaySound(OpenRCT2::Audio::SoundId::RideLaunch1, GetLocation());
     }
 
     if (curRide->mode != RideMode::Race && !curRide->IsBlockSectioned())
@@ -2849,7 +2877,7 @@ void Vehicle::UpdateCollisionSetup()
 #endif
         const auto trainLoc = train->GetLocation();
 
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::Crash, trainLoc);
+        VehiclePlaySound(OpenRCT2::Audio::SoundId::Crash, trainLoc);
 
         ExplosionCloud::Create(trainLoc);
 
@@ -2909,7 +2937,7 @@ void Vehicle::UpdateCrashSetup()
 
     if (NumPeepsUntilTrainTail() != 0)
     {
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScream2, GetLocation());
+        VehiclePlaySound(OpenRCT2::Audio::SoundId::HauntedHouseScream2, GetLocation());
     }
 
     int32_t edx = velocity >> 10;
@@ -2976,7 +3004,7 @@ void Vehicle::UpdateTravelling()
     CheckIfMissing();
 
     auto curRide = GetRide();
-    if (curRide == nullptr || (_vehicleBreakdown == 0 && curRide->mode == RideMode::RotatingLift))
+    if (curRide == nullptr || (gVehicleMotion.Breakdown == 0 && curRide->mode == RideMode::RotatingLift))
         return;
 
     if (sub_state == 2)
@@ -3095,7 +3123,7 @@ void Vehicle::UpdateTravelling()
                     {
                         acceleration = -15539;
 
-                        if (_vehicleBreakdown == 0)
+                        if (gVehicleMotion.Breakdown == 0)
                         {
                             sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
                             SetFlag(VehicleFlags::StoppedOnLift);
@@ -3112,7 +3140,7 @@ void Vehicle::UpdateTravelling()
                 acceleration = 15539;
                 if (velocity != 0)
                 {
-                    if (_vehicleBreakdown == 0)
+                    if (gVehicleMotion.Breakdown == 0)
                     {
                         SetFlag(VehicleFlags::StoppedOnLift);
                         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
@@ -3139,7 +3167,7 @@ void Vehicle::UpdateTravelling()
         return;
 
     SetState(Vehicle::Status::Arriving);
-    current_station = _vehicleStationIndex;
+    current_station = gVehicleMotion.Station;
     var_C0 = 0;
     if (velocity < 0)
         sub_state = 1;
@@ -3346,7 +3374,7 @@ void Vehicle::UpdateArriving()
 
     if ((curRide->mode == RideMode::UpwardLaunch || curRide->mode == RideMode::DownwardLaunch) && NumLaunches < 2)
     {
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::RideLaunch2, GetLocation());
+        VehiclePlaySound(OpenRCT2::Audio::SoundId::RideLaunch2, GetLocation());
         velocity = 0;
         acceleration = 0;
         SetState(Vehicle::Status::Departing, 1);
@@ -3555,7 +3583,7 @@ void Vehicle::UpdateTravellingCableLift()
     if (sub_state == 2)
         return;
 
-    if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3 && current_station == _vehicleStationIndex)
+    if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_3 && current_station == gVehicleMotion.Station)
         return;
 
     sub_state = 2;
@@ -3607,8 +3635,8 @@ void Vehicle::TryReconnectBoatToTrack(const CoordsXY& currentBoatLocation, const
 
         track_progress = 0;
         SetState(Vehicle::Status::Travelling, sub_state);
-        _vehicleCurPosition.x = currentBoatLocation.x;
-        _vehicleCurPosition.y = currentBoatLocation.y;
+        gVehicleMotion.CurPosition.x = currentBoatLocation.x;
+        gVehicleMotion.CurPosition.y = currentBoatLocation.y;
     }
 }
 
@@ -3618,10 +3646,10 @@ void Vehicle::TryReconnectBoatToTrack(const CoordsXY& currentBoatLocation, const
  */
 void Vehicle::UpdateMotionBoatHire()
 {
-    _vehicleMotionTrackFlags = 0;
+    gVehicleMotion.TrackFlags = 0;
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity >> 10) * 42;
+    gVehicleMotion.VelocityF64E08 = velocity;
+    gVehicleMotion.VelocityF64E0C = (velocity >> 10) * 42;
 
     auto carEntry = Entry();
     if (carEntry == nullptr)
@@ -3633,13 +3661,13 @@ void Vehicle::UpdateMotionBoatHire()
         UpdateAdditionalAnimation();
     }
 
-    _vehicleUnkF64E10 = 1;
+    gVehicleMotion.UnkF64E10 = 1;
     acceleration = 0;
-    remaining_distance += _vehicleVelocityF64E0C;
+    remaining_distance += gVehicleMotion.VelocityF64E0C;
     if (remaining_distance >= 0x368A)
     {
         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        _vehicleCurPosition = GetLocation();
+        gVehicleMotion.CurPosition = GetLocation();
         Invalidate();
 
         for (;;)
@@ -3806,7 +3834,7 @@ void Vehicle::UpdateMotionBoatHire()
                             TryReconnectBoatToTrack(loc2, flooredLocation);
                             break;
                         }
-                        loc2 = _vehicleCurPosition;
+                        loc2 = gVehicleMotion.CurPosition;
                         if (tilePart <= kCoordsXYHalfTile)
                         {
                             loc2.y += 1;
@@ -3825,7 +3853,7 @@ void Vehicle::UpdateMotionBoatHire()
                             TryReconnectBoatToTrack(loc2, flooredLocation);
                             break;
                         }
-                        loc2 = _vehicleCurPosition;
+                        loc2 = gVehicleMotion.CurPosition;
                         if (tilePart <= kCoordsXYHalfTile)
                         {
                             loc2.x += 1;
@@ -3840,8 +3868,8 @@ void Vehicle::UpdateMotionBoatHire()
                     remaining_distance = 0;
                     if (!UpdateMotionCollisionDetection({ loc2, z }, nullptr))
                     {
-                        _vehicleCurPosition.x = loc2.x;
-                        _vehicleCurPosition.y = loc2.y;
+                        gVehicleMotion.CurPosition.x = loc2.x;
+                        gVehicleMotion.CurPosition.y = loc2.y;
                     }
                     break;
                 }
@@ -3849,16 +3877,16 @@ void Vehicle::UpdateMotionBoatHire()
             }
 
             remaining_distance -= Unk9A36C4[edi].distance;
-            _vehicleCurPosition.x = loc2.x;
-            _vehicleCurPosition.y = loc2.y;
+            gVehicleMotion.CurPosition.x = loc2.x;
+            gVehicleMotion.CurPosition.y = loc2.y;
             if (remaining_distance < 0x368A)
             {
                 break;
             }
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
         }
 
-        MoveTo(_vehicleCurPosition);
+        MoveTo(gVehicleMotion.CurPosition);
     }
 
     // Loc6DAAC9:
@@ -3890,8 +3918,8 @@ void Vehicle::UpdateMotionBoatHire()
         }
         acceleration = ecx;
     }
-    // eax = _vehicleMotionTrackFlags;
-    // ebx = _vehicleStationIndex;
+    // eax = gVehicleMotion.TrackFlags;
+    // ebx = gVehicleMotion.Station;
 }
 
 /**
@@ -4079,7 +4107,7 @@ void Vehicle::UpdateSwinging()
  */
 void Vehicle::UpdateFerrisWheelRotating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     auto curRide = GetRide();
@@ -4171,7 +4199,7 @@ void Vehicle::UpdateFerrisWheelRotating()
  */
 void Vehicle::UpdateSimulatorOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     assert(current_time >= -1);
@@ -4215,7 +4243,7 @@ void UpdateRotatingEnterprise(Vehicle& vehicle)
  */
 void Vehicle::UpdateRotating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     auto curRide = GetRide();
@@ -4243,7 +4271,7 @@ void Vehicle::UpdateRotating()
     }
 
     uint16_t time = current_time;
-    if (_vehicleBreakdown == BREAKDOWN_CONTROL_FAILURE)
+    if (gVehicleMotion.Breakdown == BREAKDOWN_CONTROL_FAILURE)
     {
         time += (curRide->breakdown_sound_modifier >> 6) + 1;
     }
@@ -4262,7 +4290,7 @@ void Vehicle::UpdateRotating()
 
     current_time = -1;
     NumRotations++;
-    if (_vehicleBreakdown != BREAKDOWN_CONTROL_FAILURE)
+    if (gVehicleMotion.Breakdown != BREAKDOWN_CONTROL_FAILURE)
     {
         bool shouldStop = true;
         if (curRide->status != RideStatus::Closed)
@@ -4299,7 +4327,7 @@ void Vehicle::UpdateRotating()
  */
 void Vehicle::UpdateSpaceRingsOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     uint8_t spriteType = SpaceRingsTimeToSpriteMap[current_time + 1];
@@ -4325,7 +4353,7 @@ void Vehicle::UpdateSpaceRingsOperating()
  */
 void Vehicle::UpdateHauntedHouseOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     if (Pitch != 0)
@@ -4351,24 +4379,24 @@ void Vehicle::UpdateHauntedHouseOperating()
     switch (current_time)
     {
         case 45:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScare, GetLocation());
+            VehiclePlaySound(OpenRCT2::Audio::SoundId::HauntedHouseScare, GetLocation());
             break;
         case 75:
             Pitch = 1;
             Invalidate();
             break;
         case 400:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScream1, GetLocation());
+            VehiclePlaySound(OpenRCT2::Audio::SoundId::HauntedHouseScream1, GetLocation());
             break;
         case 745:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScare, GetLocation());
+            VehiclePlaySound(OpenRCT2::Audio::SoundId::HauntedHouseScare, GetLocation());
             break;
         case 775:
             Pitch = 1;
             Invalidate();
             break;
         case 1100:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::HauntedHouseScream2, GetLocation());
+            VehiclePlaySound(OpenRCT2::Audio::SoundId::HauntedHouseScream2, GetLocation());
             break;
     }
 }
@@ -4379,7 +4407,7 @@ void Vehicle::UpdateHauntedHouseOperating()
  */
 void Vehicle::UpdateCrookedHouseOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     // Originally used an array of size 1 at 0x009A0AC4 and passed the sub state into it.
@@ -4399,7 +4427,7 @@ void Vehicle::UpdateCrookedHouseOperating()
  */
 void Vehicle::UpdateTopSpinOperating()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     const TopSpinTimeToSpriteMap* sprite_map = TopSpinTimeToSpriteMaps[sub_state];
@@ -4433,7 +4461,7 @@ void Vehicle::UpdateShowingFilm()
 {
     int32_t currentTime, totalTime;
 
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     totalTime = RideFilmLength[sub_state];
@@ -4455,7 +4483,7 @@ void Vehicle::UpdateShowingFilm()
  */
 void Vehicle::UpdateDoingCircusShow()
 {
-    if (_vehicleBreakdown == 0)
+    if (gVehicleMotion.Breakdown == 0)
         return;
 
     int32_t currentTime = current_time + 1;
@@ -4631,7 +4659,7 @@ void Vehicle::CrashOnLand()
     sub_state = 2;
 
     const auto curLoc = GetLocation();
-    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::Crash, curLoc);
+    VehiclePlaySound(OpenRCT2::Audio::SoundId::Crash, curLoc);
 
     ExplosionCloud::Create(curLoc);
     ExplosionFlare::Create(curLoc);
@@ -4699,7 +4727,7 @@ void Vehicle::CrashOnWater()
     sub_state = 2;
 
     const auto curLoc = GetLocation();
-    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::Water1, curLoc);
+    VehiclePlaySound(OpenRCT2::Audio::SoundId::Water1, curLoc);
 
     CrashSplashParticle::Create(curLoc);
     CrashSplashParticle::Create(curLoc + CoordsXYZ{ -8, -9, 0 });
@@ -5127,11 +5155,11 @@ int32_t Vehicle::IsUsedInPairs() const
  */
 int32_t Vehicle::UpdateMotionDodgems()
 {
-    _vehicleMotionTrackFlags = 0;
+    gVehicleMotion.TrackFlags = 0;
 
     auto curRide = GetRide();
     if (curRide == nullptr)
-        return _vehicleMotionTrackFlags;
+        return gVehicleMotion.TrackFlags;
 
     int32_t nextVelocity = velocity + acceleration;
     if (curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN)
@@ -5141,9 +5169,9 @@ int32_t Vehicle::UpdateMotionDodgems()
     }
     velocity = nextVelocity;
 
-    _vehicleVelocityF64E08 = nextVelocity;
-    _vehicleVelocityF64E0C = (nextVelocity / 1024) * 42;
-    _vehicleUnkF64E10 = 1;
+    gVehicleMotion.VelocityF64E08 = nextVelocity;
+    gVehicleMotion.VelocityF64E0C = (nextVelocity / 1024) * 42;
+    gVehicleMotion.UnkF64E10 = 1;
 
     acceleration = 0;
     if (!(curRide->lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN))
@@ -5194,14 +5222,14 @@ int32_t Vehicle::UpdateMotionDodgems()
         }
     }
 
-    remaining_distance += _vehicleVelocityF64E0C;
+    remaining_distance += gVehicleMotion.VelocityF64E0C;
 
     if (remaining_distance >= 13962)
     {
         sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        _vehicleCurPosition.x = x;
-        _vehicleCurPosition.y = y;
-        _vehicleCurPosition.z = z;
+        gVehicleMotion.CurPosition.x = x;
+        gVehicleMotion.CurPosition.y = y;
+        gVehicleMotion.CurPosition.z = z;
 
         while (true)
         {
@@ -5209,7 +5237,7 @@ int32_t Vehicle::UpdateMotionDodgems()
             uint8_t direction = Orientation;
             direction |= var_35 & 1;
 
-            CoordsXY location = _vehicleCurPosition;
+            CoordsXY location = gVehicleMotion.CurPosition;
             location.x += Unk9A36C4[direction].x;
             location.y += Unk9A36C4[direction].y;
 
@@ -5219,13 +5247,13 @@ int32_t Vehicle::UpdateMotionDodgems()
             }
 
             remaining_distance -= Unk9A36C4[direction].distance;
-            _vehicleCurPosition.x = location.x;
-            _vehicleCurPosition.y = location.y;
+            gVehicleMotion.CurPosition.x = location.x;
+            gVehicleMotion.CurPosition.y = location.y;
             if (remaining_distance < 13962)
             {
                 break;
             }
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
         }
 
         if (remaining_distance >= 13962)
@@ -5257,7 +5285,7 @@ int32_t Vehicle::UpdateMotionDodgems()
             }
         }
 
-        MoveTo(_vehicleCurPosition);
+        MoveTo(gVehicleMotion.CurPosition);
     }
 
     int32_t eax = velocity / 2;
@@ -5277,7 +5305,7 @@ int32_t Vehicle::UpdateMotionDodgems()
     if (!(carEntry.flags & CAR_ENTRY_FLAG_POWERED))
     {
         acceleration = -eax;
-        return _vehicleMotionTrackFlags;
+        return gVehicleMotion.TrackFlags;
     }
 
     int32_t momentum = (speed * mass) >> 2;
@@ -5292,7 +5320,7 @@ int32_t Vehicle::UpdateMotionDodgems()
         _eax /= momentum;
 
     acceleration = _eax - eax;
-    return _vehicleMotionTrackFlags;
+    return gVehicleMotion.TrackFlags;
 }
 
 /**
@@ -5392,7 +5420,7 @@ void Vehicle::UpdateTrackMotionUpStopCheck() const
 
             if (Pitch != 8)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
             }
         }
     }
@@ -5421,7 +5449,7 @@ void Vehicle::UpdateTrackMotionUpStopCheck() const
 
             if (Pitch != 8 && Pitch != 55)
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_DERAILED;
             }
         }
     }
@@ -5460,7 +5488,7 @@ void Vehicle::ApplyNonStopBlockBrake()
 void Vehicle::ApplyStopBlockBrake()
 {
     // Slow it down till completely stop the car
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_BLOCK_BRAKE;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_BLOCK_BRAKE;
     acceleration = 0;
     // If the this is slow enough, stop it. If not, slow it down
     if (velocity <= 2.0_mph)
@@ -5490,7 +5518,7 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
     // Is chair lift type
     if (carEntry->flags & CAR_ENTRY_FLAG_CHAIRLIFT)
     {
-        velocity = _vehicleBreakdown == 0 ? 0 : curRide->speed << 16;
+        velocity = gVehicleMotion.Breakdown == 0 ? 0 : curRide->speed << 16;
         acceleration = 0;
     }
 
@@ -5515,7 +5543,7 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
             break;
         case TrackElemType::EndStation:
             if (trackElement->AsTrack()->IsBrakeClosed())
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_BLOCK_BRAKE;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_BLOCK_BRAKE;
 
             break;
         case TrackElemType::Up25ToFlat:
@@ -5563,8 +5591,8 @@ void Vehicle::UpdateVelocity()
     }
     velocity = nextVelocity;
 
-    _vehicleVelocityF64E08 = nextVelocity;
-    _vehicleVelocityF64E0C = (nextVelocity >> 10) * 42;
+    gVehicleMotion.VelocityF64E08 = nextVelocity;
+    gVehicleMotion.VelocityF64E0C = (nextVelocity >> 10) * 42;
 }
 
 static void block_brakes_open_previous_section(
@@ -5623,11 +5651,11 @@ static void block_brakes_open_previous_section(
     auto trackType = trackElement->GetTrackType();
     if (trackType == TrackElemType::EndStation)
     {
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::BlockBrakeClose, location);
+        VehiclePlaySound(OpenRCT2::Audio::SoundId::BlockBrakeClose, location);
     }
     else if (TrackTypeIsBlockBrakes(trackType))
     {
-        OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::BlockBrakeClose, location);
+        VehiclePlaySound(OpenRCT2::Audio::SoundId::BlockBrakeClose, location);
         BlockBrakeSetLinkedBrakesClosed(location, *trackElement, false);
     }
 }
@@ -5787,7 +5815,7 @@ static uint8_t GetSwingSprite(int16_t swingPosition)
  */
 void Vehicle::UpdateSwingingCar()
 {
-    int32_t dword_F64E08 = abs(_vehicleVelocityF64E08);
+    int32_t dword_F64E08 = abs(gVehicleMotion.VelocityF64E08);
     if (HasFlag(VehicleFlags::CarIsReversed))
     {
         dword_F64E08 *= -1;
@@ -5896,7 +5924,7 @@ void Vehicle::UpdateSpinningCar()
     }
     int32_t spinningInertia = carEntry->spinning_inertia;
     auto trackType = GetTrackType();
-    int32_t dword_F64E08 = _vehicleVelocityF64E08;
+    int32_t dword_F64E08 = gVehicleMotion.VelocityF64E08;
     int32_t spinSpeed{};
     // An L spin adds to the spin speed, R does the opposite
     // The number indicates how much right shift of the velocity will become spin
@@ -6076,7 +6104,7 @@ static void AnimateNone(Vehicle& vehicle, const CarEntry& carEntry)
  */
 static void AnimateSimpleVehicle(Vehicle& vehicle, const CarEntry& carEntry)
 {
-    vehicle.animationState += _vehicleVelocityF64E08;
+    vehicle.animationState += gVehicleMotion.VelocityF64E08;
     uint8_t targetFrame = GetTargetFrame(carEntry, vehicle.animationState);
     if (vehicle.animation_frame != targetFrame)
     {
@@ -6090,7 +6118,7 @@ static void AnimateSimpleVehicle(Vehicle& vehicle, const CarEntry& carEntry)
  */
 static void AnimateSteamLocomotive(Vehicle& vehicle, const CarEntry& carEntry)
 {
-    vehicle.animationState += _vehicleVelocityF64E08;
+    vehicle.animationState += gVehicleMotion.VelocityF64E08;
     uint8_t targetFrame = GetTargetFrame(carEntry, vehicle.animationState);
     if (vehicle.animation_frame != targetFrame)
     {
@@ -6120,7 +6148,7 @@ static void AnimateSwanBoat(Vehicle& vehicle, const CarEntry& carEntry)
 {
     // The animation of swan boats places frames at 0 and 2 instead of 0 and 1 like Water Tricycles due to the second
     // pair of peeps. The animation technically uses 4 frames, but ignores frames 1 and 3.
-    vehicle.animationState += _vehicleVelocityF64E08;
+    vehicle.animationState += gVehicleMotion.VelocityF64E08;
     uint8_t targetFrame = GetTargetFrame(carEntry, vehicle.animationState) * 2;
     if (vehicle.animation_frame != targetFrame)
     {
@@ -6203,7 +6231,7 @@ static void AnimateAnimalFlying(Vehicle& vehicle, const CarEntry& carEntry)
 {
     vehicle.UpdateAnimationAnimalFlying();
     // makes animation play faster with vehicle speed
-    uint8_t targetFrame = abs(_vehicleVelocityF64E08) >> carEntry.AnimationSpeed;
+    uint8_t targetFrame = abs(gVehicleMotion.VelocityF64E08) >> carEntry.AnimationSpeed;
     vehicle.animationState = std::max(vehicle.animationState - targetFrame, 0u);
 }
 
@@ -6244,7 +6272,7 @@ static void play_scenery_door_open_sound(const CoordsXYZ& loc, WallElement* tile
         auto soundId = DoorOpenSoundIds[doorSoundType - 1];
         if (soundId != OpenRCT2::Audio::SoundId::Null)
         {
-            OpenRCT2::Audio::Play3D(soundId, loc);
+            VehiclePlaySound(soundId, loc);
         }
     }
 }
@@ -6262,7 +6290,7 @@ static void play_scenery_door_close_sound(const CoordsXYZ& loc, WallElement* til
         auto soundId = DoorCloseSoundIds[doorSoundType - 1];
         if (soundId != OpenRCT2::Audio::SoundId::Null)
         {
-            Play3D(soundId, loc);
+            VehiclePlaySound(soundId, loc);
         }
     }
 }
@@ -6425,13 +6453,12 @@ void Vehicle::UpdateLandscapeDoorBackwards() const
 
 static void vehicle_update_play_water_splash_sound()
 {
-    if (_vehicleVelocityF64E08 <= kBlockBrakeBaseSpeed)
+    if (gVehicleMotion.VelocityF64E08 <= kBlockBrakeBaseSpeed)
     {
         return;
     }
 
-    OpenRCT2::Audio::Play3D(
-        OpenRCT2::Audio::SoundId::WaterSplash, { _vehicleCurPosition.x, _vehicleCurPosition.y, _vehicleCurPosition.z });
+    VehiclePlaySound(OpenRCT2::Audio::SoundId::WaterSplash, gVehicleMotion.CurPosition);
 }
 
 /**
@@ -6738,7 +6765,7 @@ void Vehicle::Sub6DBF3E()
 {
     const auto* carEntry = Entry();
 
-    acceleration /= _vehicleUnkF64E10;
+    acceleration /= gVehicleMotion.UnkF64E10;
     if (TrackSubposition == VehicleTrackSubposition::ChairliftGoingBack)
     {
         return;
@@ -6751,7 +6778,7 @@ void Vehicle::Sub6DBF3E()
         return;
     }
 
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
 
     TileElement* tileElement = nullptr;
     if (MapIsLocationValid(TrackLocation))
@@ -6764,12 +6791,12 @@ void Vehicle::Sub6DBF3E()
         return;
     }
 
-    if (_vehicleStationIndex.IsNull())
+    if (gVehicleMotion.Station.IsNull())
     {
-        _vehicleStationIndex = tileElement->AsTrack()->GetStationIndex();
+        gVehicleMotion.Station = tileElement->AsTrack()->GetStationIndex();
     }
 
-    if (trackType == TrackElemType::TowerBase && this == gCurrentVehicle)
+    if (trackType == TrackElemType::TowerBase && this == gVehicleMotion.CurrentVehicle)
     {
         if (track_progress > 3 && !HasFlag(VehicleFlags::PoweredCarInReverse))
         {
@@ -6779,27 +6806,27 @@ void Vehicle::Sub6DBF3E()
             CoordsXYE input = { TrackLocation, tileElement };
             if (!TrackBlockGetNext(&input, &output, &outputZ, &outputDirection))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_12;
             }
         }
 
         if (track_progress <= 3)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
 
-    if (trackType != TrackElemType::EndStation || this != gCurrentVehicle)
+    if (trackType != TrackElemType::EndStation || this != gVehicleMotion.CurrentVehicle)
     {
         return;
     }
 
     uint16_t ax = track_progress;
-    if (_vehicleVelocityF64E08 < 0)
+    if (gVehicleMotion.VelocityF64E08 < 0)
     {
         if (ax <= 22)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
     else
@@ -6819,7 +6846,7 @@ void Vehicle::Sub6DBF3E()
 
         if (ax > cx)
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
         }
     }
 }
@@ -6894,9 +6921,9 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, const Rid
         return false;
     }
 
-    if (trackType == TrackElemType::CableLiftHill && this == gCurrentVehicle)
+    if (trackType == TrackElemType::CableLiftHill && this == gVehicleMotion.CurrentVehicle)
     {
-        _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_11;
+        gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_11;
     }
 
     if (tileElement->AsTrack()->IsBlockStart())
@@ -6908,7 +6935,7 @@ bool Vehicle::UpdateTrackMotionForwardsGetNewTrack(uint16_t trackType, const Rid
             {
                 if (!(rideEntry.Cars[0].flags & CAR_ENTRY_FLAG_POWERED))
                 {
-                    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::BlockBrakeRelease, TrackLocation);
+                    VehiclePlaySound(OpenRCT2::Audio::SoundId::BlockBrakeRelease, TrackLocation);
                 }
             }
             MapInvalidateElement(TrackLocation, tileElement);
@@ -7078,11 +7105,11 @@ Loc6DAEB9:
             vehicle_type ^= 1;
             carEntry = Entry();
         }
-        if (_vehicleVelocityF64E08 >= 0x40000)
+        if (gVehicleMotion.VelocityF64E08 >= 0x40000)
         {
-            acceleration = -_vehicleVelocityF64E08 * 8;
+            acceleration = -gVehicleMotion.VelocityF64E08 * 8;
         }
-        else if (_vehicleVelocityF64E08 < 0x20000)
+        else if (gVehicleMotion.VelocityF64E08 < 0x20000)
         {
             acceleration = 0x50000;
         }
@@ -7095,16 +7122,16 @@ Loc6DAEB9:
         {
             auto brakeSpeed = ChooseBrakeSpeed();
 
-            if ((brakeSpeed << 16) < _vehicleVelocityF64E08)
+            if ((brakeSpeed << 16) < gVehicleMotion.VelocityF64E08)
             {
-                acceleration = -_vehicleVelocityF64E08 * 16;
+                acceleration = -gVehicleMotion.VelocityF64E08 * 16;
             }
             else if (!(GetGameState().CurrentTicks & 0x0F))
             {
-                if (_vehicleF64E2C == 0)
+                if (gVehicleMotion.F64E2C == 0)
                 {
-                    _vehicleF64E2C++;
-                    OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::BrakeRelease, { x, y, z });
+                    gVehicleMotion.F64E2C++;
+                    VehiclePlaySound(OpenRCT2::Audio::SoundId::BrakeRelease, { x, y, z });
                 }
             }
         }
@@ -7112,10 +7139,10 @@ Loc6DAEB9:
     else if (TrackTypeIsBooster(trackType))
     {
         auto boosterSpeed = GetBoosterSpeed(curRide.type, (brake_speed << 16));
-        if (boosterSpeed > _vehicleVelocityF64E08)
+        if (boosterSpeed > gVehicleMotion.VelocityF64E08)
         {
             acceleration = GetRideTypeDescriptor(curRide.type).LegacyBoosterSettings.BoosterAcceleration
-                << 16; //_vehicleVelocityF64E08 * 1.2;
+                << 16; //gVehicleMotion.VelocityF64E08 * 1.2;
         }
     }
     else if (rideEntry.flags & RIDE_ENTRY_FLAG_RIDER_CONTROLS_SPEED && num_peeps > 0)
@@ -7136,7 +7163,7 @@ Loc6DAEB9:
             {
                 if (track_progress >= 8)
                 {
-                    acceleration = -_vehicleVelocityF64E08 * 16;
+                    acceleration = -gVehicleMotion.VelocityF64E08 * 16;
                     if (track_progress >= 24)
                     {
                         SetFlag(VehicleFlags::StoppedOnHoldingBrake);
@@ -7172,8 +7199,8 @@ Loc6DAEB9:
 
         if (!UpdateTrackMotionForwardsGetNewTrack(trackType, curRide, rideEntry))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-            _vehicleVelocityF64E0C -= remaining_distance + 1;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+            gVehicleMotion.VelocityF64E0C -= remaining_distance + 1;
             remaining_distance = -1;
             return false;
         }
@@ -7192,15 +7219,15 @@ Loc6DAEB9:
             + CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z + GetRideTypeDescriptor(curRide.type).Heights.VehicleZOffset };
 
         uint8_t remainingDistanceFlags = 0;
-        if (nextVehiclePosition.x != _vehicleCurPosition.x)
+        if (nextVehiclePosition.x != gVehicleMotion.CurPosition.x)
         {
             remainingDistanceFlags |= 1;
         }
-        if (nextVehiclePosition.y != _vehicleCurPosition.y)
+        if (nextVehiclePosition.y != gVehicleMotion.CurPosition.y)
         {
             remainingDistanceFlags |= 2;
         }
-        if (nextVehiclePosition.z != _vehicleCurPosition.z)
+        if (nextVehiclePosition.z != gVehicleMotion.CurPosition.z)
         {
             remainingDistanceFlags |= 4;
         }
@@ -7224,7 +7251,7 @@ Loc6DAEB9:
 
         // Loc6DB8A5
         remaining_distance -= SubpositionTranslationDistances[remainingDistanceFlags];
-        _vehicleCurPosition = nextVehiclePosition;
+        gVehicleMotion.CurPosition = nextVehiclePosition;
         Orientation = moveInfo->direction;
         bank_rotation = moveInfo->bank_rotation;
         Pitch = moveInfo->Pitch;
@@ -7239,14 +7266,14 @@ Loc6DAEB9:
         }
 
         // this == frontVehicle
-        if (this == _vehicleFrontVehicle)
+        if (this == gVehicleMotion.FrontVehicle)
         {
-            if (_vehicleVelocityF64E08 >= 0)
+            if (gVehicleMotion.VelocityF64E08 >= 0)
             {
                 otherVehicleIndex = prev_vehicle_on_ride;
                 if (UpdateMotionCollisionDetection(nextVehiclePosition, &otherVehicleIndex))
                 {
-                    _vehicleVelocityF64E0C -= remaining_distance + 1;
+                    gVehicleMotion.VelocityF64E0C -= remaining_distance + 1;
                     remaining_distance = -1;
 
                     // Might need to be bp rather than this, but hopefully not
@@ -7266,7 +7293,7 @@ Loc6DAEB9:
                         {
                             if (!(carEntry->flags & CAR_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
                             {
-                                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
                             }
                         }
                     }
@@ -7281,7 +7308,7 @@ Loc6DAEB9:
                         velocity = head->velocity >> 1;
                         head->velocity = newHeadVelocity;
                     }
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
+                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_1;
                     return false;
                 }
             }
@@ -7295,7 +7322,7 @@ Loc6DAEB9:
     }
 
     acceleration += AccelerationFromPitch[moveInfovehicleSpriteType];
-    _vehicleUnkF64E10++;
+    gVehicleMotion.UnkF64E10++;
     goto Loc6DAEB9;
 }
 
@@ -7415,7 +7442,7 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, const Ri
 
     if (tileElement->AsTrack()->HasChain())
     {
-        if (_vehicleVelocityF64E08 < 0)
+        if (gVehicleMotion.VelocityF64E08 < 0)
         {
             if (next_vehicle_on_train.IsNull())
             {
@@ -7423,7 +7450,7 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, const Ri
                 const auto& ted = GetTrackElementDescriptor(trackType);
                 if (!(ted.flags & TRACK_ELEM_FLAG_DOWN))
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_9;
+                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_9;
                 }
             }
             SetFlag(VehicleFlags::OnLiftHill);
@@ -7436,9 +7463,9 @@ bool Vehicle::UpdateTrackMotionBackwardsGetNewTrack(uint16_t trackType, const Ri
             ClearFlag(VehicleFlags::OnLiftHill);
             if (next_vehicle_on_train.IsNull())
             {
-                if (_vehicleVelocityF64E08 < 0)
+                if (gVehicleMotion.VelocityF64E08 < 0)
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
+                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
                 }
             }
         }
@@ -7473,7 +7500,7 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
         auto trackType = GetTrackType();
         if (trackType == TrackElemType::Flat && curRide.GetRideTypeDescriptor().HasFlag(RtdFlag::hasLsmBehaviourOnFlat))
         {
-            int32_t unkVelocity = _vehicleVelocityF64E08;
+            int32_t unkVelocity = gVehicleMotion.VelocityF64E08;
             if (unkVelocity < -524288)
             {
                 unkVelocity = abs(unkVelocity);
@@ -7485,16 +7512,16 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
         {
             auto brakeSpeed = ChooseBrakeSpeed();
 
-            if (-(brakeSpeed << 16) > _vehicleVelocityF64E08)
+            if (-(brakeSpeed << 16) > gVehicleMotion.VelocityF64E08)
             {
-                acceleration = _vehicleVelocityF64E08 * -16;
+                acceleration = gVehicleMotion.VelocityF64E08 * -16;
             }
         }
 
         if (trackType == TrackElemType::Booster)
         {
             auto boosterSpeed = GetBoosterSpeed(curRide.type, (brake_speed << 16));
-            if (boosterSpeed < _vehicleVelocityF64E08)
+            if (boosterSpeed < gVehicleMotion.VelocityF64E08)
             {
                 acceleration = GetRideTypeDescriptor(curRide.type).LegacyBoosterSettings.BoosterAcceleration << 16;
             }
@@ -7507,8 +7534,8 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
 
             if (!UpdateTrackMotionBackwardsGetNewTrack(trackType, curRide, &newTrackProgress))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                gVehicleMotion.VelocityF64E0C -= remaining_distance - 0x368A;
                 remaining_distance = 0x368A;
                 return false;
             }
@@ -7524,21 +7551,21 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
                              moveInfo->z + GetRideTypeDescriptor(curRide.type).Heights.VehicleZOffset };
 
             uint8_t remainingDistanceFlags = 0;
-            if (nextVehiclePosition.x != _vehicleCurPosition.x)
+            if (nextVehiclePosition.x != gVehicleMotion.CurPosition.x)
             {
                 remainingDistanceFlags |= 1;
             }
-            if (nextVehiclePosition.y != _vehicleCurPosition.y)
+            if (nextVehiclePosition.y != gVehicleMotion.CurPosition.y)
             {
                 remainingDistanceFlags |= 2;
             }
-            if (nextVehiclePosition.z != _vehicleCurPosition.z)
+            if (nextVehiclePosition.z != gVehicleMotion.CurPosition.z)
             {
                 remainingDistanceFlags |= 4;
             }
             remaining_distance += SubpositionTranslationDistances[remainingDistanceFlags];
 
-            _vehicleCurPosition = nextVehiclePosition;
+            gVehicleMotion.CurPosition = nextVehiclePosition;
             Orientation = moveInfo->direction;
             bank_rotation = moveInfo->bank_rotation;
             Pitch = moveInfo->Pitch;
@@ -7551,18 +7578,18 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
                 SwingSpeed = 0;
             }
 
-            if (this == _vehicleFrontVehicle)
+            if (this == gVehicleMotion.FrontVehicle)
             {
-                if (_vehicleVelocityF64E08 < 0)
+                if (gVehicleMotion.VelocityF64E08 < 0)
                 {
                     otherVehicleIndex = next_vehicle_on_ride;
                     if (UpdateMotionCollisionDetection(nextVehiclePosition, &otherVehicleIndex))
                     {
-                        _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+                        gVehicleMotion.VelocityF64E0C -= remaining_distance - 0x368A;
                         remaining_distance = 0x368A;
 
                         Vehicle* v3 = GetEntity<Vehicle>(otherVehicleIndex);
-                        Vehicle* v4 = gCurrentVehicle;
+                        Vehicle* v4 = gVehicleMotion.CurrentVehicle;
                         if (v3 == nullptr)
                         {
                             return false;
@@ -7574,7 +7601,7 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
                             {
                                 if (!(carEntry->flags & CAR_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
                                 {
-                                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
                                 }
                             }
                         }
@@ -7582,14 +7609,14 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
                         if (carEntry->flags & CAR_ENTRY_FLAG_GO_KART)
                         {
                             velocity -= velocity >> 2;
-                            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+                            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
                         }
                         else
                         {
                             int32_t v3Velocity = v3->velocity;
                             v3->velocity = v4->velocity >> 1;
                             v4->velocity = v3Velocity >> 1;
-                            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+                            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
                         }
 
                         return false;
@@ -7604,7 +7631,7 @@ bool Vehicle::UpdateTrackMotionBackwards(const CarEntry* carEntry, const Ride& c
             return true;
         }
         acceleration += AccelerationFromPitch[moveInfoVehicleSpriteType];
-        _vehicleUnkF64E10++;
+        gVehicleMotion.UnkF64E10++;
     }
 }
 
@@ -7621,11 +7648,11 @@ void Vehicle::UpdateTrackMotionMiniGolfVehicle(const Ride& curRide, const RideOb
     CoordsXYZ trackPos;
     int32_t direction{};
 
-    _vehicleUnkF64E10 = 1;
+    gVehicleMotion.UnkF64E10 = 1;
     acceleration = AccelerationFromPitch[Pitch];
     if (!HasFlag(VehicleFlags::MoveSingleCar))
     {
-        remaining_distance = _vehicleVelocityF64E0C + remaining_distance;
+        remaining_distance = gVehicleMotion.VelocityF64E0C + remaining_distance;
     }
     if (remaining_distance >= 0 && remaining_distance < 0x368A)
     {
@@ -7633,9 +7660,9 @@ void Vehicle::UpdateTrackMotionMiniGolfVehicle(const Ride& curRide, const RideOb
         return;
     }
     sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-    _vehicleCurPosition.x = x;
-    _vehicleCurPosition.y = y;
-    _vehicleCurPosition.z = z;
+    gVehicleMotion.CurPosition.x = x;
+    gVehicleMotion.CurPosition.y = y;
+    gVehicleMotion.CurPosition.z = z;
     Invalidate();
     if (remaining_distance < 0)
         goto Loc6DCA9A;
@@ -7656,7 +7683,7 @@ Loc6DC462:
             return;
         }
         acceleration = AccelerationFromPitch[Pitch];
-        _vehicleUnkF64E10++;
+        gVehicleMotion.UnkF64E10++;
         goto Loc6DC462;
     }
 
@@ -7678,7 +7705,7 @@ Loc6DC462:
                 return;
             }
             acceleration = AccelerationFromPitch[Pitch];
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
             goto Loc6DC462;
         }
         mini_golf_flags &= ~MiniGolfFlag::Flag2;
@@ -7706,7 +7733,7 @@ Loc6DC462:
                 return;
             }
             acceleration = AccelerationFromPitch[Pitch];
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
             goto Loc6DC462;
         }
         if (vEDI->var_D3 != 0)
@@ -7723,7 +7750,7 @@ Loc6DC462:
                 return;
             }
             acceleration = AccelerationFromPitch[Pitch];
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
             goto Loc6DC462;
         }
         vEDI->mini_golf_flags &= ~MiniGolfFlag::Flag0;
@@ -7752,7 +7779,7 @@ Loc6DC462:
                 return;
             }
             acceleration = AccelerationFromPitch[Pitch];
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
             goto Loc6DC462;
         }
         if (vEDI->var_D3 != 0)
@@ -7769,7 +7796,7 @@ Loc6DC462:
                 return;
             }
             acceleration = AccelerationFromPitch[Pitch];
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
             goto Loc6DC462;
         }
         vEDI->mini_golf_flags &= ~MiniGolfFlag::Flag1;
@@ -7805,7 +7832,7 @@ Loc6DC462:
                 return;
             }
             acceleration = AccelerationFromPitch[Pitch];
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
             goto Loc6DC462;
         }
 
@@ -7825,15 +7852,15 @@ Loc6DC462:
                 CoordsXYE input = { TrackLocation, tileElement };
                 if (!TrackBlockGetNext(&input, &output, &outZ, &outDirection))
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                    _vehicleVelocityF64E0C -= remaining_distance + 1;
+                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                    gVehicleMotion.VelocityF64E0C -= remaining_distance + 1;
                     remaining_distance = -1;
                     if (remaining_distance >= 0)
                     {
                         Loc6DCDE4(curRide);
                     }
                     acceleration += AccelerationFromPitch[Pitch];
-                    _vehicleUnkF64E10++;
+                    gVehicleMotion.UnkF64E10++;
                     goto Loc6DCA9A;
                 }
                 tileElement = output.element;
@@ -7843,15 +7870,15 @@ Loc6DC462:
 
             if (PitchAndRollStart(HasFlag(VehicleFlags::CarIsInverted), tileElement) != TrackPitchAndRollEnd(GetTrackType()))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                _vehicleVelocityF64E0C -= remaining_distance + 1;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                gVehicleMotion.VelocityF64E0C -= remaining_distance + 1;
                 remaining_distance = -1;
                 if (remaining_distance >= 0)
                 {
                     Loc6DCDE4(curRide);
                 }
                 acceleration += AccelerationFromPitch[Pitch];
-                _vehicleUnkF64E10++;
+                gVehicleMotion.UnkF64E10++;
                 goto Loc6DCA9A;
             }
 
@@ -8003,7 +8030,7 @@ Loc6DC462:
         remaining_distance = 0;
     }
 
-    _vehicleCurPosition = trackPos;
+    gVehicleMotion.CurPosition = trackPos;
     Orientation = moveInfo->direction;
     bank_rotation = moveInfo->bank_rotation;
     Pitch = moveInfo->Pitch;
@@ -8018,9 +8045,9 @@ Loc6DC462:
         }
     }
 
-    if (this == _vehicleFrontVehicle)
+    if (this == gVehicleMotion.FrontVehicle)
     {
-        if (_vehicleVelocityF64E08 >= 0)
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             otherVehicleIndex = prev_vehicle_on_ride;
             UpdateMotionCollisionDetection(trackPos, &otherVehicleIndex);
@@ -8032,7 +8059,7 @@ Loc6DC462:
         return;
     }
     acceleration = AccelerationFromPitch[Pitch];
-    _vehicleUnkF64E10++;
+    gVehicleMotion.UnkF64E10++;
     goto Loc6DC462;
 
 Loc6DCA9A:
@@ -8043,15 +8070,15 @@ Loc6DCA9A:
             TrackBeginEnd trackBeginEnd;
             if (!TrackBlockGetPrevious({ TrackLocation, tileElement }, &trackBeginEnd))
             {
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-                _vehicleVelocityF64E0C -= remaining_distance + 1;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+                gVehicleMotion.VelocityF64E0C -= remaining_distance + 1;
                 remaining_distance = -1;
                 if (remaining_distance >= 0)
                 {
                     Loc6DCDE4(curRide);
                 }
                 acceleration += AccelerationFromPitch[Pitch];
-                _vehicleUnkF64E10++;
+                gVehicleMotion.UnkF64E10++;
                 goto Loc6DCA9A;
             }
             trackPos = { trackBeginEnd.begin_x, trackBeginEnd.begin_y, trackBeginEnd.begin_z };
@@ -8061,8 +8088,8 @@ Loc6DCA9A:
 
         if (PitchAndRollStart(HasFlag(VehicleFlags::CarIsInverted), tileElement) != TrackPitchAndRollEnd(GetTrackType()))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
-            _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_5;
+            gVehicleMotion.VelocityF64E0C -= remaining_distance - 0x368A;
             remaining_distance = 0x368A;
             if (remaining_distance < 0x368A)
             {
@@ -8070,7 +8097,7 @@ Loc6DCA9A:
                 return;
             }
             acceleration = AccelerationFromPitch[Pitch];
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
             goto Loc6DC462;
         }
 
@@ -8093,9 +8120,9 @@ Loc6DCA9A:
             ClearFlag(VehicleFlags::OnLiftHill);
             if (next_vehicle_on_train.IsNull())
             {
-                if (_vehicleVelocityF64E08 < 0)
+                if (gVehicleMotion.VelocityF64E08 < 0)
                 {
-                    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
+                    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_8;
                 }
             }
         }
@@ -8122,7 +8149,7 @@ Loc6DCA9A:
         remaining_distance = 0;
     }
 
-    _vehicleCurPosition = trackPos;
+    gVehicleMotion.CurPosition = trackPos;
     Orientation = moveInfo->direction;
     bank_rotation = moveInfo->bank_rotation;
     Pitch = moveInfo->Pitch;
@@ -8137,14 +8164,14 @@ Loc6DCA9A:
         }
     }
 
-    if (this == _vehicleFrontVehicle)
+    if (this == gVehicleMotion.FrontVehicle)
     {
-        if (_vehicleVelocityF64E08 >= 0)
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             otherVehicleIndex = EntityId::FromUnderlying(var_44); // Possibly wrong?.
             if (UpdateMotionCollisionDetection(trackPos, &otherVehicleIndex))
             {
-                _vehicleVelocityF64E0C -= remaining_distance - 0x368A;
+                gVehicleMotion.VelocityF64E0C -= remaining_distance - 0x368A;
                 remaining_distance = 0x368A;
                 {
                     Vehicle* vEBP = GetEntity<Vehicle>(otherVehicleIndex);
@@ -8152,25 +8179,25 @@ Loc6DCA9A:
                     {
                         return;
                     }
-                    Vehicle* vEDI = gCurrentVehicle;
+                    Vehicle* vEDI = gVehicleMotion.CurrentVehicle;
                     if (abs(vEDI->velocity - vEBP->velocity) > 14.0_mph)
                     {
                         if (!(carEntry->flags & CAR_ENTRY_FLAG_BOAT_HIRE_COLLISION_DETECTION))
                         {
-                            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
+                            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_COLLISION;
                         }
                     }
                     vEDI->velocity = vEBP->velocity >> 1;
                     vEBP->velocity = vEDI->velocity >> 1;
                 }
-                _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
+                gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_2;
                 if (remaining_distance < 0x368A)
                 {
                     Loc6DCDE4(curRide);
                     return;
                 }
                 acceleration = AccelerationFromPitch[Pitch];
-                _vehicleUnkF64E10++;
+                gVehicleMotion.UnkF64E10++;
                 goto Loc6DC462;
             }
         }
@@ -8182,20 +8209,20 @@ Loc6DCA9A:
         return;
     }
     acceleration += AccelerationFromPitch[Pitch];
-    _vehicleUnkF64E10++;
+    gVehicleMotion.UnkF64E10++;
     goto Loc6DCA9A;
 }
 
 void Vehicle::Loc6DCDE4(const Ride& curRide)
 {
-    MoveTo(_vehicleCurPosition);
+    MoveTo(gVehicleMotion.CurPosition);
 
     Loc6DCE02(curRide);
 }
 
 void Vehicle::Loc6DCE02(const Ride& curRide)
 {
-    acceleration /= _vehicleUnkF64E10;
+    acceleration /= gVehicleMotion.UnkF64E10;
     if (TrackSubposition == VehicleTrackSubposition::ChairliftGoingBack)
     {
         return;
@@ -8207,16 +8234,16 @@ void Vehicle::Loc6DCE02(const Ride& curRide)
     {
         return;
     }
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_3;
     if (trackType != TrackElemType::EndStation)
     {
         return;
     }
-    if (this != gCurrentVehicle)
+    if (this != gVehicleMotion.CurrentVehicle)
     {
         return;
     }
-    if (_vehicleVelocityF64E08 < 0)
+    if (gVehicleMotion.VelocityF64E08 < 0)
     {
         if (track_progress > 11)
         {
@@ -8228,7 +8255,7 @@ void Vehicle::Loc6DCE02(const Ride& curRide)
         return;
     }
 
-    _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
+    gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_AT_STATION;
 
     for (const auto& station : curRide.GetStations())
     {
@@ -8240,7 +8267,7 @@ void Vehicle::Loc6DCE02(const Ride& curRide)
         {
             continue;
         }
-        _vehicleStationIndex = curRide.GetStationIndex(&station);
+        gVehicleMotion.Station = curRide.GetStationIndex(&station);
     }
 }
 
@@ -8351,33 +8378,33 @@ int32_t Vehicle::UpdateTrackMotionMiniGolf(int32_t* outStation)
 
     const auto* carEntry = Entry();
 
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
+    gVehicleMotion.CurrentVehicle = this;
+    gVehicleMotion.TrackFlags = 0;
     velocity += acceleration;
-    _vehicleVelocityF64E08 = velocity;
-    _vehicleVelocityF64E0C = (velocity >> 10) * 42;
-    _vehicleFrontVehicle = _vehicleVelocityF64E08 < 0 ? TrainTail() : this;
+    gVehicleMotion.VelocityF64E08 = velocity;
+    gVehicleMotion.VelocityF64E0C = (velocity >> 10) * 42;
+    gVehicleMotion.FrontVehicle = gVehicleMotion.VelocityF64E08 < 0 ? TrainTail() : this;
 
-    for (Vehicle* vehicle = _vehicleFrontVehicle; vehicle != nullptr;)
+    for (Vehicle* vehicle = gVehicleMotion.FrontVehicle; vehicle != nullptr;)
     {
         vehicle->UpdateTrackMotionMiniGolfVehicle(*curRide, *rideEntry, carEntry);
         if (vehicle->HasFlag(VehicleFlags::OnLiftHill))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
         }
         if (vehicle->HasFlag(VehicleFlags::MoveSingleCar))
         {
             if (outStation != nullptr)
-                *outStation = _vehicleStationIndex.ToUnderlying();
-            return _vehicleMotionTrackFlags;
+                *outStation = gVehicleMotion.Station.ToUnderlying();
+            return gVehicleMotion.TrackFlags;
         }
-        if (_vehicleVelocityF64E08 >= 0)
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             vehicle = GetEntity<Vehicle>(vehicle->next_vehicle_on_train);
         }
         else
         {
-            if (vehicle == gCurrentVehicle)
+            if (vehicle == gVehicleMotion.CurrentVehicle)
             {
                 break;
             }
@@ -8388,8 +8415,8 @@ int32_t Vehicle::UpdateTrackMotionMiniGolf(int32_t* outStation)
     acceleration = UpdateTrackMotionMiniGolfCalculateAcceleration(*carEntry);
 
     if (outStation != nullptr)
-        *outStation = _vehicleStationIndex.ToUnderlying();
-    return _vehicleMotionTrackFlags;
+        *outStation = gVehicleMotion.Station.ToUnderlying();
+    return gVehicleMotion.TrackFlags;
 }
 
 /**
@@ -8522,23 +8549,23 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         return UpdateTrackMotionMiniGolf(outStation);
     }
 
-    _vehicleF64E2C = 0;
-    gCurrentVehicle = this;
-    _vehicleMotionTrackFlags = 0;
-    _vehicleStationIndex = StationIndex::GetNull();
+    gVehicleMotion.F64E2C = 0;
+    gVehicleMotion.CurrentVehicle = this;
+    gVehicleMotion.TrackFlags = 0;
+    gVehicleMotion.Station = StationIndex::GetNull();
 
     UpdateTrackMotionUpStopCheck();
     CheckAndApplyBlockSectionStopSite();
     UpdateVelocity();
 
     Vehicle* vehicle = this;
-    if (_vehicleVelocityF64E08 < 0 && !vehicle->HasFlag(VehicleFlags::MoveSingleCar))
+    if (gVehicleMotion.VelocityF64E08 < 0 && !vehicle->HasFlag(VehicleFlags::MoveSingleCar))
     {
         vehicle = vehicle->TrainTail();
     }
     // This will be the front vehicle even when traveling
     // backwards.
-    _vehicleFrontVehicle = vehicle;
+    gVehicleMotion.FrontVehicle = vehicle;
 
     auto spriteId = vehicle->Id;
     while (!spriteId.IsNull())
@@ -8570,17 +8597,17 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
             car->UpdateAdditionalAnimation();
         }
         car->acceleration = AccelerationFromPitch[car->Pitch];
-        _vehicleUnkF64E10 = 1;
+        gVehicleMotion.UnkF64E10 = 1;
 
         if (!car->HasFlag(VehicleFlags::MoveSingleCar))
         {
-            car->remaining_distance += _vehicleVelocityF64E0C;
+            car->remaining_distance += gVehicleMotion.VelocityF64E0C;
         }
 
         car->sound2_flags &= ~VEHICLE_SOUND2_FLAGS_LIFT_HILL;
-        _vehicleCurPosition.x = car->x;
-        _vehicleCurPosition.y = car->y;
-        _vehicleCurPosition.z = car->z;
+        gVehicleMotion.CurPosition.x = car->x;
+        gVehicleMotion.CurPosition.y = car->y;
+        gVehicleMotion.CurPosition.z = car->z;
         car->Invalidate();
 
         while (true)
@@ -8598,7 +8625,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
                     break;
                 }
                 car->acceleration += AccelerationFromPitch[car->Pitch];
-                _vehicleUnkF64E10++;
+                gVehicleMotion.UnkF64E10++;
                 continue;
             }
             if (car->remaining_distance < 0x368A)
@@ -8616,11 +8643,11 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
                 break;
             }
             car->acceleration = AccelerationFromPitch[car->Pitch];
-            _vehicleUnkF64E10++;
+            gVehicleMotion.UnkF64E10++;
             continue;
         }
         // Loc6DBF20
-        car->MoveTo(_vehicleCurPosition);
+        car->MoveTo(gVehicleMotion.CurPosition);
 
     Loc6DBF3E:
         car->Sub6DBF3E();
@@ -8628,21 +8655,21 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         // Loc6DC0F7
         if (car->HasFlag(VehicleFlags::OnLiftHill))
         {
-            _vehicleMotionTrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
+            gVehicleMotion.TrackFlags |= VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL;
         }
         if (car->HasFlag(VehicleFlags::MoveSingleCar))
         {
             if (outStation != nullptr)
-                *outStation = _vehicleStationIndex.ToUnderlying();
-            return _vehicleMotionTrackFlags;
+                *outStation = gVehicleMotion.Station.ToUnderlying();
+            return gVehicleMotion.TrackFlags;
         }
-        if (_vehicleVelocityF64E08 >= 0)
+        if (gVehicleMotion.VelocityF64E08 >= 0)
         {
             spriteId = car->next_vehicle_on_train;
         }
         else
         {
-            if (car == gCurrentVehicle)
+            if (car == gVehicleMotion.CurrentVehicle)
             {
                 break;
             }
@@ -8650,7 +8677,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         }
     }
     // Loc6DC144
-    vehicle = gCurrentVehicle;
+    vehicle = gVehicleMotion.CurrentVehicle;
 
     carEntry = vehicle->Entry();
     // eax
@@ -8667,7 +8694,7 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
         totalAcceleration += vehicle->acceleration;
     }
 
-    vehicle = gCurrentVehicle;
+    vehicle = gVehicleMotion.CurrentVehicle;
     int32_t newAcceleration = (totalAcceleration / numVehicles) * 21;
     if (newAcceleration < 0)
     {
@@ -8720,8 +8747,8 @@ int32_t Vehicle::UpdateTrackMotion(int32_t* outStation)
 
     // hook_setreturnregisters(&regs);
     if (outStation != nullptr)
-        *outStation = _vehicleStationIndex.ToUnderlying();
-    return _vehicleMotionTrackFlags;
+        *outStation = gVehicleMotion.Station.ToUnderlying();
+    return gVehicleMotion.TrackFlags;
 }
 
 const RideObjectEntry* Vehicle::GetRideEntry() const
@@ -8911,10 +8938,10 @@ void Vehicle::Claxon() const
     switch (rideEntry->Cars[vehicle_type].sound_range)
     {
         case SOUND_RANGE_WHISTLE:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::TrainWhistle, { x, y, z });
+            VehiclePlaySound(OpenRCT2::Audio::SoundId::TrainWhistle, { x, y, z });
             break;
         case SOUND_RANGE_BELL:
-            OpenRCT2::Audio::Play3D(OpenRCT2::Audio::SoundId::Tram, { x, y, z });
+            VehiclePlaySound(OpenRCT2::Audio::SoundId::Tram, { x, y, z });
             break;
     }
 }
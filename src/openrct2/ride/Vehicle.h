@@ -533,12 +533,22 @@ void RideUpdateMeasurementsSpecialElements_Default(Ride& ride, const track_type_
 void RideUpdateMeasurementsSpecialElements_MiniGolf(Ride& ride, const track_type_t trackType);
 void RideUpdateMeasurementsSpecialElements_WaterCoaster(Ride& ride, const track_type_t trackType);
 
-extern Vehicle* gCurrentVehicle;
-extern StationIndex _vehicleStationIndex;
-extern uint32_t _vehicleMotionTrackFlags;
-extern int32_t _vehicleVelocityF64E08;
-extern int32_t _vehicleVelocityF64E0C;
-extern int32_t _vehicleUnkF64E10;
-extern uint8_t _vehicleF64E2C;
-extern Vehicle* _vehicleFrontVehicle;
-extern CoordsXYZ _vehicleCurPosition;
+/**
+ * Scratch state of the train whose track motion is being updated, shared by the vehicle, cable lift and rider control
+ * code. Nothing in it outlives the update of one train.
+ */
+struct VehicleMotionState
+{
+    Vehicle* CurrentVehicle;
+    Vehicle* FrontVehicle;
+    CoordsXYZ CurPosition;
+    StationIndex Station;
+    uint32_t TrackFlags;
+    int32_t VelocityF64E08;
+    int32_t VelocityF64E0C;
+    int32_t UnkF64E10;
+    uint8_t Breakdown;
+    uint8_t F64E2C;
+};
+
+extern VehicleMotionState gVehicleMotion;
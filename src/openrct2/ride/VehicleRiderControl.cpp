@@ -138,9 +138,10 @@ int32_t Vehicle::CalculateRiderBraking() const
 
     // Brake if close to the vehicle in front
     Vehicle* prevVehicle = GetEntity<Vehicle>(prev_vehicle_on_ride);
-    if (prevVehicle != nullptr && this != prevVehicle && _vehicleVelocityF64E08 > minFollowVelocity)
+    if (prevVehicle != nullptr && this != prevVehicle && gVehicleMotion.VelocityF64E08 > minFollowVelocity)
     {
-        int32_t followDistance = std::max(minFollowDistance, (riderSettings.followDistance * _vehicleVelocityF64E08) >> 15);
+        int32_t followDistance = std::max(
+            minFollowDistance, (riderSettings.followDistance * gVehicleMotion.VelocityF64E08) >> 15);
         int32_t distance = std::max(abs(x - prevVehicle->x), abs(y - prevVehicle->y));
         int32_t relativeVelocity = velocity - prevVehicle->velocity;
         int32_t z_diff = abs(z - prevVehicle->z);
@@ -219,11 +220,11 @@ int32_t Vehicle::CalculateRiderBraking() const
     }
 
     // Brake if car exceeds rider's preferred max speed
-    if (_vehicleVelocityF64E08 > targetSpeed + brakeThreshold)
+    if (gVehicleMotion.VelocityF64E08 > targetSpeed + brakeThreshold)
     {
         return -maxBrake;
     }
-    else if (_vehicleVelocityF64E08 > targetSpeed)
+    else if (gVehicleMotion.VelocityF64E08 > targetSpeed)
     {
         return -minBrake;
     }
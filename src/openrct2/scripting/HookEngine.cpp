@@ -11,9 +11,16 @@
 
 #    include "HookEngine.h"
 
+#    include "../Context.h"
+#    include "../ReplayManager.h"
+#    include "../config/Config.h"
 #    include "../core/EnumMap.hpp"
+#    include "../core/String.hpp"
+#    include "../network/network.h"
 #    include "ScriptEngine.h"
 
+#    include <chrono>
+#    include <cmath>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -42,6 +49,11 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    return HooksLookupTable[type];
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
@@ -56,7 +68,8 @@ uint32_t HookEngine::Subscribe(HOOK_TYPE type, std::shared_ptr<Plugin> owner, co
 {
     auto& hookList = GetHookList(type);
     auto cookie = _nextCookie++;
-    hookList.Hooks.emplace_back(cookie, owner, function);
+    auto& stats = _stats[{ owner->GetMetadata().Name, type }];
+    hookList.Hooks.emplace_back(cookie, owner, function, &stats);
     return cookie;
 }
 
@@ -111,18 +124,41 @@ bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
 void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
+    const auto canThrottle = type == HOOK_TYPE::INTERVAL_TICK && CanThrottleTickHooks();
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        // The hook list may change while the plugin runs, so keep hold of what is needed afterwards.
+        auto& stats = *hook.Stats;
+        if (!canThrottle)
+        {
+            stats.TicksToSkip = 0;
+        }
+        else if (stats.TicksToSkip > 0)
+        {
+            stats.TicksToSkip--;
+            stats.ThrottledCount++;
+            continue;
+        }
+
+        auto owner = hook.Owner;
+        auto elapsedTimeUs = CallHook(hook, {}, isGameStateMutable);
+        if (canThrottle)
+        {
+            ThrottleTickHook(owner, stats, elapsedTimeUs);
+        }
     }
 }
 
 void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
+    if (hookList.Hooks.empty())
+        return;
+
+    const std::vector<DukValue> args = { arg };
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        CallHook(hook, args, isGameStateMutable);
     }
 }
 
@@ -130,34 +166,99 @@ void HookEngine::Call(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        auto ctx = _scriptEngine.GetContext();
+    if (hookList.Hooks.empty())
+        return;
 
-        // Convert key/value pairs into an object
-        auto objIdx = duk_push_object(ctx);
-        for (const auto& arg : args)
+    // Convert key/value pairs into an object, it is only built once and shared by all the hooks just like the event
+    // objects passed to the other overloads.
+    auto ctx = _scriptEngine.GetContext();
+    auto objIdx = duk_push_object(ctx);
+    for (const auto& arg : args)
+    {
+        if (arg.second.type() == typeid(int32_t))
+        {
+            auto val = std::any_cast<int32_t>(arg.second);
+            duk_push_int(ctx, val);
+        }
+        else if (arg.second.type() == typeid(std::string))
+        {
+            const auto& val = std::any_cast<const std::string&>(arg.second);
+            duk_push_lstring(ctx, val.data(), val.size());
+        }
+        else
         {
-            if (arg.second.type() == typeid(int32_t))
-            {
-                auto val = std::any_cast<int32_t>(arg.second);
-                duk_push_int(ctx, val);
-            }
-            else if (arg.second.type() == typeid(std::string))
-            {
-                const auto& val = std::any_cast<std::string>(arg.second);
-                duk_push_string(ctx, val.c_str());
-            }
-            else
-            {
-                throw std::runtime_error("Not implemented");
-            }
-            duk_put_prop_string(ctx, objIdx, arg.first.data());
+            duk_pop(ctx);
+            throw std::runtime_error("Not implemented");
         }
+        duk_put_prop_lstring(ctx, objIdx, arg.first.data(), arg.first.size());
+    }
+
+    const std::vector<DukValue> dukArgs = { DukValue::take_from_stack(ctx) };
+    for (auto& hook : hookList.Hooks)
+    {
+        CallHook(hook, dukArgs, isGameStateMutable);
+    }
+}
 
-        std::vector<DukValue> dukArgs;
-        dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+const HookStatsMap& HookEngine::GetStats() const
+{
+    return _stats;
+}
+
+void HookEngine::ResetStats()
+{
+    // Subscribed hooks point into the map, so only the values are reset.
+    for (auto& [key, stats] : _stats)
+    {
+        stats = {};
+    }
+}
+
+double HookEngine::CallHook(const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable)
+{
+    auto* stats = hook.Stats;
+    auto startTime = std::chrono::high_resolution_clock::now();
+    _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, args, isGameStateMutable);
+    auto deltaTime = std::chrono::high_resolution_clock::now() - startTime;
+
+    const auto elapsedTimeUs = std::chrono::duration_cast<std::chrono::nanoseconds>(deltaTime).count() / 1000.0;
+    stats->CallCount++;
+    stats->TotalTimeUs += elapsedTimeUs;
+    stats->MaxTimeUs = std::max(stats->MaxTimeUs, elapsedTimeUs);
+    return elapsedTimeUs;
+}
+
+bool HookEngine::CanThrottleTickHooks() const
+{
+    // Tick hooks may change the game state, and throttling depends on how long they take on this machine. Skipping them
+    // would make the game state differ from other players and from what a replay recorded, so they are only throttled
+    // in single player games that are not being recorded or played back.
+    if (NetworkGetMode() != NETWORK_MODE_NONE)
+        return false;
+
+    auto* replayManager = GetContext()->GetReplayManager();
+    if (replayManager != nullptr
+        && (replayManager->IsRecording() || replayManager->IsReplaying() || replayManager->IsNormalising()))
+        return false;
+
+    return true;
+}
+
+void HookEngine::ThrottleTickHook(const std::shared_ptr<Plugin>& owner, HookStats& stats, double elapsedTimeUs)
+{
+    const auto budgetUs = static_cast<double>(Config::Get().plugin.TickHookTimeBudget);
+    if (budgetUs <= 0 || elapsedTimeUs <= budgetUs)
+        return;
+
+    // Skip enough ticks that the plugin's average time per tick comes back within the budget.
+    stats.TicksToSkip = static_cast<uint32_t>(std::ceil(elapsedTimeUs / budgetUs)) - 1;
+    if (!stats.HasWarned && stats.TicksToSkip > 0)
+    {
+        stats.HasWarned = true;
+        auto message = String::StdFormat(
+            "interval.tick hook took %.0f us, exceeding the budget of %.0f us. It will be called less often.", elapsedTimeUs,
+            budgetUs);
+        _scriptEngine.LogPluginInfo(owner, message);
     }
 }
 
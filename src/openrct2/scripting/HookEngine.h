@@ -14,6 +14,7 @@
 #    include "Duktape.hpp"
 
 #    include <any>
+#    include <map>
 #    include <memory>
 #    include <string>
 #    include <tuple>
@@ -47,18 +48,39 @@ namespace OpenRCT2::Scripting
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
+
+    /**
+     * Time spent in the hooks of one plugin for one hook type. Times are in microseconds, matching the profiler.
+     */
+    struct HookStats
+    {
+        uint64_t CallCount{};
+        uint64_t ThrottledCount{};
+        double TotalTimeUs{};
+        double MaxTimeUs{};
+
+        // Number of upcoming interval.tick calls to skip after the plugin went over the tick budget.
+        uint32_t TicksToSkip{};
+        bool HasWarned{};
+    };
+
+    // Stats are keyed by plugin name rather than plugin instance so that they survive a hot reload.
+    using HookStatsMap = std::map<std::pair<std::string, HOOK_TYPE>, HookStats>;
 
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        HookStats* Stats{};
 
         Hook() = default;
-        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
+        Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function, HookStats* stats)
             : Cookie(cookie)
             , Owner(owner)
             , Function(function)
+            , Stats(stats)
         {
         }
     };
@@ -79,6 +101,7 @@ namespace OpenRCT2::Scripting
         ScriptEngine& _scriptEngine;
         std::vector<HookList> _hookMap;
         uint32_t _nextCookie = 1;
+        HookStatsMap _stats;
 
     public:
         HookEngine(ScriptEngine& scriptEngine);
@@ -94,7 +117,13 @@ namespace OpenRCT2::Scripting
         void Call(
             HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
 
+        const HookStatsMap& GetStats() const;
+        void ResetStats();
+
     private:
+        double CallHook(const Hook& hook, const std::vector<DukValue>& args, bool isGameStateMutable);
+        bool CanThrottleTickHooks() const;
+        void ThrottleTickHook(const std::shared_ptr<Plugin>& owner, HookStats& stats, double elapsedTimeUs);
         HookList& GetHookList(HOOK_TYPE type);
         const HookList& GetHookList(HOOK_TYPE type) const;
     };
@@ -0,0 +1,228 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "PluginWorker.h"
+
+#    include "../core/Guard.hpp"
+
+#    include <cstring>
+#    include <utility>
+
+using namespace OpenRCT2::Scripting;
+
+static constexpr const char* kWorkerStashKey = DUK_HIDDEN_SYMBOL("worker");
+static constexpr const char* kOnMessageStashKey = DUK_HIDDEN_SYMBOL("onMessage");
+
+PluginWorker::PluginWorker(std::string source)
+    : _source(std::move(source))
+{
+    _thread = std::thread(&PluginWorker::Run, this);
+}
+
+PluginWorker::~PluginWorker()
+{
+    Stop();
+}
+
+void PluginWorker::Post(std::vector<uint8_t>&& data)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_stopping)
+            return;
+        _inbox.push_back(std::move(data));
+    }
+    _condition.notify_one();
+}
+
+std::deque<PluginWorkerMessage> PluginWorker::Receive()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return std::exchange(_outbox, {});
+}
+
+size_t PluginWorker::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _inbox.size();
+}
+
+void PluginWorker::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_one();
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+bool PluginWorker::IsStopping() const
+{
+    return _stopping;
+}
+
+void PluginWorker::Run()
+{
+    // The heap's user data lets duk_exec_timeout_check interrupt a script that never returns once the worker is stopped.
+    auto ctx = duk_create_heap(nullptr, nullptr, nullptr, this, nullptr);
+    if (ctx == nullptr)
+    {
+        constexpr std::string_view message = "Unable to initialise duktape context for worker.";
+        Send(PluginWorkerMessageKind::Error, message.data(), message.size());
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        return;
+    }
+
+    duk_push_heap_stash(ctx);
+    duk_push_pointer(ctx, this);
+    duk_put_prop_string(ctx, -2, kWorkerStashKey);
+    duk_pop(ctx);
+
+    duk_push_global_object(ctx);
+    duk_push_c_function(ctx, PostMessage, 1);
+    duk_put_prop_string(ctx, -2, "postMessage");
+    duk_push_c_function(ctx, OnMessage, 1);
+    duk_put_prop_string(ctx, -2, "onMessage");
+    duk_push_object(ctx);
+    duk_push_c_function(ctx, ConsoleLog, DUK_VARARGS);
+    duk_put_prop_string(ctx, -2, "log");
+    duk_put_prop_string(ctx, -2, "console");
+    duk_pop(ctx);
+
+    duk_push_lstring(ctx, _source.data(), _source.size());
+    duk_push_string(ctx, "worker");
+    auto result = duk_pcompile(ctx, 0);
+    if (result == DUK_EXEC_SUCCESS)
+    {
+        result = duk_pcall(ctx, 0);
+    }
+    if (result != DUK_EXEC_SUCCESS)
+    {
+        if (!_stopping)
+        {
+            duk_size_t length{};
+            auto message = duk_safe_to_lstring(ctx, -1, &length);
+            Send(PluginWorkerMessageKind::Error, message, length);
+        }
+        duk_destroy_heap(ctx);
+
+        // Nothing can receive messages any more
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _inbox.clear();
+        return;
+    }
+    duk_pop(ctx);
+
+    while (true)
+    {
+        std::vector<uint8_t> data;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this] { return _stopping || !_inbox.empty(); });
+            if (_stopping)
+            {
+                break;
+            }
+            data = std::move(_inbox.front());
+            _inbox.pop_front();
+        }
+
+        auto buffer = duk_push_fixed_buffer(ctx, data.size());
+        std::memcpy(buffer, data.data(), data.size());
+        if (duk_safe_call(ctx, DispatchMessage, nullptr, 1, 1) != DUK_EXEC_SUCCESS && !_stopping)
+        {
+            duk_size_t length{};
+            auto message = duk_safe_to_lstring(ctx, -1, &length);
+            Send(PluginWorkerMessageKind::Error, message, length);
+        }
+        duk_pop(ctx);
+    }
+
+    duk_destroy_heap(ctx);
+}
+
+void PluginWorker::Send(PluginWorkerMessageKind kind, const void* data, size_t length)
+{
+    auto bytes = static_cast<const uint8_t*>(data);
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& message = _outbox.emplace_back();
+    message.Kind = kind;
+    message.Data.assign(bytes, bytes + length);
+}
+
+PluginWorker& PluginWorker::GetWorker(duk_context* ctx)
+{
+    duk_push_heap_stash(ctx);
+    duk_get_prop_string(ctx, -1, kWorkerStashKey);
+    auto worker = static_cast<PluginWorker*>(duk_get_pointer(ctx, -1));
+    duk_pop_2(ctx);
+    Guard::Assert(worker != nullptr);
+    return *worker;
+}
+
+duk_ret_t PluginWorker::PostMessage(duk_context* ctx)
+{
+    duk_cbor_encode(ctx, 0, 0);
+    duk_size_t length{};
+    auto data = duk_get_buffer_data(ctx, 0, &length);
+    GetWorker(ctx).Send(PluginWorkerMessageKind::Data, data, length);
+    return 0;
+}
+
+duk_ret_t PluginWorker::OnMessage(duk_context* ctx)
+{
+    if (!duk_is_function(ctx, 0))
+    {
+        return duk_error(ctx, DUK_ERR_TYPE_ERROR, "callback was not a function.");
+    }
+    duk_push_heap_stash(ctx);
+    duk_dup(ctx, 0);
+    duk_put_prop_string(ctx, -2, kOnMessageStashKey);
+    return 0;
+}
+
+duk_ret_t PluginWorker::ConsoleLog(duk_context* ctx)
+{
+    std::string line;
+    auto numArgs = duk_get_top(ctx);
+    for (duk_idx_t i = 0; i < numArgs; i++)
+    {
+        if (i != 0)
+        {
+            line.push_back(' ');
+        }
+        line.append(duk_safe_to_string(ctx, i));
+    }
+    GetWorker(ctx).Send(PluginWorkerMessageKind::Log, line.data(), line.size());
+    return 0;
+}
+
+duk_ret_t PluginWorker::DispatchMessage(duk_context* ctx, void* udata)
+{
+    duk_cbor_decode(ctx, 0, 0);
+    duk_push_heap_stash(ctx);
+    duk_get_prop_string(ctx, -1, kOnMessageStashKey);
+    if (duk_is_function(ctx, -1))
+    {
+        duk_dup(ctx, 0);
+        duk_call(ctx, 1);
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include <atomic>
+#    include <condition_variable>
+#    include <cstdint>
+#    include <deque>
+#    include <duktape.h>
+#    include <mutex>
+#    include <string>
+#    include <thread>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    enum class PluginWorkerMessageKind : uint8_t
+    {
+        // CBOR encoded value passed to postMessage
+        Data,
+        // Text written with console.log
+        Log,
+        // Text of an uncaught error
+        Error,
+    };
+
+    struct PluginWorkerMessage
+    {
+        PluginWorkerMessageKind Kind{};
+        std::vector<uint8_t> Data;
+    };
+
+    /**
+     * Runs a script in its own Duktape heap on a separate thread. The script has no access to the game or the plugin
+     * APIs, it can only exchange messages with the plugin that created it. Messages cross between the heaps encoded as
+     * CBOR, so a plugin can hand over data it read from the game at a tick boundary and have the heavy work done without
+     * taking up any tick time.
+     */
+    class PluginWorker
+    {
+    private:
+        std::string _source;
+        std::thread _thread;
+
+        mutable std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<std::vector<uint8_t>> _inbox;
+        std::deque<PluginWorkerMessage> _outbox;
+        std::atomic<bool> _stopping{};
+
+    public:
+        PluginWorker(std::string source);
+        PluginWorker(const PluginWorker&) = delete;
+        ~PluginWorker();
+
+        /**
+         * Queues a CBOR encoded value for the worker's onMessage callback.
+         */
+        void Post(std::vector<uint8_t>&& data);
+
+        /**
+         * Takes all the messages the worker has sent since the last call.
+         */
+        std::deque<PluginWorkerMessage> Receive();
+
+        /**
+         * Number of posted messages the worker has not started processing yet.
+         */
+        size_t GetPendingCount() const;
+
+        /**
+         * Interrupts the script and waits for the thread to finish.
+         */
+        void Stop();
+        bool IsStopping() const;
+
+    private:
+        void Run();
+        void Send(PluginWorkerMessageKind kind, const void* data, size_t length);
+
+        static duk_ret_t PostMessage(duk_context* ctx);
+        static duk_ret_t OnMessage(duk_context* ctx);
+        static duk_ret_t ConsoleLog(duk_context* ctx);
+        static duk_ret_t DispatchMessage(duk_context* ctx, void* udata);
+        static PluginWorker& GetWorker(duk_context* ctx);
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
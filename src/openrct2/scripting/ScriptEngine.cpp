@@ -40,6 +40,7 @@
 #    include "bindings/game/ScDisposable.hpp"
 #    include "bindings/game/ScPlugin.hpp"
 #    include "bindings/game/ScProfiler.hpp"
+#    include "bindings/game/ScWorker.hpp"
 #    include "bindings/network/ScNetwork.hpp"
 #    include "bindings/network/ScPlayer.hpp"
 #    include "bindings/network/ScPlayerGroup.hpp"
@@ -64,6 +65,7 @@
 #    include <memory>
 #    include <stdexcept>
 #    include <string>
+#    include <variant>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -454,6 +456,7 @@ void ScriptEngine::Initialise()
     ScMechanic::Register(ctx);
     ScSecurity::Register(ctx);
     ScPlugin::Register(ctx);
+    ScWorker::Register(ctx);
 
     dukglue_register_global(ctx, std::make_shared<ScCheats>(), "cheats");
     dukglue_register_global(ctx, std::make_shared<ScClimate>(), "climate");
@@ -771,6 +774,7 @@ void ScriptEngine::StopPlugin(std::shared_ptr<Plugin> plugin)
         RemoveCustomGameActions(plugin);
         RemoveIntervals(plugin);
         RemoveSockets(plugin);
+        RemoveWorkers(plugin);
         _hookEngine.UnsubscribeAll(plugin);
 
         plugin->StopEnd();
@@ -927,6 +931,7 @@ void ScriptEngine::Tick()
     CheckAndStartPlugins();
     UpdateIntervals();
     UpdateSockets();
+    UpdateWorkers();
     ProcessREPL();
     DoAutoReloadPluginCheck();
 }
@@ -1318,33 +1323,156 @@ public:
     }
 };
 
-class DukFromGameActionParameterVisitor : public GameActionParameterVisitor
+/**
+ * A copy of a game action's parameters which is only turned into the args object of an action hook's event when a
+ * plugin reads it. Most hooks only look at the action name, player or result, building the args object for every
+ * game action is wasted work.
+ */
+class GameActionArgsSnapshot final : public GameActionParameterVisitor
 {
 private:
-    DukObject& _dukObject;
+    // Parameter names are always string literals, so they can be kept as views.
+    std::vector<std::pair<std::string_view, std::variant<bool, int32_t, std::string>>> _params;
+    std::string _json;
+    bool _isCustom{};
 
 public:
-    DukFromGameActionParameterVisitor(DukObject& dukObject)
-        : _dukObject(dukObject)
+    GameActionArgsSnapshot(const GameAction& action)
     {
+        if (action.GetType() == GameCommand::Custom)
+        {
+            _isCustom = true;
+            _json = static_cast<const CustomAction&>(action).GetJson();
+        }
+        else
+        {
+            const_cast<GameAction&>(action).AcceptParameters(*this);
+            const_cast<GameAction&>(action).AcceptFlags(*this);
+        }
     }
 
     void Visit(std::string_view name, bool& param) override
     {
-        std::string szName(name);
-        _dukObject.Set(szName.c_str(), param);
+        _params.emplace_back(name, param);
     }
 
     void Visit(std::string_view name, int32_t& param) override
     {
-        std::string szName(name);
-        _dukObject.Set(szName.c_str(), param);
+        _params.emplace_back(name, param);
     }
 
     void Visit(std::string_view name, std::string& param) override
     {
-        std::string szName(name);
-        _dukObject.Set(szName.c_str(), param);
+        _params.emplace_back(name, param);
+    }
+
+    DukValue ToDuk(duk_context* ctx) const
+    {
+        if (_isCustom)
+        {
+            auto dukArgs = DuktapeTryParseJson(ctx, _json);
+            if (dukArgs)
+            {
+                return *dukArgs;
+            }
+            return DukObject(ctx).Take();
+        }
+
+        DukObject args(ctx);
+        for (const auto& [name, value] : _params)
+        {
+            std::string szName(name);
+            std::visit([&](const auto& v) { args.Set(szName.c_str(), v); }, value);
+        }
+        return args.Take();
+    }
+
+    /**
+     * Defines the args property of the given event object which creates the args object the first time it is read.
+     * The snapshot is owned by the event object from then on.
+     */
+    static void DefineLazyArgs(
+        duk_context* ctx, const DukValue& dukEventArgs, std::unique_ptr<GameActionArgsSnapshot> snapshot)
+    {
+        dukEventArgs.push();
+
+        // The event object is only ever seen by plugins, so it can take care of deleting the snapshot itself
+        duk_push_pointer(ctx, snapshot.release());
+        duk_put_prop_string(ctx, -2, DUK_HIDDEN_SYMBOL("argsSnapshot"));
+        PushAccessor(ctx, DUK_HIDDEN_SYMBOL("actionHookArgsFinaliser"), Finalise, 1);
+        duk_set_finalizer(ctx, -2);
+
+        duk_push_string(ctx, "args");
+        PushAccessor(ctx, DUK_HIDDEN_SYMBOL("actionHookArgsGetter"), Get, 0);
+        PushAccessor(ctx, DUK_HIDDEN_SYMBOL("actionHookArgsSetter"), Set, 1);
+        duk_def_prop(
+            ctx, -4,
+            DUK_DEFPROP_HAVE_GETTER | DUK_DEFPROP_HAVE_SETTER | DUK_DEFPROP_SET_ENUMERABLE | DUK_DEFPROP_SET_CONFIGURABLE);
+        duk_pop(ctx);
+    }
+
+private:
+    // The accessor functions are shared by all events rather than created for each one.
+    static void PushAccessor(duk_context* ctx, const char* key, duk_c_function func, duk_idx_t numArgs)
+    {
+        duk_push_heap_stash(ctx);
+        if (!duk_get_prop_string(ctx, -1, key))
+        {
+            duk_pop(ctx);
+            duk_push_c_function(ctx, func, numArgs);
+            duk_dup_top(ctx);
+            duk_put_prop_string(ctx, -3, key);
+        }
+        duk_remove(ctx, -2);
+    }
+
+    // Replaces the accessor on the object at the top of the stack with a plain value property, value is at index 0.
+    static void ReplaceAccessor(duk_context* ctx)
+    {
+        duk_push_string(ctx, "args");
+        duk_dup(ctx, 0);
+        duk_def_prop(
+            ctx, -3,
+            DUK_DEFPROP_HAVE_VALUE | DUK_DEFPROP_SET_WRITABLE | DUK_DEFPROP_SET_ENUMERABLE | DUK_DEFPROP_SET_CONFIGURABLE);
+
+        // The snapshot is no longer needed
+        duk_get_prop_string(ctx, -1, DUK_HIDDEN_SYMBOL("argsSnapshot"));
+        delete static_cast<GameActionArgsSnapshot*>(duk_get_pointer(ctx, -1));
+        duk_pop(ctx);
+        duk_push_pointer(ctx, nullptr);
+        duk_put_prop_string(ctx, -2, DUK_HIDDEN_SYMBOL("argsSnapshot"));
+    }
+
+    static duk_ret_t Get(duk_context* ctx)
+    {
+        duk_push_this(ctx);
+        duk_get_prop_string(ctx, -1, DUK_HIDDEN_SYMBOL("argsSnapshot"));
+        auto* snapshot = static_cast<GameActionArgsSnapshot*>(duk_get_pointer(ctx, -1));
+        duk_pop(ctx);
+        if (snapshot == nullptr)
+        {
+            return 0;
+        }
+
+        snapshot->ToDuk(ctx).push();
+        duk_insert(ctx, 0);
+        ReplaceAccessor(ctx);
+        duk_dup(ctx, 0);
+        return 1;
+    }
+
+    static duk_ret_t Set(duk_context* ctx)
+    {
+        duk_push_this(ctx);
+        ReplaceAccessor(ctx);
+        return 0;
+    }
+
+    static duk_ret_t Finalise(duk_context* ctx)
+    {
+        duk_get_prop_string(ctx, 0, DUK_HIDDEN_SYMBOL("argsSnapshot"));
+        delete static_cast<GameActionArgsSnapshot*>(duk_get_pointer(ctx, -1));
+        return 0;
     }
 };
 
@@ -1467,19 +1595,8 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
         auto actionId = action.GetType();
         if (action.GetType() == GameCommand::Custom)
         {
-            auto customAction = static_cast<const CustomAction&>(action);
+            const auto& customAction = static_cast<const CustomAction&>(action);
             obj.Set("action", customAction.GetId());
-
-            auto dukArgs = DuktapeTryParseJson(_context, customAction.GetJson());
-            if (dukArgs)
-            {
-                obj.Set("args", *dukArgs);
-            }
-            else
-            {
-                DukObject args(_context);
-                obj.Set("args", args.Take());
-            }
         }
         else
         {
@@ -1488,12 +1605,6 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
             {
                 obj.Set("action", actionName);
             }
-
-            DukObject args(_context);
-            DukFromGameActionParameterVisitor visitor(args);
-            const_cast<GameAction&>(action).AcceptParameters(visitor);
-            const_cast<GameAction&>(action).AcceptFlags(visitor);
-            obj.Set("args", args.Take());
         }
 
         obj.Set("player", action.GetPlayer());
@@ -1504,6 +1615,7 @@ void ScriptEngine::RunGameActionHooks(const GameAction& action, GameActions::Res
 
         obj.Set("result", GameActionResultToDuk(action, result));
         auto dukEventArgs = obj.Take();
+        GameActionArgsSnapshot::DefineLazyArgs(_context, dukEventArgs, std::make_unique<GameActionArgsSnapshot>(action));
 
         _hookEngine.Call(hookType, dukEventArgs, false);
 
@@ -1796,6 +1908,48 @@ void ScriptEngine::RemoveSockets(const std::shared_ptr<Plugin>& plugin)
 #    endif
 }
 
+void ScriptEngine::AddWorker(const std::shared_ptr<ScWorker>& worker)
+{
+    _workers.push_back(worker);
+}
+
+void ScriptEngine::UpdateWorkers()
+{
+    // Use iterators as Update calls can add workers to the list
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto& worker = *it;
+        worker->Update();
+        if (worker->IsDisposed())
+        {
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void ScriptEngine::RemoveWorkers(const std::shared_ptr<Plugin>& plugin)
+{
+    auto it = _workers.begin();
+    while (it != _workers.end())
+    {
+        auto worker = it->get();
+        if (worker->GetPlugin() == plugin)
+        {
+            worker->Dispose();
+            it = _workers.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
 std::string OpenRCT2::Scripting::Stringify(const DukValue& val)
 {
     return ExpressionStringifier::StringifyExpression(val);
@@ -1852,9 +2006,10 @@ int32_t OpenRCT2::Scripting::GetTargetAPIVersion()
     return plugin->GetTargetAPIVersion();
 }
 
-duk_bool_t duk_exec_timeout_check(void*)
+duk_bool_t duk_exec_timeout_check(void* udata)
 {
-    return false;
+    // Only worker heaps are created with user data, their scripts are interrupted when the worker is stopped
+    return udata != nullptr && static_cast<PluginWorker*>(udata)->IsStopping();
 }
 
 #endif
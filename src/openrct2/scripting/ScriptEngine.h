@@ -46,7 +46,7 @@ namespace OpenRCT2
 
 namespace OpenRCT2::Scripting
 {
-    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 98;
+    static constexpr int32_t OPENRCT2_PLUGIN_API_VERSION = 101;
 
     // Versions marking breaking changes.
     static constexpr int32_t API_VERSION_33_PEEP_DEPRECATION = 33;
@@ -57,6 +57,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
     class ScSocketBase;
 #    endif
+    class ScWorker;
 
     class ScriptExecutionInfo
     {
@@ -176,6 +177,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
         std::list<std::shared_ptr<ScSocketBase>> _sockets;
 #    endif
+        std::list<std::shared_ptr<ScWorker>> _workers;
 
     public:
         ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& env);
@@ -267,6 +269,7 @@ namespace OpenRCT2::Scripting
 #    ifndef DISABLE_NETWORK
         void AddSocket(const std::shared_ptr<ScSocketBase>& socket);
 #    endif
+        void AddWorker(const std::shared_ptr<ScWorker>& worker);
 
     private:
         void RegisterConstants();
@@ -301,6 +304,9 @@ namespace OpenRCT2::Scripting
 
         void UpdateSockets();
         void RemoveSockets(const std::shared_ptr<Plugin>& plugin);
+
+        void UpdateWorkers();
+        void RemoveWorkers(const std::shared_ptr<Plugin>& plugin);
     };
 
     bool IsGameStateMutable();
@@ -314,7 +314,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
-            peep->Happiness = value;
+            peep->SetHappiness(value);
         }
     }
 
@@ -506,7 +506,7 @@ namespace OpenRCT2::Scripting
         auto peep = GetGuest();
         if (peep != nullptr)
         {
-            peep->GuestIsLostCountdown = value;
+            peep->SetLostCountdown(value);
         }
     }
 
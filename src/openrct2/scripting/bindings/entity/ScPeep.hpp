@@ -45,6 +45,33 @@ namespace OpenRCT2::Scripting
         { "animationFrozen", PEEP_FLAGS_ANIMATION_FROZEN },
     });
 
+    static const DukEnumMap<PeepState> PeepStateMap({
+        { "falling", PeepState::Falling },
+        { "one", PeepState::One },
+        { "queuing_front", PeepState::QueuingFront },
+        { "on_ride", PeepState::OnRide },
+        { "leaving_ride", PeepState::LeavingRide },
+        { "walking", PeepState::Walking },
+        { "queuing", PeepState::Queuing },
+        { "entering_ride", PeepState::EnteringRide },
+        { "sitting", PeepState::Sitting },
+        { "picked", PeepState::Picked },
+        { "patrolling", PeepState::Patrolling },
+        { "mowing", PeepState::Mowing },
+        { "sweeping", PeepState::Sweeping },
+        { "entering_park", PeepState::EnteringPark },
+        { "leaving_park", PeepState::LeavingPark },
+        { "answering", PeepState::Answering },
+        { "fixing", PeepState::Fixing },
+        { "buying", PeepState::Buying },
+        { "watching", PeepState::Watching },
+        { "emptying_bin", PeepState::EmptyingBin },
+        { "using_bin", PeepState::UsingBin },
+        { "watering", PeepState::Watering },
+        { "heading_to_inspection", PeepState::HeadingToInspection },
+        { "inspecting", PeepState::Inspecting },
+    });
+
     class ScPeep : public ScEntity
     {
     public:
@@ -110,10 +137,12 @@ namespace OpenRCT2::Scripting
             if (peep != nullptr)
             {
                 auto mask = PeepFlagMap[key];
-                if (value)
-                    peep->PeepFlags |= mask;
+                auto flags = value ? peep->PeepFlags | mask : peep->PeepFlags & ~mask;
+                auto* guest = peep->As<Guest>();
+                if (guest != nullptr)
+                    guest->SetPeepFlags(flags);
                 else
-                    peep->PeepFlags &= ~mask;
+                    peep->PeepFlags = flags;
                 peep->Invalidate();
             }
         }
@@ -18,6 +18,40 @@
 
 namespace OpenRCT2::Scripting
 {
+    static const DukEnumMap<Vehicle::Status> VehicleStatusMap({
+        { "moving_to_end_of_station", Vehicle::Status::MovingToEndOfStation },
+        { "waiting_for_passengers", Vehicle::Status::WaitingForPassengers },
+        { "waiting_to_depart", Vehicle::Status::WaitingToDepart },
+        { "departing", Vehicle::Status::Departing },
+        { "travelling", Vehicle::Status::Travelling },
+        { "arriving", Vehicle::Status::Arriving },
+        { "unloading_passengers", Vehicle::Status::UnloadingPassengers },
+        { "travelling_boat", Vehicle::Status::TravellingBoat },
+        { "crashing", Vehicle::Status::Crashing },
+        { "crashed", Vehicle::Status::Crashed },
+        { "travelling_dodgems", Vehicle::Status::TravellingDodgems },
+        { "swinging", Vehicle::Status::Swinging },
+        { "rotating", Vehicle::Status::Rotating },
+        { "ferris_wheel_rotating", Vehicle::Status::FerrisWheelRotating },
+        { "simulator_operating", Vehicle::Status::SimulatorOperating },
+        { "showing_film", Vehicle::Status::ShowingFilm },
+        { "space_rings_operating", Vehicle::Status::SpaceRingsOperating },
+        { "top_spin_operating", Vehicle::Status::TopSpinOperating },
+        { "haunted_house_operating", Vehicle::Status::HauntedHouseOperating },
+        { "doing_circus_show", Vehicle::Status::DoingCircusShow },
+        { "crooked_house_operating", Vehicle::Status::CrookedHouseOperating },
+        { "waiting_for_cable_lift", Vehicle::Status::WaitingForCableLift },
+        { "travelling_cable_lift", Vehicle::Status::TravellingCableLift },
+        { "stopping", Vehicle::Status::Stopping },
+        { "waiting_for_passengers_17", Vehicle::Status::WaitingForPassengers17 },
+        { "waiting_to_start", Vehicle::Status::WaitingToStart },
+        { "starting", Vehicle::Status::Starting },
+        { "operating_1a", Vehicle::Status::Operating1A },
+        { "stopping_1b", Vehicle::Status::Stopping1B },
+        { "unloading_passengers_1c", Vehicle::Status::UnloadingPassengers1C },
+        { "stopped_by_block_brake", Vehicle::Status::StoppedByBlockBrakes },
+    });
+
     class ScVehicle : public ScEntity
     {
     public:
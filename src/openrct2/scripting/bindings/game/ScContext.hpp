@@ -23,6 +23,7 @@
 #    include "../../ScriptEngine.h"
 #    include "../game/ScConfiguration.hpp"
 #    include "../game/ScDisposable.hpp"
+#    include "../game/ScWorker.hpp"
 #    include "../object/ScObjectManager.h"
 #    include "../ride/ScTrackSegment.h"
 
@@ -437,6 +438,15 @@ namespace OpenRCT2::Scripting
             return GetIconByName(iconName);
         }
 
+        std::shared_ptr<ScWorker> createWorker(const std::string& source)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto plugin = scriptEngine.GetExecInfo().GetCurrentPlugin();
+            auto worker = std::make_shared<ScWorker>(plugin, source);
+            scriptEngine.AddWorker(worker);
+            return worker;
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
@@ -462,6 +472,7 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::clearInterval, "clearInterval");
             dukglue_register_method(ctx, &ScContext::clearTimeout, "clearTimeout");
             dukglue_register_method(ctx, &ScContext::getIcon, "getIcon");
+            dukglue_register_method(ctx, &ScContext::createWorker, "createWorker");
         }
     };
 
@@ -11,8 +11,10 @@
 
 #ifdef ENABLE_SCRIPTING
 
+#    include "../../../Context.h"
 #    include "../../../profiling/Profiling.h"
 #    include "../../Duktape.hpp"
+#    include "../../ScriptEngine.h"
 
 namespace OpenRCT2::Scripting
 {
@@ -89,6 +91,35 @@ namespace OpenRCT2::Scripting
             return OpenRCT2::Profiling::IsEnabled();
         }
 
+        DukValue getHookData()
+        {
+            const auto& stats = GetContext()->GetScriptEngine().GetHookEngine().GetStats();
+            duk_push_array(_ctx);
+            duk_uarridx_t index = 0;
+            for (const auto& [key, s] : stats)
+            {
+                if (s.CallCount == 0 && s.ThrottledCount == 0)
+                    continue;
+
+                DukObject obj(_ctx);
+                obj.Set("plugin", key.first);
+                obj.Set("hook", GetHookName(key.second));
+                obj.Set("callCount", s.CallCount);
+                obj.Set("throttledCount", s.ThrottledCount);
+                obj.Set("maxTime", s.MaxTimeUs);
+                obj.Set("totalTime", s.TotalTimeUs);
+                obj.Take().push();
+                duk_put_prop_index(_ctx, /* duk stack index */ -2, index);
+                index++;
+            }
+            return DukValue::take_from_stack(_ctx);
+        }
+
+        void resetHookData()
+        {
+            GetContext()->GetScriptEngine().GetHookEngine().ResetStats();
+        }
+
     public:
         static void Register(duk_context* ctx)
         {
@@ -97,6 +128,8 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScProfiler::stop, "stop");
             dukglue_register_method(ctx, &ScProfiler::reset, "reset");
             dukglue_register_property(ctx, &ScProfiler::enabled_get, nullptr, "enabled");
+            dukglue_register_method(ctx, &ScProfiler::getHookData, "getHookData");
+            dukglue_register_method(ctx, &ScProfiler::resetHookData, "resetHookData");
         }
     };
 } // namespace OpenRCT2::Scripting
@@ -0,0 +1,152 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "../../../Context.h"
+#    include "../../Duktape.hpp"
+#    include "../../PluginWorker.h"
+#    include "../../ScriptEngine.h"
+
+#    include <cstring>
+#    include <memory>
+#    include <string>
+
+namespace OpenRCT2::Scripting
+{
+    class ScWorker
+    {
+    private:
+        std::shared_ptr<Plugin> _plugin;
+        std::unique_ptr<PluginWorker> _worker;
+        DukValue _onMessage;
+
+    public:
+        ScWorker(const std::shared_ptr<Plugin>& plugin, std::string source)
+            : _plugin(plugin)
+            , _worker(std::make_unique<PluginWorker>(std::move(source)))
+        {
+        }
+
+        const std::shared_ptr<Plugin>& GetPlugin() const
+        {
+            return _plugin;
+        }
+
+        /**
+         * Delivers the messages the worker has sent since the last update to the plugin.
+         */
+        void Update()
+        {
+            if (_worker == nullptr)
+                return;
+
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = scriptEngine.GetContext();
+
+            // A worker whose script failed has stopped by itself, its error is sent before it stops
+            auto hasStopped = _worker->IsStopping();
+            auto messages = _worker->Receive();
+            for (auto& message : messages)
+            {
+                if (message.Kind != PluginWorkerMessageKind::Data)
+                {
+                    std::string_view text(reinterpret_cast<const char*>(message.Data.data()), message.Data.size());
+                    scriptEngine.LogPluginInfo(_plugin, text);
+                    continue;
+                }
+
+                auto buffer = duk_push_fixed_buffer(ctx, message.Data.size());
+                std::memcpy(buffer, message.Data.data(), message.Data.size());
+                if (duk_safe_call(ctx, DecodeMessage, nullptr, 1, 1) != DUK_EXEC_SUCCESS)
+                {
+                    scriptEngine.LogPluginInfo(_plugin, duk_safe_to_string(ctx, -1));
+                    duk_pop(ctx);
+                    continue;
+                }
+                auto data = DukValue::take_from_stack(ctx);
+                if (_onMessage.is_function())
+                {
+                    scriptEngine.ExecutePluginCall(_plugin, _onMessage, { data }, false);
+                }
+
+                // The callback may have terminated the worker
+                if (_worker == nullptr)
+                    break;
+            }
+
+            if (hasStopped)
+            {
+                Dispose();
+            }
+        }
+
+        void Dispose()
+        {
+            _worker = nullptr;
+            _onMessage = {};
+        }
+
+        bool IsDisposed() const
+        {
+            return _worker == nullptr;
+        }
+
+    private:
+        void postMessage(const DukValue& data)
+        {
+            auto ctx = GetContext()->GetScriptEngine().GetContext();
+            if (_worker == nullptr)
+            {
+                duk_error(ctx, DUK_ERR_ERROR, "Worker has been terminated.");
+            }
+
+            data.push();
+            duk_cbor_encode(ctx, -1, 0);
+            duk_size_t length{};
+            auto bytes = static_cast<const uint8_t*>(duk_get_buffer_data(ctx, -1, &length));
+            _worker->Post(std::vector<uint8_t>(bytes, bytes + length));
+            duk_pop(ctx);
+        }
+
+        void onMessage(const DukValue& callback)
+        {
+            _onMessage = callback;
+        }
+
+        void terminate()
+        {
+            Dispose();
+        }
+
+        int32_t pendingMessages_get() const
+        {
+            return _worker != nullptr ? static_cast<int32_t>(_worker->GetPendingCount()) : 0;
+        }
+
+        static duk_ret_t DecodeMessage(duk_context* ctx, void* udata)
+        {
+            duk_cbor_decode(ctx, -1, 0);
+            return 1;
+        }
+
+    public:
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method(ctx, &ScWorker::postMessage, "postMessage");
+            dukglue_register_method(ctx, &ScWorker::onMessage, "onMessage");
+            dukglue_register_method(ctx, &ScWorker::terminate, "terminate");
+            dukglue_register_property(ctx, &ScWorker::pendingMessages_get, nullptr, "pendingMessages");
+        }
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
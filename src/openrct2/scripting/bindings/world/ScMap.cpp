@@ -29,6 +29,7 @@
 #    include "../entity/ScGuest.hpp"
 #    include "../entity/ScLitter.hpp"
 #    include "../entity/ScParticle.hpp"
+#    include "../entity/ScPeep.hpp"
 #    include "../entity/ScStaff.hpp"
 #    include "../entity/ScVehicle.hpp"
 #    include "../ride/ScRide.hpp"
@@ -288,6 +289,232 @@ namespace OpenRCT2::Scripting
         return result;
     }
 
+    enum class EntityQueryScope : uint8_t
+    {
+        Entity,
+        Peep,
+        Guest,
+        Vehicle,
+    };
+
+    struct EntityQueryField
+    {
+        std::string_view Name;
+        EntityQueryScope Scope;
+        int32_t (*Get)(const EntityBase& entity);
+    };
+
+    // clang-format off
+    static constexpr EntityQueryField kEntityQueryFields[] = {
+        { "id", EntityQueryScope::Entity, [](const EntityBase& e) -> int32_t { return e.Id.ToUnderlying(); } },
+        { "x", EntityQueryScope::Entity, [](const EntityBase& e) -> int32_t { return e.x; } },
+        { "y", EntityQueryScope::Entity, [](const EntityBase& e) -> int32_t { return e.y; } },
+        { "z", EntityQueryScope::Entity, [](const EntityBase& e) -> int32_t { return e.z; } },
+        { "energy", EntityQueryScope::Peep, [](const EntityBase& e) -> int32_t { return static_cast<const Peep&>(e).Energy; } },
+        { "energyTarget", EntityQueryScope::Peep, [](const EntityBase& e) -> int32_t { return static_cast<const Peep&>(e).EnergyTarget; } },
+        { "happiness", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Happiness; } },
+        { "happinessTarget", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).HappinessTarget; } },
+        { "nausea", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Nausea; } },
+        { "nauseaTarget", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).NauseaTarget; } },
+        { "hunger", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Hunger; } },
+        { "thirst", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Thirst; } },
+        { "toilet", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Toilet; } },
+        { "mass", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Mass; } },
+        { "minIntensity", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Intensity.GetMinimum(); } },
+        { "maxIntensity", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).Intensity.GetMaximum(); } },
+        { "nauseaTolerance", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return EnumValue(static_cast<const Guest&>(e).NauseaTolerance); } },
+        { "cash", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).CashInPocket; } },
+        { "lostCountdown", EntityQueryScope::Guest, [](const EntityBase& e) -> int32_t { return static_cast<const Guest&>(e).GuestIsLostCountdown; } },
+        { "ride", EntityQueryScope::Vehicle, [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).ride.ToUnderlying(); } },
+        { "mass", EntityQueryScope::Vehicle, [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).mass; } },
+        { "acceleration", EntityQueryScope::Vehicle, [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).acceleration; } },
+        { "velocity", EntityQueryScope::Vehicle, [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).velocity; } },
+        { "trackProgress", EntityQueryScope::Vehicle, [](const EntityBase& e) -> int32_t { return static_cast<const Vehicle&>(e).track_progress; } },
+    };
+    // clang-format on
+
+    static std::optional<EntityQueryScope> GetEntityQueryScope(std::string_view type)
+    {
+        if (type == "peep" || type == "staff")
+            return EntityQueryScope::Peep;
+        if (type == "guest")
+            return EntityQueryScope::Guest;
+        if (type == "car")
+            return EntityQueryScope::Vehicle;
+        if (type == "balloon" || type == "litter" || type == "duck" || type == "crashed_vehicle_particle")
+            return EntityQueryScope::Entity;
+        return std::nullopt;
+    }
+
+    static const EntityQueryField* FindEntityQueryField(std::string_view name, EntityQueryScope scope)
+    {
+        for (const auto& field : kEntityQueryFields)
+        {
+            if (field.Name != name)
+                continue;
+
+            if (field.Scope == EntityQueryScope::Entity || field.Scope == scope
+                || (field.Scope == EntityQueryScope::Peep && scope == EntityQueryScope::Guest))
+            {
+                return &field;
+            }
+        }
+        return nullptr;
+    }
+
+    template<typename T, typename TFunc> static void ForEachEntityOfType(TFunc&& func)
+    {
+        for (auto entity : EntityList<T>())
+        {
+            func(*entity);
+        }
+    }
+
+    template<typename TFunc> static void ForEachEntityOfType(std::string_view type, TFunc&& func)
+    {
+        if (type == "balloon")
+        {
+            ForEachEntityOfType<Balloon>(func);
+        }
+        else if (type == "car")
+        {
+            // Same order as getAllEntities, car by car along each train
+            for (auto trainHead : TrainManager::View())
+            {
+                for (auto car = trainHead; car != nullptr; car = GetEntity<Vehicle>(car->next_vehicle_on_train))
+                {
+                    func(*car);
+                }
+            }
+        }
+        else if (type == "litter")
+        {
+            ForEachEntityOfType<Litter>(func);
+        }
+        else if (type == "duck")
+        {
+            ForEachEntityOfType<Duck>(func);
+        }
+        else if (type == "peep")
+        {
+            ForEachEntityOfType<Guest>(func);
+            ForEachEntityOfType<Staff>(func);
+        }
+        else if (type == "guest")
+        {
+            ForEachEntityOfType<Guest>(func);
+        }
+        else if (type == "staff")
+        {
+            ForEachEntityOfType<Staff>(func);
+        }
+        else if (type == "crashed_vehicle_particle")
+        {
+            ForEachEntityOfType<VehicleCrashParticle>(func);
+        }
+    }
+
+    DukValue ScMap::queryEntities(const DukValue& query) const
+    {
+        auto type = AsOrDefault(query["type"], "");
+        auto scope = GetEntityQueryScope(type);
+        if (!scope.has_value())
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type: %s", type.c_str());
+        }
+
+        std::vector<const EntityQueryField*> fields;
+        auto dukFields = query["fields"];
+        if (dukFields.is_array())
+        {
+            for (const auto& dukField : dukFields.as_array())
+            {
+                auto name = AsOrDefault(dukField, "");
+                auto field = FindEntityQueryField(name, *scope);
+                if (field == nullptr)
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Invalid field for entity type %s: %s", type.c_str(), name.c_str());
+                }
+                fields.push_back(field);
+            }
+        }
+
+        std::optional<MapRange> range;
+        if (query["range"].type() == DukValue::Type::OBJECT)
+        {
+            range = FromDuk<MapRange>(query["range"]);
+        }
+
+        std::optional<uint8_t> state;
+        auto dukState = query["state"];
+        if (dukState.type() == DukValue::Type::STRING)
+        {
+            const auto& stateName = dukState.as_string();
+            if (*scope == EntityQueryScope::Peep || *scope == EntityQueryScope::Guest)
+            {
+                if (auto peepState = PeepStateMap.TryGet(stateName))
+                    state = EnumValue(*peepState);
+            }
+            else if (*scope == EntityQueryScope::Vehicle)
+            {
+                if (auto vehicleStatus = VehicleStatusMap.TryGet(stateName))
+                    state = EnumValue(*vehicleStatus);
+            }
+            if (!state.has_value())
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid state for entity type %s: %s", type.c_str(), stateName.c_str());
+            }
+        }
+
+        // Matches are gathered first so that the fields can be written as one column each. Scripts only ever run on
+        // the main thread, so the list is kept to save reallocating it for every query.
+        static std::vector<const EntityBase*> matches;
+        matches.clear();
+        ForEachEntityOfType(type, [&](const EntityBase& entity) {
+            if (range.has_value()
+                && (entity.x < range->GetLeft() || entity.x > range->GetRight() || entity.y < range->GetTop()
+                    || entity.y > range->GetBottom()))
+            {
+                return;
+            }
+            if (state.has_value())
+            {
+                auto entityState = *scope == EntityQueryScope::Vehicle ? EnumValue(static_cast<const Vehicle&>(entity).status)
+                                                                       : EnumValue(static_cast<const Peep&>(entity).State);
+                if (entityState != *state)
+                {
+                    return;
+                }
+            }
+            matches.push_back(&entity);
+        });
+
+        // All the fields share a single buffer, each viewed by its own Int32Array
+        const auto count = matches.size();
+        const auto columnSize = count * sizeof(int32_t);
+        auto columns = static_cast<int32_t*>(duk_push_fixed_buffer(_context, columnSize * fields.size()));
+        for (size_t i = 0; i < fields.size(); i++)
+        {
+            auto get = fields[i]->Get;
+            auto column = columns + i * count;
+            for (size_t j = 0; j < count; j++)
+            {
+                column[j] = get(*matches[j]);
+            }
+        }
+
+        duk_push_object(_context);
+        duk_push_uint(_context, static_cast<duk_uint_t>(count));
+        duk_put_prop_string(_context, -2, "count");
+        for (size_t i = 0; i < fields.size(); i++)
+        {
+            duk_push_buffer_object(_context, -2, i * columnSize, columnSize, DUK_BUFOBJ_INT32ARRAY);
+            duk_put_prop_lstring(_context, -2, fields[i]->Name.data(), fields[i]->Name.size());
+        }
+        duk_remove(_context, -2);
+        return DukValue::take_from_stack(_context);
+    }
+
     template<typename TEntityType, typename TScriptType>
     DukValue createEntityType(duk_context* ctx, const DukValue& initializer)
     {
@@ -389,6 +616,7 @@ namespace OpenRCT2::Scripting
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
         dukglue_register_method(ctx, &ScMap::getAllEntitiesOnTile, "getAllEntitiesOnTile");
+        dukglue_register_method(ctx, &ScMap::queryEntities, "queryEntities");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
         dukglue_register_method(ctx, &ScMap::getTrackIterator, "getTrackIterator");
     }
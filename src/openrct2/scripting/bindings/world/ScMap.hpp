@@ -44,6 +44,8 @@ namespace OpenRCT2::Scripting
 
         std::vector<DukValue> getAllEntitiesOnTile(const std::string& type, const DukValue& tilePos) const;
 
+        DukValue queryEntities(const DukValue& query) const;
+
         DukValue createEntity(const std::string& type, const DukValue& initializer);
 
         DukValue getTrackIterator(const DukValue& position, int32_t elementIndex) const;
@@ -86,6 +86,10 @@ const TileCoordsXY TileDirectionDelta[] = {
 };
 
 constexpr size_t MIN_TILE_ELEMENTS = 1024;
+constexpr size_t kNumTileCapacityClasses = 16;
+constexpr uint8_t kMinTileCapacityClass = 2;
+constexpr size_t kTileCompactionBatchSize = 16384;
+constexpr size_t kMaxDirtyTiles = 16384;
 
 uint16_t gMapSelectFlags;
 uint16_t gMapSelectType;
@@ -101,13 +105,39 @@ uint32_t gLandRemainingConstructionSales;
 
 bool gMapLandRightsUpdateSuccess;
 
+/**
+ * Tiles own a block of tile elements whose size is a power of two (its capacity class), so that most inserts can happen in
+ * place. Blocks left behind by tiles that outgrow them are reused through per-class free lists. Tiles loaded together are
+ * packed with no spare room, which is capacity class 0. Compaction keeps the capacity class of tiles that have grown.
+ *
+ * Rather than reorganising the whole map at once when the buffer runs out of room, tiles are copied over a number of ticks
+ * into a new buffer. Tiles that need to grow in the meantime are moved to the new buffer straight away.
+ */
+struct TileElementStorage
+{
+    std::vector<uint8_t> TileCapacityClass;
+    std::array<std::vector<size_t>, kNumTileCapacityClasses> FreeBlocks;
+    size_t NumFreeElements{};
+
+    bool Compacting{};
+    size_t CompactionCursor{};
+    std::vector<TileElement> CompactedElements;
+    std::vector<bool> TileCompacted;
+};
+
 static TilePointerIndex<TileElement> _tileIndex;
 static TilePointerIndex<TileElement> _tileIndexStash;
 static std::vector<TileElement> _tileElementsStash;
 static size_t _tileElementsInUse;
 static size_t _tileElementsInUseStash;
+static TileElementStorage _tileStorage;
+static TileElementStorage _tileStorageStash;
 static TileCoordsXY _mapSizeStash;
 
+static std::vector<bool> _dirtyTileMask;
+static std::vector<TileCoordsXY> _dirtyTiles;
+static bool _allTilesDirty = true;
+
 void StashMap()
 {
     auto& gameState = GetGameState();
@@ -115,6 +145,7 @@ void StashMap()
     _tileElementsStash = std::move(gameState.TileElements);
     _mapSizeStash = GetGameState().MapSize;
     _tileElementsInUseStash = _tileElementsInUse;
+    _tileStorageStash = std::move(_tileStorage);
 }
 
 void UnstashMap()
@@ -124,6 +155,8 @@ void UnstashMap()
     gameState.TileElements = std::move(_tileElementsStash);
     GetGameState().MapSize = _mapSizeStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    _tileStorage = std::move(_tileStorageStash);
+    MapMarkAllTilesDirty();
 }
 
 CoordsXY GetMapSizeUnits()
@@ -154,6 +187,11 @@ void SetTileElements(std::vector<TileElement>&& tileElements)
     _tileIndex = TilePointerIndex<TileElement>(
         kMaximumMapSizeTechnical, gameState.TileElements.data(), gameState.TileElements.size());
     _tileElementsInUse = gameState.TileElements.size();
+
+    _tileStorage = {};
+    _tileStorage.TileCapacityClass.resize(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+
+    MapMarkAllTilesDirty();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -244,6 +282,198 @@ void ReorganiseTileElements()
     ReorganiseTileElements(GetGameState().TileElements.size());
 }
 
+static size_t GetTileStorageIndex(const TileCoordsXY& tilePos)
+{
+    return (tilePos.y * kMaximumMapSizeTechnical) + tilePos.x;
+}
+
+static uint8_t GetTileCapacityClass(size_t numElements)
+{
+    auto capacityClass = kMinTileCapacityClass;
+    while ((size_t{ 1 } << capacityClass) < numElements)
+    {
+        capacityClass++;
+    }
+    return capacityClass;
+}
+
+static size_t GetTileCapacity(size_t storageIndex, size_t numElementsOnTile)
+{
+    auto capacityClass = _tileStorage.TileCapacityClass[storageIndex];
+    return capacityClass == 0 ? numElementsOnTile : size_t{ 1 } << capacityClass;
+}
+
+/**
+ * Returns the buffer new blocks are allocated from, this is the buffer being compacted into if compaction is in progress.
+ */
+static std::vector<TileElement>& GetTileElementAllocationBuffer()
+{
+    return _tileStorage.Compacting ? _tileStorage.CompactedElements : GetGameState().TileElements;
+}
+
+static bool HasRoomForTileBlock(uint8_t capacityClass)
+{
+    if (capacityClass < kNumTileCapacityClasses && !_tileStorage.FreeBlocks[capacityClass].empty())
+    {
+        return true;
+    }
+    const auto& buffer = GetTileElementAllocationBuffer();
+    return buffer.capacity() - buffer.size() >= (size_t{ 1 } << capacityClass);
+}
+
+static TileElement* AllocateTileBlock(uint8_t capacityClass)
+{
+    auto& buffer = GetTileElementAllocationBuffer();
+    if (capacityClass < kNumTileCapacityClasses)
+    {
+        auto& freeBlocks = _tileStorage.FreeBlocks[capacityClass];
+        if (!freeBlocks.empty())
+        {
+            auto offset = freeBlocks.back();
+            freeBlocks.pop_back();
+            _tileStorage.NumFreeElements -= size_t{ 1 } << capacityClass;
+            return &buffer[offset];
+        }
+    }
+
+    // Never grow the buffer beyond its capacity, that would invalidate every tile pointer
+    auto blockSize = size_t{ 1 } << capacityClass;
+    if (buffer.capacity() - buffer.size() < blockSize)
+    {
+        return nullptr;
+    }
+    auto offset = buffer.size();
+    buffer.resize(offset + blockSize);
+    return &buffer[offset];
+}
+
+static void FreeTileBlock(TileElement* block, uint8_t capacityClass, size_t blockSize)
+{
+    // Blocks in a buffer that is being compacted away are dropped along with it
+    auto& buffer = GetTileElementAllocationBuffer();
+    if (block < buffer.data() || block >= buffer.data() + buffer.size())
+        return;
+
+    _tileStorage.NumFreeElements += blockSize;
+
+    // Packed blocks are only reclaimed by compaction
+    if (capacityClass == 0 || capacityClass >= kNumTileCapacityClasses)
+        return;
+
+    _tileStorage.FreeBlocks[capacityClass].push_back(block - buffer.data());
+}
+
+static void BeginTileElementCompaction()
+{
+    // Tiles keep their spare room, so the compacted buffer needs room for every block still in use
+    const auto& tileElements = GetGameState().TileElements;
+    auto numElementsInBlocks = tileElements.size() - std::min(tileElements.size(), _tileStorage.NumFreeElements);
+
+    _tileStorage.Compacting = true;
+    _tileStorage.CompactionCursor = 0;
+    _tileStorage.CompactedElements = {};
+    _tileStorage.CompactedElements.reserve(
+        std::max(MIN_TILE_ELEMENTS, std::max(numElementsInBlocks, _tileElementsInUse) * 2));
+    _tileStorage.TileCompacted.assign(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical, false);
+    for (auto& freeBlocks : _tileStorage.FreeBlocks)
+    {
+        freeBlocks.clear();
+    }
+    _tileStorage.NumFreeElements = 0;
+}
+
+static void FinishTileElementCompaction()
+{
+    // Moving the vector keeps its data pointer, so the tile index remains valid
+    GetGameState().TileElements = std::move(_tileStorage.CompactedElements);
+    _tileStorage.CompactedElements = {};
+    _tileStorage.TileCompacted = {};
+    _tileStorage.Compacting = false;
+}
+
+/**
+ * Copies up to the given number of tiles into the compacted buffer, returns false if the buffer ran out of room.
+ */
+static bool ContinueTileElementCompaction(size_t numTiles)
+{
+    auto& buffer = _tileStorage.CompactedElements;
+    auto& cursor = _tileStorage.CompactionCursor;
+    const size_t numTilesTotal = kMaximumMapSizeTechnical * kMaximumMapSizeTechnical;
+    for (; cursor < numTilesTotal && numTiles > 0; cursor++)
+    {
+        if (_tileStorage.TileCompacted[cursor])
+            continue;
+
+        const auto tilePos = TileCoordsXY(
+            static_cast<int32_t>(cursor % kMaximumMapSizeTechnical), static_cast<int32_t>(cursor / kMaximumMapSizeTechnical));
+        const auto* element = _tileIndex.GetFirstElementAt(tilePos);
+        auto numElements = size_t{ 1 };
+        if (element != nullptr)
+        {
+            while (!element[numElements - 1].IsLastForTile())
+            {
+                numElements++;
+            }
+        }
+
+        // Tiles that have grown keep room for at least one more element, so that their next insert does not move them
+        // again. Room they no longer need is given up.
+        auto& capacityClass = _tileStorage.TileCapacityClass[cursor];
+        if (capacityClass != 0)
+        {
+            capacityClass = std::min(capacityClass, GetTileCapacityClass(numElements + 1));
+        }
+        auto blockSize = GetTileCapacity(cursor, numElements);
+        if (buffer.capacity() - buffer.size() < blockSize)
+        {
+            return false;
+        }
+
+        auto offset = buffer.size();
+        if (element == nullptr)
+        {
+            buffer.push_back(GetDefaultSurfaceElement());
+        }
+        else
+        {
+            buffer.insert(buffer.end(), element, element + numElements);
+        }
+        buffer.resize(offset + blockSize);
+        _tileIndex.SetTile(tilePos, &buffer[offset]);
+        _tileStorage.TileCompacted[cursor] = true;
+        numTiles--;
+    }
+
+    if (cursor == numTilesTotal)
+    {
+        FinishTileElementCompaction();
+    }
+    return true;
+}
+
+/**
+ * Moves a bit more of the map into a compacted buffer if a compaction is in progress, or starts one when too much of the
+ * tile element buffer is taken up by blocks no tile uses any more. Spare room in the blocks of tiles does not count.
+ */
+void MapCompactTileElements()
+{
+    PROFILED_FUNCTION();
+
+    if (!_tileStorage.Compacting)
+    {
+        if (_tileStorage.NumFreeElements < std::max(MIN_TILE_ELEMENTS, _tileElementsInUse / 2))
+        {
+            return;
+        }
+        BeginTileElementCompaction();
+    }
+
+    if (!ContinueTileElementCompaction(kTileCompactionBatchSize))
+    {
+        ReorganiseTileElements(GetGameState().TileElements.capacity() * 2);
+    }
+}
+
 static bool MapCheckFreeElementsAndReorganise(size_t numElementsOnTile, size_t numNewElements)
 {
     // Check hard cap on num in use tiles (this would be the size of _tileElements immediately after a reorg)
@@ -252,28 +482,24 @@ static bool MapCheckFreeElementsAndReorganise(size_t numElementsOnTile, size_t n
         return false;
     }
 
-    auto& gameState = GetGameState();
-    auto totalElementsRequired = numElementsOnTile + numNewElements;
-    auto freeElements = gameState.TileElements.capacity() - gameState.TileElements.size();
-    if (freeElements >= totalElementsRequired)
+    auto capacityClass = GetTileCapacityClass(numElementsOnTile + numNewElements);
+    if (HasRoomForTileBlock(capacityClass))
     {
         return true;
     }
 
-    // if space issue is due to fragmentation then Reorg Tiles without increasing capacity
-    if (gameState.TileElements.size() > totalElementsRequired + _tileElementsInUse)
+    // Start allocating from a new buffer, the old one stays valid until every tile has moved across
+    if (!_tileStorage.Compacting)
     {
-        ReorganiseTileElements();
-        // This check is not expected to fail
-        freeElements = gameState.TileElements.capacity() - gameState.TileElements.size();
-        if (freeElements >= totalElementsRequired)
+        BeginTileElementCompaction();
+        if (HasRoomForTileBlock(capacityClass))
         {
             return true;
         }
     }
 
     // Capacity must increase to handle the space (Note capacity can go above MAX_TILE_ELEMENTS)
-    auto newCapacity = gameState.TileElements.capacity() * 2;
+    auto newCapacity = std::max(GetGameState().TileElements.capacity(), _tileElementsInUse) * 2;
     ReorganiseTileElements(newCapacity);
     return true;
 }
@@ -406,6 +632,10 @@ void MapSetTileElement(const TileCoordsXY& tilePos, TileElement* elements)
         return;
     }
     _tileIndex.SetTile(tilePos, elements);
+    if (!_tileStorage.TileCapacityClass.empty())
+    {
+        _tileStorage.TileCapacityClass[GetTileStorageIndex(tilePos)] = 0;
+    }
 }
 
 SurfaceElement* MapGetSurfaceElementAt(const TileCoordsXY& coords)
@@ -526,6 +756,10 @@ void MapStripGhostFlagFromElements()
     {
         element.SetGhost(false);
     }
+    for (auto& element : _tileStorage.CompactedElements)
+    {
+        element.SetGhost(false);
+    }
 }
 
 /**
@@ -1028,11 +1262,6 @@ void TileElementRemove(TileElement* tileElement)
     (tileElement - 1)->SetLastForTile(true);
     tileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
     _tileElementsInUse--;
-    auto& gameState = GetGameState();
-    if (tileElement == &gameState.TileElements.back())
-    {
-        gameState.TileElements.pop_back();
-    }
 }
 
 /**
@@ -1141,6 +1370,8 @@ static size_t CountElementsOnTile(const CoordsXY& loc)
 {
     size_t count = 0;
     auto* element = _tileIndex.GetFirstElementAt(TileCoordsXY(loc));
+    if (element == nullptr)
+        return count;
     do
     {
         count++;
@@ -1148,19 +1379,43 @@ static size_t CountElementsOnTile(const CoordsXY& loc)
     return count;
 }
 
-static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNewElements)
+/**
+ * Moves the elements of a tile to a new block large enough to hold the given number of elements.
+ */
+static TileElement* RelocateTileElements(const TileCoordsXY& tilePos, size_t numElementsOnTile, size_t numElementsRequired)
 {
-    if (!MapCheckFreeElementsAndReorganise(numElementsOnTile, numNewElements))
+    if (!MapCheckFreeElementsAndReorganise(numElementsOnTile, numElementsRequired - numElementsOnTile))
     {
-        LOG_ERROR("Cannot insert new element");
         return nullptr;
     }
 
-    auto& gameState = GetGameState();
-    auto oldSize = gameState.TileElements.size();
-    gameState.TileElements.resize(gameState.TileElements.size() + numElementsOnTile + numNewElements);
-    _tileElementsInUse += numNewElements;
-    return &gameState.TileElements[oldSize];
+    auto capacityClass = GetTileCapacityClass(numElementsRequired);
+    auto* newBlock = AllocateTileBlock(capacityClass);
+    if (newBlock == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto storageIndex = GetTileStorageIndex(tilePos);
+    auto* oldBlock = _tileIndex.GetFirstElementAt(tilePos);
+    if (oldBlock != nullptr)
+    {
+        std::copy_n(oldBlock, numElementsOnTile, newBlock);
+        for (size_t i = 0; i < numElementsOnTile; i++)
+        {
+            oldBlock[i].BaseHeight = MAX_ELEMENT_HEIGHT;
+        }
+        FreeTileBlock(
+            oldBlock, _tileStorage.TileCapacityClass[storageIndex], GetTileCapacity(storageIndex, numElementsOnTile));
+    }
+
+    _tileIndex.SetTile(tilePos, newBlock);
+    _tileStorage.TileCapacityClass[storageIndex] = capacityClass;
+    if (_tileStorage.Compacting)
+    {
+        _tileStorage.TileCompacted[storageIndex] = true;
+    }
+    return newBlock;
 }
 
 /**
@@ -1169,72 +1424,59 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
  */
 TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants, TileElementType type)
 {
-    const auto& tileLoc = TileCoordsXYZ(loc);
+    const auto tileLoc = TileCoordsXY(loc);
 
-    auto numElementsOnTileOld = CountElementsOnTile(loc);
-    auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
-    auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
-    if (newTileElement == nullptr)
+    auto numElementsOnTile = CountElementsOnTile(loc);
+    auto* tileElements = _tileIndex.GetFirstElementAt(tileLoc);
+    if (numElementsOnTile + 1 > GetTileCapacity(GetTileStorageIndex(tileLoc), numElementsOnTile))
     {
+        tileElements = RelocateTileElements(tileLoc, numElementsOnTile, numElementsOnTile + 1);
+        if (tileElements == nullptr)
+        {
+            LOG_ERROR("Cannot insert new element");
+            return nullptr;
+        }
+    }
+    else if (_tileElementsInUse + 1 > MAX_TILE_ELEMENTS)
+    {
+        LOG_ERROR("Cannot insert new element");
         return nullptr;
     }
+    _tileElementsInUse++;
 
-    // Set tile index pointer to point to new element block
-    _tileIndex.SetTile(tileLoc, newTileElement);
-
-    bool isLastForTile = false;
-    if (originalTileElement == nullptr)
+    // Elements are ordered by base height, find where the new element goes and make room for it
+    size_t insertIndex = 0;
+    while (insertIndex < numElementsOnTile && loc.z >= tileElements[insertIndex].GetBaseZ())
     {
-        isLastForTile = true;
+        insertIndex++;
     }
-    else
+    bool isLastForTile = insertIndex == numElementsOnTile;
+    if (isLastForTile)
     {
-        // Copy all elements that are below the insert height
-        while (loc.z >= originalTileElement->GetBaseZ())
+        if (numElementsOnTile != 0)
         {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
-
-            if ((newTileElement - 1)->IsLastForTile())
-            {
-                // No more elements above the insert element
-                (newTileElement - 1)->SetLastForTile(false);
-                isLastForTile = true;
-                break;
-            }
+            tileElements[numElementsOnTile - 1].SetLastForTile(false);
         }
     }
-
-    // Insert new map element
-    auto* insertedElement = newTileElement;
-    newTileElement->Type = 0;
-    newTileElement->SetType(type);
-    newTileElement->SetBaseZ(loc.z);
-    newTileElement->Flags = 0;
-    newTileElement->SetLastForTile(isLastForTile);
-    newTileElement->SetOccupiedQuadrants(occupiedQuadrants);
-    newTileElement->SetClearanceZ(loc.z);
-    newTileElement->Owner = 0;
-    std::memset(&newTileElement->Pad05, 0, sizeof(newTileElement->Pad05));
-    std::memset(&newTileElement->Pad08, 0, sizeof(newTileElement->Pad08));
-    newTileElement++;
-
-    // Insert rest of map elements above insert height
-    if (!isLastForTile)
+    else
     {
-        do
-        {
-            // Copy over map element
-            *newTileElement = *originalTileElement;
-            originalTileElement->BaseHeight = MAX_ELEMENT_HEIGHT;
-            originalTileElement++;
-            newTileElement++;
-        } while (!((newTileElement - 1)->IsLastForTile()));
+        std::copy_backward(
+            tileElements + insertIndex, tileElements + numElementsOnTile, tileElements + numElementsOnTile + 1);
     }
 
+    // Insert new map element
+    auto* insertedElement = &tileElements[insertIndex];
+    insertedElement->Type = 0;
+    insertedElement->SetType(type);
+    insertedElement->SetBaseZ(loc.z);
+    insertedElement->Flags = 0;
+    insertedElement->SetLastForTile(isLastForTile);
+    insertedElement->SetOccupiedQuadrants(occupiedQuadrants);
+    insertedElement->SetClearanceZ(loc.z);
+    insertedElement->Owner = 0;
+    std::memset(&insertedElement->Pad05, 0, sizeof(insertedElement->Pad05));
+    std::memset(&insertedElement->Pad08, 0, sizeof(insertedElement->Pad08));
+
     return insertedElement;
 }
 
@@ -1784,6 +2026,7 @@ static void MapInvalidateTileUnderZoom(int32_t x, int32_t y, int32_t z0, int32_t
  */
 void MapInvalidateTile(const CoordsXYRangedZ& tilePos)
 {
+    MapMarkTileDirty(tilePos);
     MapInvalidateTileUnderZoom(tilePos.x, tilePos.y, tilePos.baseZ, tilePos.clearanceZ, ZoomLevel{ -1 });
 }
 
@@ -1793,6 +2036,7 @@ void MapInvalidateTile(const CoordsXYRangedZ& tilePos)
  */
 void MapInvalidateTileZoom1(const CoordsXYRangedZ& tilePos)
 {
+    MapMarkTileDirty(tilePos);
     MapInvalidateTileUnderZoom(tilePos.x, tilePos.y, tilePos.baseZ, tilePos.clearanceZ, ZoomLevel{ 1 });
 }
 
@@ -1802,6 +2046,7 @@ void MapInvalidateTileZoom1(const CoordsXYRangedZ& tilePos)
  */
 void MapInvalidateTileZoom0(const CoordsXYRangedZ& tilePos)
 {
+    MapMarkTileDirty(tilePos);
     MapInvalidateTileUnderZoom(tilePos.x, tilePos.y, tilePos.baseZ, tilePos.clearanceZ, ZoomLevel{ 0 });
 }
 
@@ -1823,6 +2068,14 @@ void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs)
 {
     int32_t x0, y0, x1, y1, left, right, top, bottom;
 
+    for (int32_t y = mins.y; y <= maxs.y; y += kCoordsXYStep)
+    {
+        for (int32_t x = mins.x; x <= maxs.x; x += kCoordsXYStep)
+        {
+            MapMarkTileDirty({ x, y });
+        }
+    }
+
     x0 = mins.x + 16;
     y0 = mins.y + 16;
 
@@ -1839,6 +2092,60 @@ void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs)
     ViewportsInvalidate({ { left, top }, { right, bottom } });
 }
 
+void MapMarkTileDirty(const CoordsXY& tilePos)
+{
+    if (_allTilesDirty)
+        return;
+
+    const auto tileLoc = TileCoordsXY(tilePos);
+    if (tileLoc.x < 0 || tileLoc.y < 0 || tileLoc.x >= kMaximumMapSizeTechnical || tileLoc.y >= kMaximumMapSizeTechnical)
+        return;
+
+    if (_dirtyTileMask.empty())
+        _dirtyTileMask.resize(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+
+    const auto index = (tileLoc.y * kMaximumMapSizeTechnical) + tileLoc.x;
+    if (_dirtyTileMask[index])
+        return;
+
+    // Nothing may be taking the dirty tiles (the map window is closed), so stop tracking them past a point.
+    if (_dirtyTiles.size() >= kMaxDirtyTiles)
+    {
+        MapMarkAllTilesDirty();
+        return;
+    }
+
+    _dirtyTileMask[index] = true;
+    _dirtyTiles.push_back(tileLoc);
+}
+
+void MapMarkAllTilesDirty()
+{
+    for (const auto& tileLoc : _dirtyTiles)
+    {
+        _dirtyTileMask[(tileLoc.y * kMaximumMapSizeTechnical) + tileLoc.x] = false;
+    }
+    _dirtyTiles.clear();
+    _allTilesDirty = true;
+}
+
+bool MapTakeDirtyTiles(std::vector<TileCoordsXY>& dirtyTiles)
+{
+    dirtyTiles.clear();
+    if (_allTilesDirty)
+    {
+        _allTilesDirty = false;
+        return true;
+    }
+
+    for (const auto& tileLoc : _dirtyTiles)
+    {
+        _dirtyTileMask[(tileLoc.y * kMaximumMapSizeTechnical) + tileLoc.x] = false;
+    }
+    std::swap(dirtyTiles, _dirtyTiles);
+    return false;
+}
+
 int32_t MapGetTileSide(const CoordsXY& mapPos)
 {
     int32_t subMapX = mapPos.x & (32 - 1);
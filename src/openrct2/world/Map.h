@@ -112,6 +112,7 @@ extern uint32_t gLandRemainingConstructionSales;
 extern bool gMapLandRightsUpdateSuccess;
 
 void ReorganiseTileElements();
+void MapCompactTileElements();
 const std::vector<TileElement>& GetTileElements();
 void SetTileElements(std::vector<TileElement>&& tileElements);
 void StashMap();
@@ -208,6 +209,15 @@ void MapInvalidateTileFull(const CoordsXY& tilePos);
 void MapInvalidateElement(const CoordsXY& elementPos, TileElement* tileElement);
 void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs);
 
+/**
+ * Tiles whose elements changed are recorded as they are invalidated so that the map window only has to recolour those.
+ * MapTakeDirtyTiles moves the recorded tiles into dirtyTiles and returns true instead when too many tiles changed to be
+ * worth tracking individually, or the whole map was replaced, in which case every tile has to be considered changed.
+ */
+void MapMarkTileDirty(const CoordsXY& tilePos);
+void MapMarkAllTilesDirty();
+bool MapTakeDirtyTiles(std::vector<TileCoordsXY>& dirtyTiles);
+
 int32_t MapGetTileSide(const CoordsXY& mapPos);
 int32_t MapGetTileQuadrant(const CoordsXY& mapPos);
 int32_t MapGetCornerHeight(int32_t z, int32_t slope, int32_t direction);
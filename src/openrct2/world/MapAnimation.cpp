@@ -13,6 +13,7 @@
 #include "../Diagnostic.h"
 #include "../Game.h"
 #include "../GameState.h"
+#include "../OpenRCT2.h"
 #include "../entity/EntityList.h"
 #include "../entity/Peep.h"
 #include "../interface/Viewport.h"
@@ -30,45 +31,43 @@
 #include "Map.h"
 #include "Scenery.h"
 
+#include <unordered_set>
+
 using namespace OpenRCT2;
 
 using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
 
 static std::vector<MapAnimation> _mapAnimations;
+static std::unordered_set<uint64_t> _mapAnimationKeys;
 
-constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
+// Tiles to redraw, collected while updating animations so that viewports are only walked once
+static std::vector<CoordsXYRangedZ> _mapAnimationInvalidations;
 
 static bool InvalidateMapAnimation(const MapAnimation& obj);
 
-static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
+static uint64_t GetMapAnimationKey(int32_t type, const CoordsXYZ& location)
 {
-    for (const auto& a : _mapAnimations)
-    {
-        if (a.type == type && a.location == location)
-        {
-            // Animation already exists
-            return true;
-        }
-    }
-    return false;
+    return (static_cast<uint64_t>(static_cast<uint16_t>(location.x)) << 48)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(location.y)) << 32)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(location.z)) << 16) | static_cast<uint8_t>(type);
 }
 
 void MapAnimationCreate(int32_t type, const CoordsXYZ& loc)
 {
-    if (!DoesAnimationExist(type, loc))
+    if (_mapAnimationKeys.insert(GetMapAnimationKey(type, loc)).second)
     {
-        if (_mapAnimations.size() < MAX_ANIMATED_OBJECTS)
-        {
-            // Create new animation
-            _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
-        }
-        else
-        {
-            LOG_ERROR("Exceeded the maximum number of animations");
-        }
+        _mapAnimations.push_back({ static_cast<uint8_t>(type), loc });
     }
 }
 
+static void MapAnimationInvalidateTile(const CoordsXYRangedZ& tilePos)
+{
+    if (gOpenRCT2Headless)
+        return;
+
+    _mapAnimationInvalidations.push_back(tilePos);
+}
+
 /**
  *
  *  rct2: 0x0068AFAD
@@ -77,19 +76,19 @@ void MapAnimationInvalidateAll()
 {
     PROFILED_FUNCTION();
 
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
-    {
-        if (InvalidateMapAnimation(*it))
+    // Finished animations are removed in a single pass, keeping the remaining ones in order
+    auto it = std::remove_if(_mapAnimations.begin(), _mapAnimations.end(), [](const MapAnimation& a) {
+        if (InvalidateMapAnimation(a))
         {
-            // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
-        }
-        else
-        {
-            it++;
+            _mapAnimationKeys.erase(GetMapAnimationKey(a.type, a.location));
+            return true;
         }
-    }
+        return false;
+    });
+    _mapAnimations.erase(it, _mapAnimations.end());
+
+    ViewportsInvalidateTiles(_mapAnimationInvalidations, ZoomLevel{ 1 });
+    _mapAnimationInvalidations.clear();
 }
 
 /**
@@ -118,7 +117,7 @@ static bool MapAnimationInvalidateRideEntrance(const CoordsXYZ& loc)
             if (stationObj != nullptr)
             {
                 int32_t height = loc.z + stationObj->Height + 8;
-                MapInvalidateTileZoom1({ loc, height, height + 16 });
+                MapAnimationInvalidateTile({ loc, height, height + 16 });
             }
         }
         return false;
@@ -153,7 +152,7 @@ static bool MapAnimationInvalidateQueueBanner(const CoordsXYZ& loc)
         int32_t direction = (tileElement->AsPath()->GetQueueBannerDirection() + GetCurrentRotation()) & 3;
         if (direction == TILE_ELEMENT_DIRECTION_NORTH || direction == TILE_ELEMENT_DIRECTION_EAST)
         {
-            MapInvalidateTileZoom1({ loc, loc.z + 16, loc.z + 30 });
+            MapAnimationInvalidateTile({ loc, loc.z + 16, loc.z + 30 });
         }
         return false;
     } while (!(tileElement++)->IsLastForTile());
@@ -189,7 +188,7 @@ static bool MapAnimationInvalidateSmallScenery(const CoordsXYZ& loc)
                 SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
                 | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS))
         {
-            MapInvalidateTileZoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+            MapAnimationInvalidateTile({ loc, loc.z, tileElement->GetClearanceZ() });
             return false;
         }
 
@@ -217,7 +216,7 @@ static bool MapAnimationInvalidateSmallScenery(const CoordsXYZ& loc)
                     break;
                 }
             }
-            MapInvalidateTileZoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+            MapAnimationInvalidateTile({ loc, loc.z, tileElement->GetClearanceZ() });
             return false;
         }
 
@@ -248,7 +247,7 @@ static bool MapAnimationInvalidateParkEntrance(const CoordsXYZ& loc)
         if (tileElement->AsEntrance()->GetSequenceIndex())
             continue;
 
-        MapInvalidateTileZoom1({ loc, loc.z + 32, loc.z + 64 });
+        MapAnimationInvalidateTile({ loc, loc.z + 32, loc.z + 64 });
         return false;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -276,7 +275,7 @@ static bool MapAnimationInvalidateTrackWaterfall(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Waterfall)
         {
-            MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 46 });
+            MapAnimationInvalidateTile({ loc, loc.z + 14, loc.z + 46 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -305,7 +304,7 @@ static bool MapAnimationInvalidateTrackRapids(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Rapids)
         {
-            MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 18 });
+            MapAnimationInvalidateTile({ loc, loc.z + 14, loc.z + 18 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -334,7 +333,7 @@ static bool MapAnimationInvalidateTrackOnRidePhoto(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::OnRidePhoto)
         {
-            MapInvalidateTileZoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+            MapAnimationInvalidateTile({ loc, loc.z, tileElement->GetClearanceZ() });
             if (GameIsPaused())
             {
                 return false;
@@ -373,7 +372,7 @@ static bool MapAnimationInvalidateTrackWhirlpool(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Whirlpool)
         {
-            MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 18 });
+            MapAnimationInvalidateTile({ loc, loc.z + 14, loc.z + 18 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -402,7 +401,7 @@ static bool MapAnimationInvalidateTrackSpinningTunnel(const CoordsXYZ& loc)
 
         if (tileElement->AsTrack()->GetTrackType() == TrackElemType::SpinningTunnel)
         {
-            MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 32 });
+            MapAnimationInvalidateTile({ loc, loc.z + 14, loc.z + 32 });
             return false;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -437,7 +436,7 @@ static bool MapAnimationInvalidateBanner(const CoordsXYZ& loc)
             continue;
         if (tileElement->GetType() != TileElementType::Banner)
             continue;
-        MapInvalidateTileZoom1({ loc, loc.z, loc.z + 16 });
+        MapAnimationInvalidateTile({ loc, loc.z, loc.z + 16 });
         return false;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -467,7 +466,7 @@ static bool MapAnimationInvalidateLargeScenery(const CoordsXYZ& loc)
         auto* sceneryEntry = tileElement->AsLargeScenery()->GetEntry();
         if (sceneryEntry != nullptr && sceneryEntry->flags & LARGE_SCENERY_FLAG_ANIMATED)
         {
-            MapInvalidateTileZoom1({ loc, loc.z, loc.z + 16 });
+            MapAnimationInvalidateTile({ loc, loc.z, loc.z + 16 });
             wasInvalidated = true;
         }
     } while (!(tileElement++)->IsLastForTile());
@@ -532,7 +531,7 @@ static bool MapAnimationInvalidateWallDoor(const CoordsXYZ& loc)
         tileElement->AsWall()->SetAnimationFrame(currentFrame);
         if (invalidate)
         {
-            MapInvalidateTileZoom1({ loc, loc.z, loc.z + 32 });
+            MapAnimationInvalidateTile({ loc, loc.z, loc.z + 32 });
         }
     } while (!(tileElement++)->IsLastForTile());
 
@@ -565,7 +564,7 @@ static bool MapAnimationInvalidateWall(const CoordsXYZ& loc)
             || (!(wallEntry->flags2 & WALL_SCENERY_2_ANIMATED) && wallEntry->scrolling_mode == SCROLLING_MODE_NONE))
             continue;
 
-        MapInvalidateTileZoom1({ loc, loc.z, loc.z + 16 });
+        MapAnimationInvalidateTile({ loc, loc.z, loc.z + 16 });
         wasInvalidated = true;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -604,6 +603,7 @@ const std::vector<MapAnimation>& GetMapAnimations()
 static void ClearMapAnimations()
 {
     _mapAnimations.clear();
+    _mapAnimationKeys.clear();
 }
 
 void MapAnimationAutoCreate()
@@ -716,8 +716,10 @@ void ShiftAllMapAnimations(CoordsXY amount)
     if (amount.x == 0 && amount.y == 0)
         return;
 
+    _mapAnimationKeys.clear();
     for (auto& a : _mapAnimations)
     {
         a.location += amount;
+        _mapAnimationKeys.insert(GetMapAnimationKey(a.type, a.location));
     }
 }
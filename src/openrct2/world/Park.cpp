@@ -12,6 +12,7 @@
 #include "../Cheats.h"
 #include "../Context.h"
 #include "../Date.h"
+#include "../Diagnostic.h"
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
@@ -49,6 +50,11 @@ namespace OpenRCT2::Park
     // If this value is more than or equal to 0, the park rating is forced to this value. Used for cheat
     static int32_t _forcedParkRating = -1;
 
+    // Guests in the park who are happy and guests who can't find the park exit, kept up to date for the park rating
+    static uint32_t _numHappyGuests;
+    static uint32_t _numLostGuests;
+    static bool _guestStatisticsValid;
+
     static money64 calculateRideValue(const Ride& ride);
     static money64 calculateTotalRideValueForMoney();
     static uint32_t calculateSuggestedMaxGuests();
@@ -374,6 +380,90 @@ namespace OpenRCT2::Park
         return tiles;
     }
 
+    GuestStatistics GetGuestStatistics(const Guest& guest)
+    {
+        GuestStatistics statistics;
+        if (guest.OutsideOfPark)
+        {
+            if (guest.State != PeepState::LeavingPark)
+            {
+                statistics.NumHeadingForPark = 1;
+            }
+            return statistics;
+        }
+
+        statistics.NumInPark = 1;
+        if (guest.Happiness > 128)
+        {
+            statistics.NumHappy = 1;
+        }
+        // Guests who can't find the park exit
+        if ((guest.PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (guest.GuestIsLostCountdown < 90))
+        {
+            statistics.NumLost = 1;
+        }
+        return statistics;
+    }
+
+    GuestStatistics CalculateGuestStatistics()
+    {
+        GuestStatistics statistics;
+        for (auto guest : EntityList<Guest>())
+        {
+            const auto guestStatistics = GetGuestStatistics(*guest);
+            statistics.NumInPark += guestStatistics.NumInPark;
+            statistics.NumHeadingForPark += guestStatistics.NumHeadingForPark;
+            statistics.NumHappy += guestStatistics.NumHappy;
+            statistics.NumLost += guestStatistics.NumLost;
+        }
+        return statistics;
+    }
+
+    /**
+     * Called with the share of a guest from GetGuestStatistics before and after it changed the guest's happiness, lost
+     * countdown, flags or whether they are in the park, so that the happy and lost guest counts stay up to date. A
+     * guest that is removed changes to an empty share.
+     */
+    void OnGuestStatisticsChanged(const GuestStatistics& before, const GuestStatistics& after)
+    {
+        _numHappyGuests += after.NumHappy - before.NumHappy;
+        _numLostGuests += after.NumLost - before.NumLost;
+    }
+
+    /**
+     * Called when all guests are removed at once. The happy and lost guest counts are recounted from the guests there
+     * are the next time they are needed, which picks up guests that were loaded rather than created.
+     */
+    void ResetGuestStatistics()
+    {
+        _guestStatisticsValid = false;
+    }
+
+#if defined(DEBUG) && DEBUG > 0
+    // The guest counts are kept up to date as guests change, check them against the guests that exist.
+    static void verifyGuestCounts(const GameState_t& gameState, const GuestStatistics& statistics)
+    {
+        if (_numHappyGuests != statistics.NumHappy)
+        {
+            LOG_WARNING("Happy guests count is %u, but found %u guests.", _numHappyGuests, statistics.NumHappy);
+        }
+        if (_numLostGuests != statistics.NumLost)
+        {
+            LOG_WARNING("Lost guests count is %u, but found %u guests.", _numLostGuests, statistics.NumLost);
+        }
+        if (gameState.NumGuestsInPark != statistics.NumInPark)
+        {
+            LOG_WARNING("Guests in park count is %u, but found %u guests.", gameState.NumGuestsInPark, statistics.NumInPark);
+        }
+        if (gameState.NumGuestsHeadingForPark != statistics.NumHeadingForPark)
+        {
+            LOG_WARNING(
+                "Guests heading for park count is %u, but found %u guests.", gameState.NumGuestsHeadingForPark,
+                statistics.NumHeadingForPark);
+        }
+    }
+#endif
+
     int32_t CalculateParkRating()
     {
         if (_forcedParkRating >= 0)
@@ -382,6 +472,17 @@ namespace OpenRCT2::Park
         }
 
         auto& gameState = GetGameState();
+        if (!_guestStatisticsValid)
+        {
+            const auto guestStatistics = CalculateGuestStatistics();
+            _numHappyGuests = guestStatistics.NumHappy;
+            _numLostGuests = guestStatistics.NumLost;
+            _guestStatisticsValid = true;
+        }
+#if defined(DEBUG) && DEBUG > 0
+        verifyGuestCounts(gameState, CalculateGuestStatistics());
+#endif
+
         int32_t result = 1150;
         if (gameState.Park.Flags & PARK_FLAGS_DIFFICULT_PARK_RATING)
         {
@@ -393,23 +494,8 @@ namespace OpenRCT2::Park
             // -150 to +3 based on a range of guests from 0 to 2000
             result -= 150 - (std::min<int32_t>(2000, gameState.NumGuestsInPark) / 13);
 
-            // Find the number of happy peeps and the number of peeps who can't find the park exit
-            uint32_t happyGuestCount = 0;
-            uint32_t lostGuestCount = 0;
-            for (auto peep : EntityList<Guest>())
-            {
-                if (!peep->OutsideOfPark)
-                {
-                    if (peep->Happiness > 128)
-                    {
-                        happyGuestCount++;
-                    }
-                    if ((peep->PeepFlags & PEEP_FLAGS_LEAVING_PARK) && (peep->GuestIsLostCountdown < 90))
-                    {
-                        lostGuestCount++;
-                    }
-                }
-            }
+            const auto happyGuestCount = _numHappyGuests;
+            const auto lostGuestCount = _numLostGuests;
 
             // Peep happiness -500 to +0
             result -= 500;
@@ -71,10 +71,26 @@ namespace OpenRCT2
             bool IsOpen() const;
         };
 
+        /**
+         * Guest counts gathered in a single pass over all guests, or the share of a single guest. Happy and lost guests
+         * are only counted for guests that are in the park.
+         */
+        struct GuestStatistics
+        {
+            uint32_t NumInPark{};
+            uint32_t NumHeadingForPark{};
+            uint32_t NumHappy{};
+            uint32_t NumLost{};
+        };
+
         void Initialise(OpenRCT2::GameState_t& gameState);
         void Update(OpenRCT2::GameState_t& gameState, const OpenRCT2::Date& date);
 
         uint32_t CalculateParkSize();
+        GuestStatistics CalculateGuestStatistics();
+        GuestStatistics GetGuestStatistics(const Guest& guest);
+        void OnGuestStatisticsChanged(const GuestStatistics& before, const GuestStatistics& after);
+        void ResetGuestStatistics();
         int32_t CalculateParkRating();
         money64 CalculateParkValue();
         money64 CalculateCompanyValue();
@@ -6,7 +6,12 @@
 #include <gtest/gtest.h>
 #include <iterator>
 #include <openrct2/CommandLineSprite.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileSystem.hpp>
 #include <openrct2/core/Path.hpp>
+#include <string>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -38,6 +43,34 @@ public:
         return Path::Combine(SpriteTestDataPath(), u8"result.dat");
     }
 
+    static std::string ConvertTestPath()
+    {
+        return (fs::temp_directory_path() / "openrct2-convert-batch-tests").u8string();
+    }
+
+    static std::string CopyTestPark(const std::string& destinationPath)
+    {
+        Path::CreateDirectory(Path::GetDirectory(destinationPath));
+        File::Copy(TestData::GetParkPath(u8"small_park_car_ride_one_car.sv6"), destinationPath, true);
+        return destinationPath;
+    }
+
+    static int32_t RunConvertBatch(const std::vector<std::string>& args, std::string& output)
+    {
+        std::vector<const char*> argv = { "openrct2", "convert-batch" };
+        for (const auto& arg : args)
+        {
+            argv.push_back(arg.c_str());
+        }
+
+        // Errors are written to standard output while there is no context
+        testing::internal::CaptureStdout();
+        testing::internal::CaptureStderr();
+        auto result = CommandLineRun(argv.data(), static_cast<int32_t>(argv.size()));
+        output = testing::internal::GetCapturedStdout() + testing::internal::GetCapturedStderr();
+        return result;
+    }
+
     static bool CompareSpriteFiles(std::string original, std::string generated)
     {
         std::ifstream originalFile(original, std::ios::binary | std::ifstream::in);
@@ -98,3 +131,42 @@ TEST_F(CommandLineTests, command_line_for_sprite_failed_build)
     // validate the target file was unchanged
     ASSERT_TRUE(CompareSpriteFiles(ExampleSpriteFilePath(), outputfilePath));
 }
+
+TEST_F(CommandLineTests, convert_batch_same_file_name_in_two_directories)
+{
+    auto testPath = ConvertTestPath();
+    auto outputPath = Path::Combine(testPath, u8"output");
+    auto sourceA = CopyTestPark(Path::Combine(testPath, u8"a", u8"park.sv6"));
+    auto sourceB = CopyTestPark(Path::Combine(testPath, u8"b", u8"park.sv6"));
+
+    // Both would be converted to output/park.park, so nothing may be converted
+    std::string error;
+    int32_t result = RunConvertBatch({ outputPath, sourceA, sourceB }, error);
+    EXPECT_EQ(result, -1);
+    EXPECT_NE(error.find(Path::Combine(u8"a", u8"park.sv6") + "' and '"), std::string::npos) << error;
+    EXPECT_NE(error.find(Path::Combine(u8"b", u8"park.sv6") + "' would both be converted to '"), std::string::npos) << error;
+    EXPECT_NE(error.find(Path::Combine(u8"output", u8"park.park") + "'."), std::string::npos) << error;
+    EXPECT_FALSE(Path::DirectoryExists(outputPath));
+
+    Path::DeleteDirectory(testPath);
+}
+
+TEST_F(CommandLineTests, convert_batch_same_name_with_different_extensions)
+{
+    auto testPath = ConvertTestPath();
+    auto outputPath = Path::Combine(testPath, u8"output");
+    auto sourcePath = Path::Combine(testPath, u8"source");
+    CopyTestPark(Path::Combine(sourcePath, u8"park.sc6"));
+    CopyTestPark(Path::Combine(sourcePath, u8"park.sv6"));
+
+    std::string error;
+    int32_t result = RunConvertBatch({ outputPath, sourcePath }, error);
+    EXPECT_EQ(result, -1);
+    EXPECT_NE(error.find("would both be converted to"), std::string::npos) << error;
+    EXPECT_NE(error.find(Path::Combine(u8"source", u8"park.sc6") + "'"), std::string::npos) << error;
+    EXPECT_NE(error.find(Path::Combine(u8"source", u8"park.sv6") + "'"), std::string::npos) << error;
+    EXPECT_NE(error.find(Path::Combine(u8"output", u8"park.park") + "'."), std::string::npos) << error;
+    EXPECT_FALSE(Path::DirectoryExists(outputPath));
+
+    Path::DeleteDirectory(testPath);
+}
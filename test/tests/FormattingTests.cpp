@@ -58,6 +58,27 @@ TEST_F(FmtStringTests, iteration_escaped)
     ASSERT_EQ("[1:This is an ][2:{{][1:ESCAPED][2:}}][1: string.]", actual);
 }
 
+TEST_F(FmtStringTests, iteration_compiled)
+{
+    std::string expected;
+    std::string actual;
+
+    std::string_view str = "{BLACK}Guests: {INT32}{{ESCAPED}}{MOVE_X}{12}\n";
+    for (const auto& t : FmtString(str))
+    {
+        expected += String::StdFormat("[%d:%s:%u]", t.kind, std::string(t.text).c_str(), t.parameter);
+    }
+
+    auto tokens = FmtString::Compile(str);
+    for (const auto& t : FmtString(str, tokens))
+    {
+        actual += String::StdFormat("[%d:%s:%u]", t.kind, std::string(t.text).c_str(), t.parameter);
+    }
+
+    ASSERT_EQ(expected, actual);
+    ASSERT_EQ(std::size_t{ 8 }, tokens.size());
+}
+
 TEST_F(FmtStringTests, without_format_tokens)
 {
     auto fmt = FmtString("{BLACK}Guests: {INT32}");
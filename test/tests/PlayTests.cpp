@@ -9,6 +9,8 @@
 
 #include "TestData.h"
 
+#include <chrono>
+#include <cstdio>
 #include <gtest/gtest.h>
 #include <memory>
 #include <openrct2/Context.h>
@@ -20,6 +22,7 @@
 #include <openrct2/actions/ParkSetParameterAction.h>
 #include <openrct2/actions/RideSetPriceAction.h>
 #include <openrct2/actions/RideSetStatusAction.h>
+#include <openrct2/entity/EntityList.h>
 #include <openrct2/entity/EntityRegistry.h>
 #include <openrct2/entity/EntityTweener.h>
 #include <openrct2/entity/Peep.h>
@@ -195,3 +198,32 @@ TEST_F(PlayTests, CarRideWithOneCarOnlyAcceptsTwoGuests)
         gameStateUpdateLogic();
     }
 }
+
+// Times the guest and staff updates of a busy park. Not run by default, run it with
+// --gtest_also_run_disabled_tests --gtest_filter=*benchmark
+TEST_F(PlayTests, DISABLED_benchmark)
+{
+    auto context = localStartGame(TestData::GetParkPath("bpb.sv6"));
+    ASSERT_NE(context.get(), nullptr);
+
+    constexpr uint16_t kNumGuests = 4000;
+    while (GetEntityListCount(EntityType::Guest) < kNumGuests)
+    {
+        ASSERT_NE(Park::GenerateGuest(), nullptr);
+    }
+
+    // Every guest gets their 128 tick update four times, one of them the full update
+    constexpr int32_t kTicks = 512;
+    auto& gameState = GetGameState();
+    auto startTime = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < kTicks; i++)
+    {
+        gameState.CurrentTicks++;
+        PeepUpdateAll();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - startTime;
+
+    std::printf(
+        "%u guests, %.3f ms per tick\n", GetEntityListCount(EntityType::Guest),
+        std::chrono::duration<double, std::milli>(elapsed).count() / kTicks);
+}
@@ -0,0 +1,307 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/ride/QueueIndex.h>
+#include <openrct2/ride/Ride.h>
+#include <random>
+#include <vector>
+
+using namespace OpenRCT2;
+
+class QueueIndexTests : public testing::Test
+{
+protected:
+    static constexpr int32_t kStationCount = 2;
+
+    Ride* _ride{};
+    std::vector<Guest*> _guests;
+
+    // The guests expected in each station's queue, from the front to the back
+    std::vector<Guest*> _expected[kStationCount];
+
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        GetContext()->LoadParkFromFile(TestData::GetParkPath("small_park_car_ride_one_car.sv6"));
+        GameLoadInit();
+    }
+
+    static void TearDownTestCase()
+    {
+        _context = nullptr;
+    }
+
+    void SetUp() override
+    {
+        for (auto& ride : GetRideManager())
+        {
+            _ride = &ride;
+            break;
+        }
+        ASSERT_NE(_ride, nullptr);
+
+        // Start from empty queues, this drops whatever the index knew of them
+        for (int32_t i = 0; i < kStationCount; i++)
+        {
+            auto& station = _ride->GetStation(StationIndex::FromUnderlying(i));
+            station.LastPeepInQueue = EntityId::GetNull();
+            station.QueueLength = 0;
+        }
+
+        _guests.clear();
+        for (int32_t i = 0; i < 32; i++)
+        {
+            auto* guest = Guest::Generate({ 32 * 32, 32 * 32, 14 * 8 });
+            ASSERT_NE(guest, nullptr);
+            guest->GuestNextInQueue = EntityId::GetNull();
+            _guests.push_back(guest);
+        }
+    }
+
+    void TearDown() override
+    {
+        for (int32_t i = 0; i < kStationCount; i++)
+        {
+            for (auto* guest : _expected[i])
+            {
+                guest->RemoveFromQueue();
+            }
+            _expected[i].clear();
+        }
+        for (auto* guest : _guests)
+        {
+            EntityRemove(guest);
+        }
+    }
+
+    // Joins the back of the queue the way guests on a queue path do
+    void JoinBack(Guest* guest, int32_t stationIndex)
+    {
+        auto station = StationIndex::FromUnderlying(stationIndex);
+        auto& rideStation = _ride->GetStation(station);
+        auto previousBack = rideStation.LastPeepInQueue;
+        rideStation.LastPeepInQueue = guest->Id;
+        guest->GuestNextInQueue = previousBack;
+        rideStation.QueueLength++;
+        QueueIndex::OnGuestJoinedBack(*_ride, station, *guest, previousBack);
+
+        guest->CurrentRide = _ride->id;
+        guest->CurrentRideStation = station;
+        _expected[stationIndex].push_back(guest);
+    }
+
+    void Leave(Guest* guest, int32_t stationIndex)
+    {
+        guest->RemoveFromQueue();
+
+        auto& expected = _expected[stationIndex];
+        expected.erase(std::find(expected.begin(), expected.end(), guest));
+    }
+
+    void MoveToFront(Guest* guest, int32_t stationIndex)
+    {
+        Leave(guest, stationIndex);
+        _ride->QueueInsertGuestAtFront(StationIndex::FromUnderlying(stationIndex), guest);
+
+        auto& expected = _expected[stationIndex];
+        expected.insert(expected.begin(), guest);
+    }
+
+    int32_t GetQueueOf(const Guest* guest) const
+    {
+        for (int32_t i = 0; i < kStationCount; i++)
+        {
+            if (std::find(_expected[i].begin(), _expected[i].end(), guest) != _expected[i].end())
+                return i;
+        }
+        return -1;
+    }
+
+    // Walks the queue the way the game did before it was indexed and checks the index against it
+    void CheckQueue(int32_t stationIndex)
+    {
+        auto station = StationIndex::FromUnderlying(stationIndex);
+        const auto& rideStation = _ride->GetStation(station);
+
+        std::vector<Guest*> walked;
+        Guest* guest;
+        for (auto guestId = rideStation.LastPeepInQueue; (guest = TryGetEntity<Guest>(guestId)) != nullptr;
+             guestId = guest->GuestNextInQueue)
+        {
+            ASSERT_LE(walked.size(), _guests.size()) << "queue " << stationIndex << " loops";
+            walked.insert(walked.begin(), guest);
+        }
+        ASSERT_EQ(walked, _expected[stationIndex]) << "queue " << stationIndex;
+        ASSERT_EQ(rideStation.QueueLength, walked.size()) << "queue " << stationIndex;
+
+        EntityId front;
+        ASSERT_TRUE(QueueIndex::GetFront(*_ride, station, front)) << "queue " << stationIndex;
+        ASSERT_EQ(front, walked.empty() ? EntityId::GetNull() : walked.front()->Id) << "queue " << stationIndex;
+        ASSERT_EQ(_ride->GetQueueHeadGuest(station), walked.empty() ? nullptr : walked.front()) << "queue " << stationIndex;
+
+        uint16_t length;
+        ASSERT_TRUE(QueueIndex::GetLength(*_ride, station, length)) << "queue " << stationIndex;
+        ASSERT_EQ(length, walked.size()) << "queue " << stationIndex;
+
+        for (auto* other : _guests)
+        {
+            auto it = std::find(walked.begin(), walked.end(), other);
+            auto expectedBehind = EntityId::GetNull();
+            if (it != walked.end() && it + 1 != walked.end())
+            {
+                expectedBehind = (*(it + 1))->Id;
+            }
+
+            EntityId behind;
+            ASSERT_TRUE(QueueIndex::GetGuestBehind(*_ride, station, *other, behind)) << "queue " << stationIndex;
+            ASSERT_EQ(behind, expectedBehind) << "queue " << stationIndex << " guest " << other->Id.ToUnderlying();
+        }
+    }
+
+    void CheckQueues()
+    {
+        for (int32_t i = 0; i < kStationCount; i++)
+        {
+            CheckQueue(i);
+        }
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> QueueIndexTests::_context;
+
+TEST_F(QueueIndexTests, JoinBackAndLeaveFront)
+{
+    for (auto* guest : _guests)
+    {
+        JoinBack(guest, 0);
+        CheckQueue(0);
+    }
+    while (!_expected[0].empty())
+    {
+        Leave(_expected[0].front(), 0);
+        CheckQueue(0);
+    }
+}
+
+TEST_F(QueueIndexTests, LeaveFromMiddleAndBack)
+{
+    for (auto* guest : _guests)
+    {
+        JoinBack(guest, 0);
+    }
+    CheckQueue(0);
+
+    Leave(_guests[10], 0);
+    CheckQueue(0);
+    Leave(_guests.back(), 0);
+    CheckQueue(0);
+    Leave(_guests[11], 0);
+    CheckQueue(0);
+    Leave(_guests[1], 0);
+    CheckQueue(0);
+}
+
+TEST_F(QueueIndexTests, MoveToFront)
+{
+    for (auto* guest : _guests)
+    {
+        JoinBack(guest, 0);
+    }
+
+    // From the middle, the back and the front
+    MoveToFront(_guests[16], 0);
+    CheckQueue(0);
+    MoveToFront(_guests.back(), 0);
+    CheckQueue(0);
+    MoveToFront(_guests.back(), 0);
+    CheckQueue(0);
+
+    // Into an empty queue
+    Leave(_guests[0], 0);
+    JoinBack(_guests[0], 1);
+    MoveToFront(_guests[0], 1);
+    CheckQueues();
+}
+
+TEST_F(QueueIndexTests, QueueChangedOutsideOfIndex)
+{
+    for (auto* guest : _guests)
+    {
+        JoinBack(guest, 0);
+    }
+    CheckQueue(0);
+
+    // Clearing a station, as removing its entrance does, leaves the index to be rebuilt from the new list
+    auto& station = _ride->GetStation(StationIndex::FromUnderlying(0));
+    station.LastPeepInQueue = EntityId::GetNull();
+    station.QueueLength = 0;
+    _expected[0].clear();
+    CheckQueue(0);
+
+    JoinBack(_guests[3], 0);
+    JoinBack(_guests[4], 0);
+    CheckQueue(0);
+}
+
+TEST_F(QueueIndexTests, LoopedQueueIsNotIndexed)
+{
+    auto station = StationIndex::FromUnderlying(0);
+    JoinBack(_guests[0], 0);
+    JoinBack(_guests[1], 0);
+    _guests[0]->GuestNextInQueue = _guests[1]->Id;
+
+    EntityId front;
+    uint16_t length;
+    ASSERT_FALSE(QueueIndex::GetFront(*_ride, station, front));
+    ASSERT_FALSE(QueueIndex::GetLength(*_ride, station, length));
+
+    _guests[0]->GuestNextInQueue = EntityId::GetNull();
+    CheckQueue(0);
+}
+
+TEST_F(QueueIndexTests, RandomChanges)
+{
+    std::mt19937 prng(0x5EED);
+    for (int32_t i = 0; i < 4000; i++)
+    {
+        auto* guest = _guests[prng() % _guests.size()];
+        auto queue = GetQueueOf(guest);
+        if (queue == -1)
+        {
+            JoinBack(guest, prng() % kStationCount);
+        }
+        else if (prng() % 4 == 0)
+        {
+            MoveToFront(guest, queue);
+        }
+        else
+        {
+            Leave(guest, queue);
+        }
+        CheckQueues();
+    }
+}
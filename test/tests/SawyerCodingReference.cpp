@@ -0,0 +1,112 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "SawyerCodingReference.h"
+
+#include <cstring>
+#include <openrct2/core/Numerics.hpp>
+#include <openrct2/rct12/SawyerChunkReader.h>
+#include <openrct2/util/SawyerCoding.h>
+
+namespace SawyerCodingReference
+{
+    std::vector<uint8_t> DecodeRLE(const uint8_t* src, size_t srcLength)
+    {
+        std::vector<uint8_t> buf;
+        for (size_t i = 0; i < srcLength; i++)
+        {
+            uint8_t rleCodeByte = src[i];
+            if (rleCodeByte & 128)
+            {
+                i++;
+                if (i >= srcLength)
+                    throw SawyerChunkException("Reference: run past the end.");
+                buf.insert(buf.end(), 257 - rleCodeByte, src[i]);
+            }
+            else
+            {
+                size_t len = rleCodeByte + 1;
+                if (i + 1 + len > srcLength)
+                    throw SawyerChunkException("Reference: literal past the end.");
+                buf.insert(buf.end(), src + i + 1, src + i + 1 + len);
+                i += len;
+            }
+        }
+        return buf;
+    }
+
+    std::vector<uint8_t> DecodeRepeat(const std::vector<uint8_t>& src)
+    {
+        std::vector<uint8_t> buf;
+        for (size_t i = 0; i < src.size(); i++)
+        {
+            if (src[i] == 0xFF)
+            {
+                if (i + 1 >= src.size())
+                    throw SawyerChunkException("Reference: escaped byte past the end.");
+                buf.push_back(src[++i]);
+            }
+            else
+            {
+                size_t count = (src[i] & 7) + 1;
+                size_t distance = 32 - (src[i] >> 3);
+                if (distance > buf.size() || count > distance)
+                    throw SawyerChunkException("Reference: repeat outside of the decoded data.");
+                for (size_t j = 0; j < count; j++)
+                    buf.push_back(buf[buf.size() - distance]);
+            }
+        }
+        return buf;
+    }
+
+    std::optional<std::vector<uint8_t>> ReadChunk(const uint8_t* data, size_t size)
+    {
+        SawyerCodingChunkHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        const uint8_t* src = data + sizeof(header);
+        if (header.length >= 16 * 1024 * 1024 || header.length > size - sizeof(header))
+            return std::nullopt;
+
+        try
+        {
+            std::vector<uint8_t> buf;
+            switch (header.encoding)
+            {
+                case CHUNK_ENCODING_NONE:
+                    buf.assign(src, src + header.length);
+                    break;
+                case CHUNK_ENCODING_RLE:
+                    buf = DecodeRLE(src, header.length);
+                    break;
+                case CHUNK_ENCODING_RLECOMPRESSED:
+                    buf = DecodeRepeat(DecodeRLE(src, header.length));
+                    break;
+                case CHUNK_ENCODING_ROTATE:
+                {
+                    uint8_t code = 1;
+                    for (uint32_t i = 0; i < header.length; i++)
+                    {
+                        buf.push_back(OpenRCT2::Numerics::ror8(src[i], code));
+                        code = (code + 2) % 8;
+                    }
+                    break;
+                }
+                default:
+                    return std::nullopt;
+            }
+            if (buf.empty())
+                return std::nullopt;
+            return buf;
+        }
+        catch (const SawyerChunkException&)
+        {
+            return std::nullopt;
+        }
+    }
+} // namespace SawyerCodingReference
@@ -0,0 +1,38 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * The Sawyer chunk decoder as it was before it decoded in place: one byte at a time into growing buffers, checking
+ * every read against the end of its input. SawyerChunkReader must give the same data, or fail, wherever this does.
+ */
+namespace SawyerCodingReference
+{
+    /**
+     * Decodes RLE encoded data, throws SawyerChunkException if the data is corrupt.
+     */
+    std::vector<uint8_t> DecodeRLE(const uint8_t* src, size_t srcLength);
+
+    /**
+     * Decodes repeat encoded data, throws SawyerChunkException if the data is corrupt.
+     */
+    std::vector<uint8_t> DecodeRepeat(const std::vector<uint8_t>& src);
+
+    /**
+     * Decodes the chunk, header included, at the start of the data. Returns nothing where SawyerChunkReader::ReadChunk
+     * is expected to throw.
+     */
+    std::optional<std::vector<uint8_t>> ReadChunk(const uint8_t* data, size_t size);
+} // namespace SawyerCodingReference
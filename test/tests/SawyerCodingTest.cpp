@@ -7,10 +7,21 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "SawyerCodingReference.h"
+#include "TestData.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <gtest/gtest.h>
+#include <openrct2/core/File.h>
 #include <openrct2/core/MemoryStream.h>
 #include <openrct2/rct12/SawyerChunkReader.h>
 #include <openrct2/util/SawyerCoding.h>
+#include <optional>
+#include <random>
+#include <vector>
 
 constexpr size_t BUFFER_SIZE = 0x600000;
 
@@ -31,6 +42,14 @@ protected:
     static const uint8_t invalid7[6];
     static const uint8_t empty[1];
 
+    static constexpr const char* kCorpusParks[] = {
+        "bpb.sv6",
+        "pathfinding-tests.sv6",
+        "small_park_car_ride_one_car.sv6",
+        "small_park_with_ferris_wheel.sv6",
+        "tile-element-tests.sv6",
+    };
+
     void TestEncodeDecode(uint8_t encoding_type)
     {
         // Encode
@@ -68,6 +87,131 @@ protected:
         auto result = memcmp(chunk->GetData(), randomdata, sizeof(randomdata));
         ASSERT_EQ(result, 0);
     }
+
+    // Runs and repeated short sequences, so that the decoders take all of their paths
+    static std::vector<uint8_t> MakeCompressibleData(std::mt19937& prng, size_t length)
+    {
+        std::vector<uint8_t> data(length);
+        for (size_t i = 0; i < data.size();)
+        {
+            auto count = std::min<size_t>(1 + prng() % 40, data.size() - i);
+            switch (prng() % 3)
+            {
+                case 0:
+                    std::fill_n(data.begin() + i, count, static_cast<uint8_t>(prng()));
+                    break;
+                case 1:
+                    for (size_t j = 0; j < count; j++)
+                        data[i + j] = i + j >= 8 ? data[i + j - 8] : static_cast<uint8_t>(prng());
+                    break;
+                default:
+                    for (size_t j = 0; j < count; j++)
+                        data[i + j] = static_cast<uint8_t>(prng());
+                    break;
+            }
+            i += count;
+        }
+        return data;
+    }
+
+    static std::vector<uint8_t> EncodeChunk(uint8_t encoding, const std::vector<uint8_t>& data)
+    {
+        SawyerCodingChunkHeader header;
+        header.encoding = encoding;
+        header.length = static_cast<uint32_t>(data.size());
+        std::vector<uint8_t> encoded(data.size() * 2 + 1024);
+        encoded.resize(SawyerCodingWriteChunkBuffer(encoded.data(), data.data(), header));
+        return encoded;
+    }
+
+    // Reads every chunk of a saved game in the test data, header included
+    static void ReadParkChunks(const char* park, std::vector<std::vector<uint8_t>>& chunks)
+    {
+        auto data = OpenRCT2::File::ReadAllBytes(TestData::GetParkPath(park));
+        ASSERT_GT(data.size(), sizeof(SawyerCodingChunkHeader) + 4) << park;
+
+        // The chunks run up to the checksum at the end of the file
+        size_t offset = 0;
+        while (offset < data.size() - 4)
+        {
+            SawyerCodingChunkHeader header;
+            std::memcpy(&header, data.data() + offset, sizeof(header));
+            auto end = std::min<size_t>(offset + sizeof(header) + header.length, data.size());
+            chunks.emplace_back(data.begin() + offset, data.begin() + end);
+            offset += sizeof(header) + header.length;
+        }
+        ASSERT_EQ(offset, data.size() - 4) << park;
+    }
+
+    static std::vector<uint8_t> MakeChunk(uint8_t encoding, const uint8_t* payload, size_t length)
+    {
+        SawyerCodingChunkHeader header;
+        header.encoding = encoding;
+        header.length = static_cast<uint32_t>(length);
+        std::vector<uint8_t> chunk(sizeof(header) + length);
+        std::memcpy(chunk.data(), &header, sizeof(header));
+        std::copy_n(payload, length, chunk.begin() + sizeof(header));
+        return chunk;
+    }
+
+    static std::vector<uint8_t> MakeChunk(uint8_t encoding, const std::vector<uint8_t>& payload)
+    {
+        return MakeChunk(encoding, payload.data(), payload.size());
+    }
+
+    // Wraps repeat encoded data in RLE literals, so that it reaches the repeat decoder exactly as given
+    static std::vector<uint8_t> MakeRepeatChunk(const std::vector<uint8_t>& repeatData)
+    {
+        std::vector<uint8_t> payload;
+        for (size_t i = 0; i < repeatData.size(); i += 128)
+        {
+            auto len = std::min<size_t>(repeatData.size() - i, 128);
+            payload.push_back(static_cast<uint8_t>(len - 1));
+            payload.insert(payload.end(), repeatData.begin() + i, repeatData.begin() + i + len);
+        }
+        return MakeChunk(CHUNK_ENCODING_RLECOMPRESSED, payload);
+    }
+
+    // Reads the chunk at the given offset both as a whole and into a buffer, and compares it with the reference decoder
+    static void TestMatchesReference(const std::vector<uint8_t>& data, size_t offset = 0)
+    {
+        auto expected = SawyerCodingReference::ReadChunk(data.data() + offset, data.size() - offset);
+
+        OpenRCT2::MemoryStream ms(data.data(), data.size());
+        ms.SetPosition(offset);
+        SawyerChunkReader reader(&ms);
+        std::shared_ptr<SawyerChunk> chunk;
+        if (!expected.has_value())
+        {
+            EXPECT_THROW(chunk = reader.ReadChunk(), SawyerChunkException) << "chunk at " << offset;
+            ASSERT_EQ(ms.GetPosition(), offset);
+
+            uint8_t buffer[64];
+            EXPECT_THROW(reader.ReadChunk(buffer, sizeof(buffer)), SawyerChunkException) << "chunk at " << offset;
+            ASSERT_EQ(ms.GetPosition(), offset);
+            return;
+        }
+
+        ASSERT_NO_THROW(chunk = reader.ReadChunk()) << "chunk at " << offset;
+        ASSERT_EQ(chunk->GetLength(), expected->size()) << "chunk at " << offset;
+        ASSERT_EQ(memcmp(chunk->GetData(), expected->data(), expected->size()), 0) << "chunk at " << offset;
+
+        std::vector<uint8_t> buffer(expected->size());
+        ms.SetPosition(offset);
+        ASSERT_NO_THROW(reader.ReadChunk(buffer.data(), buffer.size())) << "chunk at " << offset;
+        ASSERT_EQ(buffer, *expected) << "chunk at " << offset;
+
+        // Buffers shorter than the chunk get its start, longer ones are padded with zeros
+        for (size_t length : { expected->size() / 2, expected->size() + 16 })
+        {
+            std::vector<uint8_t> expectedBuffer(*expected);
+            expectedBuffer.resize(length);
+            buffer.assign(length, 0xCC);
+            ms.SetPosition(offset);
+            ASSERT_NO_THROW(reader.ReadChunk(buffer.data(), buffer.size())) << "chunk at " << offset;
+            ASSERT_EQ(buffer, expectedBuffer) << "chunk at " << offset << ", length " << length;
+        }
+    }
 };
 
 TEST_F(SawyerCodingTest, write_read_chunk_none)
@@ -179,6 +323,224 @@ TEST_F(SawyerCodingTest, empty)
     EXPECT_THROW(ptr = reader.ReadChunk(), IOException);
 }
 
+TEST_F(SawyerCodingTest, read_chunk_into_larger_buffer)
+{
+    std::vector<uint8_t> buffer(sizeof(randomdata) + 64, 0xCC);
+    OpenRCT2::MemoryStream ms(rlecompresseddata, sizeof(rlecompresseddata));
+    SawyerChunkReader reader(&ms);
+    reader.ReadChunk(buffer.data(), buffer.size());
+    ASSERT_EQ(memcmp(buffer.data(), randomdata, sizeof(randomdata)), 0);
+    for (size_t i = sizeof(randomdata); i < buffer.size(); i++)
+    {
+        ASSERT_EQ(buffer[i], 0);
+    }
+}
+
+TEST_F(SawyerCodingTest, read_chunk_into_smaller_buffer)
+{
+    std::vector<uint8_t> buffer(sizeof(randomdata) / 2 + 1, 0xCC);
+    OpenRCT2::MemoryStream ms(rlecompresseddata, sizeof(rlecompresseddata));
+    SawyerChunkReader reader(&ms);
+    reader.ReadChunk(buffer.data(), buffer.size());
+    ASSERT_EQ(memcmp(buffer.data(), randomdata, buffer.size()), 0);
+}
+
+TEST_F(SawyerCodingTest, read_chunk_into_buffer_invalid)
+{
+    uint8_t buffer[64];
+    OpenRCT2::MemoryStream ms(invalid3, sizeof(invalid3));
+    SawyerChunkReader reader(&ms);
+    EXPECT_THROW(reader.ReadChunk(buffer, sizeof(buffer)), SawyerChunkException);
+    ASSERT_EQ(ms.GetPosition(), 0u);
+}
+
+TEST_F(SawyerCodingTest, write_read_chunk_compressible)
+{
+    std::mt19937 prng(1234);
+    for (int32_t iteration = 0; iteration < 64; iteration++)
+    {
+        auto data = MakeCompressibleData(prng, 1 + prng() % 8192);
+        for (uint8_t encoding :
+             { CHUNK_ENCODING_NONE, CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED, CHUNK_ENCODING_ROTATE })
+        {
+            auto encoded = EncodeChunk(encoding, data);
+            OpenRCT2::MemoryStream ms(encoded.data(), encoded.size());
+            SawyerChunkReader reader(&ms);
+            auto chunk = reader.ReadChunk();
+            ASSERT_EQ(chunk->GetLength(), data.size());
+            ASSERT_EQ(memcmp(chunk->GetData(), data.data(), data.size()), 0);
+        }
+    }
+}
+
+TEST_F(SawyerCodingTest, malformed_rle_past_end)
+{
+    // Literals and runs that need more bytes than the chunk has left
+    const std::vector<std::vector<uint8_t>> payloads = {
+        { 0x00 },
+        { 0x05, 0x41, 0x42 },
+        { 0xFE },
+        { 0x00, 0x41, 0xFE },
+        { 0x00, 0x41, 0x03, 0x42, 0x43 },
+        { 0x7F, 0x41 },
+    };
+    for (uint8_t encoding : { CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED })
+    {
+        for (const auto& payload : payloads)
+        {
+            auto chunk = MakeChunk(encoding, payload);
+            ASSERT_FALSE(SawyerCodingReference::ReadChunk(chunk.data(), chunk.size()).has_value());
+            TestMatchesReference(chunk);
+        }
+    }
+
+    // A chunk whose header claims more data than the stream holds
+    for (uint8_t encoding : { CHUNK_ENCODING_NONE, CHUNK_ENCODING_RLE, CHUNK_ENCODING_RLECOMPRESSED, CHUNK_ENCODING_ROTATE })
+    {
+        auto chunk = MakeChunk(encoding, { 0x00, 0x41, 0x00, 0x41 });
+        chunk.pop_back();
+        TestMatchesReference(chunk);
+    }
+}
+
+TEST_F(SawyerCodingTest, malformed_repeat_past_end)
+{
+    // Escaped bytes past the end, and repeats reaching before the start or past the end of the data decoded so far
+    const std::vector<std::vector<uint8_t>> repeatData = {
+        { 0xFF },
+        { 0xFF, 0x41, 0xFF },
+        { 0xF8 },
+        { 0xFF, 0x41, 0xF0 },
+        { 0xFF, 0x41, 0xFF, 0x42, 0xF2 },
+        { 0xFF, 0x41, 0x07 },
+    };
+    for (const auto& data : repeatData)
+    {
+        auto chunk = MakeRepeatChunk(data);
+        ASSERT_FALSE(SawyerCodingReference::ReadChunk(chunk.data(), chunk.size()).has_value());
+        TestMatchesReference(chunk);
+    }
+
+    // Repeats that just fit
+    TestMatchesReference(MakeRepeatChunk({ 0xFF, 0x41, 0xF8 }));
+    TestMatchesReference(MakeRepeatChunk({ 0xFF, 0x41, 0xFF, 0x42, 0xF1 }));
+}
+
+TEST_F(SawyerCodingTest, truncated_chunks_match_reference)
+{
+    // Cut the encoded data off at every length, both between and in the middle of runs
+    const std::pair<const uint8_t*, size_t> encodedData[] = {
+        { nonedata, sizeof(nonedata) },
+        { rledata, sizeof(rledata) },
+        { rlecompresseddata, sizeof(rlecompresseddata) },
+        { rotatedata, sizeof(rotatedata) },
+    };
+    for (const auto& [data, size] : encodedData)
+    {
+        const auto* payload = data + sizeof(SawyerCodingChunkHeader);
+        for (size_t length = 0; length <= size - sizeof(SawyerCodingChunkHeader); length++)
+        {
+            TestMatchesReference(MakeChunk(data[0], payload, length));
+        }
+    }
+
+    // The same for the repeat encoded data inside the RLE
+    auto repeatData = SawyerCodingReference::DecodeRLE(
+        rlecompresseddata + sizeof(SawyerCodingChunkHeader), sizeof(rlecompresseddata) - sizeof(SawyerCodingChunkHeader));
+    for (size_t length = 1; length <= repeatData.size(); length++)
+    {
+        TestMatchesReference(MakeRepeatChunk({ repeatData.begin(), repeatData.begin() + length }));
+    }
+}
+
+TEST_F(SawyerCodingTest, corpus_matches_reference)
+{
+    for (const auto* park : kCorpusParks)
+    {
+        std::vector<std::vector<uint8_t>> chunks;
+        ReadParkChunks(park, chunks);
+        ASSERT_GT(chunks.size(), 1u) << park;
+        for (const auto& chunk : chunks)
+        {
+            TestMatchesReference(chunk);
+        }
+    }
+}
+
+// Compares the speed of the reader with the reference decoder. Not run by default, run it with
+// --gtest_also_run_disabled_tests --gtest_filter=*benchmark
+TEST_F(SawyerCodingTest, DISABLED_benchmark)
+{
+    struct BenchmarkCase
+    {
+        const char* Name;
+        std::vector<std::vector<uint8_t>> Chunks;
+        std::vector<size_t> ChunkLengths;
+        size_t Length{};
+    };
+    std::vector<BenchmarkCase> cases;
+
+    std::mt19937 prng(1234);
+    auto data = MakeCompressibleData(prng, 6 * 1024 * 1024);
+    const std::pair<const char*, uint8_t> encodings[] = {
+        { "6 MiB none", CHUNK_ENCODING_NONE },
+        { "6 MiB RLE", CHUNK_ENCODING_RLE },
+        { "6 MiB RLE repeat", CHUNK_ENCODING_RLECOMPRESSED },
+        { "6 MiB rotate", CHUNK_ENCODING_ROTATE },
+    };
+    for (const auto& [name, encoding] : encodings)
+    {
+        cases.push_back({ name, { EncodeChunk(encoding, data) }, { data.size() }, data.size() });
+    }
+
+    auto& corpus = cases.emplace_back(BenchmarkCase{ "saved games", {}, {}, 0 });
+    for (const auto* park : kCorpusParks)
+    {
+        ReadParkChunks(park, corpus.Chunks);
+    }
+    for (const auto& chunk : corpus.Chunks)
+    {
+        auto chunkLength = SawyerCodingReference::ReadChunk(chunk.data(), chunk.size())->size();
+        corpus.ChunkLengths.push_back(chunkLength);
+        corpus.Length += chunkLength;
+    }
+
+    constexpr int32_t kIterations = 20;
+    for (const auto& benchmarkCase : cases)
+    {
+        std::vector<uint8_t> buffer(benchmarkCase.Length);
+        auto startTime = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < kIterations; i++)
+        {
+            for (size_t j = 0; j < benchmarkCase.Chunks.size(); j++)
+            {
+                const auto& chunk = benchmarkCase.Chunks[j];
+                OpenRCT2::MemoryStream ms(chunk.data(), chunk.size());
+                SawyerChunkReader reader(&ms);
+                reader.ReadChunk(buffer.data(), benchmarkCase.ChunkLengths[j]);
+            }
+        }
+        auto readerTime = std::chrono::steady_clock::now() - startTime;
+
+        startTime = std::chrono::steady_clock::now();
+        for (int32_t i = 0; i < kIterations; i++)
+        {
+            for (const auto& chunk : benchmarkCase.Chunks)
+            {
+                auto decoded = SawyerCodingReference::ReadChunk(chunk.data(), chunk.size());
+                ASSERT_TRUE(decoded.has_value());
+            }
+        }
+        auto referenceTime = std::chrono::steady_clock::now() - startTime;
+
+        auto mebibytes = static_cast<double>(benchmarkCase.Length) * kIterations / (1024 * 1024);
+        std::printf(
+            "%-16s reader %8.1f MiB/s, reference %8.1f MiB/s\n", benchmarkCase.Name,
+            mebibytes / std::chrono::duration<double>(readerTime).count(),
+            mebibytes / std::chrono::duration<double>(referenceTime).count());
+    }
+}
+
 // 1024 bytes of random data
 // use `dd if=/dev/urandom bs=1024 count=1 | xxd -i` to get your own
 const uint8_t SawyerCodingTest::randomdata[] = {
@@ -0,0 +1,298 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/world/Map.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// What a test expects to find on a tile, in order. Elements are told apart by their base and clearance heights.
+struct ExpectedElement
+{
+    TileElementType Type;
+    uint8_t BaseHeight;
+    uint8_t ClearanceHeight;
+};
+
+class TileElementStorageTests : public testing::Test
+{
+protected:
+    static constexpr int32_t kMapSize = kMaximumMapSizePractical;
+
+    std::vector<std::vector<ExpectedElement>> _expected;
+    std::mt19937 _random{ 0x5EED };
+    uint8_t _nextMarker{};
+
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+    }
+
+    static void TearDownTestCase()
+    {
+        if (_context)
+            _context.reset();
+    }
+
+    void SetUp() override
+    {
+        MapInit({ kMapSize, kMapSize });
+
+        _expected.clear();
+        _expected.resize(kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+        for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+        {
+            for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+            {
+                auto* element = MapGetFirstElementAt(TileCoordsXY{ x, y });
+                ASSERT_NE(element, nullptr);
+                do
+                {
+                    GetExpected(x, y).push_back({ element->GetType(), element->BaseHeight, element->ClearanceHeight });
+                } while (!(element++)->IsLastForTile());
+            }
+        }
+    }
+
+    std::vector<ExpectedElement>& GetExpected(int32_t x, int32_t y)
+    {
+        return _expected[(y * kMaximumMapSizeTechnical) + x];
+    }
+
+    TileCoordsXY GetRandomTile(int32_t areaSize)
+    {
+        std::uniform_int_distribution<int32_t> dist(1, areaSize);
+        return { dist(_random), dist(_random) };
+    }
+
+    void Insert(const TileCoordsXY& tilePos)
+    {
+        std::uniform_int_distribution<int32_t> heightDist(14, 200);
+        auto baseHeight = static_cast<uint8_t>(heightDist(_random));
+        auto marker = _nextMarker++;
+
+        auto* element = TileElementInsert(
+            TileCoordsXYZ(tilePos, baseHeight).ToCoordsXYZ(), 0b0000, TileElementType::SmallScenery);
+        ASSERT_NE(element, nullptr);
+        element->ClearanceHeight = marker;
+
+        // New elements go above every element with the same or a lower base height
+        auto& expected = GetExpected(tilePos.x, tilePos.y);
+        auto it = std::find_if(
+            expected.begin(), expected.end(), [baseHeight](const auto& e) { return e.BaseHeight > baseHeight; });
+        expected.insert(it, { TileElementType::SmallScenery, baseHeight, marker });
+    }
+
+    void RemoveRandom(const TileCoordsXY& tilePos)
+    {
+        auto& expected = GetExpected(tilePos.x, tilePos.y);
+        if (expected.size() < 2)
+            return;
+
+        // Keep the surface element
+        std::uniform_int_distribution<size_t> indexDist(1, expected.size() - 1);
+        auto index = indexDist(_random);
+        TileElementRemove(MapGetFirstElementAt(tilePos) + index);
+        expected.erase(expected.begin() + index);
+    }
+
+    void CompactFully()
+    {
+        // Every call copies a batch of tiles, a full compaction must finish well within this many calls
+        for (int32_t i = 0; i < 1000; i++)
+        {
+            MapCompactTileElements();
+        }
+    }
+
+    void CheckAllTiles()
+    {
+        const auto& tileElements = GetTileElements();
+        std::vector<std::pair<const TileElement*, size_t>> blocks;
+        for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+        {
+            for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+            {
+                const auto& expected = GetExpected(x, y);
+                const auto* first = MapGetFirstElementAt(TileCoordsXY{ x, y });
+                ASSERT_NE(first, nullptr) << "tile " << x << ", " << y;
+                for (size_t i = 0; i < expected.size(); i++)
+                {
+                    const auto& element = first[i];
+                    ASSERT_EQ(element.GetType(), expected[i].Type) << "tile " << x << ", " << y << " element " << i;
+                    ASSERT_EQ(element.BaseHeight, expected[i].BaseHeight) << "tile " << x << ", " << y << " element " << i;
+                    ASSERT_EQ(element.ClearanceHeight, expected[i].ClearanceHeight)
+                        << "tile " << x << ", " << y << " element " << i;
+                    ASSERT_EQ(element.IsLastForTile(), i == expected.size() - 1)
+                        << "tile " << x << ", " << y << " element " << i;
+                }
+                blocks.emplace_back(first, expected.size());
+            }
+        }
+
+        // No two tiles may share elements
+        std::sort(blocks.begin(), blocks.end());
+        for (size_t i = 1; i < blocks.size(); i++)
+        {
+            ASSERT_LE(blocks[i - 1].first + blocks[i - 1].second, blocks[i].first);
+        }
+
+        // Once compacted, every tile lives in the game state's buffer
+        ASSERT_GE(blocks.front().first, tileElements.data());
+        ASSERT_LE(blocks.back().first + blocks.back().second, tileElements.data() + tileElements.size());
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+};
+
+std::shared_ptr<IContext> TileElementStorageTests::_context;
+
+TEST_F(TileElementStorageTests, InsertOnEveryTile)
+{
+    for (int32_t y = 1; y <= kMapSize; y++)
+    {
+        for (int32_t x = 1; x <= kMapSize; x++)
+        {
+            Insert({ x, y });
+        }
+    }
+    CompactFully();
+    CheckAllTiles();
+}
+
+TEST_F(TileElementStorageTests, GrowAndShrinkTiles)
+{
+    // Tiles of a small area grow through several capacity classes while tiles elsewhere get the odd element
+    for (int32_t i = 0; i < 400000; i++)
+    {
+        Insert(GetRandomTile(i % 4 == 0 ? kMapSize : 64));
+    }
+    for (int32_t i = 0; i < 300000; i++)
+    {
+        RemoveRandom(GetRandomTile(64));
+    }
+    CompactFully();
+    CheckAllTiles();
+}
+
+TEST_F(TileElementStorageTests, ChangeTilesWhileCompacting)
+{
+    for (int32_t i = 0; i < 200000; i++)
+    {
+        Insert(GetRandomTile(kMapSize));
+    }
+    for (int32_t i = 0; i < 200000; i++)
+    {
+        RemoveRandom(GetRandomTile(kMapSize));
+    }
+
+    // Keep changing tiles between compaction batches, both ahead of and behind the tiles copied so far
+    for (int32_t i = 0; i < 200; i++)
+    {
+        MapCompactTileElements();
+        for (int32_t j = 0; j < 1000; j++)
+        {
+            if (j % 3 == 0)
+            {
+                RemoveRandom(GetRandomTile(kMapSize));
+            }
+            else
+            {
+                Insert(GetRandomTile(kMapSize));
+            }
+        }
+    }
+    CompactFully();
+    CheckAllTiles();
+}
+
+TEST_F(TileElementStorageTests, ReorganiseAfterChanges)
+{
+    for (int32_t i = 0; i < 100000; i++)
+    {
+        Insert(GetRandomTile(128));
+    }
+    for (int32_t i = 0; i < 50000; i++)
+    {
+        RemoveRandom(GetRandomTile(128));
+    }
+    ReorganiseTileElements();
+    CheckAllTiles();
+
+    for (int32_t i = 0; i < 100000; i++)
+    {
+        Insert(GetRandomTile(128));
+    }
+    CompactFully();
+    CheckAllTiles();
+}
+
+TEST_F(TileElementStorageTests, CompactionKeepsRoomOfGrownTiles)
+{
+    // Grow the tiles of a small area, this starts a compaction of the freshly loaded map
+    constexpr int32_t kAreaSize = 64;
+    for (int32_t i = 0; i < 200000; i++)
+    {
+        Insert(GetRandomTile(kAreaSize));
+    }
+    for (int32_t i = 0; i < 100000; i++)
+    {
+        RemoveRandom(GetRandomTile(kAreaSize));
+    }
+    CompactFully();
+
+    // Growing every other tile runs the buffer out of room again, compacting between changes as the game does copies the
+    // grown tiles into the new buffer
+    int32_t numInserted = 0;
+    for (int32_t y = 1; y <= kMapSize; y++)
+    {
+        for (int32_t x = 1; x <= kMapSize; x++)
+        {
+            if (x > kAreaSize || y > kAreaSize)
+            {
+                Insert({ x, y });
+                if (++numInserted % 1000 == 0)
+                {
+                    MapCompactTileElements();
+                }
+            }
+        }
+    }
+    CompactFully();
+    CheckAllTiles();
+
+    // Spare room kept by grown tiles does not start another compaction
+    const auto* tileElementsData = GetTileElements().data();
+    CompactFully();
+    ASSERT_EQ(GetTileElements().data(), tileElementsData);
+
+    // Every tile of the area has grown, so each can take another element without moving
+    for (int32_t y = 1; y <= kAreaSize; y++)
+    {
+        for (int32_t x = 1; x <= kAreaSize; x++)
+        {
+            const auto* first = MapGetFirstElementAt(TileCoordsXY{ x, y });
+            Insert({ x, y });
+            ASSERT_EQ(MapGetFirstElementAt(TileCoordsXY{ x, y }), first) << "tile " << x << ", " << y;
+        }
+    }
+    CheckAllTiles();
+}
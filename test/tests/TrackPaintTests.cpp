@@ -0,0 +1,305 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/PlatformEnvironment.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/FileSystem.hpp>
+#include <openrct2/core/Path.hpp>
+#include <openrct2/core/String.hpp>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/ride/Ride.h>
+#include <openrct2/ride/RideData.h>
+#include <openrct2/ride/Track.h>
+#include <openrct2/ride/TrackData.h>
+#include <openrct2/ride/TrackPaint.h>
+#include <openrct2/sprites.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::TrackMetaData;
+
+// Ride types whose track pieces are drawn from sprite tables. The paint output of every piece they can draw is compared
+// against checksums taken from the hand-written painters the tables replaced.
+static constexpr ride_type_t kTableDrawnRideTypes[] = {
+    RIDE_TYPE_BOBSLEIGH_COASTER,
+    RIDE_TYPE_CLASSIC_STAND_UP_ROLLER_COASTER,
+    RIDE_TYPE_COMPACT_INVERTED_COASTER,
+    RIDE_TYPE_CORKSCREW_ROLLER_COASTER,
+    RIDE_TYPE_FLYING_ROLLER_COASTER,
+    RIDE_TYPE_GIGA_COASTER,
+    RIDE_TYPE_HEARTLINE_TWISTER_COASTER,
+    RIDE_TYPE_HYPER_TWISTER,
+    RIDE_TYPE_INVERTED_HAIRPIN_COASTER,
+    RIDE_TYPE_INVERTED_IMPULSE_COASTER,
+    RIDE_TYPE_INVERTED_ROLLER_COASTER,
+    RIDE_TYPE_LAY_DOWN_ROLLER_COASTER,
+    RIDE_TYPE_LIM_LAUNCHED_ROLLER_COASTER,
+    RIDE_TYPE_LOOPING_ROLLER_COASTER,
+    RIDE_TYPE_MINE_RIDE,
+    RIDE_TYPE_MINE_TRAIN_COASTER,
+    RIDE_TYPE_MINI_ROLLER_COASTER,
+    RIDE_TYPE_MINI_SUSPENDED_COASTER,
+    RIDE_TYPE_MULTI_DIMENSION_ROLLER_COASTER,
+    RIDE_TYPE_REVERSER_ROLLER_COASTER,
+    RIDE_TYPE_SIDE_FRICTION_ROLLER_COASTER,
+    RIDE_TYPE_STAND_UP_ROLLER_COASTER,
+    RIDE_TYPE_STEEPLECHASE,
+    RIDE_TYPE_SUSPENDED_MONORAIL,
+    RIDE_TYPE_SUSPENDED_SWINGING_COASTER,
+    RIDE_TYPE_VERTICAL_DROP_ROLLER_COASTER,
+};
+
+class TrackPaintTests : public testing::Test
+{
+protected:
+    static constexpr int32_t kHeight = 112;
+
+    static void SetUpTestCase()
+    {
+        gOpenRCT2Headless = true;
+        gOpenRCT2NoGraphics = true;
+        _context = CreateContext();
+        bool initialised = _context->Initialise();
+        ASSERT_TRUE(initialised);
+
+        // Paint structs are only created for images that exist, so stand in a 1x1 image for every g1 and g2 sprite
+        _graphicsPath = (fs::temp_directory_path() / "openrct2-track-paint-tests").u8string();
+        Path::CreateDirectory(Path::Combine(_graphicsPath, u8"Data"));
+        WriteGraphicsFile(Path::Combine(_graphicsPath, u8"Data", u8"g1.dat"), SPR_G1_END);
+        WriteGraphicsFile(Path::Combine(_graphicsPath, u8"g2.dat"), G2_SPRITE_COUNT);
+
+        auto env = _context->GetPlatformEnvironment();
+        auto rct2Path = env->GetDirectoryPath(DIRBASE::RCT2);
+        auto openrct2Path = env->GetDirectoryPath(DIRBASE::OPENRCT2);
+        env->SetBasePath(DIRBASE::RCT2, _graphicsPath);
+        env->SetBasePath(DIRBASE::OPENRCT2, _graphicsPath);
+        gOpenRCT2NoGraphics = false;
+        ASSERT_TRUE(GfxLoadG1(*env));
+        ASSERT_TRUE(GfxLoadG2());
+        env->SetBasePath(DIRBASE::RCT2, rct2Path);
+        env->SetBasePath(DIRBASE::OPENRCT2, openrct2Path);
+    }
+
+    static void TearDownTestCase()
+    {
+        GfxUnloadG2();
+        GfxUnloadG1();
+        gOpenRCT2NoGraphics = true;
+        Path::DeleteDirectory(_graphicsPath);
+        if (_context)
+            _context.reset();
+    }
+
+    static void WriteGraphicsFile(const u8string& path, uint32_t numEntries)
+    {
+        std::vector<uint8_t> data(sizeof(RCTG1Header) + (numEntries * sizeof(RCTG1Element)) + 1);
+        RCTG1Header header{ numEntries, 1 };
+        std::memcpy(data.data(), &header, sizeof(header));
+        for (uint32_t i = 0; i < numEntries; i++)
+        {
+            RCTG1Element element{ 0, 1, 1, 0, 0, 0, 0 };
+            std::memcpy(data.data() + sizeof(header) + (i * sizeof(element)), &element, sizeof(element));
+        }
+        File::WriteAllBytes(path, data.data(), data.size());
+    }
+
+    static void HashValue(uint64_t& hash, int64_t value)
+    {
+        // FNV-1a
+        for (int32_t i = 0; i < 8; i++)
+        {
+            hash ^= static_cast<uint8_t>(value >> (i * 8));
+            hash *= 0x100000001B3;
+        }
+    }
+
+    static void HashImage(uint64_t& hash, ImageId imageId)
+    {
+        HashValue(hash, imageId.ToUInt32());
+        HashValue(hash, imageId.GetTertiary());
+    }
+
+    static void HashPaintStruct(uint64_t& hash, const PaintStruct& ps)
+    {
+        HashImage(hash, ps.image_id);
+        HashValue(hash, ps.ScreenPos.x);
+        HashValue(hash, ps.ScreenPos.y);
+        HashValue(hash, ps.Bounds.x);
+        HashValue(hash, ps.Bounds.y);
+        HashValue(hash, ps.Bounds.z);
+        HashValue(hash, ps.Bounds.x_end);
+        HashValue(hash, ps.Bounds.y_end);
+        HashValue(hash, ps.Bounds.z_end);
+        for (const auto* attached = ps.Attached; attached != nullptr; attached = attached->NextEntry)
+        {
+            HashImage(hash, attached->image_id);
+            HashImage(hash, attached->ColourImageId);
+            HashValue(hash, attached->RelativePos.x);
+            HashValue(hash, attached->RelativePos.y);
+            HashValue(hash, attached->IsMasked);
+        }
+        if (ps.Children != nullptr)
+        {
+            HashPaintStruct(hash, *ps.Children);
+        }
+    }
+
+    static void HashSession(uint64_t& hash, const PaintSession& session)
+    {
+        for (uint32_t i = session.QuadrantBackIndex; i <= session.QuadrantFrontIndex && i < MaxPaintQuadrants; i++)
+        {
+            for (const auto* ps = session.Quadrants[i]; ps != nullptr; ps = ps->NextQuadrantEntry)
+            {
+                HashPaintStruct(hash, *ps);
+            }
+        }
+        for (const auto& segment : session.SupportSegments)
+        {
+            HashValue(hash, segment.height);
+            HashValue(hash, segment.slope);
+        }
+        HashValue(hash, session.Support.height);
+        HashValue(hash, session.Support.slope);
+        for (uint8_t i = 0; i < session.LeftTunnelCount; i++)
+        {
+            HashValue(hash, session.LeftTunnels[i].height);
+            HashValue(hash, EnumValue(session.LeftTunnels[i].type));
+        }
+        for (uint8_t i = 0; i < session.RightTunnelCount; i++)
+        {
+            HashValue(hash, session.RightTunnels[i].height);
+            HashValue(hash, EnumValue(session.RightTunnels[i].type));
+        }
+        HashValue(hash, session.VerticalTunnelHeight);
+    }
+
+    // Paints every sequence of a track piece in every direction, with and without a chain lift
+    static uint64_t HashTrackPiece(ride_type_t rideType, TRACK_PAINT_FUNCTION paintFunction, track_type_t trackType)
+    {
+        Ride ride{};
+        ride.type = rideType;
+
+        TileElement tileElement{};
+        tileElement.SetType(TileElementType::Track);
+        auto& trackElement = *tileElement.AsTrack();
+        trackElement.SetTrackType(trackType);
+        trackElement.SetRideType(rideType);
+        trackElement.SetBaseZ(kHeight);
+        trackElement.SetClearanceZ(kHeight + kCoordsZStep);
+
+        DrawPixelInfo dpi{};
+        dpi.x = -0x10000;
+        dpi.y = -0x10000;
+        dpi.width = 0x20000;
+        dpi.height = 0x20000;
+
+        uint64_t hash = 0xCBF29CE484222325;
+        const auto& ted = GetTrackElementDescriptor(trackType);
+        for (uint8_t sequence = 0; ted.GetBlockForSequence(sequence) != nullptr; sequence++)
+        {
+            trackElement.SetSequenceIndex(sequence);
+            for (uint8_t direction = 0; direction < kNumOrthogonalDirections; direction++)
+            {
+                for (bool hasChain : { false, true })
+                {
+                    trackElement.SetHasChain(hasChain);
+
+                    auto* session = PaintSessionAlloc(dpi, 0, 0);
+                    session->LeftTunnelCount = 0;
+                    session->RightTunnelCount = 0;
+                    session->LeftTunnels[0] = { 0xFF, TunnelType::Null };
+                    session->RightTunnels[0] = { 0xFF, TunnelType::Null };
+                    session->VerticalTunnelHeight = 0xFF;
+                    std::fill(std::begin(session->SupportSegments), std::end(session->SupportSegments), SupportHeight{});
+                    session->Support = {};
+                    session->SpritePosition = {};
+                    session->MapPosition = {};
+                    session->TrackColours = ImageId(0, COLOUR_BRIGHT_RED, COLOUR_LIGHT_BLUE);
+                    session->SupportColours = ImageId(0, COLOUR_DARK_BROWN, COLOUR_LIGHT_BLUE);
+
+                    paintFunction(*session, ride, sequence, direction, kHeight, trackElement);
+                    HashSession(hash, *session);
+
+                    PaintSessionFree(session);
+                }
+            }
+        }
+        return hash;
+    }
+
+    static std::vector<std::string> GetTrackPieceChecksums()
+    {
+        std::vector<std::string> lines;
+        std::vector<TRACK_PAINT_FUNCTION_GETTER> seenDrawers;
+        for (auto rideType : kTableDrawnRideTypes)
+        {
+            const auto& rtd = GetRideTypeDescriptor(rideType);
+            for (bool isInverted : { false, true })
+            {
+                for (bool isCovered : { false, true })
+                {
+                    auto drawer = getTrackDrawerEntry(rtd, isInverted, isCovered).Drawer;
+                    if (drawer == nullptr || std::find(seenDrawers.begin(), seenDrawers.end(), drawer) != seenDrawers.end())
+                        continue;
+                    seenDrawers.push_back(drawer);
+
+                    for (track_type_t trackType = 0; trackType < TrackElemType::Count; trackType++)
+                    {
+                        // Stations look up their neighbours on the map, and were never drawn from tables
+                        auto paintFunction = drawer(trackType);
+                        if (paintFunction == nullptr || TrackTypeIsStation(trackType))
+                            continue;
+
+                        auto hash = HashTrackPiece(rideType, paintFunction, trackType);
+                        lines.push_back(String::StdFormat(
+                            "%s%s%s %u: %016llx", rtd.EnumName, isInverted ? " inverted" : "", isCovered ? " covered" : "",
+                            trackType, static_cast<unsigned long long>(hash)));
+                    }
+                }
+            }
+        }
+        return lines;
+    }
+
+private:
+    static std::shared_ptr<IContext> _context;
+    static u8string _graphicsPath;
+};
+
+std::shared_ptr<IContext> TrackPaintTests::_context;
+u8string TrackPaintTests::_graphicsPath;
+
+TEST_F(TrackPaintTests, TableDrawnPiecesMatchChecksums)
+{
+    const auto checksumsPath = Path::Combine(TestData::GetBasePath(), u8"trackpaint", u8"checksums.txt");
+    auto expected = File::ReadAllLines(checksumsPath);
+    if (!expected.empty() && expected.back().empty())
+    {
+        // Trailing new line
+        expected.pop_back();
+    }
+    ASSERT_FALSE(expected.empty());
+
+    auto actual = GetTrackPieceChecksums();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++)
+    {
+        EXPECT_EQ(actual[i], expected[i]);
+    }
+}